@@ -0,0 +1,790 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/unordered/flat_unordered_map.hpp
+///
+/// \brief The flat_unordered_map is an open-addressing hash table which can be
+///        used as the storage of the partitions of hpx::unordered_map.
+///
+/// All elements are stored in a single array of slots. A separate array holds
+/// one control byte per slot, which encodes whether the slot is empty, deleted
+/// or full and in the latter case 7 bits of the hash of its key. Lookups
+/// compare the control bytes of a group of 16 slots at once (using SSE2 where
+/// available) and touch the slots only for candidate matches.
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HPX_FLAT_UNORDERED_MAP_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // values of the control bytes which do not refer to a full slot, full
+        // slots hold 7 bits of the hash of their key (i.e. a value >= 0)
+        enum flat_map_ctrl : std::int8_t
+        {
+            flat_map_ctrl_empty = -128,
+            flat_map_ctrl_deleted = -2,
+            flat_map_ctrl_sentinel = -1
+        };
+
+        constexpr std::size_t flat_map_group_width = 16;
+
+        inline std::size_t flat_map_count_trailing_zeros(
+            std::uint32_t mask) noexcept
+        {
+            HPX_ASSERT(mask != 0);
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            return static_cast<std::size_t>(__builtin_ctz(mask));
+#else
+            std::size_t count = 0;
+            while ((mask & 1) == 0)
+            {
+                mask >>= 1;
+                ++count;
+            }
+            return count;
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // A group of control bytes, the member functions return a bit mask of
+        // the positions in the group matching the respective condition.
+        class flat_map_group
+        {
+        public:
+            explicit flat_map_group(std::int8_t const* ctrl) noexcept
+#if defined(HPX_FLAT_UNORDERED_MAP_HAVE_SSE2)
+              : ctrl_(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ctrl)))
+#else
+              : ctrl_(ctrl)
+#endif
+            {
+            }
+
+#if defined(HPX_FLAT_UNORDERED_MAP_HAVE_SSE2)
+            std::uint32_t match(std::int8_t h2) const noexcept
+            {
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(
+                    _mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+            }
+
+            std::uint32_t match_empty() const noexcept
+            {
+                return match(flat_map_ctrl_empty);
+            }
+
+            std::uint32_t match_empty_or_deleted() const noexcept
+            {
+                __m128i const sentinel = _mm_set1_epi8(flat_map_ctrl_sentinel);
+                return static_cast<std::uint32_t>(
+                    _mm_movemask_epi8(_mm_cmplt_epi8(ctrl_, sentinel)));
+            }
+
+        private:
+            __m128i ctrl_;
+#else
+            std::uint32_t match(std::int8_t h2) const noexcept
+            {
+                std::uint32_t mask = 0;
+                for (std::size_t i = 0; i != flat_map_group_width; ++i)
+                {
+                    if (ctrl_[i] == h2)
+                        mask |= std::uint32_t(1) << i;
+                }
+                return mask;
+            }
+
+            std::uint32_t match_empty() const noexcept
+            {
+                return match(flat_map_ctrl_empty);
+            }
+
+            std::uint32_t match_empty_or_deleted() const noexcept
+            {
+                std::uint32_t mask = 0;
+                for (std::size_t i = 0; i != flat_map_group_width; ++i)
+                {
+                    if (ctrl_[i] < flat_map_ctrl_sentinel)
+                        mask |= std::uint32_t(1) << i;
+                }
+                return mask;
+            }
+
+        private:
+            std::int8_t const* ctrl_;
+#endif
+        };
+
+        // the control byte used by empty tables (which have no slots)
+        inline std::int8_t* flat_map_empty_ctrl() noexcept
+        {
+            static std::int8_t sentinel = flat_map_ctrl_sentinel;
+            return &sentinel;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Open-addressing hash table with an interface compatible to the subset
+    /// of std::unordered_map used by the partitions of hpx::unordered_map.
+    ///
+    /// Iterators and references are invalidated by insertions that grow the
+    /// table, erasing an element invalidates only iterators to that element.
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    class flat_unordered_map
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<Key const, T>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using reference = value_type&;
+        using const_reference = value_type const&;
+
+    private:
+        using slot_type = typename std::aligned_storage<sizeof(value_type),
+            alignof(value_type)>::type;
+
+        static constexpr std::size_t group_width =
+            detail::flat_map_group_width;
+
+        template <typename Value>
+        class iterator_impl
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename std::remove_const<Value>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            iterator_impl() noexcept
+              : ctrl_(nullptr)
+              , slot_(nullptr)
+            {
+            }
+
+            template <typename U,
+                typename Enable = typename std::enable_if<
+                    std::is_convertible<U*, Value*>::value>::type>
+            iterator_impl(iterator_impl<U> const& rhs) noexcept
+              : ctrl_(rhs.ctrl_)
+              , slot_(rhs.slot_)
+            {
+            }
+
+            reference operator*() const noexcept
+            {
+                return *slot_;
+            }
+            pointer operator->() const noexcept
+            {
+                return slot_;
+            }
+
+            iterator_impl& operator++() noexcept
+            {
+                ++ctrl_;
+                ++slot_;
+                skip_free_slots();
+                return *this;
+            }
+            iterator_impl operator++(int) noexcept
+            {
+                iterator_impl tmp(*this);
+                ++*this;
+                return tmp;
+            }
+
+            friend bool operator==(
+                iterator_impl const& lhs, iterator_impl const& rhs) noexcept
+            {
+                return lhs.ctrl_ == rhs.ctrl_;
+            }
+            friend bool operator!=(
+                iterator_impl const& lhs, iterator_impl const& rhs) noexcept
+            {
+                return lhs.ctrl_ != rhs.ctrl_;
+            }
+
+        private:
+            friend class flat_unordered_map;
+
+            template <typename U>
+            friend class iterator_impl;
+
+            iterator_impl(std::int8_t const* ctrl, Value* slot) noexcept
+              : ctrl_(ctrl)
+              , slot_(slot)
+            {
+            }
+
+            // the sentinel control byte after the last slot stops the loop
+            void skip_free_slots() noexcept
+            {
+                while (*ctrl_ < detail::flat_map_ctrl_sentinel)
+                {
+                    ++ctrl_;
+                    ++slot_;
+                }
+            }
+
+            std::int8_t const* ctrl_;
+            Value* slot_;
+        };
+
+    public:
+        using iterator = iterator_impl<value_type>;
+        using const_iterator = iterator_impl<value_type const>;
+
+        ///////////////////////////////////////////////////////////////////////
+        flat_unordered_map()
+          : ctrl_(detail::flat_map_empty_ctrl())
+          , capacity_(0)
+          , size_(0)
+          , growth_left_(0)
+        {
+        }
+
+        explicit flat_unordered_map(size_type bucket_count,
+            Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual())
+          : ctrl_(detail::flat_map_empty_ctrl())
+          , capacity_(0)
+          , size_(0)
+          , growth_left_(0)
+          , hash_(hash)
+          , equal_(equal)
+        {
+            reserve(bucket_count);
+        }
+
+        flat_unordered_map(flat_unordered_map const& rhs)
+          : ctrl_(detail::flat_map_empty_ctrl())
+          , capacity_(0)
+          , size_(0)
+          , growth_left_(0)
+          , hash_(rhs.hash_)
+          , equal_(rhs.equal_)
+        {
+            reserve(rhs.size_);
+            for (value_type const& v : rhs)
+                insert_unique(hash_of(v.first), v);
+        }
+
+        flat_unordered_map(flat_unordered_map&& rhs) noexcept
+          : flat_unordered_map()
+        {
+            swap(rhs);
+        }
+
+        flat_unordered_map& operator=(flat_unordered_map const& rhs)
+        {
+            if (this != &rhs)
+            {
+                flat_unordered_map tmp(rhs);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        flat_unordered_map& operator=(flat_unordered_map&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                flat_unordered_map tmp(std::move(rhs));
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        ~flat_unordered_map()
+        {
+            destroy_elements();
+            if (capacity_ != 0)
+                delete[] ctrl_;
+        }
+
+        void swap(flat_unordered_map& rhs) noexcept
+        {
+            std::swap(ctrl_, rhs.ctrl_);
+            std::swap(slots_, rhs.slots_);
+            std::swap(capacity_, rhs.capacity_);
+            std::swap(size_, rhs.size_);
+            std::swap(growth_left_, rhs.growth_left_);
+            std::swap(hash_, rhs.hash_);
+            std::swap(equal_, rhs.equal_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        iterator begin() noexcept
+        {
+            iterator it(ctrl_, slot(0));
+            it.skip_free_slots();
+            return it;
+        }
+        const_iterator begin() const noexcept
+        {
+            const_iterator it(ctrl_, slot(0));
+            it.skip_free_slots();
+            return it;
+        }
+        const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        iterator end() noexcept
+        {
+            return iterator(ctrl_ + capacity_, slot(capacity_));
+        }
+        const_iterator end() const noexcept
+        {
+            return const_iterator(ctrl_ + capacity_, slot(capacity_));
+        }
+        const_iterator cend() const noexcept
+        {
+            return end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+        size_type size() const noexcept
+        {
+            return size_;
+        }
+        size_type max_size() const noexcept
+        {
+            return (std::numeric_limits<size_type>::max)() /
+                (sizeof(slot_type) + 1);
+        }
+
+        size_type bucket_count() const noexcept
+        {
+            return capacity_;
+        }
+        float load_factor() const noexcept
+        {
+            return capacity_ == 0 ? 0.0f : float(size_) / float(capacity_);
+        }
+
+        hasher hash_function() const
+        {
+            return hash_;
+        }
+        key_equal key_eq() const
+        {
+            return equal_;
+        }
+
+        /// Make sure at least \a n elements can be stored without growing
+        /// the table.
+        void reserve(size_type n)
+        {
+            size_type capacity = group_width;
+            while (max_load(capacity) < n)
+                capacity *= 2;
+
+            if (capacity > capacity_)
+                rehash_impl(capacity);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        iterator find(Key const& key)
+        {
+            size_type const pos = find_index(key, hash_of(key));
+            return pos == capacity_ ? end() : iterator_at(pos);
+        }
+        const_iterator find(Key const& key) const
+        {
+            size_type const pos = find_index(key, hash_of(key));
+            return pos == capacity_ ? end() : const_iterator_at(pos);
+        }
+
+        size_type count(Key const& key) const
+        {
+            return find_index(key, hash_of(key)) == capacity_ ? 0 : 1;
+        }
+
+        T& operator[](Key const& key)
+        {
+            return try_emplace(key).first->second;
+        }
+        T& operator[](Key&& key)
+        {
+            return try_emplace(std::move(key)).first->second;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename K, typename... Ts>
+        std::pair<iterator, bool> try_emplace(K&& key, Ts&&... ts)
+        {
+            std::uint64_t const h = hash_of(key);
+            size_type pos = find_index(key, h);
+            if (pos != capacity_)
+                return std::make_pair(iterator_at(pos), false);
+
+            if (growth_left_ == 0)
+                grow();
+
+            pos = insert_unique(h, std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)),
+                std::forward_as_tuple(std::forward<Ts>(ts)...));
+            return std::make_pair(iterator_at(pos), true);
+        }
+
+        std::pair<iterator, bool> insert(value_type const& value)
+        {
+            return try_emplace(value.first, value.second);
+        }
+
+        template <typename P,
+            typename Enable = typename std::enable_if<
+                std::is_constructible<value_type, P&&>::value>::type>
+        std::pair<iterator, bool> insert(P&& value)
+        {
+            return try_emplace(std::forward<P>(value).first,
+                std::forward<P>(value).second);
+        }
+
+        iterator insert(const_iterator, value_type const& value)
+        {
+            return insert(value).first;
+        }
+
+        template <typename P,
+            typename Enable = typename std::enable_if<
+                std::is_constructible<value_type, P&&>::value>::type>
+        iterator insert(const_iterator, P&& value)
+        {
+            return insert(std::forward<P>(value)).first;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        iterator erase(const_iterator it)
+        {
+            size_type const pos = static_cast<size_type>(it.ctrl_ - ctrl_);
+            HPX_ASSERT(pos < capacity_ && ctrl_[pos] >= 0);
+
+            erase_at(pos);
+
+            iterator next(ctrl_ + pos + 1, slot(pos + 1));
+            next.skip_free_slots();
+            return next;
+        }
+
+        // overload needed to disambiguate from erase(Key const&) for tables
+        // whose keys are constructible from iterators
+        iterator erase(iterator it)
+        {
+            return erase(const_iterator(it));
+        }
+
+        size_type erase(Key const& key)
+        {
+            size_type const pos = find_index(key, hash_of(key));
+            if (pos == capacity_)
+                return 0;
+
+            erase_at(pos);
+            return 1;
+        }
+
+        void clear() noexcept
+        {
+            destroy_elements();
+            if (capacity_ != 0)
+            {
+                std::memset(ctrl_, detail::flat_map_ctrl_empty, capacity_);
+                growth_left_ = max_load(capacity_);
+            }
+            size_ = 0;
+        }
+
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        // maximal number of elements stored in a table of the given capacity
+        static constexpr size_type max_load(size_type capacity) noexcept
+        {
+            return capacity - capacity / 8;
+        }
+
+        // mix the bits of the user supplied hash, the lower 7 bits of the
+        // result are stored in the control bytes, the remaining bits select
+        // the group to start probing at
+        std::uint64_t hash_of(Key const& key) const
+        {
+            std::uint64_t h = static_cast<std::uint64_t>(hash_(key));
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+        static std::int8_t h2(std::uint64_t h) noexcept
+        {
+            return static_cast<std::int8_t>(h & 0x7f);
+        }
+
+        value_type* slot(size_type pos) const noexcept
+        {
+            return reinterpret_cast<value_type*>(slots_.get()) + pos;
+        }
+
+        iterator iterator_at(size_type pos) noexcept
+        {
+            return iterator(ctrl_ + pos, slot(pos));
+        }
+        const_iterator const_iterator_at(size_type pos) const noexcept
+        {
+            return const_iterator(ctrl_ + pos, slot(pos));
+        }
+
+        // Probe the groups of the table in triangular order starting at the
+        // group selected by the hash. As the number of groups is a power of
+        // two this visits every group exactly once.
+        template <typename F>
+        size_type probe(std::uint64_t h, F&& f) const
+        {
+            size_type const mask = capacity_ / group_width - 1;
+            size_type group = static_cast<size_type>(h >> 7) & mask;
+            for (size_type i = 1; /**/; ++i)
+            {
+                size_type result = 0;
+                if (f(group * group_width, result))
+                    return result;
+
+                HPX_ASSERT(i <= mask + 1);
+                group = (group + i) & mask;
+            }
+        }
+
+        // return the position of the element with the given key or capacity_
+        size_type find_index(Key const& key, std::uint64_t h) const
+        {
+            if (size_ == 0)
+                return capacity_;
+
+            return probe(h, [&](size_type start, size_type& result) {
+                detail::flat_map_group g(ctrl_ + start);
+                for (std::uint32_t m = g.match(h2(h)); m != 0; m &= m - 1)
+                {
+                    size_type const pos =
+                        start + detail::flat_map_count_trailing_zeros(m);
+                    if (equal_(slot(pos)->first, key))
+                    {
+                        result = pos;
+                        return true;
+                    }
+                }
+
+                // the key is not stored if the group has an empty slot
+                if (g.match_empty() != 0)
+                {
+                    result = capacity_;
+                    return true;
+                }
+                return false;
+            });
+        }
+
+        // construct a new element which is known not to be stored in the
+        // table yet
+        template <typename... Ts>
+        size_type insert_unique(std::uint64_t h, Ts&&... ts)
+        {
+            HPX_ASSERT(growth_left_ != 0);
+
+            size_type const pos =
+                probe(h, [&](size_type start, size_type& result) {
+                    std::uint32_t const m =
+                        detail::flat_map_group(ctrl_ + start)
+                            .match_empty_or_deleted();
+                    if (m == 0)
+                        return false;
+
+                    result = start + detail::flat_map_count_trailing_zeros(m);
+                    return true;
+                });
+
+            ::new (static_cast<void*>(slot(pos)))
+                value_type(std::forward<Ts>(ts)...);
+
+            if (ctrl_[pos] == detail::flat_map_ctrl_empty)
+                --growth_left_;
+            ctrl_[pos] = h2(h);
+            ++size_;
+
+            return pos;
+        }
+
+        void erase_at(size_type pos) noexcept
+        {
+            slot(pos)->~value_type();
+            --size_;
+
+            // A probe sequence never continues past a group having an empty
+            // slot, thus the slot can be marked empty if its group has one
+            // already. Otherwise it has to be marked as deleted to keep the
+            // probe sequences running through this group intact.
+            size_type const start = pos & ~(group_width - 1);
+            if (detail::flat_map_group(ctrl_ + start).match_empty() != 0)
+            {
+                ctrl_[pos] = detail::flat_map_ctrl_empty;
+                ++growth_left_;
+            }
+            else
+            {
+                ctrl_[pos] = detail::flat_map_ctrl_deleted;
+            }
+        }
+
+        // make room for at least one more element
+        void grow()
+        {
+            // reclaim the deleted slots if that frees enough space, grow the
+            // table otherwise
+            if (capacity_ != 0 && size_ < max_load(capacity_) / 2)
+                rehash_impl(capacity_);
+            else
+                rehash_impl(capacity_ == 0 ? group_width : 2 * capacity_);
+        }
+
+        void rehash_impl(size_type capacity)
+        {
+            HPX_ASSERT(capacity % group_width == 0);
+            HPX_ASSERT((capacity & (capacity - 1)) == 0);
+
+            flat_unordered_map tmp;
+            tmp.hash_ = hash_;
+            tmp.equal_ = equal_;
+            tmp.allocate(capacity);
+
+            for (size_type pos = 0; pos != capacity_; ++pos)
+            {
+                if (ctrl_[pos] >= 0)
+                {
+                    value_type* v = slot(pos);
+                    tmp.insert_unique(hash_of(v->first), std::move(*v));
+                }
+            }
+            swap(tmp);
+        }
+
+        void allocate(size_type capacity)
+        {
+            HPX_ASSERT(capacity_ == 0);
+
+            std::unique_ptr<slot_type[]> slots(new slot_type[capacity]);
+            ctrl_ = new std::int8_t[capacity + 1];
+            slots_ = std::move(slots);
+
+            std::memset(ctrl_, detail::flat_map_ctrl_empty, capacity);
+            ctrl_[capacity] = detail::flat_map_ctrl_sentinel;
+
+            capacity_ = capacity;
+            growth_left_ = max_load(capacity);
+        }
+
+        void destroy_elements() noexcept
+        {
+            if (!std::is_trivially_destructible<value_type>::value)
+            {
+                for (size_type pos = 0; pos != capacity_; ++pos)
+                {
+                    if (ctrl_[pos] >= 0)
+                        slot(pos)->~value_type();
+                }
+            }
+        }
+
+        // control bytes (capacity_ + 1 for the sentinel)
+        std::int8_t* ctrl_;
+        std::unique_ptr<slot_type[]> slots_;
+
+        size_type capacity_;
+        size_type size_;
+        size_type growth_left_;
+
+        Hash hash_;
+        KeyEqual equal_;
+    };
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    void swap(flat_unordered_map<Key, T, Hash, KeyEqual>& lhs,
+        flat_unordered_map<Key, T, Hash, KeyEqual>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+}}    // namespace hpx::util
+
+namespace hpx { namespace serialization {
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    void serialize(input_archive& ar,
+        util::flat_unordered_map<Key, T, Hash, KeyEqual>& t, unsigned)
+    {
+        using container_type = util::flat_unordered_map<Key, T, Hash, KeyEqual>;
+        using size_type = typename container_type::size_type;
+
+        size_type size;
+        ar >> size;    //-V128
+
+        t.clear();
+        t.reserve(size);
+        for (size_type i = 0; i < size; ++i)
+        {
+            std::pair<Key, T> v;
+            ar >> v;
+            t.insert(std::move(v));
+        }
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    void serialize(output_archive& ar,
+        const util::flat_unordered_map<Key, T, Hash, KeyEqual>& t, unsigned)
+    {
+        using container_type = util::flat_unordered_map<Key, T, Hash, KeyEqual>;
+        using value_type = typename container_type::value_type;
+
+        ar << t.size();    //-V128
+        for (const value_type& val : t)
+        {
+            ar << val;
+        }
+    }
+}}    // namespace hpx::serialization
@@ -37,6 +37,8 @@
 #include <hpx/runtime_components/component_factory.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <hpx/components/containers/unordered/flat_unordered_map.hpp>
+
 #include <cstddef>
 #include <memory>
 #include <string>
@@ -45,6 +47,44 @@
 #include <utility>
 #include <vector>
 
+namespace hpx { namespace traits
+{
+    /// \brief Customization point selecting the data structure used by the
+    ///        partitions of hpx::unordered_map to store their elements.
+    ///
+    /// The default is std::unordered_map. Specialize this trait to make
+    /// hpx::unordered_map<Key, T, Hash, KeyEqual> use the open-addressing
+    /// hpx::util::flat_unordered_map instead, which avoids one allocation per
+    /// element and improves the cache behavior of lookups:
+    ///
+    /// \code
+    ///     namespace hpx { namespace traits {
+    ///         template <>
+    ///         struct unordered_map_partition_storage<std::uint64_t, double,
+    ///             std::hash<std::uint64_t>, std::equal_to<std::uint64_t>>
+    ///           : flat_unordered_map_partition_storage<std::uint64_t, double,
+    ///                 std::hash<std::uint64_t>, std::equal_to<std::uint64_t>>
+    ///         {
+    ///         };
+    ///     }}
+    /// \endcode
+    ///
+    /// The specialization has to be visible wherever the unordered_map type
+    /// is used, including the HPX_REGISTER_UNORDERED_MAP invocation.
+    template <typename Key, typename T, typename Hash, typename KeyEqual,
+        typename Enable = void>
+    struct unordered_map_partition_storage
+    {
+        typedef std::unordered_map<Key, T, Hash, KeyEqual> type;
+    };
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    struct flat_unordered_map_partition_storage
+    {
+        typedef util::flat_unordered_map<Key, T, Hash, KeyEqual> type;
+    };
+}}
+
 namespace hpx { namespace server
 {
     /// \brief This is the basic wrapper class for stl unordered_map.
@@ -59,7 +99,8 @@ namespace hpx { namespace server
                 partition_unordered_map<Key, T, Hash, KeyEqual> > >
     {
     public:
-        typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
+        typedef typename traits::unordered_map_partition_storage<Key, T, Hash,
+            KeyEqual>::type data_type;
 
         typedef typename data_type::size_type size_type;
         typedef typename data_type::iterator iterator_type;
@@ -292,7 +333,6 @@ namespace hpx { namespace server
             std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
 
             for (std::size_t i = 0; i != keys.size(); ++i)
                 partition_unordered_map_[keys[i]] = val[i];
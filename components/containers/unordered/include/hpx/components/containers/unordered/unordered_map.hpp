@@ -12,6 +12,7 @@
 #include <hpx/actions_base/traits/is_distribution_policy.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/component_type.hpp>
@@ -358,6 +359,23 @@ namespace hpx
             return this->hasher_(key) % partitions_.size();
         }
 
+        // Distribute the given keys onto the partitions they belong to,
+        // returns the keys and their original positions for each partition.
+        void group_by_partition(std::vector<Key> const& keys,
+            std::vector<std::vector<Key> >& part_keys,
+            std::vector<std::vector<std::size_t> >& part_pos) const
+        {
+            part_keys.resize(partitions_.size());
+            part_pos.resize(partitions_.size());
+
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                std::size_t part = get_partition(keys[i]);
+                part_keys[part].push_back(keys[i]);
+                part_pos[part].push_back(i);
+            }
+        }
+
         std::vector<hpx::id_type> get_partition_ids() const
         {
             std::vector<hpx::id_type> ids;
@@ -792,6 +810,141 @@ namespace hpx
                 .set_value(pos, std::forward<T_>(val));
         }
 
+        /// Returns the elements with the given keys in the unordered_map
+        /// container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements in the same order as
+        ///         the given keys.
+        ///
+        std::vector<T> get_values(launch::sync_policy,
+            std::vector<Key> const& keys) const
+        {
+            return get_values(keys).get();
+        }
+
+        /// Asynchronously returns the elements with the given keys in the
+        /// unordered_map container. The keys are grouped by partition and
+        /// each partition is accessed only once.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the same order as the given keys.
+        ///
+        future<std::vector<T> > get_values(std::vector<Key> const& keys) const
+        {
+            std::vector<std::vector<Key> > part_keys;
+            std::vector<std::vector<std::size_t> > part_pos;
+            group_by_partition(keys, part_keys, part_pos);
+
+            std::vector<future<std::vector<T> > > values;
+            std::vector<std::vector<std::size_t> > positions;
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    values.push_back(make_ready_future(
+                        part_data.local_data_->get_values(part_keys[part])));
+                }
+                else
+                {
+                    values.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .get_values(part_keys[part]));
+                }
+                positions.push_back(std::move(part_pos[part]));
+            }
+
+            std::size_t const count = keys.size();
+            return hpx::when_all(values).then(
+                [count, positions = std::move(positions)](
+                    future<std::vector<future<std::vector<T> > > >&& f)
+                    -> std::vector<T> {
+                    std::vector<future<std::vector<T> > > part_values = f.get();
+
+                    std::vector<T> result(count);
+                    for (std::size_t i = 0; i != part_values.size(); ++i)
+                    {
+                        std::vector<T> vals = part_values[i].get();
+                        std::vector<std::size_t> const& pos = positions[i];
+
+                        HPX_ASSERT(vals.size() == pos.size());
+                        for (std::size_t j = 0; j != pos.size(); ++j)
+                            result[pos[j]] = std::move(vals[j]);
+                    }
+                    return result;
+                });
+        }
+
+        /// Copy the given values into the elements with the given keys in
+        /// the unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        void set_values(launch::sync_policy, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            set_values(keys, vals).get();
+        }
+
+        /// Asynchronously copy the given values into the elements with the
+        /// given keys in the unordered_map container. The keys are grouped
+        /// by partition and each partition is accessed only once.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+
+            std::vector<std::vector<Key> > part_keys;
+            std::vector<std::vector<std::size_t> > part_pos;
+            group_by_partition(keys, part_keys, part_pos);
+
+            std::vector<future<void> > results;
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                std::vector<T> part_vals;
+                part_vals.reserve(part_pos[part].size());
+                for (std::size_t pos : part_pos[part])
+                    part_vals.push_back(vals[pos]);
+
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    part_data.local_data_->set_values(
+                        part_keys[part], part_vals);
+                }
+                else
+                {
+                    results.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .set_values(part_keys[part], part_vals));
+                }
+            }
+
+            return hpx::when_all(results).then(
+                [](future<std::vector<future<void> > >&& f) -> void {
+                    for (future<void>& r : f.get())
+                        r.get();
+                });
+        }
+
         /// Asynchronously compute the size of the unordered_map.
         ///
         /// \return Return the number of elements in the unordered_map
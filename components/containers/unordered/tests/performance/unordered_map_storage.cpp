@@ -0,0 +1,203 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the two storage backends available for the
+// partitions of hpx::unordered_map: std::unordered_map and the open-addressing
+// hpx::util::flat_unordered_map. It measures both, the raw partition storage
+// and bulk accesses to a distributed hpx::unordered_map.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/include/unordered_map.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// unordered_maps using flat_hash store their elements in flat partitions
+struct flat_hash : std::hash<std::uint64_t>
+{
+};
+
+namespace hpx { namespace traits {
+    template <>
+    struct unordered_map_partition_storage<std::uint64_t, double, flat_hash,
+        std::equal_to<std::uint64_t>>
+      : flat_unordered_map_partition_storage<std::uint64_t, double, flat_hash,
+            std::equal_to<std::uint64_t>>
+    {
+    };
+}}    // namespace hpx::traits
+
+HPX_REGISTER_UNORDERED_MAP(std::uint64_t, double);
+HPX_REGISTER_UNORDERED_MAP(std::uint64_t, double, flat_hash,
+    std::equal_to<std::uint64_t>, flat_double);
+
+///////////////////////////////////////////////////////////////////////////////
+// measure the partition storage on its own
+template <typename Map>
+void run_storage_benchmark(char const* name,
+    std::vector<std::uint64_t> const& keys,
+    std::vector<std::uint64_t> const& lookups, int test_count)
+{
+    double insert_time = 0.0;
+    double lookup_time = 0.0;
+    double sum = 0.0;
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        Map m;
+
+        std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+        for (std::uint64_t key : keys)
+            m[key] = double(key);
+        insert_time += (hpx::chrono::high_resolution_clock::now() - t) * 1e-9;
+
+        t = hpx::chrono::high_resolution_clock::now();
+        for (std::uint64_t key : lookups)
+        {
+            auto it = m.find(key);
+            if (it != m.end())
+                sum += it->second;
+        }
+        lookup_time += (hpx::chrono::high_resolution_clock::now() - t) * 1e-9;
+    }
+
+    std::cout << name << ",insert," << insert_time / test_count << "\n"
+              << name << ",lookup," << lookup_time / test_count << "\n"
+              << name << ",checksum," << sum << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// measure bulk accesses to a distributed unordered_map
+template <typename Hash>
+void run_unordered_map_benchmark(char const* name,
+    std::vector<std::uint64_t> const& keys,
+    std::vector<std::uint64_t> const& lookups, std::size_t batch_size,
+    int test_count)
+{
+    double insert_time = 0.0;
+    double lookup_time = 0.0;
+
+    std::vector<double> values(keys.size());
+    std::transform(keys.begin(), keys.end(), values.begin(),
+        [](std::uint64_t key) { return double(key); });
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::unordered_map<std::uint64_t, double, Hash> m(
+            hpx::container_layout(hpx::find_all_localities()));
+
+        std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+        for (std::size_t j = 0; j < keys.size(); j += batch_size)
+        {
+            std::size_t last = (std::min)(j + batch_size, keys.size());
+            m.set_values(hpx::launch::sync,
+                std::vector<std::uint64_t>(
+                    keys.begin() + j, keys.begin() + last),
+                std::vector<double>(
+                    values.begin() + j, values.begin() + last));
+        }
+        insert_time += (hpx::chrono::high_resolution_clock::now() - t) * 1e-9;
+
+        t = hpx::chrono::high_resolution_clock::now();
+        for (std::size_t j = 0; j < lookups.size(); j += batch_size)
+        {
+            std::size_t last = (std::min)(j + batch_size, lookups.size());
+            m.get_values(hpx::launch::sync,
+                std::vector<std::uint64_t>(
+                    lookups.begin() + j, lookups.begin() + last));
+        }
+        lookup_time += (hpx::chrono::high_resolution_clock::now() - t) * 1e-9;
+    }
+
+    std::cout << name << ",set_values," << insert_time / test_count << "\n"
+              << name << ",get_values," << lookup_time / test_count
+              << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        std::size_t num_entries = vm["num_entries"].as<std::size_t>();
+        std::size_t batch_size = vm["batch_size"].as<std::size_t>();
+        int test_count = vm["test_count"].as<int>();
+
+        unsigned int seed = std::random_device{}();
+        if (vm.count("seed"))
+            seed = vm["seed"].as<unsigned int>();
+
+        std::mt19937_64 gen(seed);
+
+        // random keys, every key is looked up once in random order
+        std::vector<std::uint64_t> keys(num_entries);
+        std::generate(keys.begin(), keys.end(), std::ref(gen));
+
+        std::vector<std::uint64_t> lookups(keys);
+        std::shuffle(lookups.begin(), lookups.end(), gen);
+
+        run_storage_benchmark<std::unordered_map<std::uint64_t, double>>(
+            "std_unordered_map", keys, lookups, test_count);
+        run_storage_benchmark<
+            hpx::util::flat_unordered_map<std::uint64_t, double>>(
+            "flat_unordered_map", keys, lookups, test_count);
+
+        run_unordered_map_benchmark<std::hash<std::uint64_t>>(
+            "unordered_map<std>", keys, lookups, batch_size, test_count);
+        run_unordered_map_benchmark<flat_hash>(
+            "unordered_map<flat>", keys, lookups, batch_size, test_count);
+
+        return hpx::finalize();
+    }
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all", "hpx.run_hpx_main!=1"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("num_entries",
+         hpx::program_options::value<std::size_t>()->default_value(1000000),
+         "number of entries stored in the maps (default: 1000000)")
+        ("batch_size",
+         hpx::program_options::value<std::size_t>()->default_value(10000),
+         "number of keys accessed by one bulk operation (default: 10000)")
+        ("test_count",
+         hpx::program_options::value<int>()->default_value(5),
+         "number of tests to be averaged (default: 5)")
+        ("seed,s", hpx::program_options::value<unsigned int>(),
+         "the random number generator seed to use for this run");
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,141 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/components/containers/unordered/flat_unordered_map.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/string.hpp>
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// compare the flat_unordered_map against std::unordered_map for a random
+// sequence of insertions, lookups and erasures
+template <typename Key, typename F>
+void test_random_operations(F make_key)
+{
+    hpx::util::flat_unordered_map<Key, int> m;
+    std::unordered_map<Key, int> expected;
+
+    std::mt19937 gen(42);
+    for (int i = 0; i != 100000; ++i)
+    {
+        Key key = make_key(gen() % 2000);
+        switch (gen() % 4)
+        {
+        case 0:
+        case 1:
+            m[key] = i;
+            expected[key] = i;
+            break;
+
+        case 2:
+            HPX_TEST_EQ(m.erase(key), expected.erase(key));
+            break;
+
+        case 3:
+        {
+            auto it = m.find(key);
+            auto expected_it = expected.find(key);
+            HPX_TEST_EQ(it == m.end(), expected_it == expected.end());
+            if (it != m.end() && expected_it != expected.end())
+            {
+                HPX_TEST_EQ(it->second, expected_it->second);
+            }
+        }
+        break;
+        }
+        HPX_TEST_EQ(m.size(), expected.size());
+    }
+
+    std::size_t count = 0;
+    for (auto const& v : m)
+    {
+        HPX_TEST_EQ(v.second, expected.at(v.first));
+        ++count;
+    }
+    HPX_TEST_EQ(count, expected.size());
+
+    // erase through iterators
+    for (auto it = m.begin(); it != m.end(); /**/)
+    {
+        if (it->second % 2 == 0)
+        {
+            expected.erase(it->first);
+            it = m.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    HPX_TEST_EQ(m.size(), expected.size());
+
+    // copies hold the same elements
+    hpx::util::flat_unordered_map<Key, int> copy(m);
+    HPX_TEST_EQ(copy.size(), expected.size());
+    for (auto const& v : expected)
+    {
+        HPX_TEST_EQ(copy.count(v.first), std::size_t(1));
+        HPX_TEST_EQ(copy[v.first], v.second);
+    }
+
+    hpx::util::flat_unordered_map<Key, int> moved(std::move(copy));
+    HPX_TEST_EQ(moved.size(), expected.size());
+    HPX_TEST(copy.empty());    //-V774
+    HPX_TEST(copy.begin() == copy.end());
+
+    moved.clear();
+    HPX_TEST(moved.empty());
+    HPX_TEST(moved.begin() == moved.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_serialization()
+{
+    hpx::util::flat_unordered_map<std::string, double> m(100);
+    for (int i = 0; i != 100; ++i)
+    {
+        m[std::to_string(i)] = i;
+    }
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer);
+        oarchive << m;
+    }
+
+    hpx::util::flat_unordered_map<std::string, double> result;
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive >> result;
+    }
+
+    HPX_TEST_EQ(result.size(), m.size());
+    for (auto const& v : m)
+    {
+        auto it = result.find(v.first);
+        HPX_TEST(it != result.end());
+        HPX_TEST_EQ(it->second, v.second);
+    }
+}
+
+int main()
+{
+    test_random_operations<int>([](unsigned i) { return int(i * 64); });
+    test_random_operations<std::string>(
+        [](unsigned i) { return std::to_string(i); });
+    test_serialization();
+
+    return hpx::util::report_errors();
+}
@@ -20,9 +20,27 @@
 #include <string>
 #include <vector>
 
+///////////////////////////////////////////////////////////////////////////////
+// Use the flat storage for the partitions of unordered_maps using flat_hash
+struct flat_hash : std::hash<std::string>
+{
+};
+
+namespace hpx { namespace traits {
+    template <>
+    struct unordered_map_partition_storage<std::string, double, flat_hash,
+        std::equal_to<std::string>>
+      : flat_unordered_map_partition_storage<std::string, double, flat_hash,
+            std::equal_to<std::string>>
+    {
+    };
+}}    // namespace hpx::traits
+
 ///////////////////////////////////////////////////////////////////////////////
 // Define the vector types to be used.
 HPX_REGISTER_UNORDERED_MAP(std::string, double);
+HPX_REGISTER_UNORDERED_MAP(
+    std::string, double, flat_hash, std::equal_to<std::string>, flat_double);
 
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Key, typename Value, typename Hash, typename KeyEqual>
@@ -79,6 +97,34 @@ void fill_unordered_map(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
     HPX_TEST_EQ(m.size(), count);
 }
 
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void test_bulk_access(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
+    std::size_t count)
+{
+    std::vector<Key> keys;
+    std::vector<Value> values;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        keys.push_back(std::to_string(i));
+        values.push_back(Value(i));
+    }
+
+    m.set_values(hpx::launch::sync, keys, values);
+    HPX_TEST_EQ(m.size(), count);
+
+    // query the keys in reverse order
+    std::reverse(keys.begin(), keys.end());
+    std::reverse(values.begin(), values.end());
+
+    std::vector<Value> result = m.get_values(keys).get();
+    HPX_TEST(result == values);
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(m[keys[i]], values[i]);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Key, typename Value, typename DistPolicy>
 void trivial_tests(DistPolicy const& policy)
@@ -110,6 +156,25 @@ void trivial_tests(DistPolicy const& policy)
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
     }
+
+    // bulk access
+    {
+        hpx::unordered_map<Key, Value> m(policy);
+        test_bulk_access(m, 107);
+    }
+
+    // flat partition storage
+    {
+        hpx::unordered_map<Key, Value, flat_hash> m(17, flat_hash(), policy);
+        test_bulk_access(m, 107);
+
+        for (std::size_t i = 0; i != 107; i += 2)
+        {
+            HPX_TEST_EQ(m.erase(hpx::launch::sync, std::to_string(i)),
+                std::size_t(1));
+        }
+        HPX_TEST_EQ(m.size(), std::size_t(53));
+    }
 }
 
 template <typename Key, typename Value>
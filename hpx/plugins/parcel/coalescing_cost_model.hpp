@@ -0,0 +1,175 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_COALESCING)
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace plugins { namespace parcel { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Online model of the cost of sending the parcels of one action to one
+    // destination. The time needed for sending a message is modelled as
+    //
+    //      latency + bytes * time_per_byte
+    //
+    // where both terms are estimated from the measured send times using an
+    // exponentially weighted linear regression. Together with the average
+    // time between arriving parcels this allows to compute the smallest
+    // number of parcels to coalesce for messages to be sent as fast as
+    // parcels arrive, which minimizes the latency added by coalescing.
+    class coalescing_cost_model
+    {
+    public:
+        // weight of a new measurement
+        static constexpr double smoothing_factor() noexcept
+        {
+            return 0.1;
+        }
+
+        coalescing_cost_model()
+          : time_between_parcels_(0.0)
+          , num_messages_(0)
+          , bytes_per_parcel_(0.0)
+          , mean_bytes_(0.0)
+          , mean_time_(0.0)
+          , var_bytes_(0.0)
+          , cov_bytes_time_(0.0)
+        {
+        }
+
+        // record the time [ns] between two parcels arriving at the message
+        // handler, longer gaps are clamped to the given maximum [ns] (the
+        // coalescing interval) as parcels arriving that far apart are never
+        // coalesced anyway, this keeps idle phases (and the time before
+        // the first parcel) from dominating the estimate
+        void parcel_arrived(
+            std::int64_t time_between_parcels, std::int64_t max_time)
+        {
+            double const t =
+                double((std::min)(time_between_parcels, max_time));
+            if (time_between_parcels_ == 0.0)
+                time_between_parcels_ = t;
+            else
+                time_between_parcels_ +=
+                    smoothing_factor() * (t - time_between_parcels_);
+        }
+
+        // record that a message containing the given number of parcels and
+        // bytes was sent in the given time [ns]
+        void message_sent(std::size_t num_parcels, std::size_t num_bytes,
+            std::int64_t time)
+        {
+            if (num_parcels == 0)
+                return;
+
+            double const x = double(num_bytes);
+            double const y = double(time);
+            double const bytes_per_parcel = x / double(num_parcels);
+
+            if (num_messages_++ == 0)
+            {
+                bytes_per_parcel_ = bytes_per_parcel;
+                mean_bytes_ = x;
+                mean_time_ = y;
+                return;
+            }
+
+            double const a = smoothing_factor();
+            bytes_per_parcel_ += a * (bytes_per_parcel - bytes_per_parcel_);
+
+            double const dx = x - mean_bytes_;
+            double const dy = y - mean_time_;
+            mean_bytes_ += a * dx;
+            mean_time_ += a * dy;
+            var_bytes_ = (1.0 - a) * (var_bytes_ + a * dx * dx);
+            cov_bytes_time_ = (1.0 - a) * (cov_bytes_time_ + a * dx * dy);
+        }
+
+        // return whether enough data was collected to make decisions
+        bool has_estimate() const noexcept
+        {
+            return num_messages_ != 0 && time_between_parcels_ != 0.0;
+        }
+
+        // the estimated time [ns] needed for sending one byte
+        double time_per_byte() const noexcept
+        {
+            // all messages had (almost) the same size, attribute the whole
+            // time to the latency
+            if (var_bytes_ < 1.0)
+                return 0.0;
+            return (std::max)(0.0, cov_bytes_time_ / var_bytes_);
+        }
+
+        // the estimated fixed cost [ns] of sending one message
+        double latency() const noexcept
+        {
+            return (std::max)(0.0, mean_time_ - time_per_byte() * mean_bytes_);
+        }
+
+        double time_between_parcels() const noexcept
+        {
+            return time_between_parcels_;
+        }
+
+        // Return the number of parcels to coalesce into one message. Sending
+        // n parcels takes latency + n * transfer_time while their arrival
+        // takes n * time_between_parcels, thus messages keep up with the
+        // arriving parcels for n >= latency / (time_between_parcels -
+        // transfer_time).
+        std::size_t batch_size(std::size_t max_batch_size) const noexcept
+        {
+            double const transfer_time = time_per_byte() * bytes_per_parcel_;
+            double const slack = time_between_parcels_ - transfer_time;
+            if (slack <= 0.0)
+            {
+                // the available bandwidth is exhausted, coalesce as much as
+                // possible
+                return max_batch_size;
+            }
+
+            double const n = std::ceil(latency() / slack);
+            if (n >= double(max_batch_size))
+                return max_batch_size;
+
+            return (std::max)(std::size_t(1), static_cast<std::size_t>(n));
+        }
+
+        // Return the time [ns] to wait for the given number of parcels to
+        // arrive, limited by the given maximum.
+        std::int64_t flush_interval(
+            std::size_t batch_size, std::int64_t max_interval) const noexcept
+        {
+            double const interval = double(batch_size) * time_between_parcels_;
+            if (interval >= double(max_interval))
+                return max_interval;
+            return static_cast<std::int64_t>(interval);
+        }
+
+    private:
+        double time_between_parcels_;    // [ns]
+
+        std::size_t num_messages_;
+        double bytes_per_parcel_;
+
+        // exponentially weighted statistics of the message sizes [bytes]
+        // and send times [ns]
+        double mean_bytes_;
+        double mean_time_;
+        double var_bytes_;
+        double cov_bytes_time_;
+    };
+}}}}
+
+#endif
@@ -52,6 +52,10 @@ namespace hpx { namespace plugins { namespace parcel
             get_counter_type average_time_between_parcels;
             get_counter_values_creator_type time_between_parcels_histogram_creator;
             std::int64_t min_boundary, max_boundary, num_buckets;
+            get_counter_values_creator_type parcels_per_message_histogram_creator;
+            std::int64_t parcels_per_message_min_boundary,
+                parcels_per_message_max_boundary,
+                parcels_per_message_num_buckets;
         };
 
         typedef std::unordered_map<
@@ -66,7 +70,8 @@ namespace hpx { namespace plugins { namespace parcel
             get_counter_type num_parcels, get_counter_type num_messages,
             get_counter_type time_between_parcels,
             get_counter_type average_time_between_parcels,
-            get_counter_values_creator_type time_between_parcels_histogram_creator);
+            get_counter_values_creator_type time_between_parcels_histogram_creator,
+            get_counter_values_creator_type parcels_per_message_histogram_creator);
 
         get_counter_type get_parcels_counter(std::string const& name) const;
         get_counter_type get_messages_counter(std::string const& name) const;
@@ -77,6 +82,9 @@ namespace hpx { namespace plugins { namespace parcel
         get_counter_values_type get_time_between_parcels_histogram_counter(
             std::string const& name, std::int64_t min_boundary,
             std::int64_t max_boundary, std::int64_t num_buckets);
+        get_counter_values_type get_parcels_per_message_histogram_counter(
+            std::string const& name, std::int64_t min_boundary,
+            std::int64_t max_boundary, std::int64_t num_buckets);
 
         bool counter_discoverer(
             performance_counters::counter_info const& info,
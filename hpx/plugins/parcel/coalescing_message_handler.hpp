@@ -17,6 +17,7 @@
 #include <hpx/statistics/histogram.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <hpx/plugins/parcel/coalescing_cost_model.hpp>
 #include <hpx/plugins/parcel/message_buffer.hpp>
 
 #include <cstddef>
@@ -24,6 +25,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <system_error>
 #include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
@@ -66,6 +68,12 @@ namespace hpx { namespace plugins { namespace parcel
             std::int64_t min_boundary, std::int64_t max_boundary,
             std::int64_t num_buckets,
             util::function_nonser<std::vector<std::int64_t>(bool)>& result);
+        std::vector<std::int64_t>
+            get_parcels_per_message_histogram(bool reset);
+        void get_parcels_per_message_histogram_creator(
+            std::int64_t min_boundary, std::int64_t max_boundary,
+            std::int64_t num_buckets,
+            util::function_nonser<std::vector<std::int64_t>(bool)>& result);
 
         // register the given action
         static void register_action(char const* action, error_code& ec);
@@ -78,6 +86,15 @@ namespace hpx { namespace plugins { namespace parcel
 
         void update_num_messages();
         void update_interval();
+        void update_adaptive();
+
+        // adaptive coalescing
+        void message_sent(write_handler_type const& f, std::int64_t started,
+            std::size_t num_parcels, std::error_code const& ec,
+            parcelset::parcel const& p);
+        write_handler_type measure_message(write_handler_type&& f,
+            std::size_t num_parcels);
+        void record_parcels_per_message(std::size_t num_parcels);
 
     private:
         mutable mutex_type mtx_;
@@ -88,6 +105,8 @@ namespace hpx { namespace plugins { namespace parcel
         util::pool_timer timer_;
         bool stopped_;
         bool allow_background_flush_;
+        bool adaptive_;
+        detail::coalescing_cost_model cost_model_;
         std::string action_name_;
 
         // performance counter data
@@ -110,6 +129,11 @@ namespace hpx { namespace plugins { namespace parcel
         std::int64_t histogram_min_boundary_;
         std::int64_t histogram_max_boundary_;
         std::int64_t histogram_num_buckets_;
+
+        std::unique_ptr<histogram_collector_type> parcels_per_message_;
+        std::int64_t parcels_per_message_min_boundary_;
+        std::int64_t parcels_per_message_max_boundary_;
+        std::int64_t parcels_per_message_num_buckets_;
     };
 }}}
 
@@ -158,6 +158,14 @@ namespace hpx { namespace plugins { namespace parcel { namespace detail
 
         std::size_t capacity() const { return max_messages_; }
 
+        // the handler of the first message is invoked once the whole buffer
+        // has been sent
+        parcelset::write_handler_type& front_handler()
+        {
+            HPX_ASSERT(!handlers_.empty());
+            return handlers_.front();
+        }
+
     private:
         parcelset::locality dest_;
         std::vector<parcelset::parcel> messages_;
@@ -14,6 +14,7 @@
 #include <hpx/plugins/parcelport/mpi/header.hpp>
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
 #include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/serialization/detail/buffer_pool.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -63,7 +64,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
             data.time_ = timer_.elapsed_nanoseconds();
             data.bytes_ = static_cast<std::size_t>(header_.numbytes());
 
-            buffer_.data_.resize(static_cast<std::size_t>(header_.size()));
+            serialization::detail::resize_buffer(
+                buffer_.data_, static_cast<std::size_t>(header_.size()));
             buffer_.num_chunks_ = header_.num_chunks();
         }
 
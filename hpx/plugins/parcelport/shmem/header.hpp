@@ -0,0 +1,44 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <cstdint>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    // A message is written to a ring as
+    //
+    //  - this header
+    //  - the transmission chunks (if there are zero-copy chunks)
+    //  - the archive data
+    //  - for each zero-copy chunk: the sequence number of the segment the
+    //    chunk was exported through, or zero followed by the chunk data
+    struct header
+    {
+        header() = default;
+
+        template <typename Buffer>
+        explicit header(Buffer const& buffer)
+          : size_(buffer.data_.size())
+          , data_size_(buffer.data_size_)
+          , num_chunks_first_(buffer.num_chunks_.first)
+          , num_chunks_second_(buffer.num_chunks_.second)
+        {
+        }
+
+        std::uint64_t size_ = 0;
+        std::uint64_t data_size_ = 0;
+        std::uint32_t num_chunks_first_ = 0;
+        std::uint32_t num_chunks_second_ = 0;
+    };
+}}}}
+
+#endif
@@ -0,0 +1,98 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/util/ios_flags_saver.hpp>
+
+#include <cstdint>
+#include <ostream>
+
+namespace hpx { namespace parcelset
+{
+    namespace policies { namespace shmem
+    {
+        // A locality reachable through shared memory is identified by the
+        // host it runs on and its process id.
+        class locality
+        {
+        public:
+            locality()
+              : host_(0)
+              , pid_(-1)
+            {}
+
+            locality(std::uint64_t host, std::int32_t pid)
+              : host_(host)
+              , pid_(pid)
+            {}
+
+            std::uint64_t host() const
+            {
+                return host_;
+            }
+
+            std::int32_t pid() const
+            {
+                return pid_;
+            }
+
+            static const char *type()
+            {
+                return "shmem";
+            }
+
+            explicit operator bool() const noexcept
+            {
+                return pid_ != -1;
+            }
+
+            void save(serialization::output_archive & ar) const
+            {
+                ar << host_;
+                ar << pid_;
+            }
+
+            void load(serialization::input_archive & ar)
+            {
+                ar >> host_;
+                ar >> pid_;
+            }
+
+        private:
+            friend bool operator==(locality const & lhs, locality const & rhs)
+            {
+                return lhs.pid_ == rhs.pid_ && lhs.host_ == rhs.host_;
+            }
+
+            friend bool operator<(locality const & lhs, locality const & rhs)
+            {
+                return lhs.host_ < rhs.host_ ||
+                    (lhs.host_ == rhs.host_ && lhs.pid_ < rhs.pid_);
+            }
+
+            friend std::ostream& operator<<(
+                std::ostream& os, locality const& loc)
+            {
+                hpx::util::ios_flags_saver ifs(os);
+                os << std::hex << loc.host_ << std::dec << ":" << loc.pid_;
+
+                return os;
+            }
+
+            std::uint64_t host_;
+            std::int32_t pid_;
+        };
+    }}
+}}
+
+#endif
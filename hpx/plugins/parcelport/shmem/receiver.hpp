@@ -0,0 +1,125 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assert.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver_connection.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    template <typename Parcelport>
+    struct receiver
+    {
+        typedef hpx::lcos::local::spinlock mutex_type;
+        typedef
+            receiver_connection<Parcelport>
+            connection_type;
+
+        receiver(Parcelport& pp, segment& seg)
+          : pp_(pp)
+          , segment_(seg)
+          , seen_(0)
+        {
+        }
+
+        void run()
+        {
+            HPX_ASSERT(segment_);
+
+            std::size_t const num_rings = segment_.num_rings();
+            connections_.reserve(num_rings);
+            for (std::size_t i = 0; i != num_rings; ++i)
+            {
+                connections_.emplace_back(new entry(segment_.ring(i), pp_));
+            }
+        }
+
+        bool background_work(std::size_t num_thread = -1)
+        {
+            if (connections_.empty()) return false;
+
+            segment_header& h = segment_.header();
+
+            // nothing was written since the last scan of the rings
+            std::uint32_t const doorbell = h.doorbell_.load();
+            if (doorbell == seen_.load(std::memory_order_relaxed))
+                return false;
+            seen_.store(doorbell, std::memory_order_relaxed);
+
+            bool has_work = false;
+            std::uint64_t claimed = h.claimed_.load();
+            for (std::size_t i = 0; claimed != 0; ++i, claimed >>= 1)
+            {
+                if ((claimed & 1) == 0) continue;
+
+                entry& e = *connections_[i];
+                std::unique_lock<mutex_type> l(e.mtx_, std::try_to_lock);
+                if (!l)
+                {
+                    // The thread holding the lock may have looked at the
+                    // ring before the data announced by the doorbell
+                    // arrived, make sure the rings are scanned again.
+                    seen_.store(doorbell - 1, std::memory_order_relaxed);
+                    continue;
+                }
+
+                if (e.connection_.receive(num_thread))
+                    has_work = true;
+            }
+            return has_work;
+        }
+
+        // Block until data is written to any of the rings or the timeout
+        // expired.
+        void wait(std::chrono::microseconds timeout)
+        {
+            segment_header& h = segment_.header();
+
+            std::uint32_t const seen = seen_.load(std::memory_order_relaxed);
+            h.waiting_.fetch_add(1);
+            if (h.doorbell_.load() == seen)
+            {
+                futex_wait(h.doorbell_, seen, timeout);
+            }
+            h.waiting_.fetch_sub(1);
+        }
+
+    private:
+        struct entry
+        {
+            entry(ring_buffer& ring, Parcelport& pp)
+              : connection_(ring, pp)
+            {
+            }
+
+            mutex_type mtx_;
+            connection_type connection_;
+        };
+
+        Parcelport & pp_;
+        segment& segment_;
+
+        std::atomic<std::uint32_t> seen_;
+        std::vector<std::unique_ptr<entry>> connections_;
+    };
+}}}}
+
+#endif
@@ -0,0 +1,237 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/plugins/parcelport/shmem/header.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/serialization/detail/buffer_pool.hpp>
+#include <hpx/timing/high_resolution_timer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    // Receives the messages written to one of the rings of the segment of
+    // this locality.
+    template <typename Parcelport>
+    struct receiver_connection
+    {
+    private:
+        enum connection_state
+        {
+            receiving_header
+          , receiving_transmission_chunks
+          , receiving_data
+          , receiving_chunks
+        };
+
+        enum chunk_state
+        {
+            chunk_receiving_seq
+          , chunk_receiving_data
+        };
+
+        typedef std::vector<char> data_type;
+        typedef parcel_buffer<data_type, chunk_buffer> buffer_type;
+
+    public:
+        receiver_connection(ring_buffer& ring, Parcelport& pp)
+          : state_(receiving_header)
+          , ring_(ring)
+          , offset_(0)
+          , bytes_read_(0)
+          , chunks_idx_(0)
+          , chunk_state_(chunk_receiving_seq)
+          , chunk_seq_(0)
+          , discard_(false)
+          , pp_(pp)
+        {
+        }
+
+        // Read everything currently available in the ring, returns whether
+        // any data was received.
+        bool receive(std::size_t num_thread = -1)
+        {
+            bytes_read_ = 0;
+            while (receive_message(num_thread))
+                /**/;
+            return bytes_read_ != 0;
+        }
+
+        bool receive_message(std::size_t num_thread)
+        {
+            switch (state_)
+            {
+            case receiving_header:
+                if (!read(&header_, sizeof(header_))) return false;
+                start_message();
+                state_ = receiving_transmission_chunks;
+                HPX_FALLTHROUGH;
+
+            case receiving_transmission_chunks:
+                if (!read(buffer_.transmission_chunks_.data(),
+                        buffer_.transmission_chunks_.size() *
+                            sizeof(buffer_type::transmission_chunk_type)))
+                {
+                    return false;
+                }
+                state_ = receiving_data;
+                HPX_FALLTHROUGH;
+
+            case receiving_data:
+                if (!read(buffer_.data_.data(), buffer_.data_.size()))
+                    return false;
+                state_ = receiving_chunks;
+                HPX_FALLTHROUGH;
+
+            case receiving_chunks:
+                if (!receive_chunks()) return false;
+                return done(num_thread);
+
+            default:
+                HPX_ASSERT(false);
+            }
+            return false;
+        }
+
+        void start_message()
+        {
+            performance_counters::parcels::data_point& data =
+                buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.bytes_ = static_cast<std::size_t>(header_.data_size_);
+
+            serialization::detail::resize_buffer(
+                buffer_.data_, static_cast<std::size_t>(header_.size_));
+            buffer_.size_ = static_cast<std::size_t>(header_.size_);
+            buffer_.data_size_ = static_cast<std::size_t>(header_.data_size_);
+            buffer_.num_chunks_ = buffer_type::count_chunks_type(
+                header_.num_chunks_first_, header_.num_chunks_second_);
+
+            std::size_t num_zero_copy_chunks = header_.num_chunks_first_;
+            if (num_zero_copy_chunks != 0)
+            {
+                buffer_.transmission_chunks_.resize(
+                    num_zero_copy_chunks + header_.num_chunks_second_);
+                buffer_.chunks_.resize(num_zero_copy_chunks);
+            }
+
+            chunks_idx_ = 0;
+            chunk_state_ = chunk_receiving_seq;
+        }
+
+        bool receive_chunks()
+        {
+            while (chunks_idx_ < buffer_.chunks_.size())
+            {
+                chunk_buffer& c = buffer_.chunks_[chunks_idx_];
+                std::size_t const size = static_cast<std::size_t>(
+                    buffer_.transmission_chunks_[chunks_idx_].second);
+
+                if (chunk_state_ == chunk_receiving_seq)
+                {
+                    if (!read(&chunk_seq_, sizeof(chunk_seq_))) return false;
+
+                    // adopt the segment the chunk was exported through, if
+                    // any, otherwise the data follows in the ring
+                    if (chunk_seq_ != 0)
+                    {
+                        error_code ec(lightweight);
+                        c.map(chunk_name(ring_.owner_.load(), chunk_seq_),
+                            size, ec);
+                        if (ec)
+                        {
+                            // the rest of the message is still read from
+                            // the ring to stay in sync with the sender
+                            LPT_(error).format("shmem::receiver_connection: "
+                                               "dropping message: {}",
+                                ec.get_message());
+                            discard_ = true;
+                        }
+                    }
+                    else
+                    {
+                        c.resize(size);
+                    }
+                    chunk_state_ = chunk_receiving_data;
+                }
+
+                if (chunk_seq_ == 0 && !read(c.data(), size)) return false;
+
+                chunk_state_ = chunk_receiving_seq;
+                ++chunks_idx_;
+            }
+            return true;
+        }
+
+        bool done(std::size_t num_thread)
+        {
+            performance_counters::parcels::data_point& data =
+                buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds() - data.time_;
+
+            if (!discard_)
+            {
+                decode_parcels(pp_, std::move(buffer_), num_thread);
+            }
+            discard_ = false;
+
+            buffer_ = buffer_type();
+            state_ = receiving_header;
+
+            return true;
+        }
+
+        // Read the remaining part of the given item from the ring, returns
+        // whether the item was read completely.
+        bool read(void* data, std::size_t size)
+        {
+            std::size_t const n = ring_.read(
+                static_cast<char*>(data) + offset_, size - offset_);
+            offset_ += n;
+            bytes_read_ += n;
+
+            if (offset_ != size) return false;
+
+            offset_ = 0;
+            return true;
+        }
+
+        hpx::chrono::high_resolution_timer timer_;
+
+        connection_state state_;
+        ring_buffer& ring_;
+
+        std::size_t offset_;
+        std::size_t bytes_read_;
+        std::size_t chunks_idx_;
+        chunk_state chunk_state_;
+        std::uint64_t chunk_seq_;
+
+        // a chunk of the current message could not be received
+        bool discard_;
+
+        header header_;
+        buffer_type buffer_;
+
+        Parcelport & pp_;
+    };
+}}}}
+
+#endif
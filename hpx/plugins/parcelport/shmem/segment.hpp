@@ -0,0 +1,244 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Returns an identifier for the host this process runs on. Localities
+    // with the same host identifier can reach each other through shared
+    // memory.
+    HPX_EXPORT std::uint64_t host_id();
+    HPX_EXPORT std::string host_name();
+
+    // returns the id of this process
+    HPX_EXPORT std::int32_t process_id();
+
+    // The name of the segment holding the rings of the given process and the
+    // name of a segment holding a single zero-copy chunk.
+    HPX_EXPORT std::string segment_name(std::int32_t pid);
+    HPX_EXPORT std::string chunk_name(std::int32_t pid, std::uint64_t seq);
+
+    // Wait until the value of the given word differs from expected, the word
+    // is woken up or the timeout expired. The word may live in memory shared
+    // between processes.
+    HPX_EXPORT void futex_wait(std::atomic<std::uint32_t>& word,
+        std::uint32_t expected, std::chrono::microseconds timeout);
+    HPX_EXPORT void futex_wake(std::atomic<std::uint32_t>& word);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A single producer, single consumer ring of bytes placed in shared
+    // memory, directly followed by its data. Positions are monotonically
+    // increasing byte counts, the capacity is a power of two. Each side keeps
+    // a cached copy of the other side's position on its own cache line to
+    // avoid touching the shared one for every operation.
+    struct ring_buffer
+    {
+        explicit ring_buffer(std::uint64_t capacity) noexcept
+          : head_(0)
+          , tail_cache_(0)
+          , tail_(0)
+          , head_cache_(0)
+          , owner_(0)
+          , capacity_(capacity)
+        {
+        }
+
+        ring_buffer(ring_buffer const&) = delete;
+        ring_buffer& operator=(ring_buffer const&) = delete;
+
+        // Copy up to size bytes into the ring, returns the number of bytes
+        // written. Must be called by the producer only.
+        HPX_EXPORT std::size_t write(
+            void const* data, std::size_t size) noexcept;
+
+        // Copy up to size bytes out of the ring, returns the number of bytes
+        // read. Must be called by the consumer only.
+        HPX_EXPORT std::size_t read(void* data, std::size_t size) noexcept;
+
+        char* buffer() noexcept
+        {
+            return reinterpret_cast<char*>(this + 1);
+        }
+
+        // read position and cached write position, owned by the consumer
+        alignas(threads::get_cache_line_size())
+            std::atomic<std::uint64_t> head_;
+        std::uint64_t tail_cache_;
+
+        // write position and cached read position, owned by the producer
+        alignas(threads::get_cache_line_size())
+            std::atomic<std::uint64_t> tail_;
+        std::uint64_t head_cache_;
+
+        // the process id of the producer, zero if the ring is unclaimed
+        alignas(threads::get_cache_line_size())
+            std::atomic<std::int32_t> owner_;
+        std::uint64_t const capacity_;
+    };
+
+    // The header of the segment a locality receives messages through. It is
+    // followed by the rings, one per producing locality.
+    struct segment_header
+    {
+        segment_header(std::uint64_t num_rings, std::uint64_t ring_capacity)
+          : magic_(0)
+          , num_rings_(num_rings)
+          , ring_capacity_(ring_capacity)
+          , claimed_(0)
+          , doorbell_(0)
+          , waiting_(0)
+        {
+        }
+
+        std::atomic<std::uint64_t> magic_;
+        std::uint64_t const num_rings_;
+        std::uint64_t const ring_capacity_;
+
+        // bit i is set once ring i was claimed by a producer
+        std::atomic<std::uint64_t> claimed_;
+
+        // Incremented by the producers after writing to any of the rings.
+        // The consumer blocks on it (as a futex) while there is nothing to
+        // receive, waiting_ counts the blocked consumer threads.
+        alignas(threads::get_cache_line_size())
+            std::atomic<std::uint32_t> doorbell_;
+        std::atomic<std::uint32_t> waiting_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A mapping of the segment a locality receives messages through.
+    class HPX_EXPORT segment
+    {
+    public:
+        // the maximal number of rings per segment
+        static constexpr std::size_t max_rings = 64;
+
+        segment() = default;
+        ~segment();
+
+        segment(segment const&) = delete;
+        segment& operator=(segment const&) = delete;
+
+        // Create and map a new segment for the given number of rings of the
+        // given capacity, which is rounded up to the next power of two.
+        void create(std::string const& name, std::size_t num_rings,
+            std::size_t ring_capacity, error_code& ec = throws);
+
+        // Map an existing segment created by another process.
+        void open(std::string const& name, error_code& ec = throws);
+
+        // Remove the name of the segment, existing mappings stay valid.
+        void unlink();
+
+        explicit operator bool() const noexcept
+        {
+            return addr_ != nullptr;
+        }
+
+        segment_header& header() noexcept
+        {
+            return *static_cast<segment_header*>(addr_);
+        }
+
+        std::size_t num_rings() noexcept
+        {
+            return static_cast<std::size_t>(header().num_rings_);
+        }
+
+        ring_buffer& ring(std::size_t i) noexcept;
+
+        // Claim an unused ring for the calling process, returns the index of
+        // the claimed ring.
+        std::size_t claim_ring(error_code& ec = throws);
+
+        // Notify the consumer that data was written to one of the rings.
+        void notify() noexcept
+        {
+            segment_header& h = header();
+            h.doorbell_.fetch_add(1);
+            if (h.waiting_.load() != 0)
+            {
+                futex_wake(h.doorbell_);
+            }
+        }
+
+    private:
+        void unmap() noexcept;
+
+        std::string name_;
+        void* addr_ = nullptr;
+        std::size_t size_ = 0;
+        bool owner_ = false;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Copy the given data into a new shared memory segment with the given
+    // name. The receiving locality maps and removes the segment.
+    HPX_EXPORT void export_chunk(std::string const& name, void const* data,
+        std::size_t size, error_code& ec = throws);
+
+    // Remove an exported chunk which will not be received.
+    HPX_EXPORT void remove_chunk(std::string const& name) noexcept;
+
+    // The storage of a received zero-copy chunk, either a plain buffer the
+    // data was copied into, or the mapping of the segment the sending
+    // locality exported the chunk through. Moving a chunk does not move its
+    // data.
+    class HPX_EXPORT chunk_buffer
+    {
+    public:
+        chunk_buffer() = default;
+        ~chunk_buffer();
+
+        chunk_buffer(chunk_buffer&& rhs) noexcept;
+        chunk_buffer& operator=(chunk_buffer&& rhs) noexcept;
+
+        void resize(std::size_t size)
+        {
+            data_.resize(size);
+        }
+
+        // Map the exported segment of the given name and size and remove its
+        // name.
+        void map(std::string const& name, std::size_t size,
+            error_code& ec = throws);
+
+        char* data() noexcept
+        {
+            return addr_ != nullptr ? static_cast<char*>(addr_) : data_.data();
+        }
+
+        std::size_t size() const noexcept
+        {
+            return addr_ != nullptr ? size_ : data_.size();
+        }
+
+    private:
+        void unmap() noexcept;
+
+        std::vector<char> data_;
+        void* addr_ = nullptr;
+        std::size_t size_ = 0;
+    };
+}}}}
+
+#endif
@@ -0,0 +1,162 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/sender_connection.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    struct sender
+    {
+        using connection_type = sender_connection;
+        using connection_ptr = std::shared_ptr<connection_type>;
+        using connection_list = std::deque<connection_ptr>;
+
+        using mutex_type = hpx::lcos::local::spinlock;
+
+        explicit sender(std::size_t segment_threshold)
+          : segment_threshold_(segment_threshold)
+          , chunk_seq_(0)
+        {
+        }
+
+        connection_ptr create_connection(parcelset::locality const& dest,
+            parcelset::parcelport* pp, error_code& ec)
+        {
+            std::shared_ptr<peer> p = get_peer(dest.get<locality>().pid(), ec);
+            if (!p) return connection_ptr();
+
+            return std::make_shared<connection_type>(
+                this, std::move(p), dest, segment_threshold_, pp);
+        }
+
+        void add(connection_ptr const & ptr)
+        {
+            std::unique_lock<mutex_type> l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        std::uint64_t next_chunk_seq()
+        {
+            return ++chunk_seq_;
+        }
+
+        bool has_pending()
+        {
+            std::unique_lock<mutex_type> l(connections_mtx_);
+            return !connections_.empty();
+        }
+
+        // Returns whether the connection made progress, i.e. whether it
+        // wrote anything to its ring.
+        bool send_messages(
+            connection_ptr connection
+        )
+        {
+            // Check if sending has been completed....
+            if (connection->send())
+            {
+                error_code ec;
+                util::unique_function_nonser<
+                    void(
+                        error_code const&
+                      , parcelset::locality const&
+                      , connection_ptr
+                    )
+                > postprocess_handler;
+                std::swap(
+                    postprocess_handler, connection->postprocess_handler_);
+                postprocess_handler(
+                    ec, connection->destination(), connection);
+                return true;
+            }
+
+            // a connection waiting for a full ring or for another connection
+            // to the same destination makes no progress
+            bool const has_work = connection->bytes_written_ != 0;
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_);
+                connections_.push_back(std::move(connection));
+            }
+            return has_work;
+        }
+
+        // Give each waiting connection one chance to write to its ring,
+        // returns whether any of them made progress.
+        bool background_work()
+        {
+            std::size_t num_connections = 0;
+            {
+                std::unique_lock<mutex_type> l(
+                    connections_mtx_, std::try_to_lock);
+                if(!l) return false;
+                num_connections = connections_.size();
+            }
+
+            bool has_work = false;
+            for (/**/; num_connections != 0; --num_connections)
+            {
+                connection_ptr connection;
+                {
+                    std::unique_lock<mutex_type> l(connections_mtx_);
+                    if(connections_.empty()) break;
+                    connection = std::move(connections_.front());
+                    connections_.pop_front();
+                }
+                if (send_messages(std::move(connection)))
+                    has_work = true;
+            }
+            return has_work;
+        }
+
+    private:
+        std::shared_ptr<peer> get_peer(std::int32_t pid, error_code& ec)
+        {
+            std::unique_lock<mutex_type> l(peers_mtx_);
+
+            auto it = peers_.find(pid);
+            if (it != peers_.end())
+                return it->second;
+
+            auto p = std::make_shared<peer>();
+            p->connect(pid, ec);
+            if (ec) return std::shared_ptr<peer>();
+
+            peers_.emplace(pid, p);
+            return p;
+        }
+
+        std::size_t const segment_threshold_;
+        std::atomic<std::uint64_t> chunk_seq_;
+
+        mutex_type connections_mtx_;
+        connection_list connections_;
+
+        mutex_type peers_mtx_;
+        std::map<std::int32_t, std::shared_ptr<peer>> peers_;
+    };
+}}}}
+
+#endif
@@ -0,0 +1,375 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assert.hpp>
+#include <hpx/functional/unique_function.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/plugins/parcelport/shmem/header.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/runtime/parcelset_fwd.hpp>
+#include <hpx/serialization/serialization_chunk.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    struct sender;
+    struct sender_connection;
+
+    std::uint64_t next_chunk_seq(sender *);
+    void add_connection(sender *, std::shared_ptr<sender_connection> const&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The ring this locality claimed in the segment of a destination. The
+    // messages of all connections to that destination go through this ring,
+    // one message at a time.
+    struct peer
+    {
+        void connect(std::int32_t pid, error_code& ec)
+        {
+            segment_.open(segment_name(pid), ec);
+            if (ec) return;
+
+            std::size_t const i = segment_.claim_ring(ec);
+            if (ec) return;
+
+            ring_ = &segment_.ring(i);
+        }
+
+        bool try_acquire()
+        {
+            return !busy_.exchange(true, std::memory_order_acquire);
+        }
+
+        void release()
+        {
+            busy_.store(false, std::memory_order_release);
+        }
+
+        ring_buffer& ring()
+        {
+            HPX_ASSERT(ring_ != nullptr);
+            return *ring_;
+        }
+
+        void notify()
+        {
+            segment_.notify();
+        }
+
+    private:
+        segment segment_;
+        ring_buffer* ring_ = nullptr;
+        std::atomic<bool> busy_{false};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct sender_connection
+      : parcelset::parcelport_connection<
+            sender_connection
+          , std::vector<char>
+        >
+    {
+    private:
+        typedef sender sender_type;
+
+        typedef std::vector<char> data_type;
+        typedef parcel_buffer_type::transmission_chunk_type
+            transmission_chunk_type;
+
+        enum connection_state
+        {
+            initialized
+          , sending_header
+          , sending_transmission_chunks
+          , sending_data
+          , sending_chunks
+        };
+
+        enum chunk_state
+        {
+            chunk_sending_seq
+          , chunk_sending_data
+        };
+
+        typedef
+            parcelset::parcelport_connection<sender_connection, data_type>
+            base_type;
+
+    public:
+        sender_connection(sender_type* s, std::shared_ptr<peer> p,
+                parcelset::locality const& there,
+                std::size_t segment_threshold, parcelset::parcelport* pp)
+          : state_(initialized)
+          , sender_(s)
+          , peer_(std::move(p))
+          , segment_threshold_(segment_threshold)
+          , offset_(0)
+          , bytes_written_(0)
+          , chunks_idx_(0)
+          , chunk_state_(chunk_sending_seq)
+          , pp_(pp)
+          , there_(there)
+        {
+        }
+
+        parcelset::locality const& destination() const
+        {
+            return there_;
+        }
+
+        void verify_(parcelset::locality const& /* parcel_locality_id */) const
+        {
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(
+            Handler&& handler, ParcelPostprocess&& parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+            buffer_.data_point_.time_ =
+                hpx::chrono::high_resolution_clock::now();
+            header_ = header(buffer_);
+            chunks_idx_ = 0;
+            chunk_state_ = chunk_sending_seq;
+            offset_ = 0;
+
+            state_ = initialized;
+
+            handler_ = std::forward<Handler>(handler);
+
+            // The large chunks are exported before anything is written to
+            // the ring, a failure leaves the ring untouched.
+            error_code ec(lightweight);
+            export_chunks(ec);
+            if (ec)
+            {
+                handler_(ec);
+                handler_.reset();
+                buffer_.clear();
+                parcel_postprocess(ec, there_, shared_from_this());
+                return;
+            }
+
+            if(!send())
+            {
+                postprocess_handler_
+                    = std::forward<ParcelPostprocess>(parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                error_code ec;
+                parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        // Write as much of the message as fits into the ring, returns true
+        // once the whole message was written. The number of bytes written
+        // by the call is left in bytes_written_.
+        bool send()
+        {
+            bytes_written_ = 0;
+            if (state_ == initialized)
+            {
+                // wait for other connections to finish their messages
+                if (!peer_->try_acquire()) return false;
+                state_ = sending_header;
+            }
+
+            bool const completed = send_message();
+            if (bytes_written_ != 0)
+            {
+                peer_->notify();
+            }
+            return completed;
+        }
+
+        bool send_message()
+        {
+            switch (state_)
+            {
+            case sending_header:
+                if (!write(&header_, sizeof(header_))) return false;
+                state_ = sending_transmission_chunks;
+                HPX_FALLTHROUGH;
+
+            case sending_transmission_chunks:
+                if (!write(buffer_.transmission_chunks_.data(),
+                        buffer_.transmission_chunks_.size() *
+                            sizeof(transmission_chunk_type)))
+                {
+                    return false;
+                }
+                state_ = sending_data;
+                HPX_FALLTHROUGH;
+
+            case sending_data:
+                if (!write(buffer_.data_.data(), buffer_.data_.size()))
+                    return false;
+                state_ = sending_chunks;
+                HPX_FALLTHROUGH;
+
+            case sending_chunks:
+                if (!send_chunks()) return false;
+                return done();
+
+            default:
+                HPX_ASSERT(false);
+            }
+            return false;
+        }
+
+        bool send_chunks()
+        {
+            while (chunks_idx_ < buffer_.chunks_.size())
+            {
+                serialization::serialization_chunk& c =
+                    buffer_.chunks_[chunks_idx_];
+                if (c.type_ != serialization::chunk_type_pointer)
+                {
+                    ++chunks_idx_;
+                    continue;
+                }
+
+                std::uint64_t const& seq = chunk_seqs_[chunks_idx_];
+                if (chunk_state_ == chunk_sending_seq)
+                {
+                    if (!write(&seq, sizeof(seq))) return false;
+                    chunk_state_ = chunk_sending_data;
+                }
+
+                if (seq == 0 && !write(c.data_.cpos_, c.size_))
+                    return false;
+
+                chunk_state_ = chunk_sending_seq;
+                ++chunks_idx_;
+            }
+            return true;
+        }
+
+        // Large chunks are handed over through a segment of their own
+        // instead of being streamed through the ring. The sequence number of
+        // the segment is sent in place of the data, zero if the chunk is
+        // streamed.
+        void export_chunks(error_code& ec)
+        {
+            chunk_seqs_.assign(buffer_.chunks_.size(), 0);
+            for (std::size_t i = 0; i != buffer_.chunks_.size(); ++i)
+            {
+                serialization::serialization_chunk const& c =
+                    buffer_.chunks_[i];
+                if (c.type_ != serialization::chunk_type_pointer ||
+                    c.size_ < segment_threshold_)
+                {
+                    continue;
+                }
+
+                std::uint64_t const seq = next_chunk_seq(sender_);
+                export_chunk(
+                    chunk_name(process_id(), seq), c.data_.cpos_, c.size_, ec);
+                if (ec)
+                {
+                    // nobody is going to receive the chunks exported so far
+                    for (std::size_t j = 0; j != i; ++j)
+                    {
+                        if (chunk_seqs_[j] != 0)
+                        {
+                            remove_chunk(
+                                chunk_name(process_id(), chunk_seqs_[j]));
+                        }
+                    }
+                    return;
+                }
+                chunk_seqs_[i] = seq;
+            }
+        }
+
+        bool done()
+        {
+            peer_->release();
+
+            error_code ec;
+            handler_(ec);
+            handler_.reset();
+            buffer_.data_point_.time_ =
+                hpx::chrono::high_resolution_clock::now() -
+                buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+            buffer_.clear();
+
+            state_ = initialized;
+
+            return true;
+        }
+
+        // Write the remaining part of the given item to the ring, returns
+        // whether the item was written completely.
+        bool write(void const* data, std::size_t size)
+        {
+            std::size_t const n = peer_->ring().write(
+                static_cast<char const*>(data) + offset_, size - offset_);
+            offset_ += n;
+            bytes_written_ += n;
+
+            if (offset_ != size) return false;
+
+            offset_ = 0;
+            return true;
+        }
+
+        connection_state state_;
+        sender_type * sender_;
+        std::shared_ptr<peer> peer_;
+        std::size_t segment_threshold_;
+
+        std::size_t offset_;
+        std::size_t bytes_written_;
+        std::size_t chunks_idx_;
+        chunk_state chunk_state_;
+        std::vector<std::uint64_t> chunk_seqs_;
+
+        util::unique_function_nonser<
+            void(
+                error_code const&
+            )
+        > handler_;
+        util::unique_function_nonser<
+            void(
+                error_code const&
+              , parcelset::locality const&
+              , std::shared_ptr<sender_connection>
+            )
+        > postprocess_handler_;
+
+        header header_;
+
+        parcelset::parcelport* pp_;
+
+        parcelset::locality there_;
+    };
+}}}}
+
+#endif
@@ -25,6 +25,7 @@
 #include <hpx/runtime/parcelset/detail/data_point.hpp>
 #include <hpx/runtime/parcelset/detail/gatherer.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/serialization/detail/buffer_pool.hpp>
 #include <hpx/timing/high_resolution_timer.hpp>
 
 #include <asio/buffer.hpp>
@@ -200,7 +201,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                             sizeof(transmission_chunk_type)));
 
                     // add main buffer holding data which was serialized normally
-                    buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+                    serialization::detail::resize_buffer(buffer_.data_,
+                        static_cast<std::size_t>(inbound_size));
                     buffers.push_back(asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
@@ -208,7 +210,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 }
                 else {
                     // add main buffer holding data which was serialized normally
-                    buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+                    serialization::detail::resize_buffer(buffer_.data_,
+                        static_cast<std::size_t>(inbound_size));
                     buffers.push_back(asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
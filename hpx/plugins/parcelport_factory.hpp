@@ -109,6 +109,10 @@ namespace hpx { namespace plugins {
                 name_uc +
                 "_ZERO_COPY_OPTIMIZATION:"
                 "$[hpx.parcel.zero_copy_optimization]}");
+            fillini.emplace_back(
+                "zero_copy_serialization_threshold = ${HPX_PARCEL_" + name_uc +
+                "_ZERO_COPY_SERIALIZATION_THRESHOLD:"
+                "$[hpx.parcel.zero_copy_serialization_threshold]}");
             fillini.emplace_back("async_serialization = ${HPX_PARCEL_" +
                 name_uc +
                 "_ASYNC_SERIALIZATION:"
@@ -22,6 +22,7 @@
 #include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/runtime_distributed/runtime_fwd.hpp>
 #include <hpx/runtime_local/report_error.hpp>
+#include <hpx/serialization/detail/buffer_pool.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/timing/high_resolution_timer.hpp>
 
@@ -33,16 +34,24 @@
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <system_error>
 #include <utility>
 #include <vector>
 
 namespace hpx { namespace parcelset
 {
+    // If chunk_owners is given, the received zero-copy chunks are moved into
+    // separately owned objects (stored at the index of the corresponding
+    // serialization chunk). This allows for the de-serialized data to adopt
+    // the received memory instead of copying it.
     template <typename Buffer>
-    std::vector<serialization::serialization_chunk> decode_chunks(Buffer & buffer)
+    std::vector<serialization::serialization_chunk> decode_chunks(
+        Buffer & buffer,
+        std::vector<std::shared_ptr<void>>* chunk_owners = nullptr)
     {
         typedef typename Buffer::transmission_chunk_type transmission_chunk_type;
+        typedef typename decltype(buffer.chunks_)::value_type chunk_type;
 
         std::vector<serialization::serialization_chunk> chunks;
 
@@ -58,6 +67,11 @@ namespace hpx { namespace parcelset
                     static_cast<std::uint32_t>(buffer.num_chunks_.second));
 
             chunks.resize(num_zero_copy_chunks + num_non_zero_copy_chunks);
+            if (chunk_owners != nullptr)
+            {
+                chunk_owners->clear();
+                chunk_owners->resize(chunks.size());
+            }
 
             // place the zero-copy chunks at their spots first
             for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
@@ -70,8 +84,20 @@ namespace hpx { namespace parcelset
 
                 HPX_ASSERT(buffer.chunks_[i].size() == second);
 
-                chunks[first] = serialization::create_pointer_chunk(
+                if (chunk_owners != nullptr)
+                {
+                    // moving the chunk leaves its data where it is
+                    auto owner = std::make_shared<chunk_type>(
+                        std::move(buffer.chunks_[i]));
+                    chunks[first] = serialization::create_pointer_chunk(
+                        owner->data(), second);
+                    (*chunk_owners)[first] = std::move(owner);
+                }
+                else
+                {
+                    chunks[first] = serialization::create_pointer_chunk(
                         buffer.chunks_[i].data(), second);
+                }
             }
 
             std::size_t index = 0;
@@ -115,6 +141,7 @@ namespace hpx { namespace parcelset
       , std::size_t parcel_count
       , std::vector<serialization::serialization_chunk> &chunks
       , std::size_t num_thread = -1
+      , std::vector<std::shared_ptr<void>> const* chunk_owners = nullptr
     )
     {
         std::size_t inbound_data_size = static_cast<std::size_t>(
@@ -133,7 +160,7 @@ namespace hpx { namespace parcelset
                     std::vector<parcel> deferred_parcels;
                     // De-serialize the parcel data
                     serialization::input_archive archive(buffer.data_,
-                        inbound_data_size, &chunks);
+                        inbound_data_size, &chunks, chunk_owners);
 
                     if(parcel_count == 0)
                     {
@@ -238,6 +265,10 @@ namespace hpx { namespace parcelset
                     overall_add_parcel_time;
 
                 pp.add_received_data(data);
+
+                // the received data is not referenced anymore, allow for it
+                // to be reused
+                serialization::detail::release_buffer(buffer.data_);
             }
             catch (hpx::exception const& e) {
                 LPT_(error).format(
@@ -279,10 +310,11 @@ namespace hpx { namespace parcelset
       , std::size_t num_thread = -1
     )
     {
+        std::vector<std::shared_ptr<void>> chunk_owners;
         std::vector<serialization::serialization_chunk>
-            chunks(decode_chunks(buffer));
+            chunks(decode_chunks(buffer, &chunk_owners));
         decode_message_with_chunks(pp, std::move(buffer),
-            parcel_count, chunks, num_thread);
+            parcel_count, chunks, num_thread, &chunk_owners);
     }
 
     template <typename Parcelport, typename Buffer>
@@ -25,6 +25,7 @@
 #include <hpx/runtime/parcelset_fwd.hpp>
 #include <hpx/runtime_distributed/runtime_fwd.hpp>
 #include <hpx/runtime_local/report_error.hpp>
+#include <hpx/serialization/detail/buffer_pool.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/timing/high_resolution_timer.hpp>
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -175,7 +176,11 @@ namespace hpx
                         num_chunks += ps[parcels_sent].num_chunks();
                     }
 
-                    buffer.data_.reserve(arg_size);
+                    // the sizes of the parcels were computed while
+                    // preprocessing them, this avoids growing the buffer
+                    // during serialization
+                    serialization::detail::reserve_buffer(
+                        buffer.data_, arg_size);
 
                     buffer.chunks_.reserve(num_chunks);
 
@@ -189,7 +194,8 @@ namespace hpx
 
                         serialization::output_archive archive(
                             buffer.data_, archive_flags, &buffer.chunks_,
-                            filter.get());
+                            filter.get(),
+                            pp.get_zero_copy_serialization_threshold());
 
                         if (num_parcels != std::size_t(-1))
                             archive << parcels_sent; //-V128
@@ -321,6 +321,12 @@ namespace hpx { namespace parcelset
             return allow_zero_copy_optimizations_;
         }
 
+        /// Return the minimal size of arrays sent as zero copy chunks
+        std::size_t get_zero_copy_serialization_threshold() const
+        {
+            return zero_copy_serialization_threshold_;
+        }
+
         bool async_serialization() const
         {
             return async_serialization_;
@@ -368,6 +374,7 @@ namespace hpx { namespace parcelset
         /// serialization is allowed to use array optimization
         bool allow_array_optimizations_;
         bool allow_zero_copy_optimizations_;
+        std::size_t zero_copy_serialization_threshold_;
 
         /// async serialization of parcels
         bool async_serialization_;
@@ -11,10 +11,12 @@
 #include <hpx/cache/statistics/no_statistics.hpp>
 
 #include <algorithm>
-#include <deque>
+#include <cstddef>
 #include <functional>
 #include <map>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace util { namespace cache {
@@ -66,10 +68,10 @@ namespace hpx { namespace util { namespace cache {
         ///////////////////////////////////////////////////////////////////////
         // The UpdatePolicy Concept expects to get passed references to
         // instances of the Entry type. But our internal data structures hold
-        // a pointer to the stored entry only. We use the \a adapt function
-        // object to wrap any user supplied UpdatePolicy, dereferencing the
-        // pointers.
-        template <typename Func, typename Iterator>
+        // a pointer to the heap node referring to the stored entry only. We
+        // use the \a adapt function object to wrap any user supplied
+        // UpdatePolicy, dereferencing the pointers.
+        template <typename Func, typename Node>
         struct adapt
         {
             adapt(Func f)
@@ -77,9 +79,9 @@ namespace hpx { namespace util { namespace cache {
             {
             }
 
-            bool operator()(Iterator const& lhs, Iterator const& rhs) const
+            bool operator()(Node const* lhs, Node const* rhs) const
             {
-                return f_((*lhs).second, (*rhs).second);
+                return f_((*lhs->it_).second, (*rhs->it_).second);
             }
 
             Func f_;    // user supplied UpdatePolicy
@@ -101,10 +103,23 @@ namespace hpx { namespace util { namespace cache {
         typedef typename storage_type::iterator iterator;
         typedef typename storage_type::const_iterator const_iterator;
 
-        typedef std::deque<iterator> heap_type;
-        typedef typename heap_type::iterator heap_iterator;
+        // Every entry held in the cache has an associated heap node which
+        // knows its current position in the heap. This allows to restore the
+        // heap property in O(log n) whenever a single entry has changed.
+        struct heap_node
+        {
+            iterator it_;
+            std::size_t pos_;
+        };
+
+        typedef std::vector<heap_node*> heap_type;
+
+        // the heap nodes are indexed by the address of the stored entries,
+        // which is stable for all node based storage types
+        typedef std::unordered_map<storage_value_type const*, heap_node>
+            heap_index_type;
 
-        typedef adapt<UpdatePolicy, iterator> adapted_update_policy_type;
+        typedef adapt<UpdatePolicy, heap_node> adapted_update_policy_type;
 
         typedef typename statistics_type::update_on_exit update_on_exit;
 
@@ -141,6 +156,7 @@ namespace hpx { namespace util { namespace cache {
           , current_size_(other.current_size_)
           , store_(std::move(other.store_))
           , entry_heap_(std::move(other.entry_heap_))
+          , heap_index_(std::move(other.heap_index_))
           , update_policy_(std::move(other.update_policy_.f_))
           , insert_policy_(std::move(other.insert_policy_))
           , statistics_(std::move(other.statistics_))
@@ -245,8 +261,7 @@ namespace hpx { namespace util { namespace cache {
             if ((*it).second.touch())
             {
                 // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                heap_update(it);
             }
 
             // update statistics
@@ -288,8 +303,7 @@ namespace hpx { namespace util { namespace cache {
             if ((*it).second.touch())
             {
                 // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                heap_update(it);
             }
 
             // update statistics
@@ -330,8 +344,7 @@ namespace hpx { namespace util { namespace cache {
             if ((*it).second.touch())
             {
                 // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                heap_update(it);
             }
 
             // update statistics
@@ -419,9 +432,7 @@ namespace hpx { namespace util { namespace cache {
             current_size_ += entry_size;
 
             // update the entry heap
-            entry_heap_.push_back(p.first);
-            std::push_heap(
-                entry_heap_.begin(), entry_heap_.end(), update_policy_);
+            heap_push(p.first);
 
             // update statistics
             statistics_.got_insertion();
@@ -470,8 +481,7 @@ namespace hpx { namespace util { namespace cache {
             if ((*it).second.touch())
             {
                 // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                heap_update(it);
             }
 
             // update statistics
@@ -529,8 +539,7 @@ namespace hpx { namespace util { namespace cache {
             if ((*it).second.touch())
             {
                 // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                heap_update(it);
             }
 
             // update statistics
@@ -587,8 +596,7 @@ namespace hpx { namespace util { namespace cache {
             if ((*it).second.touch())
             {
                 // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                heap_update(it);
             }
 
             // update statistics
@@ -619,11 +627,9 @@ namespace hpx { namespace util { namespace cache {
             update_on_exit update(statistics_, statistics::method_erase_entry);
 
             size_type erased = 0;
-            for (heap_iterator it = entry_heap_.begin();
-                 it != entry_heap_.end();
-                /**/)
+            for (std::size_t pos = 0; pos != entry_heap_.size(); /**/)
             {
-                iterator sit = *it;
+                iterator sit = entry_heap_[pos]->it_;
 
                 // check if this item needs to be erased
                 // do not remove this entry from the cache if either the
@@ -633,13 +639,17 @@ namespace hpx { namespace util { namespace cache {
                 {
                     // update the current size and the overall size of the
                     // removed items
-                    size_type entry_size = (*(*it)).second.get_size();
+                    size_type entry_size = val.second.get_size();
                     current_size_ -= entry_size;
                     erased += entry_size;
 
                     // we remove the element manually, forcing the heap to be
                     // rebuilt at the end
-                    it = entry_heap_.erase(it);
+                    heap_node* last = entry_heap_.back();
+                    entry_heap_[pos] = last;
+                    last->pos_ = pos;
+                    entry_heap_.pop_back();
+                    heap_index_.erase(&val);
 
                     // remove the cache entry
                     store_.erase(sit);
@@ -650,13 +660,13 @@ namespace hpx { namespace util { namespace cache {
                 else
                 {
                     // do not remove this item from cache
-                    ++it;
+                    ++pos;
                 }
             }
 
             // reorder heap based on the changed entry list
-            std::make_heap(
-                entry_heap_.begin(), entry_heap_.end(), update_policy_);
+            if (erased != 0)
+                heap_rebuild();
 
             return erased;
         }
@@ -685,8 +695,9 @@ namespace hpx { namespace util { namespace cache {
         /// Unconditionally removes all stored entries from the cache.
         void clear()
         {
-            store_.clear();
             entry_heap_.clear();
+            heap_index_.clear();
+            store_.clear();
             statistics_.clear();
             current_size_ = 0;
         }
@@ -714,36 +725,30 @@ namespace hpx { namespace util { namespace cache {
             if (entry_heap_.empty())
                 return false;
 
-            bool is_heap = true;
-            for (heap_iterator it = entry_heap_.begin();
-                 num_free > 0 && it != entry_heap_.end();
+            for (std::size_t pos = 0;
+                 num_free > 0 && pos != entry_heap_.size();
                 /**/)
             {
-                iterator sit = *it;
+                iterator sit = entry_heap_[pos]->it_;
                 if (!(*sit).second.remove())
                 {
-                    ++it;    // do not remove this entry from the cache
+                    ++pos;    // do not remove this entry from the cache
                 }
                 else
                 {
-                    size_type entry_size = (*(*it)).second.get_size();
-
-                    if (it == entry_heap_.begin())
-                    {
-                        // if we're at the top of the list, just pop the item
-                        // this doesn't disturb the heap property of the heap
-                        ++it;
-                        std::pop_heap(entry_heap_.begin(), entry_heap_.end(),
-                            update_policy_);
-                        entry_heap_.pop_back();
-                    }
-                    else
-                    {
-                        // otherwise we remove the element manually, forcing
-                        // the heap to be rebuilt at the end
-                        it = entry_heap_.erase(it);
-                        is_heap = false;
-                    }
+                    size_type entry_size = (*sit).second.get_size();
+
+                    // if we're at the top of the heap, this pops the item;
+                    // otherwise the entry is replaced by the last item of
+                    // the heap which is then moved to its proper position
+                    heap_node* last = entry_heap_.back();
+                    bool const replaced = pos + 1 != entry_heap_.size();
+                    heap_erase(pos);
+
+                    // the last item has not been looked at yet, continue
+                    // with it if it moved before the current position
+                    if (replaced && last->pos_ < pos)
+                        pos = last->pos_;
 
                     // remove the cache entry
                     store_.erase(sit);
@@ -755,17 +760,111 @@ namespace hpx { namespace util { namespace cache {
                 }
             }
 
-            // reorder heap based on the changed entry list
-            if (!is_heap)
+            return num_free <= 0;
+        }
+
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        // Maintain the heap of entries. The entry on top of the heap is the
+        // one to be evicted first.
+        void heap_swap(std::size_t lhs, std::size_t rhs)
+        {
+            std::swap(entry_heap_[lhs], entry_heap_[rhs]);
+            entry_heap_[lhs]->pos_ = lhs;
+            entry_heap_[rhs]->pos_ = rhs;
+        }
+
+        bool heap_sift_up(std::size_t pos)
+        {
+            std::size_t const start = pos;
+            while (pos != 0)
             {
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                std::size_t parent = (pos - 1) / 2;
+                if (!update_policy_(entry_heap_[parent], entry_heap_[pos]))
+                    break;
+
+                heap_swap(parent, pos);
+                pos = parent;
             }
+            return pos != start;
+        }
 
-            return num_free <= 0;
+        void heap_sift_down(std::size_t pos)
+        {
+            std::size_t const size = entry_heap_.size();
+            while (true)
+            {
+                std::size_t top = pos;
+                std::size_t child = 2 * pos + 1;
+
+                if (child < size &&
+                    update_policy_(entry_heap_[top], entry_heap_[child]))
+                {
+                    top = child;
+                }
+                if (child + 1 < size &&
+                    update_policy_(entry_heap_[top], entry_heap_[child + 1]))
+                {
+                    top = child + 1;
+                }
+                if (top == pos)
+                    break;
+
+                heap_swap(pos, top);
+                pos = top;
+            }
+        }
+
+        void heap_push(iterator it)
+        {
+            heap_node& node =
+                heap_index_
+                    .emplace(&*it, heap_node{it, entry_heap_.size()})
+                    .first->second;
+
+            entry_heap_.push_back(&node);
+            heap_sift_up(node.pos_);
+        }
+
+        // the attributes of the given entry have changed
+        void heap_update(iterator it)
+        {
+            typename heap_index_type::iterator hit = heap_index_.find(&*it);
+            if (hit == heap_index_.end())
+                return;
+
+            std::size_t pos = (*hit).second.pos_;
+            if (!heap_sift_up(pos))
+                heap_sift_down(pos);
+        }
+
+        void heap_erase(std::size_t pos)
+        {
+            heap_node* node = entry_heap_[pos];
+            heap_node* last = entry_heap_.back();
+            entry_heap_.pop_back();
+
+            if (node != last)
+            {
+                entry_heap_[pos] = last;
+                last->pos_ = pos;
+                if (!heap_sift_up(pos))
+                    heap_sift_down(pos);
+            }
+
+            heap_index_.erase(&*node->it_);
+        }
+
+        void heap_rebuild()
+        {
+            std::make_heap(
+                entry_heap_.begin(), entry_heap_.end(), update_policy_);
+
+            std::size_t pos = 0;
+            for (heap_node* node : entry_heap_)
+                node->pos_ = pos++;
         }
 
-    private:
         size_type max_size_;        // cache capacity
         size_type current_size_;    // current cache size
         storage_type store_;        // the cache itself
@@ -773,6 +872,7 @@ namespace hpx { namespace util { namespace cache {
         // we store a list of pointers to the held keys in a std::heap which
         // is being sorted based on the criteria defined by the UpdatePolicy
         heap_type entry_heap_;
+        heap_index_type heap_index_;
 
         adapted_update_policy_type update_policy_;
         insert_policy_type insert_policy_;
@@ -0,0 +1,143 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the latency of cache hits of the local_cache for LRU and LFU entries
+// and compare it to the previous implementation which rebuilt the whole entry
+// heap on every touched entry.
+
+#include <hpx/cache/entries/lfu_entry.hpp>
+#include <hpx/cache/entries/lru_entry.hpp>
+#include <hpx/cache/local_cache.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// Minimal copy of the lookup path of the original local_cache
+template <typename Key, typename Entry>
+class rebuild_heap_cache
+{
+    typedef std::map<Key, Entry> storage_type;
+    typedef typename storage_type::iterator iterator;
+
+    struct adapt
+    {
+        bool operator()(iterator const& lhs, iterator const& rhs) const
+        {
+            return (*lhs).second < (*rhs).second;
+        }
+    };
+
+public:
+    void insert(Key const& k, typename Entry::value_type const& val)
+    {
+        entry_heap_.push_back(store_.emplace(k, Entry(val)).first);
+        std::push_heap(entry_heap_.begin(), entry_heap_.end(), adapt());
+    }
+
+    bool get_entry(Key const& k, typename Entry::value_type& val)
+    {
+        iterator it = store_.find(k);
+        if (it == store_.end())
+            return false;
+
+        if ((*it).second.touch())
+            std::make_heap(entry_heap_.begin(), entry_heap_.end(), adapt());
+
+        val = (*it).second.get();
+        return true;
+    }
+
+private:
+    storage_type store_;
+    std::deque<iterator> entry_heap_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Cache>
+double measure_hits(
+    Cache& cache, std::size_t num_entries, std::size_t iterations)
+{
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        cache.insert(i, i);
+    }
+
+    std::size_t sum = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        std::size_t val = 0;
+        cache.get_entry((i * 7919) % num_entries, val);
+        sum += val;
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    if (sum == std::size_t(-1))
+        std::cout << sum << std::endl;    // prevent optimizing the loop away
+
+    return std::chrono::duration<double, std::nano>(finish - start).count() /
+        iterations;
+}
+
+template <typename Entry>
+void test_hit_latency(
+    std::string const& name, std::size_t num_entries, std::size_t iterations)
+{
+    typedef hpx::util::cache::local_cache<std::size_t, Entry> cache_type;
+    typedef rebuild_heap_cache<std::size_t, Entry> rebuild_cache_type;
+
+    cache_type cache;
+    double t = measure_hits(cache, num_entries, iterations);
+
+    // the original implementation is O(n) per hit, limit the number of
+    // iterations for larger caches
+    rebuild_cache_type rebuild_cache;
+    double t_rebuild = measure_hits(rebuild_cache, num_entries,
+        (std::min)(iterations, std::size_t(100000000) / num_entries));
+
+    std::cout << name << ": entries = " << num_entries
+              << ", hit latency = " << t << " ns (rebuild heap: " << t_rebuild
+              << " ns)" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t iterations = 100000;
+    if (argc > 1)
+    {
+        try
+        {
+            iterations = hpx::util::from_string<std::size_t>(argv[1]);
+        }
+        catch (std::exception const& e)
+        {
+            std::cerr << "Error: " << e.what() << std::endl;
+            std::cerr << "usage: " << argv[0] << " [iterations]" << std::endl;
+            return -1;
+        }
+    }
+
+    typedef hpx::util::cache::entries::lru_entry<std::size_t> lru_entry;
+    typedef hpx::util::cache::entries::lfu_entry<std::size_t> lfu_entry;
+
+    for (std::size_t num_entries : {1000, 10000, 100000})
+    {
+        test_hit_latency<lru_entry>("lru", num_entries, iterations);
+        test_hit_latency<lfu_entry>("lfu", num_entries, iterations);
+    }
+
+    return 0;
+}
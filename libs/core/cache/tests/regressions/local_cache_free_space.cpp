@@ -0,0 +1,62 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Removing an entry from the middle of the heap moves the last entry into its
+// place. If that entry sifts up it has to be looked at again, otherwise
+// shrinking the cache fails even though there are removable entries left.
+
+#include <hpx/cache/entries/entry.hpp>
+#include <hpx/cache/local_cache.hpp>
+#include <hpx/modules/testing.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// entries holding an even value are pinned to the cache
+struct pinned_entry : hpx::util::cache::entries::entry<int, pinned_entry>
+{
+    using base_type = hpx::util::cache::entries::entry<int, pinned_entry>;
+
+    pinned_entry() = default;
+
+    explicit pinned_entry(int value)
+      : base_type(value)
+    {
+    }
+
+    bool remove()
+    {
+        return (get() % 2) != 0;
+    }
+};
+
+int main()
+{
+    using cache_type = hpx::util::cache::local_cache<int, pinned_entry>;
+
+    // inserted in this order the heap ends up as
+    //
+    //                   100
+    //           90               10
+    //       80      70       5       4
+    //     61
+    //
+    // removing 5 moves 61 into its place from where it sifts up
+    int const values[] = {100, 90, 10, 80, 70, 5, 4, 61};
+
+    cache_type c(8);
+    for (int value : values)
+    {
+        HPX_TEST(c.insert(value, value));
+    }
+    HPX_TEST_EQ(c.size(), static_cast<cache_type::size_type>(8));
+
+    // both removable entries have to go
+    HPX_TEST(c.reserve(6));
+    HPX_TEST_EQ(c.size(), static_cast<cache_type::size_type>(6));
+    HPX_TEST(!c.holds_key(5));
+    HPX_TEST(!c.holds_key(61));
+
+    return hpx::util::report_errors();
+}
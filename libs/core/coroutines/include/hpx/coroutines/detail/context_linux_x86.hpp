@@ -17,6 +17,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/coroutines/detail/get_stack_pointer.hpp>
+#include <hpx/coroutines/detail/posix_stack_pool.hpp>
 #include <hpx/coroutines/detail/posix_utility.hpp>
 #include <hpx/coroutines/detail/swap_context.hpp>
 #include <hpx/modules/format.hpp>
@@ -201,6 +202,7 @@ namespace hpx { namespace threads { namespace coroutines {
                         static_cast<std::ptrdiff_t>(default_stack_size) :
                         stack_size)
               , m_stack(nullptr)
+              , m_stack_pool(nullptr)
             {
             }
 
@@ -223,8 +225,8 @@ namespace hpx { namespace threads { namespace coroutines {
                         "stack size of {1} is invalid", m_stack_size));
                 }
 
-                m_stack =
-                    posix::alloc_stack(static_cast<std::size_t>(m_stack_size));
+                m_stack = posix::pool_alloc_stack(
+                    static_cast<std::size_t>(m_stack_size), m_stack_pool);
                 if (m_stack == nullptr)
                 {
                     throw std::runtime_error(
@@ -268,8 +270,8 @@ namespace hpx { namespace threads { namespace coroutines {
                     VALGRIND_STACK_DEREGISTER(
                         reinterpret_cast<std::size_t>(m_sp[valgrind_id_idx]));
 #endif
-                    posix::free_stack(
-                        m_stack, static_cast<std::size_t>(m_stack_size));
+                    posix::pool_free_stack(m_stack,
+                        static_cast<std::size_t>(m_stack_size), m_stack_pool);
                 }
             }
 
@@ -509,6 +511,7 @@ namespace hpx { namespace threads { namespace coroutines {
 
                         std::ptrdiff_t m_stack_size;
                         void* m_stack;
+                        posix::stack_pool* m_stack_pool;
 
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION) &&                               \
     !defined(HPX_HAVE_ADDRESS_SANITIZER)
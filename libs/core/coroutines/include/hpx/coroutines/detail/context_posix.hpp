@@ -162,6 +162,11 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 #endif    // generic Posix platform
 
 #include <hpx/coroutines/detail/get_stack_pointer.hpp>
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#define HPX_COROUTINE_POSIX_STACK_POOL
+#include <hpx/coroutines/detail/posix_stack_pool.hpp>
+#endif
 #include <hpx/coroutines/detail/posix_utility.hpp>
 #include <hpx/coroutines/detail/swap_context.hpp>
 #include <atomic>
@@ -232,6 +237,9 @@ namespace hpx { namespace threads { namespace coroutines {
               : m_stack_size(
                     stack_size == -1 ? this->default_stack_size : stack_size)
               , m_stack(nullptr)
+#if defined(HPX_COROUTINE_POSIX_STACK_POOL)
+              , m_stack_pool(nullptr)
+#endif
               , funp_(&trampoline<CoroutineImpl>)
             {
             }
@@ -241,7 +249,12 @@ namespace hpx { namespace threads { namespace coroutines {
                 if (m_stack != nullptr)
                     return;
 
+#if defined(HPX_COROUTINE_POSIX_STACK_POOL)
+                m_stack = pool_alloc_stack(
+                    static_cast<std::size_t>(m_stack_size), m_stack_pool);
+#else
                 m_stack = alloc_stack(static_cast<std::size_t>(m_stack_size));
+#endif
                 if (m_stack == nullptr)
                 {
                     throw std::runtime_error(
@@ -326,7 +339,14 @@ namespace hpx { namespace threads { namespace coroutines {
             ~ucontext_context_impl()
             {
                 if (m_stack)
+                {
+#if defined(HPX_COROUTINE_POSIX_STACK_POOL)
+                    pool_free_stack(m_stack,
+                        static_cast<std::size_t>(m_stack_size), m_stack_pool);
+#else
                     free_stack(m_stack, m_stack_size);
+#endif
+                }
             }
 
             // Return the size of the reserved stack address space.
@@ -418,6 +438,9 @@ namespace hpx { namespace threads { namespace coroutines {
             // declare m_stack_size first so we can use it to initialize m_stack
             std::ptrdiff_t m_stack_size;
             void* m_stack;
+#if defined(HPX_COROUTINE_POSIX_STACK_POOL)
+            posix::stack_pool* m_stack_pool;
+#endif
             void (*funp_)(void*);
 
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION)
@@ -0,0 +1,76 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/topology/cpu_mask.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+// The per-worker stack pool sits on top of posix::alloc_stack/free_stack. Each
+// OS-thread keeps a small LIFO cache of idle stacks for every stack size it
+// has seen. Stacks released to the pool keep their mapping (and their guard
+// page), so reusing them avoids the mmap/mprotect/munmap round-trip. Idle
+// stacks are trimmed using madvise(MADV_DONTNEED) instead of being unmapped.
+// Stacks released by a different OS-thread are handed back to the pool they
+// were allocated from, keeping them on the NUMA domain of their home pool.
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+    namespace posix {
+        // this global variable is used to control whether thread stacks will
+        // be recycled through the per-worker stack pools
+        HPX_CORE_EXPORT extern bool use_stack_pool;
+
+        // maximal number of idle stacks cached per OS-thread and stack size,
+        // any stack released beyond this limit is unmapped right away
+        HPX_CORE_EXPORT extern std::size_t stack_pool_max_cached;
+
+        // number of most recently released stacks per OS-thread and stack
+        // size which are never trimmed by trim_stack_pool()
+        HPX_CORE_EXPORT extern std::size_t stack_pool_min_resident;
+
+        // time (in milliseconds) a worker thread has to be idle before the
+        // idle stacks cached by it are trimmed
+        HPX_CORE_EXPORT extern std::size_t stack_pool_trim_delay;
+
+        // number of pages at the top of a newly allocated stack which are
+        // touched by the allocating OS-thread before handing out the stack
+        HPX_CORE_EXPORT extern std::size_t stack_pool_prefault_pages;
+
+        // Bind the stack pool of the calling OS-thread to the NUMA domain(s)
+        // covering the given PU mask. All stacks newly allocated by this
+        // OS-thread will be placed on those NUMA domains.
+        HPX_CORE_EXPORT void init_stack_pool(threads::mask_cref_type pu_mask);
+
+        // Release all stacks cached by the calling OS-thread.
+        HPX_CORE_EXPORT void deinit_stack_pool();
+
+        class stack_pool;
+
+        // Allocate a stack of the given size, preferably from the stack pool
+        // of the calling OS-thread. The pool the stack has to be returned to
+        // is stored in 'home' (nullptr if the stack does not belong to any
+        // pool).
+        HPX_CORE_EXPORT void* pool_alloc_stack(
+            std::size_t size, stack_pool*& home);
+
+        // Return a stack to its home pool, this may be called on any
+        // OS-thread. The stack is unmapped if the pool is full (or disabled).
+        HPX_CORE_EXPORT void pool_free_stack(
+            void* stack, std::size_t size, stack_pool* home);
+
+        // Give back the memory held by the idle stacks cached by the calling
+        // OS-thread (except for the stack_pool_min_resident most recently
+        // used ones) to the operating system. Returns the number of stacks
+        // which have been trimmed.
+        HPX_CORE_EXPORT std::size_t trim_stack_pool();
+
+        // Counters collected across all stack pools.
+        HPX_CORE_EXPORT std::int64_t get_stack_pool_hit_count(bool reset);
+        HPX_CORE_EXPORT std::int64_t get_stack_pool_miss_count(bool reset);
+        HPX_CORE_EXPORT std::int64_t get_stack_pool_trim_count(bool reset);
+}}}}}    // namespace hpx::threads::coroutines::detail::posix
@@ -149,6 +149,30 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
             return false;
         }
 
+        // Unconditionally give back all but the first (topmost) page of the
+        // given stack to the operating system. The mapping is left intact.
+        inline bool trim_stack(void* stack, std::size_t size)
+        {
+            HPX_ASSERT(size > EXEC_PAGESIZE);
+            return ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED) == 0;
+        }
+
+        // Touch the given number of pages at the top of the stack to make
+        // sure they are backed by physical memory local to the calling thread.
+        inline void prefault_stack(
+            void* stack, std::size_t size, std::size_t num_pages)
+        {
+            std::size_t const num_stack_pages = size / EXEC_PAGESIZE;
+            if (num_pages > num_stack_pages)
+                num_pages = num_stack_pages;
+
+            char* top = static_cast<char*>(stack) + size;
+            for (std::size_t i = 1; i <= num_pages; ++i)
+            {
+                *static_cast<char volatile*>(top - i * EXEC_PAGESIZE) = 0;
+            }
+        }
+
         inline void free_stack(void* stack, std::size_t size)
         {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
@@ -201,6 +225,16 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
             return false;
         }
 
+        inline bool trim_stack(void* stack, std::size_t size)
+        {
+            return false;
+        }
+
+        inline void prefault_stack(
+            void* stack, std::size_t size, std::size_t num_pages)
+        {
+        }    // no-op
+
         inline void free_stack(void* stack, std::size_t size)
         {
             delete[] static_cast<stack_aligner*>(stack);
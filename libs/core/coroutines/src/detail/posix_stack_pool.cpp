@@ -0,0 +1,385 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_stack_pool.hpp>
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/modules/topology.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+    namespace posix {
+        HPX_CORE_EXPORT bool use_stack_pool = true;
+        HPX_CORE_EXPORT std::size_t stack_pool_max_cached = 64;
+        HPX_CORE_EXPORT std::size_t stack_pool_min_resident = 4;
+        HPX_CORE_EXPORT std::size_t stack_pool_trim_delay = 10;
+        HPX_CORE_EXPORT std::size_t stack_pool_prefault_pages = 2;
+
+        namespace {
+            std::atomic<std::int64_t> stack_pool_hits(0);
+            std::atomic<std::int64_t> stack_pool_misses(0);
+            std::atomic<std::int64_t> stack_pool_trims(0);
+        }    // namespace
+
+        ///////////////////////////////////////////////////////////////////////
+        class stack_pool
+        {
+            struct cached_stack
+            {
+                void* stack_;
+                bool trimmed_;
+            };
+
+            struct bucket
+            {
+                std::size_t size_;
+                std::size_t num_untrimmed_;
+                std::vector<cached_stack> stacks_;
+            };
+
+            // Stacks released by other OS-threads are linked through a node
+            // placed at the top of the (unused) stack itself. The top page of
+            // a pooled stack is never trimmed.
+            struct remote_stack
+            {
+                remote_stack* next_;
+                std::size_t size_;
+            };
+
+        public:
+            stack_pool()
+              : remote_stacks_(nullptr)
+              , orphaned_(false)
+            {
+            }
+
+            stack_pool(stack_pool const&) = delete;
+            stack_pool& operator=(stack_pool const&) = delete;
+
+            void bind(threads::mask_cref_type pu_mask)
+            {
+                topology const& topo = create_topology();
+                if (topo.get_number_of_numa_nodes() > 1)
+                {
+                    nodeset_ = topo.cpuset_to_nodeset(pu_mask);
+                }
+            }
+
+            void* allocate(std::size_t size)
+            {
+                bucket& b = get_bucket(size);
+                if (b.stacks_.empty())
+                    collect_remote_stacks();
+
+                if (!b.stacks_.empty())
+                {
+                    // use the most recently released (hottest) stack
+                    cached_stack s = b.stacks_.back();
+                    b.stacks_.pop_back();
+                    if (!s.trimmed_)
+                        --b.num_untrimmed_;
+
+                    ++stack_pool_hits;
+                    return s.stack_;
+                }
+
+                ++stack_pool_misses;
+
+                void* stack = alloc_stack(size);
+                if (nodeset_)
+                {
+                    create_topology().set_area_membind_nodeset(
+                        stack, size, nodeset_->get_bmp());
+                }
+                prefault_stack(stack, size, stack_pool_prefault_pages);
+                return stack;
+            }
+
+            // called by the owning OS-thread only
+            bool deallocate(void* stack, std::size_t size)
+            {
+                bucket& b = get_bucket(size);
+                if (b.stacks_.size() >= stack_pool_max_cached)
+                    return false;
+
+                b.stacks_.push_back(cached_stack{stack, false});
+                ++b.num_untrimmed_;
+                return true;
+            }
+
+            // called by any other OS-thread, the stack is picked up by the
+            // owning OS-thread the next time it runs out of stacks
+            void deallocate_remote(void* stack, std::size_t size)
+            {
+                if (orphaned_.load(std::memory_order_acquire))
+                {
+                    free_stack(stack, size);
+                    return;
+                }
+
+                remote_stack* node = ::new (static_cast<char*>(stack) + size -
+                    sizeof(remote_stack)) remote_stack{nullptr, size};
+
+                remote_stack* head =
+                    remote_stacks_.load(std::memory_order_relaxed);
+                do
+                {
+                    node->next_ = head;
+                } while (!remote_stacks_.compare_exchange_weak(head, node,
+                    std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            std::size_t trim()
+            {
+                collect_remote_stacks();
+
+                std::size_t trimmed = 0;
+                for (bucket& b : buckets_)
+                {
+                    if (b.num_untrimmed_ <= stack_pool_min_resident)
+                        continue;
+
+                    // the oldest stacks are at the front of the cache
+                    for (cached_stack& s : b.stacks_)
+                    {
+                        if (b.num_untrimmed_ <= stack_pool_min_resident)
+                            break;
+
+                        if (!s.trimmed_)
+                        {
+                            trim_stack(s.stack_, b.size_);
+                            s.trimmed_ = true;
+                            --b.num_untrimmed_;
+                            ++trimmed;
+                        }
+                    }
+                }
+
+                if (trimmed != 0)
+                    stack_pool_trims += trimmed;
+                return trimmed;
+            }
+
+            void release()
+            {
+                collect_remote_stacks();
+                for (bucket& b : buckets_)
+                {
+                    for (cached_stack& s : b.stacks_)
+                        free_stack(s.stack_, b.size_);
+                }
+                buckets_.clear();
+            }
+
+            // The owning OS-thread exits, stacks released afterwards are
+            // unmapped right away. A stack released concurrently might still
+            // end up in the list of remote stacks, those are recovered once
+            // the pool is adopted by another OS-thread.
+            void orphan()
+            {
+                release();
+                orphaned_.store(true, std::memory_order_release);
+                release();
+                nodeset_.reset();
+            }
+
+            void adopt()
+            {
+                orphaned_.store(false, std::memory_order_release);
+            }
+
+        private:
+            bucket& get_bucket(std::size_t size)
+            {
+                // there are only very few distinct stack sizes in use
+                for (bucket& b : buckets_)
+                {
+                    if (b.size_ == size)
+                        return b;
+                }
+                buckets_.push_back(bucket{size, 0, {}});
+                return buckets_.back();
+            }
+
+            void collect_remote_stacks()
+            {
+                if (remote_stacks_.load(std::memory_order_relaxed) == nullptr)
+                    return;
+
+                remote_stack* node =
+                    remote_stacks_.exchange(nullptr, std::memory_order_acquire);
+                while (node != nullptr)
+                {
+                    remote_stack* next = node->next_;
+                    std::size_t const size = node->size_;
+                    void* stack = reinterpret_cast<char*>(node) +
+                        sizeof(remote_stack) - size;
+
+                    if (!deallocate(stack, size))
+                        free_stack(stack, size);
+
+                    node = next;
+                }
+            }
+
+            std::vector<bucket> buckets_;
+            threads::hwloc_bitmap_ptr nodeset_;
+            std::atomic<remote_stack*> remote_stacks_;
+            std::atomic<bool> orphaned_;
+        };
+
+        namespace {
+            // Pools are never destroyed as stacks may be returned to their
+            // home pool at any time. The pools of exited OS-threads are reused
+            // by newly created OS-threads instead.
+            struct orphaned_stack_pools
+            {
+                std::mutex mtx_;
+                std::vector<stack_pool*> pools_;
+            };
+
+            orphaned_stack_pools& get_orphaned_stack_pools()
+            {
+                static orphaned_stack_pools* pools = new orphaned_stack_pools;
+                return *pools;
+            }
+
+            // Stacks may still be released while the OS-thread is shutting
+            // down, after its pool has been orphaned. This pointer is
+            // trivially destructible and therefore stays valid.
+            thread_local stack_pool* this_thread_stack_pool = nullptr;
+            thread_local bool stack_pool_destroyed = false;
+
+            struct thread_stack_pool
+            {
+                thread_stack_pool()
+                  : pool_(nullptr)
+                {
+                    orphaned_stack_pools& orphans = get_orphaned_stack_pools();
+                    {
+                        std::lock_guard<std::mutex> l(orphans.mtx_);
+                        if (!orphans.pools_.empty())
+                        {
+                            pool_ = orphans.pools_.back();
+                            orphans.pools_.pop_back();
+                        }
+                    }
+
+                    if (pool_ != nullptr)
+                        pool_->adopt();
+                    else
+                        pool_ = new stack_pool;
+
+                    this_thread_stack_pool = pool_;
+                }
+
+                ~thread_stack_pool()
+                {
+                    this_thread_stack_pool = nullptr;
+                    stack_pool_destroyed = true;
+
+                    pool_->orphan();
+
+                    orphaned_stack_pools& orphans = get_orphaned_stack_pools();
+                    std::lock_guard<std::mutex> l(orphans.mtx_);
+                    orphans.pools_.push_back(pool_);
+                }
+
+                stack_pool* pool_;
+            };
+
+            stack_pool* get_stack_pool()
+            {
+                if (stack_pool_destroyed)
+                    return nullptr;
+
+                static thread_local thread_stack_pool pool;
+                return pool.pool_;
+            }
+        }    // namespace
+
+        ///////////////////////////////////////////////////////////////////////
+        void init_stack_pool(threads::mask_cref_type pu_mask)
+        {
+            if (!use_stack_pool || !threads::any(pu_mask))
+                return;
+
+            if (stack_pool* pool = get_stack_pool())
+                pool->bind(pu_mask);
+        }
+
+        void deinit_stack_pool()
+        {
+            if (stack_pool* pool = this_thread_stack_pool)
+                pool->release();
+        }
+
+        void* pool_alloc_stack(std::size_t size, stack_pool*& home)
+        {
+            if (use_stack_pool)
+            {
+                if (stack_pool* pool = get_stack_pool())
+                {
+                    home = pool;
+                    return pool->allocate(size);
+                }
+            }
+
+            home = nullptr;
+            return alloc_stack(size);
+        }
+
+        void pool_free_stack(void* stack, std::size_t size, stack_pool* home)
+        {
+            if (home == nullptr)
+            {
+                free_stack(stack, size);
+            }
+            else if (home == this_thread_stack_pool)
+            {
+                if (!home->deallocate(stack, size))
+                    free_stack(stack, size);
+            }
+            else
+            {
+                // keep the stack on the NUMA domain it was placed on
+                home->deallocate_remote(stack, size);
+            }
+        }
+
+        std::size_t trim_stack_pool()
+        {
+            if (stack_pool* pool = this_thread_stack_pool)
+                return pool->trim();
+            return 0;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::int64_t get_stack_pool_hit_count(bool reset)
+        {
+            return util::get_and_reset_value(stack_pool_hits, reset);
+        }
+
+        std::int64_t get_stack_pool_miss_count(bool reset)
+        {
+            return util::get_and_reset_value(stack_pool_misses, reset);
+        }
+
+        std::int64_t get_stack_pool_trim_count(bool reset)
+        {
+            return util::get_and_reset_value(stack_pool_trims, reset);
+        }
+}}}}}    // namespace hpx::threads::coroutines::detail::posix
+#endif
@@ -0,0 +1,136 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_stack_pool.hpp>
+#include <hpx/coroutines/detail/posix_utility.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+
+std::size_t const stack_size = 16 * EXEC_PAGESIZE;
+
+void touch_stack(void* stack)
+{
+    std::memset(stack, 0xcd, stack_size);
+}
+
+// a stack released by the allocating OS-thread is reused right away
+void test_local_reuse()
+{
+    posix::stack_pool* home = nullptr;
+    void* stack = posix::pool_alloc_stack(stack_size, home);
+    HPX_TEST(stack != nullptr);
+    HPX_TEST(home != nullptr);
+    touch_stack(stack);
+
+    posix::pool_free_stack(stack, stack_size, home);
+
+    std::int64_t const hits = posix::get_stack_pool_hit_count(false);
+
+    posix::stack_pool* home2 = nullptr;
+    void* stack2 = posix::pool_alloc_stack(stack_size, home2);
+    HPX_TEST_EQ(stack, stack2);
+    HPX_TEST_EQ(home, home2);
+    HPX_TEST_EQ(posix::get_stack_pool_hit_count(false), hits + 1);
+    touch_stack(stack2);
+
+    posix::pool_free_stack(stack2, stack_size, home2);
+}
+
+// a stack released by another OS-thread is returned to its home pool
+void test_remote_release()
+{
+    posix::stack_pool* home = nullptr;
+    void* stack = posix::pool_alloc_stack(stack_size, home);
+    touch_stack(stack);
+
+    std::thread t([&]() {
+        posix::pool_free_stack(stack, stack_size, home);
+
+        // the stack was not added to the pool of this OS-thread
+        posix::stack_pool* other = nullptr;
+        void* other_stack = posix::pool_alloc_stack(stack_size, other);
+        HPX_TEST(other_stack != stack);
+        HPX_TEST(other != home);
+        touch_stack(other_stack);
+
+        posix::pool_free_stack(other_stack, stack_size, other);
+    });
+    t.join();
+
+    posix::stack_pool* home2 = nullptr;
+    void* stack2 = posix::pool_alloc_stack(stack_size, home2);
+    HPX_TEST_EQ(stack, stack2);
+    HPX_TEST_EQ(home, home2);
+    touch_stack(stack2);
+
+    posix::pool_free_stack(stack2, stack_size, home2);
+}
+
+// stacks may outlive the OS-thread which allocated them
+void test_thread_exit()
+{
+    posix::stack_pool* home = nullptr;
+    void* stack = nullptr;
+
+    std::thread t([&]() {
+        stack = posix::pool_alloc_stack(stack_size, home);
+        touch_stack(stack);
+    });
+    t.join();
+
+    HPX_TEST(stack != nullptr);
+    touch_stack(stack);
+    posix::pool_free_stack(stack, stack_size, home);
+
+    // the pool of the exited OS-thread is reused
+    std::thread t2([&]() {
+        posix::stack_pool* home2 = nullptr;
+        void* stack2 = posix::pool_alloc_stack(stack_size, home2);
+        HPX_TEST(stack2 != nullptr);
+        touch_stack(stack2);
+        posix::pool_free_stack(stack2, stack_size, home2);
+    });
+    t2.join();
+}
+
+void test_disabled()
+{
+    posix::use_stack_pool = false;
+
+    posix::stack_pool* home = nullptr;
+    void* stack = posix::pool_alloc_stack(stack_size, home);
+    HPX_TEST(home == nullptr);
+    touch_stack(stack);
+    posix::pool_free_stack(stack, stack_size, home);
+
+    posix::use_stack_pool = true;
+}
+
+int main()
+{
+    test_local_reuse();
+    test_remote_release();
+    test_thread_exit();
+    test_disabled();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return hpx::util::report_errors();
+}
+#endif
@@ -68,6 +68,8 @@ namespace hpx { namespace filesystem {
 
 #include <boost/filesystem.hpp>
 
+#include <cstdint>
+#include <ctime>
 #include <system_error>
 
 static_assert(BOOST_FILESYSTEM_VERSION == 3,
@@ -95,5 +97,24 @@ namespace hpx { namespace filesystem {
         return is_regular_file(p, compat_error_code(ec));
     }
 
+    using boost::filesystem::file_size;
+    inline std::uintmax_t file_size(path const& p, std::error_code& ec) noexcept
+    {
+        return file_size(p, compat_error_code(ec));
+    }
+
+    using boost::filesystem::last_write_time;
+    inline std::time_t last_write_time(
+        path const& p, std::error_code& ec) noexcept
+    {
+        return last_write_time(p, compat_error_code(ec));
+    }
+
+    using boost::filesystem::create_directories;
+    inline bool create_directories(path const& p, std::error_code& ec) noexcept
+    {
+        return create_directories(p, compat_error_code(ec));
+    }
+
 }}    // namespace hpx::filesystem
 #endif
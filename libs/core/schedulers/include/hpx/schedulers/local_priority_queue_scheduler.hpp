@@ -22,7 +22,9 @@
 #include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/topology/topology.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 
+#include <array>
 #include <atomic>
 #include <cmath>
 #include <cstddef>
@@ -123,7 +125,7 @@ namespace hpx { namespace threads { namespace policies {
           , low_priority_queue_(0, thread_queue_init_)
           , queues_(num_queues_)
           , high_priority_queues_(num_queues_)
-          , victim_threads_(num_queues_)
+          , victims_(num_queues_)
         {
             if (!deferred_initialization)
             {
@@ -555,6 +557,84 @@ namespace hpx { namespace threads { namespace policies {
             queues_[num_thread].data_->create_thread(data, id, ec);
         }
 
+        // Create a batch of new threads. Consecutive threads targeting the
+        // same queue are enqueued at once. Threads without a thread hint are
+        // distributed across all queues in contiguous chunks.
+        void create_threads_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            if (count == 0)
+                return;
+
+            // NOTE: This scheduler ignores NUMA hints.
+            std::size_t const chunk_size =
+                (count + num_queues_ - 1) / num_queues_;
+            std::size_t const first_queue =
+                curr_queue_.fetch_add((count + chunk_size - 1) / chunk_size);
+
+            auto is_normal_priority = [](thread_init_data const& d) {
+                return d.priority != thread_priority::high_recursive &&
+                    d.priority != thread_priority::high &&
+                    d.priority != thread_priority::boost &&
+                    d.priority != thread_priority::low;
+            };
+
+            auto get_queue = [&](std::size_t i) {
+                std::size_t num_thread =
+                    data[i].schedulehint.mode ==
+                        thread_schedule_hint_mode::thread ?
+                    data[i].schedulehint.hint :
+                    std::size_t(-1);
+
+                if (std::size_t(-1) == num_thread)
+                {
+                    return (first_queue + i / chunk_size) % num_queues_;
+                }
+                return num_thread % num_queues_;
+            };
+
+            std::size_t i = 0;
+            while (i != count)
+            {
+                if (!is_normal_priority(data[i]))
+                {
+                    create_thread(data[i], nullptr, ec);
+                    if (ec)
+                        return;
+                    ++i;
+                    continue;
+                }
+
+                // find all consecutive threads for the same queue
+                std::size_t num_thread = get_queue(i);
+                std::size_t end = i + 1;
+                while (end != count && is_normal_priority(data[end]) &&
+                    get_queue(end) == num_thread)
+                {
+                    ++end;
+                }
+
+                std::unique_lock<pu_mutex_type> l;
+                num_thread = select_active_pu(l, num_thread);
+
+                for (std::size_t j = i; j != end; ++j)
+                {
+                    data[j].schedulehint.mode =
+                        thread_schedule_hint_mode::thread;
+                    data[j].schedulehint.hint =
+                        static_cast<std::int16_t>(num_thread);
+                }
+
+                HPX_ASSERT(num_thread < num_queues_);
+                queues_[num_thread].data_->create_threads_bulk(
+                    data + i, end - i, ec);
+                if (ec)
+                    return;
+
+                i = end;
+            }
+        }
+
         /// Return the next thread to be executed, return false if none is
         /// available
         bool get_next_thread(std::size_t num_thread, bool running,
@@ -597,12 +677,8 @@ namespace hpx { namespace threads { namespace policies {
                 return false;
             }
 
-            if (enable_stealing)
-            {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
-                {
-                    HPX_ASSERT(idx != num_thread);
-
+            if (enable_stealing &&
+                steal_from_victims(num_thread, [&](std::size_t idx) {
                     if (idx < num_high_priority_queues_ &&
                         num_thread < num_high_priority_queues_)
                     {
@@ -622,7 +698,10 @@ namespace hpx { namespace threads { namespace policies {
                         this_queue->increment_num_stolen_to_pending();
                         return true;
                     }
-                }
+                    return false;
+                }))
+            {
+                return true;
             }
 
             return low_priority_queue_.get_next_thread(thrd);
@@ -1063,12 +1142,8 @@ namespace hpx { namespace threads { namespace policies {
                 return true;
             }
 
-            if (enable_stealing)
-            {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
-                {
-                    HPX_ASSERT(idx != num_thread);
-
+            if (enable_stealing &&
+                steal_from_victims(num_thread, [&](std::size_t idx) {
                     if (idx < num_high_priority_queues_ &&
                         num_thread < num_high_priority_queues_)
                     {
@@ -1082,7 +1157,7 @@ namespace hpx { namespace threads { namespace policies {
                             q->increment_num_stolen_from_staged(added);
                             this_high_priority_queue
                                 ->increment_num_stolen_to_staged(added);
-                            return result;
+                            return true;
                         }
                     }
 
@@ -1095,9 +1170,12 @@ namespace hpx { namespace threads { namespace policies {
                         queues_[idx].data_->increment_num_stolen_from_staged(
                             added);
                         this_queue->increment_num_stolen_to_staged(added);
-                        return result;
+                        return true;
                     }
-                }
+                    return false;
+                }))
+            {
+                return result;
             }
 
 #ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
@@ -1177,13 +1255,15 @@ namespace hpx { namespace threads { namespace policies {
             std::size_t num_threads = num_queues_;
             auto const& topo = create_topology();
 
-            // get NUMA domain masks of all queues...
+            // get NUMA domain, cache, and core masks of all queues...
             std::vector<mask_type> numa_masks(num_threads);
+            std::vector<mask_type> cache_masks(num_threads);
             std::vector<mask_type> core_masks(num_threads);
             for (std::size_t i = 0; i != num_threads; ++i)
             {
                 std::size_t num_pu = affinity_data_.get_pu_num(i);
                 numa_masks[i] = topo.get_numa_node_affinity_mask(num_pu);
+                cache_masks[i] = topo.get_cache_affinity_mask(num_pu);
                 core_masks[i] = topo.get_core_affinity_mask(num_pu);
             }
 
@@ -1191,11 +1271,16 @@ namespace hpx { namespace threads { namespace policies {
             // steal from
             std::ptrdiff_t radius =
                 std::lround(static_cast<double>(num_threads) / 2.0);
-            victim_threads_[num_thread].data_.reserve(num_threads);
+
+            victim_data& victims = victims_[num_thread].data_;
+            victims.threads_.clear();
+            victims.threads_.reserve(num_threads);
+            victims.seed_ = num_thread + 1;
 
             std::size_t num_pu = affinity_data_.get_pu_num(num_thread);
             mask_cref_type pu_mask = topo.get_thread_affinity_mask(num_pu);
             mask_cref_type numa_mask = numa_masks[num_thread];
+            mask_cref_type cache_mask = cache_masks[num_thread];
             mask_cref_type core_mask = core_masks[num_thread];
 
             // we allow the thread on the boundary of the NUMA domain to steal
@@ -1223,14 +1308,14 @@ namespace hpx { namespace threads { namespace policies {
 
                         if (f(std::size_t(left)))
                         {
-                            victim_threads_[num_thread].data_.push_back(
+                            victims.threads_.push_back(
                                 static_cast<std::size_t>(left));
                         }
 
                         std::size_t right = (num_thread + i) % num_threads;
                         if (f(right))
                         {
-                            victim_threads_[num_thread].data_.push_back(right);
+                            victims.threads_.push_back(right);
                         }
                     }
                     if ((num_threads % 2) == 0)
@@ -1238,30 +1323,56 @@ namespace hpx { namespace threads { namespace policies {
                         std::size_t right = (num_thread + i) % num_threads;
                         if (f(right))
                         {
-                            victim_threads_[num_thread].data_.push_back(right);
+                            victims.threads_.push_back(right);
                         }
                     }
                 };
 
+            // the last level cache is considered only if we are topology
+            // aware, it refines the NUMA domain level
+            bool const topology_aware =
+                has_scheduler_mode(policies::enable_stealing_topology);
+            auto same_cache = [&](std::size_t other_num_thread) {
+                return topology_aware &&
+                    any(cache_mask & cache_masks[other_num_thread]);
+            };
+
             // check for threads which share the same core...
             iterate([&](std::size_t other_num_thread) {
                 return any(core_mask & core_masks[other_num_thread]);
             });
+            victims.level_end_[std::size_t(policies::steal_level::core)] =
+                victims.threads_.size();
+
+            // check for threads which share the same last level cache...
+            iterate([&](std::size_t other_num_thread) {
+                return !any(core_mask & core_masks[other_num_thread]) &&
+                    same_cache(other_num_thread) &&
+                    any(numa_mask & numa_masks[other_num_thread]);
+            });
+            victims.level_end_[std::size_t(policies::steal_level::cache)] =
+                victims.threads_.size();
 
             // check for threads which share the same NUMA domain...
             iterate([&](std::size_t other_num_thread) {
                 return !any(core_mask & core_masks[other_num_thread]) &&
+                    !same_cache(other_num_thread) &&
                     any(numa_mask & numa_masks[other_num_thread]);
             });
+            victims.level_end_[std::size_t(policies::steal_level::numa)] =
+                victims.threads_.size();
 
-            // check for the rest and if we are NUMA aware
+            // check for the rest and if we are NUMA aware (if we are topology
+            // aware, all threads may steal across NUMA domains)
             if (has_scheduler_mode(policies::enable_stealing_numa) &&
-                any(first_mask & pu_mask))
+                (topology_aware || any(first_mask & pu_mask)))
             {
                 iterate([&](std::size_t other_num_thread) {
                     return !any(numa_mask & numa_masks[other_num_thread]);
                 });
             }
+            victims.level_end_[std::size_t(policies::steal_level::remote)] =
+                victims.threads_.size();
         }
 
         void on_stop_thread(std::size_t num_thread) override
@@ -1296,7 +1407,94 @@ namespace hpx { namespace threads { namespace policies {
             curr_queue_.store(0, std::memory_order_release);
         }
 
+        std::int64_t get_num_steals(policies::steal_level level,
+            std::size_t num_thread, bool reset) override
+        {
+            std::size_t const l = static_cast<std::size_t>(level);
+            if (num_thread == std::size_t(-1))
+            {
+                std::int64_t count = 0;
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    count += util::get_and_reset_value(
+                        victims_[i].data_.steals_[l], reset);
+                }
+                return count;
+            }
+
+            HPX_ASSERT(num_thread < num_queues_);
+            return util::get_and_reset_value(
+                victims_[num_thread].data_.steals_[l], reset);
+        }
+
     protected:
+        // The victims of a worker thread, ordered by the level of the
+        // hardware topology they share with it.
+        struct victim_data
+        {
+            victim_data()
+              : level_end_()
+              , steals_()
+              , seed_(1)
+            {
+            }
+
+            // xorshift random number generator
+            std::uint64_t next_random() noexcept
+            {
+                seed_ ^= seed_ << 13;
+                seed_ ^= seed_ >> 7;
+                seed_ ^= seed_ << 17;
+                return seed_;
+            }
+
+            std::vector<std::size_t> threads_;
+            std::array<std::size_t, policies::num_steal_levels> level_end_;
+            std::array<std::atomic<std::int64_t>, policies::num_steal_levels>
+                steals_;
+            std::uint64_t seed_;
+        };
+
+        // Invoke f for the victims of the given worker thread, level by
+        // level, until it returns true. If enable_stealing_topology is set,
+        // the victims of each level are visited starting at a random
+        // position to avoid all thieves converging on the same victim.
+        template <typename F>
+        bool steal_from_victims(std::size_t num_thread, F&& f)
+        {
+            victim_data& victims = victims_[num_thread].data_;
+            bool const randomize =
+                has_scheduler_mode(policies::enable_stealing_topology);
+
+            std::size_t first = 0;
+            for (std::size_t level = 0; level != policies::num_steal_levels;
+                 ++level)
+            {
+                std::size_t const last = victims.level_end_[level];
+                std::size_t const count = last - first;
+
+                std::size_t offset = 0;
+                if (randomize && count > 1)
+                    offset = victims.next_random() % count;
+
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    std::size_t idx =
+                        victims.threads_[first + (offset + i) % count];
+                    HPX_ASSERT(idx != num_thread);
+
+                    if (f(idx))
+                    {
+                        victims.steals_[level].fetch_add(
+                            1, std::memory_order_relaxed);
+                        return true;
+                    }
+                }
+                first = last;
+            }
+            return false;
+        }
+
         std::atomic<std::size_t> curr_queue_;
 
         detail::affinity_data const& affinity_data_;
@@ -1309,8 +1507,7 @@ namespace hpx { namespace threads { namespace policies {
         std::vector<util::cache_line_data<thread_queue_type*>> queues_;
         std::vector<util::cache_line_data<thread_queue_type*>>
             high_priority_queues_;
-        std::vector<util::cache_line_data<std::vector<std::size_t>>>
-            victim_threads_;
+        std::vector<util::cache_line_data<victim_data>> victims_;
     };
 }}}    // namespace hpx::threads::policies
 
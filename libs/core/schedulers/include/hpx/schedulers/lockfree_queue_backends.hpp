@@ -64,6 +64,18 @@ namespace hpx { namespace threads { namespace policies {
 #endif
         }
 
+        // there is no bulk operation available, push the items one by one
+        template <typename Iterator>
+        bool push_bulk(Iterator first, std::size_t count)
+        {
+            bool result = true;
+            for (std::size_t i = 0; i != count; ++i, ++first)
+            {
+                result = push(*first) && result;
+            }
+            return result;
+        }
+
         bool pop(reference val, bool /* steal */ = true)
         {
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
@@ -120,6 +132,12 @@ namespace hpx { namespace threads { namespace policies {
             return queue_.enqueue(val);
         }
 
+        template <typename Iterator>
+        bool push_bulk(Iterator first, std::size_t count)
+        {
+            return queue_.enqueue_bulk(first, count);
+        }
+
         bool pop(reference val, bool /* steal */ = true)
         {
             return queue_.try_dequeue(val);
@@ -172,6 +190,18 @@ namespace hpx { namespace threads { namespace policies {
             return queue_.push_left(val);
         }
 
+        // there is no bulk operation available, push the items one by one
+        template <typename Iterator>
+        bool push_bulk(Iterator first, std::size_t count)
+        {
+            bool result = true;
+            for (std::size_t i = 0; i != count; ++i, ++first)
+            {
+                result = push(*first) && result;
+            }
+            return result;
+        }
+
         bool pop(reference val, bool /* steal */ = true)
         {
             return queue_.pop_left(val);
@@ -223,6 +253,18 @@ namespace hpx { namespace threads { namespace policies {
             return queue_.push_left(val);
         }
 
+        // there is no bulk operation available, push the items one by one
+        template <typename Iterator>
+        bool push_bulk(Iterator first, std::size_t count)
+        {
+            bool result = true;
+            for (std::size_t i = 0; i != count; ++i, ++first)
+            {
+                result = push(*first) && result;
+            }
+            return result;
+        }
+
         bool pop(reference val, bool steal = true)
         {
             if (steal)
@@ -277,6 +319,18 @@ namespace hpx { namespace threads { namespace policies {
             return queue_.push_left(val);
         }
 
+        // there is no bulk operation available, push the items one by one
+        template <typename Iterator>
+        bool push_bulk(Iterator first, std::size_t count)
+        {
+            bool result = true;
+            for (std::size_t i = 0; i != count; ++i, ++first)
+            {
+                result = push(*first) && result;
+            }
+            return result;
+        }
+
         bool pop(reference val, bool steal = true)
         {
             if (steal)
@@ -67,6 +67,9 @@ namespace hpx { namespace threads { namespace policies {
     //
     //     bool push(const_reference val);
     //
+    //     template <typename Iterator>
+    //     bool push_bulk(Iterator first, std::size_t count);
+    //
     //     bool pop(reference val, bool steal = true);
     //
     //     bool empty();
@@ -734,6 +737,65 @@ namespace hpx { namespace threads { namespace policies {
                 ec = make_success_code();
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // register a batch of task descriptions for later thread creation,
+        // the task descriptions are pushed onto the queue in groups with a
+        // single update of the task counter each
+        void create_threads_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec)
+        {
+            constexpr std::size_t max_batch_size = 64;
+
+            task_description* tasks[max_batch_size];
+            std::size_t num_tasks = 0;
+
+            auto flush = [&]() {
+                new_tasks_count_.data_.fetch_add(
+                    static_cast<std::int64_t>(num_tasks));
+                new_tasks_.push_bulk(&tasks[0], num_tasks);
+                num_tasks = 0;
+            };
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                thread_init_data& d = data[i];
+
+                // threads which have to be created right away are handled
+                // separately
+                if (d.run_now)
+                {
+                    create_thread(d, nullptr, ec);
+                    if (ec)
+                        break;
+                    continue;
+                }
+
+                if (d.stacksize == threads::thread_stacksize::current)
+                {
+                    d.stacksize = get_self_stacksize_enum();
+                }
+
+                HPX_ASSERT(d.stacksize != threads::thread_stacksize::current);
+
+                task_description* td = task_description_alloc_.allocate(1);
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                new (td) task_description{
+                    std::move(d), hpx::chrono::high_resolution_clock::now()};
+#else
+                new (td) task_description{std::move(d)};    //-V106
+#endif
+                tasks[num_tasks++] = td;
+                if (num_tasks == max_batch_size)
+                    flush();
+            }
+
+            if (num_tasks != 0)
+                flush();
+
+            if (&ec != &throws && !ec)
+                ec = make_success_code();
+        }
+
         void move_work_items_from(thread_queue* src, std::int64_t count)
         {
             thread_description* trd;
@@ -0,0 +1,147 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that work created in bulk (threads::register_work_bulk, which ends
+// up in scheduler_base::create_threads_bulk) runs to completion and is
+// spread over all workers, even if the workers have been parked and the
+// scheduler does not assign the work items to particular queues.
+
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+constexpr std::size_t num_os_threads = 4;
+
+void test_bulk(bool hinted)
+{
+    hpx::threads::thread_pool_base* pool = hpx::this_thread::get_pool();
+    std::size_t const num_threads = pool->get_os_thread_count();
+
+    // give the workers a chance to park themselves
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // each task waits (for a limited time) until all of them have started,
+    // this succeeds only if all workers were woken up to run them
+    std::size_t const num_tasks = num_threads - 1;
+    std::atomic<std::size_t> started(0);
+    std::atomic<std::size_t> concurrent(0);
+    std::atomic<std::size_t> finished(0);
+
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        hpx::threads::thread_schedule_hint hint;
+        if (hinted)
+        {
+            hint = hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(i + 1));
+        }
+
+        data.emplace_back(hpx::threads::make_thread_function_nullary([&]() {
+            ++started;
+            auto const until =
+                std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (started.load() != num_tasks &&
+                std::chrono::steady_clock::now() < until)
+            {
+            }
+            if (started.load() == num_tasks)
+                ++concurrent;
+            ++finished;
+        }),
+            hpx::util::thread_description("test_bulk"),
+            hpx::threads::thread_priority::normal, hint);
+    }
+
+    hpx::threads::register_work_bulk(data.data(), data.size(), pool);
+
+    while (finished.load() != num_tasks)
+    {
+        hpx::this_thread::yield();
+    }
+
+    HPX_TEST_EQ(started.load(), num_tasks);
+    HPX_TEST_EQ(concurrent.load(), num_tasks);
+}
+
+int hpx_main()
+{
+    test_bulk(true);
+    test_bulk(false);
+
+    return hpx::local::finalize();
+}
+
+template <typename Scheduler>
+void test_scheduler(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+
+    init_args.cfg = {"hpx.os_threads=" + std::to_string(num_os_threads)};
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default",
+            [](hpx::threads::thread_pool_init_parameters thread_pool_init,
+                hpx::threads::policies::thread_queue_init_parameters)
+                -> std::unique_ptr<hpx::threads::thread_pool_base> {
+                typename Scheduler::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, "create_work_bulk");
+                std::unique_ptr<Scheduler> scheduler(new Scheduler(init));
+
+                thread_pool_init.mode_ = hpx::threads::policies::scheduler_mode(
+                    hpx::threads::policies::do_background_work |
+                    hpx::threads::policies::reduce_thread_priority |
+                    hpx::threads::policies::delay_exit |
+                    hpx::threads::policies::enable_stealing |
+                    hpx::threads::policies::enable_idle_parking);
+
+                std::unique_ptr<hpx::threads::thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<Scheduler>(
+                        std::move(scheduler), thread_pool_init));
+
+                return pool;
+            });
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    // assigns queues to unhinted work items in create_threads_bulk
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_fifo>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+
+    // relies on the default scheduler_base::create_threads_bulk
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_fifo>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+
+    return hpx::util::report_errors();
+}
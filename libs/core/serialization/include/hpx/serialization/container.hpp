@@ -12,6 +12,7 @@
 #include <hpx/serialization/binary_filter.hpp>
 
 #include <cstddef>
+#include <memory>
 
 namespace hpx { namespace serialization {
 
@@ -43,5 +44,15 @@ namespace hpx { namespace serialization {
         virtual void set_filter(binary_filter* filter) = 0;
         virtual void load_binary(void* address, std::size_t count) = 0;
         virtual void load_binary_chunk(void* address, std::size_t count) = 0;
+
+        // Take shared ownership of the memory of the current zero-copy
+        // chunk instead of copying it. Returns an empty pointer if the data
+        // was not received as a suitably aligned zero-copy chunk of the given
+        // size or if its memory can't be adopted.
+        virtual std::shared_ptr<void> adopt_binary_chunk(
+            std::size_t /*count*/, std::size_t /*alignment*/)
+        {
+            return std::shared_ptr<void>();
+        }
     };
 }}    // namespace hpx::serialization
@@ -0,0 +1,104 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace serialization { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The buffer pool keeps released serialization buffers around for later
+    // reuse. Buffers are segregated into size classes (four per power of two,
+    // which limits the memory wasted by rounding up a request to 25%), each
+    // size class is managed by a free list of bounded length shared by all
+    // threads. Buffers are commonly acquired and released on different
+    // threads (e.g. receive buffers are allocated by the network layer and
+    // released after decoding the parcels on a worker thread). Buffers larger
+    // than the largest size class are never pooled.
+    struct HPX_CORE_EXPORT buffer_pool
+    {
+        using buffer_type = std::vector<char>;
+
+        // smallest and largest size class managed by the pool (log2)
+        static constexpr std::size_t min_size_class = 8;     // 256 bytes
+        static constexpr std::size_t max_size_class = 24;    // 16 MBytes
+
+        // maximal number of buffers kept per size class
+        static constexpr std::size_t max_buffers_per_class = 8;
+
+        // Return an empty buffer able to hold at least 'size' bytes without
+        // reallocation.
+        static buffer_type acquire(std::size_t size);
+
+        // Hand the given buffer back to the pool. The buffer is dropped if
+        // its capacity does not fit any of the size classes or if the
+        // corresponding free list is full.
+        static void release(buffer_type&& buffer) noexcept;
+
+        // statistics
+        static std::int64_t get_hits(bool reset);
+        static std::int64_t get_misses(bool reset);
+        static std::int64_t get_bytes_recycled(bool reset);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Make sure the given container can hold at least 'size' bytes, buffers
+    // of type std::vector<char> are drawn from the buffer pool.
+    template <typename Container>
+    void reserve_buffer(Container& cont, std::size_t size)
+    {
+        cont.reserve(size);
+    }
+
+    inline void reserve_buffer(buffer_pool::buffer_type& cont, std::size_t size)
+    {
+        if (cont.empty() && cont.capacity() < size)
+        {
+            buffer_pool::buffer_type buffer = buffer_pool::acquire(size);
+            std::swap(cont, buffer);
+            buffer_pool::release(std::move(buffer));
+        }
+        else
+        {
+            cont.reserve(size);
+        }
+    }
+
+    // Resize the given container to 'size' bytes, buffers of type
+    // std::vector<char> are drawn from the buffer pool.
+    template <typename Container>
+    void resize_buffer(Container& cont, std::size_t size)
+    {
+        cont.resize(size);
+    }
+
+    inline void resize_buffer(buffer_pool::buffer_type& cont, std::size_t size)
+    {
+        reserve_buffer(cont, size);
+        cont.resize(size);
+    }
+
+    // Return the memory held by the given container to the buffer pool, if
+    // possible.
+    template <typename Container>
+    void release_buffer(Container& cont) noexcept
+    {
+        cont.clear();
+    }
+
+    inline void release_buffer(buffer_pool::buffer_type& cont) noexcept
+    {
+        buffer_pool::release(std::move(cont));
+        cont = buffer_pool::buffer_type();
+    }
+}}}    // namespace hpx::serialization::detail
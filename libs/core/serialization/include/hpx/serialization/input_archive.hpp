@@ -31,12 +31,17 @@ namespace hpx { namespace serialization {
     {
         using base_type = basic_archive<input_archive>;
 
+        // The optional chunk_owners refer to the objects owning the memory
+        // of the zero-copy chunks (using the same index as chunks). If given,
+        // the memory of those chunks can be adopted during de-serialization
+        // instead of being copied (see adopt_binary_chunk).
         template <typename Container>
         input_archive(Container& buffer, std::size_t inbound_data_size = 0,
-            const std::vector<serialization_chunk>* chunks = nullptr)
+            const std::vector<serialization_chunk>* chunks = nullptr,
+            std::vector<std::shared_ptr<void>> const* chunk_owners = nullptr)
           : base_type(0U)
           , buffer_(new input_container<Container>(
-                buffer, chunks, inbound_data_size))
+                buffer, chunks, inbound_data_size, chunk_owners))
         {
             // endianness needs to be saves separately as it is needed to
             // properly interpret the flags
@@ -120,6 +125,23 @@ namespace hpx { namespace serialization {
             return basic_archive<input_archive>::current_pos();
         }
 
+        // Take shared ownership of the memory holding the next count bytes
+        // if those were received as a zero-copy chunk with the given
+        // alignment, returns an empty pointer otherwise (nothing is consumed
+        // from the archive in this case).
+        std::shared_ptr<void> adopt_binary_chunk(
+            std::size_t count, std::size_t alignment = 1)
+        {
+            if (0 == count || disable_data_chunking())
+                return std::shared_ptr<void>();
+
+            std::shared_ptr<void> result =
+                buffer_->adopt_binary_chunk(count, alignment);
+            if (result)
+                size_ += count;
+            return result;
+        }
+
     private:
         friend struct basic_archive<input_archive>;
 
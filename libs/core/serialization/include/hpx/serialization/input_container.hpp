@@ -58,12 +58,14 @@ namespace hpx { namespace serialization {
           , chunks_(nullptr)
           , current_chunk_(std::size_t(-1))
           , current_chunk_size_(0)
+          , chunk_owners_(nullptr)
         {
         }
 
         input_container(Container const& cont,
             std::vector<serialization_chunk> const* chunks,
-            std::size_t inbound_data_size)
+            std::size_t inbound_data_size,
+            std::vector<std::shared_ptr<void>> const* chunk_owners = nullptr)
           : cont_(cont)
           , current_(0)
           , filter_()
@@ -71,6 +73,7 @@ namespace hpx { namespace serialization {
           , chunks_(nullptr)
           , current_chunk_(std::size_t(-1))
           , current_chunk_size_(0)
+          , chunk_owners_(chunk_owners)
         {
             if (chunks && chunks->size() != 0)
             {
@@ -148,18 +151,15 @@ namespace hpx { namespace serialization {
         {
             HPX_ASSERT((std::int64_t) count >= 0);
 
-            if (chunks_ == nullptr ||
-                count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD || filter_)
+            // the sending end decides whether data is sent as a separate
+            // zero-copy chunk, its threshold may differ from ours
+            if (!is_zero_copy_chunk())
             {
                 // fall back to serialization_chunk-less archive
                 this->input_container::load_binary(address, count);
             }
             else
             {
-                HPX_ASSERT(current_chunk_ != std::size_t(-1));
-                HPX_ASSERT(
-                    get_chunk_type(current_chunk_) == chunk_type_pointer);
-
                 if (get_chunk_size(current_chunk_) != count)
                 {
                     HPX_THROW_EXCEPTION(serialization_error,
@@ -177,6 +177,37 @@ namespace hpx { namespace serialization {
             }
         }
 
+        std::shared_ptr<void> adopt_binary_chunk(
+            std::size_t count, std::size_t alignment) override
+        {
+            if (chunk_owners_ == nullptr || !is_zero_copy_chunk() ||
+                get_chunk_size(current_chunk_) != count ||
+                current_chunk_ >= chunk_owners_->size() ||
+                !(*chunk_owners_)[current_chunk_] ||
+                reinterpret_cast<std::uintptr_t>(
+                    get_chunk_data(current_chunk_).cpos_) %
+                        alignment !=
+                    0)
+            {
+                return std::shared_ptr<void>();
+            }
+
+            // share ownership with the object holding the received data
+            std::shared_ptr<void> result((*chunk_owners_)[current_chunk_],
+                get_chunk_data(current_chunk_).pos_);
+            ++current_chunk_;
+            return result;
+        }
+
+    private:
+        bool is_zero_copy_chunk() const
+        {
+            return chunks_ != nullptr && !filter_ &&
+                current_chunk_ < get_num_chunks() &&
+                get_chunk_type(current_chunk_) == chunk_type_pointer;
+        }
+
+    public:
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -185,5 +216,8 @@ namespace hpx { namespace serialization {
         std::vector<serialization_chunk> const* chunks_;
         std::size_t current_chunk_;
         std::size_t current_chunk_size_;
+
+        // optional owners of the memory referenced by the zero-copy chunks
+        std::vector<std::shared_ptr<void>> const* chunk_owners_;
     };
 }}    // namespace hpx::serialization
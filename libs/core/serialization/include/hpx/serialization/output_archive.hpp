@@ -33,20 +33,21 @@ namespace hpx { namespace serialization {
         template <typename Container>
         inline std::unique_ptr<erased_output_container> create_output_container(
             Container& buffer, std::vector<serialization_chunk>* chunks,
-            binary_filter* filter, std::false_type)
+            binary_filter* filter, std::size_t zero_copy_serialization_threshold,
+            std::false_type)
         {
             std::unique_ptr<erased_output_container> res;
             if (filter == nullptr)
             {
                 if (chunks == nullptr)
                 {
-                    res.reset(
-                        new output_container<Container, basic_chunker>(buffer));
+                    res.reset(new output_container<Container, basic_chunker>(
+                        buffer, nullptr, zero_copy_serialization_threshold));
                 }
                 else
                 {
                     res.reset(new output_container<Container, vector_chunker>(
-                        buffer, chunks));
+                        buffer, chunks, zero_copy_serialization_threshold));
                 }
             }
             else
@@ -55,12 +56,14 @@ namespace hpx { namespace serialization {
                 {
                     res.reset(
                         new filtered_output_container<Container, basic_chunker>(
-                            buffer));
+                            buffer, nullptr,
+                            zero_copy_serialization_threshold));
                 }
                 else
                 {
                     res.reset(new filtered_output_container<Container,
-                        vector_chunker>(buffer, chunks));
+                        vector_chunker>(
+                        buffer, chunks, zero_copy_serialization_threshold));
                 }
             }
             return res;
@@ -69,19 +72,20 @@ namespace hpx { namespace serialization {
         template <typename Container>
         inline std::unique_ptr<erased_output_container> create_output_container(
             Container& buffer, std::vector<serialization_chunk>* chunks,
-            binary_filter* filter, std::true_type)
+            binary_filter* filter, std::size_t zero_copy_serialization_threshold,
+            std::true_type)
         {
             std::unique_ptr<erased_output_container> res;
             if (filter == nullptr)
             {
                 res.reset(new output_container<Container, counting_chunker>(
-                    buffer, chunks));
+                    buffer, chunks, zero_copy_serialization_threshold));
             }
             else
             {
                 res.reset(
                     new filtered_output_container<Container, counting_chunker>(
-                        buffer, chunks));
+                        buffer, chunks, zero_copy_serialization_threshold));
             }
             return res;
         }
@@ -102,12 +106,19 @@ namespace hpx { namespace serialization {
     public:
         using base_type = basic_archive<output_archive>;
 
+        // Arrays of bitwise serializable data of at least
+        // zero_copy_serialization_threshold bytes are not copied into the
+        // archive but are referenced from separate zero-copy chunks (if
+        // chunks is given). A threshold of zero selects the default
+        // (HPX_ZERO_COPY_SERIALIZATION_THRESHOLD).
         template <typename Container>
         output_archive(Container& buffer, std::uint32_t flags = 0U,
             std::vector<serialization_chunk>* chunks = nullptr,
-            binary_filter* filter = nullptr)
+            binary_filter* filter = nullptr,
+            std::size_t zero_copy_serialization_threshold = 0)
           : base_type(make_flags(flags, chunks))
           , buffer_(detail::create_output_container(buffer, chunks, filter,
+                zero_copy_serialization_threshold,
                 typename traits::serialization_access_data<
                     Container>::preprocessing_only()))
         {
@@ -161,11 +161,18 @@ namespace hpx { namespace serialization {
     {
         using access_traits = traits::serialization_access_data<Container>;
 
-        output_container(
-            Container& cont, std::vector<serialization_chunk>* chunks = nullptr)
+        // A zero_copy_serialization_threshold of zero selects the default
+        // threshold (HPX_ZERO_COPY_SERIALIZATION_THRESHOLD).
+        output_container(Container& cont,
+            std::vector<serialization_chunk>* chunks = nullptr,
+            std::size_t zero_copy_serialization_threshold = 0)
           : cont_(cont)
           , current_(0)
           , chunker_(chunks)
+          , zero_copy_serialization_threshold_(
+                zero_copy_serialization_threshold == 0 ?
+                    HPX_ZERO_COPY_SERIALIZATION_THRESHOLD :
+                    zero_copy_serialization_threshold)
         {
             chunker_.reset();
         }
@@ -231,7 +238,7 @@ namespace hpx { namespace serialization {
         std::size_t save_binary_chunk(
             void const* address, std::size_t count) override
         {
-            if (count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD)
+            if (count < zero_copy_serialization_threshold_)
             {
                 // fall back to serialization_chunk-less archive
                 this->output_container::save_binary(address, count);
@@ -270,6 +277,7 @@ namespace hpx { namespace serialization {
         Container& cont_;
         std::size_t current_;
         Chunker chunker_;
+        std::size_t zero_copy_serialization_threshold_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -279,9 +287,10 @@ namespace hpx { namespace serialization {
         using access_traits = traits::serialization_access_data<Container>;
         using base_type = output_container<Container, Chunker>;
 
-        filtered_output_container(
-            Container& cont, std::vector<serialization_chunk>* chunks = nullptr)
-          : base_type(cont, chunks)
+        filtered_output_container(Container& cont,
+            std::vector<serialization_chunk>* chunks = nullptr,
+            std::size_t zero_copy_serialization_threshold = 0)
+          : base_type(cont, chunks, zero_copy_serialization_threshold)
           , start_compressing_at_(0)
           , filter_(nullptr)
         {
@@ -340,7 +349,7 @@ namespace hpx { namespace serialization {
         std::size_t save_binary_chunk(
             void const* address, std::size_t count)    // override
         {
-            if (count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD)
+            if (count < this->zero_copy_serialization_threshold_)
             {
                 // fall back to serialization_chunk-less archive
                 HPX_ASSERT(count != 0);
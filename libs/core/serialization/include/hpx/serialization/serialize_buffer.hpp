@@ -8,6 +8,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/config/endian.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/datastructures/traits/supports_streaming_with_any.hpp>
 #include <hpx/modules/errors.hpp>
@@ -15,6 +16,7 @@
 #include <hpx/serialization/array.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 
 #if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
 #include <boost/shared_array.hpp>
@@ -24,6 +26,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <type_traits>
 
 namespace hpx { namespace serialization {
@@ -313,12 +316,50 @@ namespace hpx { namespace serialization {
         }
 
         ///////////////////////////////////////////////////////////////////////
+        // Buffers using the default allocator may directly refer to the
+        // memory of a received zero-copy chunk instead of copying the data.
+        using can_adopt_received_data = std::integral_constant<bool,
+            std::is_same<Allocator, std::allocator<T>>::value &&
+                hpx::traits::is_bitwise_serializable<T>::value>;
+
+        template <typename Archive>
+        bool load_adopted(Archive& ar, std::true_type)
+        {
+            bool archive_endianess_differs = endian::native == endian::big ?
+                ar.endian_little() :
+                ar.endian_big();
+
+            if (ar.disable_array_optimization() || archive_endianess_differs)
+                return false;
+
+            std::shared_ptr<void> owner =
+                ar.adopt_binary_chunk(size_ * sizeof(T), alignof(T));
+            if (!owner)
+                return false;
+
+            // the deleter keeps the received data alive
+            data_ = buffer_type(
+                static_cast<T*>(owner.get()), [owner](T*) {});
+            return true;
+        }
+
+        template <typename Archive>
+        static bool load_adopted(Archive&, std::false_type)
+        {
+            return false;
+        }
+
         template <typename Archive>
         void load(Archive& ar, unsigned int const)
         {
             ar >> size_ >> alloc_;
             // -V128
 
+            if (size_ != 0 && load_adopted(ar, can_adopt_received_data()))
+            {
+                return;
+            }
+
             data_.reset(alloc_.allocate(size_),
                 [alloc = this->alloc_, size = this->size_](T* p) {
                     serialize_buffer::deleter<allocator_type>(p, alloc, size);
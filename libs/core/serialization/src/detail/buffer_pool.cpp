@@ -0,0 +1,219 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/detail/buffer_pool.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace serialization { namespace detail {
+
+    namespace {
+
+        // every power of two is split into four size classes
+        constexpr std::size_t size_class_steps_log2 = 2;
+        constexpr std::size_t size_class_steps = 1 << size_class_steps_log2;
+
+        constexpr std::size_t num_size_classes =
+            (buffer_pool::max_size_class - buffer_pool::min_size_class) *
+                size_class_steps +
+            1;
+
+        constexpr std::size_t invalid_size_class = std::size_t(-1);
+
+        // The free lists are shared between all threads, each of them is
+        // protected by its own spinlock. The lock is held while moving a
+        // single buffer only.
+        struct free_list
+        {
+            void lock() noexcept
+            {
+                while (locked_.exchange(true, std::memory_order_acquire))
+                {
+                    while (locked_.load(std::memory_order_relaxed))
+                    {
+                        HPX_SMT_PAUSE;
+                    }
+                }
+            }
+
+            void unlock() noexcept
+            {
+                locked_.store(false, std::memory_order_release);
+            }
+
+            std::atomic<bool> locked_{false};
+            std::size_t count_ = 0;
+            std::array<buffer_pool::buffer_type,
+                buffer_pool::max_buffers_per_class>
+                buffers_;
+        };
+
+        // avoid false sharing between the free lists
+        struct alignas(64) aligned_free_list : free_list
+        {
+        };
+
+        using free_lists_type =
+            std::array<aligned_free_list, num_size_classes>;
+
+        free_lists_type& get_free_lists()
+        {
+            static free_lists_type free_lists;
+            return free_lists;
+        }
+
+        std::atomic<std::int64_t> hits(0);
+        std::atomic<std::int64_t> misses(0);
+        std::atomic<std::int64_t> bytes_recycled(0);
+
+        std::int64_t get_and_reset(
+            std::atomic<std::int64_t>& value, bool reset) noexcept
+        {
+            if (reset)
+                return value.exchange(0, std::memory_order_relaxed);
+            return value.load(std::memory_order_relaxed);
+        }
+
+        std::size_t floor_log2(std::size_t value) noexcept
+        {
+            std::size_t result = 0;
+            while ((value >>= 1) != 0)
+            {
+                ++result;
+            }
+            return result;
+        }
+
+        // number of bytes held by the buffers of the given size class
+        std::size_t size_of_size_class(std::size_t size_class) noexcept
+        {
+            std::size_t const octave = size_class / size_class_steps;
+            std::size_t const step = size_class % size_class_steps;
+            return (size_class_steps + step)
+                << (buffer_pool::min_size_class + octave -
+                       size_class_steps_log2);
+        }
+
+        // smallest size class able to hold 'size' bytes
+        std::size_t size_class_for_size(std::size_t size) noexcept
+        {
+            if (size <= (std::size_t(1) << buffer_pool::min_size_class))
+            {
+                return 0;
+            }
+
+            // the bits following the most significant bit of (size - 1)
+            // select the step within the power of two
+            std::size_t const n = size - 1;
+            std::size_t const log2 = floor_log2(n);
+            std::size_t const step =
+                (n >> (log2 - size_class_steps_log2)) & (size_class_steps - 1);
+
+            return (log2 - buffer_pool::min_size_class) * size_class_steps +
+                step + 1;
+        }
+
+        // largest size class completely covered by the given capacity
+        std::size_t size_class_for_capacity(std::size_t capacity) noexcept
+        {
+            if (capacity < (std::size_t(1) << buffer_pool::min_size_class))
+            {
+                return invalid_size_class;
+            }
+
+            std::size_t const log2 = floor_log2(capacity);
+            std::size_t const step = (capacity >>
+                                         (log2 - size_class_steps_log2)) &
+                (size_class_steps - 1);
+
+            std::size_t const size_class =
+                (log2 - buffer_pool::min_size_class) * size_class_steps + step;
+            return size_class < num_size_classes ? size_class :
+                                                   invalid_size_class;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    buffer_pool::buffer_type buffer_pool::acquire(std::size_t size)
+    {
+        buffer_type buffer;
+
+        std::size_t const size_class = size_class_for_size(size);
+        if (size_class >= num_size_classes)
+        {
+            // too large to be pooled
+            misses.fetch_add(1, std::memory_order_relaxed);
+            buffer.reserve(size);
+            return buffer;
+        }
+
+        free_list& list = get_free_lists()[size_class];
+        list.lock();
+        if (list.count_ != 0)
+        {
+            buffer = std::move(list.buffers_[--list.count_]);
+            list.unlock();
+
+            HPX_ASSERT(buffer.empty() && buffer.capacity() >= size);
+
+            hits.fetch_add(1, std::memory_order_relaxed);
+            bytes_recycled.fetch_add(
+                static_cast<std::int64_t>(buffer.capacity()),
+                std::memory_order_relaxed);
+            return buffer;
+        }
+        list.unlock();
+
+        // allocate the full size class to allow for the buffer to be reused
+        // for requests of similar size
+        misses.fetch_add(1, std::memory_order_relaxed);
+        buffer.reserve(size_of_size_class(size_class));
+        return buffer;
+    }
+
+    void buffer_pool::release(buffer_type&& buffer) noexcept
+    {
+        std::size_t const size_class =
+            size_class_for_capacity(buffer.capacity());
+        if (size_class == invalid_size_class)
+        {
+            return;
+        }
+
+        buffer.clear();
+
+        free_list& list = get_free_lists()[size_class];
+        list.lock();
+        if (list.count_ != max_buffers_per_class)
+        {
+            list.buffers_[list.count_++] = std::move(buffer);
+        }
+        list.unlock();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t buffer_pool::get_hits(bool reset)
+    {
+        return get_and_reset(hits, reset);
+    }
+
+    std::int64_t buffer_pool::get_misses(bool reset)
+    {
+        return get_and_reset(misses, reset);
+    }
+
+    std::int64_t buffer_pool::get_bytes_recycled(bool reset)
+    {
+        return get_and_reset(bytes_recycled, reset);
+    }
+}}}    // namespace hpx::serialization::detail
@@ -0,0 +1,184 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/serialization/detail/buffer_pool.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using hpx::serialization::detail::buffer_pool;
+
+void test_acquire_release()
+{
+    buffer_pool::get_hits(true);
+    buffer_pool::get_misses(true);
+    buffer_pool::get_bytes_recycled(true);
+
+    // the first request allocates the full size class
+    std::vector<char> buffer = buffer_pool::acquire(1000);
+    HPX_TEST(buffer.empty());
+    HPX_TEST_LTE(std::size_t(1000), buffer.capacity());
+    HPX_TEST_EQ(buffer_pool::get_misses(false), 1);
+    HPX_TEST_EQ(buffer_pool::get_hits(false), 0);
+
+    char const* data = buffer.data();
+    std::size_t capacity = buffer.capacity();
+
+    buffer.resize(1000);
+    buffer_pool::release(std::move(buffer));
+
+    // a request of similar size reuses the released buffer
+    std::vector<char> reused = buffer_pool::acquire(900);
+    HPX_TEST(reused.empty());
+    HPX_TEST_EQ(reused.data(), data);
+    HPX_TEST_EQ(buffer_pool::get_hits(false), 1);
+    HPX_TEST_EQ(buffer_pool::get_bytes_recycled(false),
+        static_cast<std::int64_t>(capacity));
+
+    // a request for a larger buffer can't be served by the released buffer
+    buffer_pool::release(std::move(reused));
+    std::vector<char> larger = buffer_pool::acquire(4 * capacity);
+    HPX_TEST_LTE(4 * capacity, larger.capacity());
+    HPX_TEST_EQ(buffer_pool::get_misses(false), 2);
+
+    // buffers which are too large are not pooled
+    std::size_t const too_large =
+        (std::size_t(1) << buffer_pool::max_size_class) + 1;
+    std::vector<char> huge = buffer_pool::acquire(too_large);
+    HPX_TEST_LTE(too_large, huge.capacity());
+    HPX_TEST_EQ(buffer_pool::get_misses(false), 3);
+
+    // statistics can be reset
+    HPX_TEST_EQ(buffer_pool::get_hits(true), 1);
+    HPX_TEST_EQ(buffer_pool::get_hits(false), 0);
+}
+
+void test_serialization()
+{
+    std::vector<int> os(1000);
+    std::iota(os.begin(), os.end(), 0);
+
+    for (int i = 0; i != 10; ++i)
+    {
+        std::vector<char> buffer;
+        hpx::serialization::detail::reserve_buffer(
+            buffer, os.size() * sizeof(int) + 64);
+
+        {
+            hpx::serialization::output_archive oarchive(buffer);
+            oarchive << os;
+        }
+
+        std::vector<int> is;
+        {
+            hpx::serialization::input_archive iarchive(buffer);
+            iarchive >> is;
+        }
+        HPX_TEST(os == is);
+
+        hpx::serialization::detail::release_buffer(buffer);
+        HPX_TEST(buffer.empty());
+        HPX_TEST_EQ(buffer.capacity(), std::size_t(0));
+    }
+
+    // all but the first iteration were served from the pool
+    HPX_TEST_LTE(std::int64_t(9), buffer_pool::get_hits(false));
+}
+
+void test_cross_thread()
+{
+    buffer_pool::get_hits(true);
+
+    // buffers acquired on one thread and released on another one are
+    // available to the acquiring thread afterwards
+    std::vector<std::vector<char>> buffers;
+    std::vector<char const*> data;
+    std::thread acquire([&]() {
+        for (std::size_t i = 0; i != buffer_pool::max_buffers_per_class; ++i)
+        {
+            buffers.push_back(buffer_pool::acquire(3000));
+            data.push_back(buffers.back().data());
+        }
+    });
+    acquire.join();
+
+    std::thread release([&]() {
+        for (auto& buffer : buffers)
+        {
+            buffer_pool::release(std::move(buffer));
+        }
+    });
+    release.join();
+
+    std::thread reacquire([&]() {
+        for (std::size_t i = 0; i != buffer_pool::max_buffers_per_class; ++i)
+        {
+            std::vector<char> buffer = buffer_pool::acquire(3000);
+            HPX_TEST(std::find(data.begin(), data.end(), buffer.data()) !=
+                data.end());
+        }
+    });
+    reacquire.join();
+
+    HPX_TEST_EQ(buffer_pool::get_hits(false),
+        static_cast<std::int64_t>(buffer_pool::max_buffers_per_class));
+
+    // concurrent use of the pool
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != 4; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            for (std::size_t i = 0; i != 10000; ++i)
+            {
+                std::size_t const size = 256 + (i * 97 + t * 31) % 20000;
+                std::vector<char> buffer = buffer_pool::acquire(size);
+                if (!buffer.empty() || buffer.capacity() < size)
+                    failed = true;
+                buffer.resize(size);
+                buffer_pool::release(std::move(buffer));
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    HPX_TEST(!failed);
+}
+
+void test_size_classes()
+{
+    // requests are rounded up to at most 25% more than requested
+    for (std::size_t size = 257; size < (std::size_t(1) << 20); size += 1013)
+    {
+        std::vector<char> buffer = buffer_pool::acquire(size);
+        HPX_TEST_LTE(size, buffer.capacity());
+        HPX_TEST_LTE(buffer.capacity(), size + size / 4);
+    }
+}
+
+int main()
+{
+    test_acquire_release();
+    test_serialization();
+    test_cross_thread();
+    test_size_classes();
+
+    return hpx::util::report_errors();
+}
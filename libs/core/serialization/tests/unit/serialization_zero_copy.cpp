@@ -0,0 +1,155 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+using hpx::serialization::serialization_chunk;
+
+///////////////////////////////////////////////////////////////////////////////
+// emulate the transmission of the zero-copy chunks by copying them into
+// separately owned memory (as a parcelport would do)
+std::vector<std::shared_ptr<void>> transmit_chunks(
+    std::vector<serialization_chunk> const& sent,
+    std::vector<serialization_chunk>& chunks)
+{
+    chunks = sent;
+
+    std::vector<std::shared_ptr<void>> owners(chunks.size());
+    for (std::size_t i = 0; i != chunks.size(); ++i)
+    {
+        serialization_chunk& c = chunks[i];
+        if (c.type_ != hpx::serialization::chunk_type_pointer)
+            continue;
+
+        auto received = std::make_shared<std::vector<char>>(c.size_);
+        std::memcpy(received->data(), c.data_.cpos_, c.size_);
+        c = hpx::serialization::create_pointer_chunk(
+            received->data(), c.size_);
+        owners[i] = std::move(received);
+    }
+    return owners;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_threshold()
+{
+    std::vector<double> small(100), large(200);
+    std::iota(small.begin(), small.end(), 0.0);
+    std::iota(large.begin(), large.end(), 0.0);
+
+    // the default threshold sends both arrays as separate chunks
+    {
+        std::vector<char> buffer;
+        std::vector<serialization_chunk> chunks;
+        hpx::serialization::output_archive oarchive(buffer, 0U, &chunks);
+        oarchive << small << large;
+        oarchive.flush();
+
+        HPX_TEST_EQ(oarchive.get_num_chunks(), std::size_t(4));
+    }
+
+    // a larger threshold sends only the large array as a separate chunk
+    {
+        std::vector<char> buffer;
+        std::vector<serialization_chunk> chunks;
+        hpx::serialization::output_archive oarchive(
+            buffer, 0U, &chunks, nullptr, 1024);
+        oarchive << small << large;
+        oarchive.flush();
+
+        HPX_TEST_EQ(oarchive.get_num_chunks(), std::size_t(2));
+
+        // the receiving end does not need to know the threshold
+        hpx::serialization::input_archive iarchive(
+            buffer, oarchive.bytes_written(), &chunks);
+        std::vector<double> small_in, large_in;
+        iarchive >> small_in >> large_in;
+
+        HPX_TEST(small == small_in);
+        HPX_TEST(large == large_in);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_adopt_received_chunks()
+{
+    using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+    std::vector<double> data(1000);
+    std::iota(data.begin(), data.end(), 0.0);
+
+    buffer_type out(data.data(), data.size(), buffer_type::reference);
+
+    std::vector<char> buffer;
+    std::vector<serialization_chunk> chunks;
+    hpx::serialization::output_archive oarchive(buffer, 0U, &chunks);
+    oarchive << out;
+    oarchive.flush();
+
+    HPX_TEST_EQ(oarchive.get_num_chunks(), std::size_t(2));
+
+    std::vector<serialization_chunk> received;
+    std::vector<std::shared_ptr<void>> owners =
+        transmit_chunks(chunks, received);
+    HPX_TEST(!!owners[1]);
+
+    // the received memory is adopted if its owners are known
+    {
+        buffer_type in;
+        {
+            hpx::serialization::input_archive iarchive(
+                buffer, oarchive.bytes_written(), &received, &owners);
+            iarchive >> in;
+        }
+
+        HPX_TEST_EQ(in.size(), data.size());
+        HPX_TEST_EQ(static_cast<void const*>(in.data()),
+            received[1].data_.cpos_);
+        HPX_TEST(std::equal(data.begin(), data.end(), in.data()));
+
+        // the buffer keeps the received memory alive
+        owners.clear();
+        HPX_TEST(std::equal(data.begin(), data.end(), in.data()));
+    }
+
+    // otherwise the data is copied
+    {
+        owners = transmit_chunks(chunks, received);
+
+        buffer_type in;
+        hpx::serialization::input_archive iarchive(
+            buffer, oarchive.bytes_written(), &received);
+        iarchive >> in;
+
+        HPX_TEST_EQ(in.size(), data.size());
+        HPX_TEST_NEQ(static_cast<void const*>(in.data()),
+            received[1].data_.cpos_);
+        HPX_TEST(std::equal(data.begin(), data.end(), in.data()));
+    }
+}
+
+int main()
+{
+    test_threshold();
+    test_adopt_received_chunks();
+
+    return hpx::util::report_errors();
+}
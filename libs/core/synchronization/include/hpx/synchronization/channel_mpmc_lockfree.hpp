@@ -0,0 +1,730 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  The ring buffer is based on the bounded MPMC queue by Dmitry Vyukov, see
+//  http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace lcos { namespace local {
+
+    ////////////////////////////////////////////////////////////////////////////
+    // A bounded channel supporting multiple producers and multiple consumers.
+    // The data is stored in a ring-buffer where each slot carries a sequence
+    // number, which allows for the producers and the consumers to claim slots
+    // using a single compare-and-swap, without taking any lock.
+    //
+    // Operations that can't complete immediately (get on an empty channel,
+    // set on a full channel) register a waiter with the channel. Waiters are
+    // kept in lists protected by a spinlock. This lock is touched only if
+    // there are waiters, the fast path does not use it. Waiters are notified
+    // whenever an item is added to (or removed from) the channel. Blocking
+    // operations suspend the calling thread while waiting, the operations
+    // returned by async_send and async_receive are completed from the thread
+    // notifying them.
+    //
+    // Closing the channel makes all further set operations fail. Values that
+    // are still stored in the channel can be retrieved after it was closed.
+    template <typename T>
+    class channel_mpmc_lockfree
+    {
+    private:
+        using mutex_type = hpx::lcos::local::spinlock;
+
+        // the ring buffer operations move-assign values into and out of the
+        // slots, they can't fail only if T's move assignment can't throw
+        static constexpr bool nothrow_move =
+            std::is_nothrow_move_assignable<T>::value;
+
+        enum class status
+        {
+            ok,
+            would_block,
+            closed
+        };
+
+        ////////////////////////////////////////////////////////////////////////
+        struct cell
+        {
+            std::atomic<std::size_t> sequence_;
+            T data_;
+        };
+
+        // Waiters are linked into intrusive lists, they are notified once
+        // the operation they wait for may succeed.
+        struct waiter_base
+        {
+            virtual ~waiter_base() = default;
+            virtual void notify() noexcept = 0;
+
+            waiter_base* next_ = nullptr;
+        };
+
+        struct waiter_list
+        {
+            void push_back(waiter_base* w) noexcept
+            {
+                w->next_ = nullptr;
+                if (tail_ == nullptr)
+                {
+                    head_ = w;
+                }
+                else
+                {
+                    tail_->next_ = w;
+                }
+                tail_ = w;
+            }
+
+            waiter_base* pop_front() noexcept
+            {
+                waiter_base* w = head_;
+                if (w != nullptr)
+                {
+                    head_ = w->next_;
+                    if (head_ == nullptr)
+                    {
+                        tail_ = nullptr;
+                    }
+                    w->next_ = nullptr;
+                }
+                return w;
+            }
+
+            waiter_base* head_ = nullptr;
+            waiter_base* tail_ = nullptr;
+
+            // number of registered waiters, this is incremented before
+            // checking the ring buffer for the last time, which allows
+            // for the notifying side to skip the lock if there is no waiter
+            std::atomic<std::size_t> count_{0};
+        };
+
+        // Waiter suspending the calling thread
+        struct blocking_waiter : waiter_base
+        {
+            void notify() noexcept override
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                notified_ = true;
+                cond_.notify_one(std::move(l));
+            }
+
+            void wait()
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                while (!notified_)
+                {
+                    cond_.wait(l, "channel_mpmc_lockfree::wait");
+                }
+                notified_ = false;
+            }
+
+            mutex_type mtx_;
+            hpx::lcos::local::detail::condition_variable cond_;
+            bool notified_ = false;
+        };
+
+        ////////////////////////////////////////////////////////////////////////
+        static std::size_t round_up_to_power_of_two(std::size_t size) noexcept
+        {
+            std::size_t result = 2;
+            while (result < size)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        // make the given slot available to the other side
+        struct publish_on_exit
+        {
+            ~publish_on_exit()
+            {
+                c_->sequence_.store(sequence_, std::memory_order_release);
+            }
+
+            cell* c_;
+            std::size_t sequence_;
+        };
+
+        // lock-free operations on the ring buffer
+        bool push(T& val) noexcept(nothrow_move)
+        {
+            std::size_t pos = enqueue_pos_.data_.load(std::memory_order_relaxed);
+            cell* c = nullptr;
+            for (;;)
+            {
+                c = &buffer_[pos & mask_];
+                std::size_t seq = c->sequence_.load(std::memory_order_acquire);
+                std::intptr_t diff = static_cast<std::intptr_t>(seq) -
+                    static_cast<std::intptr_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (enqueue_pos_.data_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // full
+                }
+                else
+                {
+                    pos = enqueue_pos_.data_.load(std::memory_order_relaxed);
+                }
+            }
+
+            // the claimed slot is released even if the move throws,
+            // otherwise all consumers would stall on it (it holds a valid but
+            // unspecified value in this case)
+            publish_on_exit publish{c, pos + 1};
+            c->data_ = std::move(val);
+            return true;
+        }
+
+        bool pop(T& val) noexcept(nothrow_move)
+        {
+            std::size_t pos = dequeue_pos_.data_.load(std::memory_order_relaxed);
+            cell* c = nullptr;
+            for (;;)
+            {
+                c = &buffer_[pos & mask_];
+                std::size_t seq = c->sequence_.load(std::memory_order_acquire);
+                std::intptr_t diff = static_cast<std::intptr_t>(seq) -
+                    static_cast<std::intptr_t>(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (dequeue_pos_.data_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // empty
+                }
+                else
+                {
+                    pos = dequeue_pos_.data_.load(std::memory_order_relaxed);
+                }
+            }
+
+            // the slot is handed back to the producers even if the move
+            // throws, the value is lost in this case
+            publish_on_exit publish{c, pos + mask_ + 1};
+            val = std::move(c->data_);
+            return true;
+        }
+
+        status try_send(T& val) noexcept(nothrow_move)
+        {
+            if (closed_.load(std::memory_order_acquire))
+            {
+                return status::closed;
+            }
+            return push(val) ? status::ok : status::would_block;
+        }
+
+        status try_receive(T& val) noexcept(nothrow_move)
+        {
+            if (pop(val))
+            {
+                return status::ok;
+            }
+            return closed_.load(std::memory_order_acquire) ?
+                status::closed :
+                status::would_block;
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Wake up the first waiter of the given list, if any
+        void notify_one(waiter_list& waiters) noexcept
+        {
+            // pairs with the fence in register_waiter
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiters.count_.load(std::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+
+            waiter_base* w = nullptr;
+            {
+                std::unique_lock<mutex_type> l(mtx_.data_);
+                w = waiters.pop_front();
+                if (w != nullptr)
+                {
+                    waiters.count_.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+
+            if (w != nullptr)
+            {
+                w->notify();
+            }
+        }
+
+        std::size_t notify_all(waiter_list& waiters) noexcept
+        {
+            waiter_base* w = nullptr;
+            {
+                std::unique_lock<mutex_type> l(mtx_.data_);
+                w = waiters.head_;
+                waiters.head_ = waiters.tail_ = nullptr;
+                waiters.count_.store(0, std::memory_order_relaxed);
+            }
+
+            std::size_t count = 0;
+            while (w != nullptr)
+            {
+                // the waiter may go out of scope once notified
+                waiter_base* next = w->next_;
+                w->notify();
+                w = next;
+                ++count;
+            }
+            return count;
+        }
+
+        // Register the given waiter unless the operation f succeeds (or the
+        // channel was closed) after the waiter has been made visible to the
+        // notifying side. Return the result of the last invocation of f.
+        template <typename F>
+        status register_waiter(waiter_list& waiters, waiter_base& w, F&& f)
+        {
+            std::unique_lock<mutex_type> l(mtx_.data_);
+
+            waiters.count_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            status s = status::would_block;
+            try
+            {
+                s = f();
+            }
+            catch (...)
+            {
+                waiters.count_.fetch_sub(1, std::memory_order_relaxed);
+                throw;
+            }
+
+            if (s == status::would_block)
+            {
+                waiters.push_back(&w);
+            }
+            else
+            {
+                waiters.count_.fetch_sub(1, std::memory_order_relaxed);
+            }
+            return s;
+        }
+
+        // Retrieve a value or register the given waiter, notify a sender if
+        // a value was retrieved.
+        status receive_or_wait(T& val, waiter_base& w)
+        {
+            status s = try_receive(val);
+            if (s == status::would_block)
+            {
+                s = register_waiter(
+                    receive_waiters_, w, [&] { return try_receive(val); });
+            }
+            if (s == status::ok)
+            {
+                notify_one(send_waiters_);
+            }
+            return s;
+        }
+
+        // Store the value or register the given waiter, notify a receiver if
+        // a value was stored.
+        status send_or_wait(T& val, waiter_base& w)
+        {
+            status s = try_send(val);
+            if (s == status::would_block)
+            {
+                s = register_waiter(
+                    send_waiters_, w, [&] { return try_send(val); });
+            }
+            if (s == status::ok)
+            {
+                notify_one(receive_waiters_);
+            }
+            return s;
+        }
+
+        template <typename Receiver>
+        static void set_closed_error(Receiver& r) noexcept
+        {
+            try
+            {
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::channel_mpmc_lockfree::async_send",
+                    "attempting to write to a closed channel");
+            }
+            catch (...)
+            {
+                hpx::execution::experimental::set_error(
+                    std::move(r), std::current_exception());
+            }
+        }
+
+    public:
+        explicit channel_mpmc_lockfree(std::size_t size)
+          : mask_(round_up_to_power_of_two(size) - 1)
+          , buffer_(new cell[mask_ + 1])
+          , closed_(false)
+        {
+            HPX_ASSERT(size != 0);
+
+            for (std::size_t i = 0; i != mask_ + 1; ++i)
+            {
+                buffer_[i].sequence_.store(i, std::memory_order_relaxed);
+            }
+
+            enqueue_pos_.data_.store(0, std::memory_order_relaxed);
+            dequeue_pos_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        // waiters refer to the channel, it can't be moved or copied
+        channel_mpmc_lockfree(channel_mpmc_lockfree const&) = delete;
+        channel_mpmc_lockfree(channel_mpmc_lockfree&&) = delete;
+        channel_mpmc_lockfree& operator=(
+            channel_mpmc_lockfree const&) = delete;
+        channel_mpmc_lockfree& operator=(channel_mpmc_lockfree&&) = delete;
+
+        ~channel_mpmc_lockfree()
+        {
+            HPX_ASSERT(receive_waiters_.head_ == nullptr &&
+                send_waiters_.head_ == nullptr);
+        }
+
+        // Retrieve a value without blocking, return false if the channel is
+        // empty.
+        bool try_get(T& val) noexcept(nothrow_move)
+        {
+            if (!pop(val))
+            {
+                return false;
+            }
+            notify_one(send_waiters_);
+            return true;
+        }
+
+        // Store a value without blocking, return false if the channel is full
+        // or was closed.
+        bool try_set(T&& val) noexcept(nothrow_move)
+        {
+            if (try_send(val) != status::ok)
+            {
+                return false;
+            }
+            notify_one(receive_waiters_);
+            return true;
+        }
+
+        // Retrieve a value, suspend the calling thread while the channel is
+        // empty. Return false if the channel was closed and no value is
+        // available.
+        bool get(T& val)
+        {
+            for (std::size_t k = 0; k != 16; ++k)
+            {
+                if (try_get(val))
+                {
+                    return true;
+                }
+                hpx::execution_base::this_thread::yield_k(
+                    k, "hpx::lcos::local::channel_mpmc_lockfree::get");
+            }
+
+            blocking_waiter w;
+            for (;;)
+            {
+                status s = receive_or_wait(val, w);
+                if (s != status::would_block)
+                {
+                    return s == status::ok;
+                }
+                w.wait();
+            }
+        }
+
+        // Store a value, suspend the calling thread while the channel is
+        // full. Return false if the channel was closed.
+        bool set(T&& val)
+        {
+            for (std::size_t k = 0; k != 16; ++k)
+            {
+                status s = try_send(val);
+                if (s != status::would_block)
+                {
+                    if (s == status::ok)
+                    {
+                        notify_one(receive_waiters_);
+                    }
+                    return s == status::ok;
+                }
+                hpx::execution_base::this_thread::yield_k(
+                    k, "hpx::lcos::local::channel_mpmc_lockfree::set");
+            }
+
+            blocking_waiter w;
+            for (;;)
+            {
+                status s = send_or_wait(val, w);
+                if (s != status::would_block)
+                {
+                    return s == status::ok;
+                }
+                w.wait();
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // The sender returned from async_receive sends the retrieved value
+        // once it is available, it calls set_done if the channel was closed
+        // and no value is available.
+        struct receive_sender
+        {
+            channel_mpmc_lockfree* channel_;
+
+            template <template <typename...> class Tuple,
+                template <typename...> class Variant>
+            using value_types = Variant<Tuple<T>>;
+
+            template <template <typename...> class Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_done = true;
+
+            template <typename R>
+            struct operation_state : waiter_base
+            {
+                channel_mpmc_lockfree* channel_;
+                std::decay_t<R> r_;
+
+                template <typename R_>
+                operation_state(channel_mpmc_lockfree* channel, R_&& r)
+                  : channel_(channel)
+                  , r_(std::forward<R_>(r))
+                {
+                }
+
+                // the operation state must not be moved once started
+                operation_state(operation_state&&) = default;
+                operation_state& operator=(operation_state&&) = delete;
+                operation_state(operation_state const&) = delete;
+                operation_state& operator=(operation_state const&) = delete;
+
+                void start() noexcept
+                {
+                    notify();
+                }
+
+                void notify() noexcept override
+                {
+                    T val;
+                    status s = status::would_block;
+                    try
+                    {
+                        s = channel_->receive_or_wait(val, *this);
+                    }
+                    catch (...)
+                    {
+                        hpx::execution::experimental::set_error(
+                            std::move(r_), std::current_exception());
+                        return;
+                    }
+
+                    if (s == status::ok)
+                    {
+                        try
+                        {
+                            hpx::execution::experimental::set_value(
+                                std::move(r_), std::move(val));
+                        }
+                        catch (...)
+                        {
+                            hpx::execution::experimental::set_error(
+                                std::move(r_), std::current_exception());
+                        }
+                    }
+                    else if (s == status::closed)
+                    {
+                        hpx::execution::experimental::set_done(std::move(r_));
+                    }
+                }
+            };
+
+            template <typename R>
+            operation_state<R> connect(R&& r) &&
+            {
+                return operation_state<R>(channel_, std::forward<R>(r));
+            }
+        };
+
+        // The sender returned from async_send stores the value once there is
+        // space available in the channel, it sends no value. It calls
+        // set_error if the channel was closed.
+        struct send_sender
+        {
+            channel_mpmc_lockfree* channel_;
+            T val_;
+
+            template <template <typename...> class Tuple,
+                template <typename...> class Variant>
+            using value_types = Variant<Tuple<>>;
+
+            template <template <typename...> class Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_done = false;
+
+            template <typename R>
+            struct operation_state : waiter_base
+            {
+                channel_mpmc_lockfree* channel_;
+                T val_;
+                std::decay_t<R> r_;
+
+                template <typename R_>
+                operation_state(channel_mpmc_lockfree* channel, T&& val, R_&& r)
+                  : channel_(channel)
+                  , val_(std::move(val))
+                  , r_(std::forward<R_>(r))
+                {
+                }
+
+                // the operation state must not be moved once started
+                operation_state(operation_state&&) = default;
+                operation_state& operator=(operation_state&&) = delete;
+                operation_state(operation_state const&) = delete;
+                operation_state& operator=(operation_state const&) = delete;
+
+                void start() noexcept
+                {
+                    notify();
+                }
+
+                void notify() noexcept override
+                {
+                    status s = status::would_block;
+                    try
+                    {
+                        s = channel_->send_or_wait(val_, *this);
+                    }
+                    catch (...)
+                    {
+                        hpx::execution::experimental::set_error(
+                            std::move(r_), std::current_exception());
+                        return;
+                    }
+
+                    if (s == status::ok)
+                    {
+                        try
+                        {
+                            hpx::execution::experimental::set_value(
+                                std::move(r_));
+                        }
+                        catch (...)
+                        {
+                            hpx::execution::experimental::set_error(
+                                std::move(r_), std::current_exception());
+                        }
+                    }
+                    else if (s == status::closed)
+                    {
+                        set_closed_error(r_);
+                    }
+                }
+            };
+
+            template <typename R>
+            operation_state<R> connect(R&& r) &&
+            {
+                return operation_state<R>(
+                    channel_, std::move(val_), std::forward<R>(r));
+            }
+        };
+
+        // Return a sender retrieving a value from the channel
+        receive_sender async_receive() noexcept
+        {
+            return receive_sender{this};
+        }
+
+        // Return a sender storing the given value in the channel
+        send_sender async_send(T val)
+        {
+            return send_sender{this, std::move(val)};
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Close the channel, all waiting operations are notified. Return the
+        // number of notified operations.
+        std::size_t close()
+        {
+            if (closed_.exchange(true, std::memory_order_acq_rel))
+            {
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::channel_mpmc_lockfree::close",
+                    "attempting to close an already closed channel");
+            }
+
+            return notify_all(receive_waiters_) + notify_all(send_waiters_);
+        }
+
+        bool is_closed() const noexcept
+        {
+            return closed_.load(std::memory_order_acquire);
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return mask_ + 1;
+        }
+
+    private:
+        // keep the enqueue and the dequeue positions and the lock protecting
+        // the waiter lists in separate cache lines
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> enqueue_pos_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> dequeue_pos_;
+        hpx::util::cache_aligned_data<mutex_type> mtx_;
+
+        std::size_t mask_;
+        std::unique_ptr<cell[]> buffer_;
+
+        std::atomic<bool> closed_;
+
+        waiter_list receive_waiters_;
+        waiter_list send_waiters_;
+    };
+}}}    // namespace hpx::lcos::local
@@ -10,6 +10,7 @@
 #include <hpx/local/init.hpp>
 #include <hpx/modules/timing.hpp>
 #include <hpx/synchronization/channel_mpmc.hpp>
+#include <hpx/synchronization/channel_mpmc_lockfree.hpp>
 #include <hpx/thread.hpp>
 
 #include <cstddef>
@@ -56,9 +57,24 @@ inline void channel_set(hpx::lcos::local::channel_mpmc<data>& c, data&& val)
     }
 }
 
+// the lock-free channel suspends the calling thread if necessary
+inline data channel_get(hpx::lcos::local::channel_mpmc_lockfree<data>& c)
+{
+    data result;
+    c.get(result);
+    return result;
+}
+
+inline void channel_set(
+    hpx::lcos::local::channel_mpmc_lockfree<data>& c, data&& val)
+{
+    c.set(std::move(val));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Produce
-double thread_func_0(hpx::lcos::local::channel_mpmc<data>& c)
+template <typename Channel>
+double thread_func_0(Channel& c)
 {
     std::uint64_t start = hpx::chrono::high_resolution_clock::now();
 
@@ -73,7 +89,8 @@ double thread_func_0(hpx::lcos::local::channel_mpmc<data>& c)
 }
 
 // Consume
-double thread_func_1(hpx::lcos::local::channel_mpmc<data>& c)
+template <typename Channel>
+double thread_func_1(Channel& c)
 {
     std::uint64_t start = hpx::chrono::high_resolution_clock::now();
 
@@ -91,20 +108,33 @@ double thread_func_1(hpx::lcos::local::channel_mpmc<data>& c)
     return static_cast<double>(end - start) / 1e9;
 }
 
-int hpx_main()
+template <typename Channel>
+void measure_throughput(char const* name)
 {
-    hpx::lcos::local::channel_mpmc<data> c(10000);
+    Channel c(10000);
 
-    hpx::future<double> producer = hpx::async(thread_func_0, std::ref(c));
-    hpx::future<double> consumer = hpx::async(thread_func_1, std::ref(c));
+    hpx::future<double> producer =
+        hpx::async(&thread_func_0<Channel>, std::ref(c));
+    hpx::future<double> consumer =
+        hpx::async(&thread_func_1<Channel>, std::ref(c));
 
     auto producer_time = producer.get();
-    std::cout << "Producer throughput: " << (NUM_TESTS / producer_time)
-              << " [op/s] (" << (producer_time / NUM_TESTS) << " [s/op])\n";
+    std::cout << name << ": Producer throughput: "
+              << (NUM_TESTS / producer_time) << " [op/s] ("
+              << (producer_time / NUM_TESTS) << " [s/op])\n";
 
     auto consumer_time = consumer.get();
-    std::cout << "Consumer throughput: " << (NUM_TESTS / consumer_time)
-              << " [op/s] (" << (consumer_time / NUM_TESTS) << " [s/op])\n";
+    std::cout << name << ": Consumer throughput: "
+              << (NUM_TESTS / consumer_time) << " [op/s] ("
+              << (consumer_time / NUM_TESTS) << " [s/op])\n";
+}
+
+int hpx_main()
+{
+    measure_throughput<hpx::lcos::local::channel_mpmc<data>>(
+        "channel_mpmc");
+    measure_throughput<hpx::lcos::local::channel_mpmc_lockfree<data>>(
+        "channel_mpmc_lockfree");
 
     return hpx::local::finalize();
 }
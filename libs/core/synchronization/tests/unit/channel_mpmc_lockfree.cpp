@@ -0,0 +1,304 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/channel_mpmc_lockfree.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using channel_type = hpx::lcos::local::channel_mpmc_lockfree<int>;
+
+constexpr int NUM_PRODUCERS = 4;
+constexpr int NUM_CONSUMERS = 4;
+constexpr int NUM_ITEMS = 10000;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_try_get_set()
+{
+    // the capacity is rounded up to the next power of two
+    channel_type c(3);
+    HPX_TEST_EQ(c.capacity(), std::size_t(4));
+
+    for (int i = 0; i != 4; ++i)
+    {
+        HPX_TEST(c.try_set(int(i)));
+    }
+    HPX_TEST(!c.try_set(4));
+
+    int val = -1;
+    for (int i = 0; i != 4; ++i)
+    {
+        HPX_TEST(c.try_get(val));
+        HPX_TEST_EQ(val, i);
+    }
+    HPX_TEST(!c.try_get(val));
+
+    // values can be retrieved after the channel was closed
+    HPX_TEST(c.try_set(42));
+    c.close();
+    HPX_TEST(c.is_closed());
+    HPX_TEST(!c.try_set(43));
+    HPX_TEST(c.get(val));
+    HPX_TEST_EQ(val, 42);
+    HPX_TEST(!c.get(val));
+
+    bool caught_exception = false;
+    try
+    {
+        c.close();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void producer(channel_type& c, int base)
+{
+    for (int i = 0; i != NUM_ITEMS; ++i)
+    {
+        HPX_TEST(c.set(base + i));
+    }
+}
+
+std::int64_t consumer(channel_type& c)
+{
+    std::int64_t sum = 0;
+    int val = 0;
+    while (c.get(val))
+    {
+        sum += val;
+    }
+    return sum;
+}
+
+void test_blocking_get_set()
+{
+    // a small capacity makes both, producers and consumers, suspend
+    channel_type c(2);
+
+    std::vector<hpx::future<std::int64_t>> consumers;
+    for (int i = 0; i != NUM_CONSUMERS; ++i)
+    {
+        consumers.push_back(hpx::async(&consumer, std::ref(c)));
+    }
+
+    std::vector<hpx::future<void>> producers;
+    for (int i = 0; i != NUM_PRODUCERS; ++i)
+    {
+        producers.push_back(
+            hpx::async(&producer, std::ref(c), i * NUM_ITEMS));
+    }
+
+    hpx::wait_all(producers);
+    c.close();
+
+    std::int64_t sum = 0;
+    for (auto& f : consumers)
+    {
+        sum += f.get();
+    }
+
+    std::int64_t const n = std::int64_t(NUM_PRODUCERS) * NUM_ITEMS;
+    HPX_TEST_EQ(sum, n * (n - 1) / 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct result
+{
+    std::atomic<int> value{-1};
+    std::atomic<bool> value_called{false};
+    std::atomic<bool> error_called{false};
+    std::atomic<bool> done_called{false};
+};
+
+struct receiver
+{
+    result& r;
+
+    void set_value(int val) && noexcept
+    {
+        r.value = val;
+        r.value_called = true;
+    }
+
+    void set_value() && noexcept
+    {
+        r.value_called = true;
+    }
+
+    void set_error(std::exception_ptr) && noexcept
+    {
+        r.error_called = true;
+    }
+
+    void set_done() && noexcept
+    {
+        r.done_called = true;
+    }
+};
+
+void test_senders()
+{
+    namespace ex = hpx::execution::experimental;
+
+    static_assert(ex::is_sender<channel_type::receive_sender>::value,
+        "channel_type::receive_sender must be a sender");
+    static_assert(ex::is_sender<channel_type::send_sender>::value,
+        "channel_type::send_sender must be a sender");
+
+    channel_type c(1);
+    HPX_TEST_EQ(c.capacity(), std::size_t(2));
+
+    // receiving from an empty channel completes once a value is stored
+    {
+        result r;
+        auto os = ex::connect(c.async_receive(), receiver{r});
+        ex::start(os);
+        HPX_TEST(!r.value_called);
+
+        HPX_TEST(c.try_set(42));
+        HPX_TEST(r.value_called);
+        HPX_TEST_EQ(r.value.load(), 42);
+    }
+
+    // sending to a full channel completes once a value is retrieved
+    {
+        HPX_TEST(c.try_set(1));
+        HPX_TEST(c.try_set(2));
+
+        result r;
+        auto os = ex::connect(c.async_send(3), receiver{r});
+        ex::start(os);
+        HPX_TEST(!r.value_called);
+
+        int val = 0;
+        HPX_TEST(c.try_get(val));
+        HPX_TEST_EQ(val, 1);
+        HPX_TEST(r.value_called);
+
+        HPX_TEST(c.try_get(val));
+        HPX_TEST_EQ(val, 2);
+        HPX_TEST(c.try_get(val));
+        HPX_TEST_EQ(val, 3);
+    }
+
+    // closing the channel completes pending receive operations
+    {
+        result r;
+        auto os = ex::connect(c.async_receive(), receiver{r});
+        ex::start(os);
+        HPX_TEST(!r.done_called);
+
+        HPX_TEST_EQ(c.close(), std::size_t(1));
+        HPX_TEST(r.done_called);
+        HPX_TEST(!r.value_called);
+    }
+
+    // sending to a closed channel reports an error
+    {
+        result r;
+        auto os = ex::connect(c.async_send(4), receiver{r});
+        ex::start(os);
+        HPX_TEST(r.error_called);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// moving a value out of an instance marked as 'poisoned' throws
+struct throwing_move
+{
+    throwing_move() = default;
+
+    explicit throwing_move(int value, bool poisoned = false)
+      : value_(value)
+      , poisoned_(poisoned)
+    {
+    }
+
+    throwing_move(throwing_move&&) = default;
+    throwing_move& operator=(throwing_move&& rhs)
+    {
+        if (rhs.poisoned_)
+        {
+            throw std::runtime_error("throwing_move");
+        }
+        value_ = rhs.value_;
+        return *this;
+    }
+
+    int value_ = 0;
+    bool poisoned_ = false;
+};
+
+void test_throwing_move()
+{
+    using throwing_channel_type =
+        hpx::lcos::local::channel_mpmc_lockfree<throwing_move>;
+
+    static_assert(noexcept(std::declval<channel_type&>().try_set(0)),
+        "try_set should be noexcept for nothrow movable types");
+    static_assert(
+        !noexcept(std::declval<throwing_channel_type&>().try_set(
+            std::declval<throwing_move>())),
+        "try_set must not be noexcept for throwing movable types");
+
+    throwing_channel_type c(2);
+
+    bool caught = false;
+    try
+    {
+        c.try_set(throwing_move(1, true));
+    }
+    catch (std::runtime_error const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+
+    // the slot claimed by the failed operation is released, the channel is
+    // still usable
+    throwing_move val;
+    HPX_TEST(c.try_get(val));
+    HPX_TEST(c.try_set(throwing_move(2)));
+    HPX_TEST(c.try_set(throwing_move(3)));
+    HPX_TEST(c.try_get(val));
+    HPX_TEST_EQ(val.value_, 2);
+    HPX_TEST(c.try_get(val));
+    HPX_TEST_EQ(val.value_, 3);
+    HPX_TEST(!c.try_get(val));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_try_get_set();
+    test_blocking_get_set();
+    test_senders();
+    test_throwing_move();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -76,6 +76,9 @@ namespace hpx { namespace threads { namespace detail {
 
         void create_work(thread_init_data& data, error_code& ec) override;
 
+        void create_work_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override;
+
         thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) override;
@@ -277,6 +280,18 @@ namespace hpx { namespace threads { namespace detail {
 
         std::int64_t get_idle_loop_count(std::size_t num, bool reset) override;
         std::int64_t get_busy_loop_count(std::size_t num, bool reset) override;
+
+        std::int64_t get_idle_park_count(std::size_t num, bool reset) override;
+        std::int64_t get_idle_unpark_count(
+            std::size_t num, bool reset) override;
+        std::int64_t get_idle_wake_latency(
+            std::size_t num, bool reset) override;
+
+        std::int64_t get_num_steals(policies::steal_level level,
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_steals(level, num, reset);
+        }
         std::int64_t get_scheduler_utilization() const override;
 
     protected:
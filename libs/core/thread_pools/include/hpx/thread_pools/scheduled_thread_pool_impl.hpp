@@ -10,6 +10,10 @@
 #include <hpx/affinity/affinity_data.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concurrency/barrier.hpp>
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_stack_pool.hpp>
+#endif
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/detail/invoke.hpp>
@@ -412,6 +416,13 @@ namespace hpx { namespace threads { namespace detail {
                 id_.name(), global_thread_num);
         }
 
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+        // place the thread stacks allocated by this worker on the NUMA
+        // domain(s) the worker is bound to
+        coroutines::detail::posix::init_stack_pool(mask);
+#endif
+
         // Setting priority of worker threads to a lower priority, this
         // needs to
         // be done in order to give the parcel pool threads higher
@@ -595,6 +606,26 @@ namespace hpx { namespace threads { namespace detail {
         ++tasks_scheduled_;
     }
 
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::create_work_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        // verify state
+        if (thread_count_ == 0 && !sched_->Scheduler::is_state(state_running))
+        {
+            // thread-manager is not currently running
+            HPX_THROWS_IF(ec, invalid_status,
+                "thread_pool<Scheduler>::create_work_bulk",
+                "invalid state: thread pool is not running");
+            return;
+        }
+
+        detail::create_work_bulk(sched_.get(), data, count, ec);    //-V601
+
+        // update statistics
+        tasks_scheduled_ += static_cast<std::int64_t>(count);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Scheduler>
     thread_state scheduled_thread_pool<Scheduler>::set_state(
@@ -1753,6 +1784,27 @@ namespace hpx { namespace threads { namespace detail {
         return counter_data_[num].busy_loop_counts_;
     }
 
+    template <typename Scheduler>
+    std::int64_t scheduled_thread_pool<Scheduler>::get_idle_park_count(
+        std::size_t num, bool reset)
+    {
+        return sched_->Scheduler::get_idle_park_count(num, reset);
+    }
+
+    template <typename Scheduler>
+    std::int64_t scheduled_thread_pool<Scheduler>::get_idle_unpark_count(
+        std::size_t num, bool reset)
+    {
+        return sched_->Scheduler::get_idle_unpark_count(num, reset);
+    }
+
+    template <typename Scheduler>
+    std::int64_t scheduled_thread_pool<Scheduler>::get_idle_wake_latency(
+        std::size_t num, bool reset)
+    {
+        return sched_->Scheduler::get_idle_wake_latency(num, reset);
+    }
+
     template <typename Scheduler>
     std::int64_t scheduled_thread_pool<Scheduler>::get_scheduler_utilization()
         const
@@ -1922,6 +1974,9 @@ namespace hpx { namespace threads { namespace detail {
 
         l.unlock();
 
+        // make sure the worker is not parked
+        sched_->Scheduler::do_some_work(virt_core);
+
         HPX_ASSERT(expected == state_running || expected == state_pre_sleep ||
             expected == state_sleeping);
 
@@ -588,6 +588,10 @@ namespace hpx { namespace threads { namespace detail {
         // spin for some time after queues have become empty
         bool may_exit = false;
 
+        // number of consecutive rounds of max_idle_loop_count iterations
+        // without any work being found
+        std::size_t idle_rounds = 0;
+
         std::shared_ptr<bool> background_running = nullptr;
         thread_id_type background_thread;
 
@@ -640,6 +644,7 @@ namespace hpx { namespace threads { namespace detail {
                 HPX_ASSERT(thrd->get_scheduler_base() == &scheduler);
 
                 idle_loop_count = params.max_idle_loop_count_;
+                idle_rounds = 0;
                 ++busy_loop_count;
 
                 may_exit = false;
@@ -977,6 +982,15 @@ namespace hpx { namespace threads { namespace detail {
                 idle_loop_count = params.max_idle_loop_count_;
             }
 
+            // wake up the threads whose timers armed on this worker expired,
+            // idle workers expire the due timers of busy workers as well
+            if (scheduler.SchedulingPolicy::poll_timers(num_thread,
+                    idle_loop_count < params.max_idle_loop_count_))
+            {
+                idle_loop_count = params.max_idle_loop_count_;
+                idle_rounds = 0;
+            }
+
             // something went badly wrong, give up
             if (HPX_UNLIKELY(this_state.load() == state_terminating))
                 break;
@@ -1018,8 +1032,19 @@ namespace hpx { namespace threads { namespace detail {
             else if (idle_loop_count < 0 || may_exit)
             {
                 if (idle_loop_count < 0)
+                {
                     idle_loop_count = params.max_idle_loop_count_;
 
+                    // put this worker to sleep if it has been idle for long
+                    // enough (only if enabled)
+                    if (running && !may_exit &&
+                        scheduler.SchedulingPolicy::park_idle_worker(
+                            num_thread, ++idle_rounds))
+                    {
+                        idle_rounds = 0;
+                    }
+                }
+
                 // call back into invoking context
                 if (!params.outer_.empty())
                 {
@@ -13,9 +13,14 @@
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
+#include <cstddef>
+#include <cstdint>
+
 namespace hpx { namespace threads { namespace detail {
-    inline void create_work(policies::scheduler_base* scheduler,
-        thread_init_data& data, error_code& ec = throws)
+    // verify the given thread data and fill in the missing values, returns
+    // false if the thread data is invalid
+    inline bool init_work_data(policies::scheduler_base* scheduler,
+        thread_init_data& data, thread_self* self, error_code& ec)
     {
         // verify parameters
         switch (data.initial_state)
@@ -30,7 +35,7 @@ namespace hpx { namespace threads { namespace detail {
         {
             HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
                 "invalid initial state: {}", data.initial_state);
-            return;
+            return false;
         }
         }
 
@@ -39,7 +44,7 @@ namespace hpx { namespace threads { namespace detail {
         {
             HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
                 "description is nullptr");
-            return;
+            return false;
         }
 #endif
 
@@ -52,8 +57,6 @@ namespace hpx { namespace threads { namespace detail {
 #endif
             ;
 
-        thread_self* self = get_self_ptr();
-
 #ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
         if (nullptr == data.parent_id)
         {
@@ -89,10 +92,69 @@ namespace hpx { namespace threads { namespace detail {
             thread_priority::high_recursive == data.priority ||
             thread_priority::boost == data.priority);
 
+        return true;
+    }
+
+    inline void create_work(policies::scheduler_base* scheduler,
+        thread_init_data& data, error_code& ec = throws)
+    {
+        if (!init_work_data(scheduler, data, get_self_ptr(), ec))
+            return;
+
         scheduler->create_thread(data, nullptr, ec);
 
         // NOTE: Don't care if the hint is a NUMA hint, just want to wake up a
         // thread.
         scheduler->do_some_work(data.schedulehint.hint);
     }
+
+    // create a contiguous batch of work items with a single call into the
+    // scheduler
+    inline void create_work_bulk(policies::scheduler_base* scheduler,
+        thread_init_data* data, std::size_t count, error_code& ec = throws)
+    {
+        thread_self* self = get_self_ptr();
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            if (!init_work_data(scheduler, data[i], self, ec))
+                return;
+        }
+
+        scheduler->create_threads_bulk(data, count, ec);
+        if (ec)
+            return;
+
+        // wake up one thread for each of the queues that received work,
+        // items the scheduler has not assigned to a particular queue may be
+        // picked up by any worker, wake up one worker for each of those
+        std::size_t num_unassigned = 0;
+        std::int16_t hint = -1;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            if (data[i].schedulehint.hint < 0)
+            {
+                ++num_unassigned;
+            }
+            else if (data[i].schedulehint.hint != hint)
+            {
+                hint = data[i].schedulehint.hint;
+                scheduler->do_some_work(hint);
+            }
+        }
+
+        if (num_unassigned != 0)
+        {
+            // there is no point in waking up more workers than there are
+            // in the pool
+            std::size_t const num_workers =
+                scheduler->get_parent_pool()->get_os_thread_count();
+            if (num_unassigned > num_workers)
+                num_unassigned = num_workers;
+
+            for (std::size_t i = 0; i != num_unassigned; ++i)
+            {
+                scheduler->do_some_work(std::size_t(-1));
+            }
+        }
+    }
 }}}    // namespace hpx::threads::detail
@@ -0,0 +1,164 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads { namespace detail {
+
+    class timer_wheel;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A timer which can be armed on a timer_wheel. The entry is linked into
+    /// the wheel intrusively, it has to stay alive until it either fired or
+    /// was canceled. The callback is invoked once the timer expires, it must
+    /// not throw. If the callback returns false, the timer is armed again and
+    /// expires once more on the next tick.
+    class timer_wheel_entry
+    {
+    public:
+        using callback_type = bool (*)(timer_wheel_entry&);
+
+        explicit timer_wheel_entry(callback_type callback) noexcept
+          : callback_(callback)
+        {
+        }
+
+        timer_wheel_entry(timer_wheel_entry const&) = delete;
+        timer_wheel_entry& operator=(timer_wheel_entry const&) = delete;
+
+        ~timer_wheel_entry()
+        {
+            HPX_ASSERT(state_.load(std::memory_order_relaxed) == state::idle);
+        }
+
+        // returns whether the entry is currently armed
+        bool is_armed() const noexcept
+        {
+            return state_.load(std::memory_order_acquire) == state::armed;
+        }
+
+    private:
+        friend class timer_wheel;
+
+        enum class state : std::uint8_t
+        {
+            idle,      // not linked into a wheel
+            armed,     // linked into a wheel, waiting to expire
+            firing     // unlinked from the wheel, callback is running
+        };
+
+        timer_wheel_entry* next_ = nullptr;
+        timer_wheel_entry** prev_ = nullptr;
+        std::uint64_t expiry_ = 0;    // in ticks
+        std::uint8_t level_ = 0;
+        std::atomic<state> state_{state::idle};
+        callback_type callback_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A hierarchical timer wheel (see Varghese and Lauck, "Hashed and
+    /// Hierarchical Timing Wheels"). Each level has 64 slots, the slots of the
+    /// lowest level have a width of one tick (1024ns). Timers are kept in
+    /// intrusive lists, which makes arming and canceling a timer O(1).
+    /// Expiring timers costs O(1) per timer plus the cascading of timers from
+    /// higher levels, which happens at most once per level for each timer.
+    ///
+    /// Timers may be armed and canceled concurrently from any thread. The
+    /// wheel is usually polled by the worker thread owning it, idle worker
+    /// threads poll the wheels of other workers as well. The callbacks of
+    /// expired timers are invoked by poll on the polling thread.
+    class HPX_CORE_EXPORT timer_wheel
+    {
+    public:
+        using clock_type = std::chrono::steady_clock;
+
+        static constexpr std::size_t tick_bits = 10;
+        static constexpr std::size_t slot_bits = 6;
+        static constexpr std::size_t num_slots = std::size_t(1) << slot_bits;
+        static constexpr std::size_t num_levels = (64 + slot_bits - 1) /
+            slot_bits;
+
+        timer_wheel();
+        ~timer_wheel();
+
+        timer_wheel(timer_wheel const&) = delete;
+        timer_wheel& operator=(timer_wheel const&) = delete;
+
+        // Arm the given timer to expire at the given point in time. The
+        // timer's callback will be invoked by the first call to poll which
+        // observes a time not earlier than abs_time.
+        void add(timer_wheel_entry& e, clock_type::time_point abs_time);
+
+        // Cancel the given timer. Returns true if the timer was disarmed
+        // before it expired. Otherwise, waits for a concurrently running
+        // callback of the timer to finish and returns false.
+        bool cancel(timer_wheel_entry& e);
+
+        // Expire all timers which are due at the given point in time and
+        // invoke their callbacks. Returns the number of expired timers. If
+        // wait_for_lock is false, nothing is done if the wheel is being
+        // modified or polled concurrently.
+        std::size_t poll(clock_type::time_point now, bool wait_for_lock = true);
+
+        std::size_t poll()
+        {
+            return empty() ? 0 : poll(clock_type::now());
+        }
+
+        std::size_t try_poll()
+        {
+            return empty() ? 0 : poll(clock_type::now(), false);
+        }
+
+        // returns whether no timers are armed on this wheel
+        bool empty() const noexcept
+        {
+            return size_.load(std::memory_order_relaxed) == 0;
+        }
+
+        // returns the number of timers armed on this wheel
+        std::size_t size() const noexcept
+        {
+            return size_.load(std::memory_order_relaxed);
+        }
+
+        // Returns the earliest point in time at which a timer armed on this
+        // wheel may expire, clock_type::time_point::max() if no timer is
+        // armed.
+        clock_type::time_point next_expiry() const noexcept;
+
+    private:
+        void link(timer_wheel_entry& e) noexcept;
+        void unlink(timer_wheel_entry& e) noexcept;
+        timer_wheel_entry* take_slot(std::size_t level, std::size_t slot);
+        std::uint64_t next_event() const noexcept;
+
+        mutable hpx::util::detail::spinlock mtx_;
+
+        // the current time in ticks, modified only while holding the lock
+        std::uint64_t now_;
+
+        // lower bound for the expiry of the earliest armed timer
+        std::atomic<std::uint64_t> next_tick_;
+        std::atomic<std::size_t> size_;
+
+        std::uint64_t occupied_[num_levels];
+        timer_wheel_entry* slots_[num_levels][num_slots];
+    };
+}}}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
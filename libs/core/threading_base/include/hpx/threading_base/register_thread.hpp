@@ -222,6 +222,36 @@ namespace hpx { namespace threads {
     {
         register_work(data, detail::get_self_or_default_pool(), ec);
     }
+
+    /// \brief Create a contiguous batch of new work items using the given
+    ///        data with a single call into the scheduler.
+    ///
+    /// \param data       [in] Points to the first element of the data to use
+    ///                   for creating the threads.
+    /// \param count      [in] The number of threads to create.
+    /// \param pool       [in] The thread pool to use for launching the work.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    ///
+    /// \note             As long as \a ec is not pre-initialized to
+    ///                   \a hpx#throws this function doesn't
+    ///                   throw but returns the result code using the
+    ///                   parameter \a ec. Otherwise it throws an instance
+    ///                   of hpx#exception.
+    inline void register_work_bulk(threads::thread_init_data* data,
+        std::size_t count, threads::thread_pool_base* pool,
+        error_code& ec = throws)
+    {
+        HPX_ASSERT(pool);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            data[i].run_now = false;
+        }
+        pool->create_work_bulk(data, count, ec);
+    }
 }}    // namespace hpx::threads
 
 /// \endcond
@@ -12,6 +12,7 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -24,6 +25,7 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
@@ -99,6 +101,48 @@ namespace hpx { namespace threads { namespace policies {
         /// possibly idling OS threads
         void do_some_work(std::size_t);
 
+        /// This function gets called by the scheduling loop whenever the
+        /// given worker thread has been idle for another max_idle_loop_count
+        /// iterations. If parking is enabled (see
+        /// policies::enable_idle_parking) and the worker has spun for long
+        /// enough, the worker is put to sleep until new work is scheduled or
+        /// max_idle_backoff_time has elapsed. The number of idle rounds the
+        /// worker spins before parking adapts to the measured time the worker
+        /// stayed parked. The idle stacks cached by the worker are trimmed
+        /// once it has been idle for hpx.stacks.pool_trim_delay or when it
+        /// gets parked.
+        ///
+        /// \returns true if the worker was parked and got woken up because
+        ///          of new work.
+        bool park_idle_worker(std::size_t num_thread, std::size_t idle_rounds);
+
+        /// Return the timer wheel of the given worker thread. Timers armed on
+        /// it are expired by the scheduling loop of that worker thread, or by
+        /// any idle worker thread (see poll_timers).
+        threads::detail::timer_wheel& get_timer_wheel(std::size_t num_thread)
+        {
+            HPX_ASSERT(num_thread < timer_wheels_.size());
+            return timer_wheels_[num_thread].data_;
+        }
+
+        /// This function gets called by the scheduling loop of the given
+        /// worker thread to expire the timers which are due on its timer
+        /// wheel. Idle worker threads additionally expire the due timers of
+        /// the other worker threads, whose owners may be busy running a long
+        /// task.
+        ///
+        /// \returns true if at least one timer has expired.
+        bool poll_timers(std::size_t num_thread, bool idle = false)
+        {
+            HPX_ASSERT(num_thread < timer_wheels_.size());
+            bool expired = timer_wheels_[num_thread].data_.poll() != 0;
+            if (idle && poll_other_timers(num_thread))
+            {
+                expired = true;
+            }
+            return expired;
+        }
+
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
 
@@ -189,6 +233,19 @@ namespace hpx { namespace threads { namespace policies {
             std::size_t num_thread, bool reset) = 0;
 #endif
 
+        // statistics collected for parked worker threads
+        std::int64_t get_idle_park_count(std::size_t num_thread, bool reset);
+        std::int64_t get_idle_unpark_count(std::size_t num_thread, bool reset);
+        std::int64_t get_idle_wake_latency(std::size_t num_thread, bool reset);
+
+        // number of successful steal operations of the given worker thread
+        // from victims on the given level of the hardware topology
+        virtual std::int64_t get_num_steals(steal_level /*level*/,
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
         virtual std::int64_t get_queue_length(
             std::size_t num_thread = std::size_t(-1)) const = 0;
 
@@ -221,6 +278,13 @@ namespace hpx { namespace threads { namespace policies {
         virtual void create_thread(
             thread_init_data& data, thread_id_type* id, error_code& ec) = 0;
 
+        // Create a contiguous batch of new threads. Schedulers may override
+        // this to enqueue the whole batch at once, the default creates the
+        // threads one by one. The schedule hints of the passed thread data
+        // are updated to refer to the worker thread that received it.
+        virtual void create_threads_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
         virtual bool get_next_thread(std::size_t num_thread, bool running,
             threads::thread_data*& thrd, bool enable_stealing) = 0;
 
@@ -354,6 +418,49 @@ namespace hpx { namespace threads { namespace policies {
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
 #endif
 
+        // support for parking of idle worker threads
+        bool unpark_idle_worker(std::size_t num_thread);
+        void unpark_all_idle_workers();
+
+        struct idle_parking_data
+        {
+            pu_mutex_type mtx_;
+            std::condition_variable cond_;
+
+            // set while the worker is parked, modified only while holding
+            // mtx_ but may be inspected without holding the lock
+            std::atomic<bool> parked_;
+
+            // protected by mtx_
+            bool notified_;
+            std::chrono::steady_clock::time_point notify_time_;
+
+            // only accessed by the owning worker thread
+            std::size_t spin_rounds_;
+            std::chrono::steady_clock::time_point idle_start_;
+            bool stacks_trimmed_;
+
+            std::atomic<std::int64_t> park_count_;
+            std::atomic<std::int64_t> unpark_count_;
+            std::atomic<std::int64_t> wake_latency_;
+            std::atomic<std::int64_t> wake_latency_count_;
+        };
+        std::vector<util::cache_line_data<idle_parking_data>> parking_data_;
+        std::atomic<std::size_t> num_parked_;
+
+        // the timers armed by the threads running on each worker thread
+        std::vector<util::cache_line_data<threads::detail::timer_wheel>>
+            timer_wheels_;
+
+        // expire the due timers of all but the given worker thread
+        bool poll_other_timers(std::size_t num_thread);
+
+        // the earliest expiry of a timer the given worker thread has to wake
+        // up for while sleeping, this includes the timers of all worker
+        // threads which are not sleeping themselves
+        std::chrono::steady_clock::time_point next_timer_expiry(
+            std::size_t num_thread) const;
+
         // support for suspension of pus
         std::vector<pu_mutex_type> suspend_mtxs_;
         std::vector<std::condition_variable> suspend_conds_;
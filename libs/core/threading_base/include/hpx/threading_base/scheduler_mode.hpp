@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace hpx { namespace threads { namespace policies {
@@ -58,6 +59,16 @@ namespace hpx { namespace threads { namespace policies {
         /// This option allows for certain schedulers to explicitly disable
         /// exponential idle-back off
         enable_idle_backoff = 0x0800,
+        /// This option tells schedulers to park worker threads which have been
+        /// idle for some (adaptively determined) time. Parked worker threads
+        /// do not consume any CPU time and are woken up one by one as new work
+        /// is being scheduled.
+        enable_idle_parking = 0x1000,
+        /// This option tells schedulers that support it to select victims
+        /// for work stealing level by level along the hardware topology
+        /// (same core, same last level cache, same NUMA domain, other NUMA
+        /// domains), visiting the victims of each level in random order.
+        enable_stealing_topology = 0x2000,
 
         // clang-format off
         /// This option represents the default mode.
@@ -83,7 +94,21 @@ namespace hpx { namespace threads { namespace policies {
             assign_work_thread_parent |
             steal_high_priority_first |
             steal_after_local |
-            enable_idle_backoff
+            enable_idle_backoff |
+            enable_idle_parking |
+            enable_stealing_topology
         // clang-format on
     };
+
+    /// The levels of the hardware topology schedulers group the victims for
+    /// work stealing by.
+    enum class steal_level : std::uint8_t
+    {
+        core = 0,      ///< the victim runs on the same core
+        cache = 1,     ///< the victim shares the last level cache
+        numa = 2,      ///< the victim runs in the same NUMA domain
+        remote = 3,    ///< the victim runs in a different NUMA domain
+    };
+
+    constexpr std::size_t num_steal_levels = 4;
 }}}    // namespace hpx::threads::policies
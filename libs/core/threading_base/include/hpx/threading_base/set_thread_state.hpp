@@ -7,28 +7,23 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/config/asio.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/coroutines/coroutine.hpp>
 #include <hpx/functional/bind.hpp>
-#include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/threading_base/create_thread.hpp>
 #include <hpx/threading_base/create_work.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
-
-#include <asio/basic_waitable_timer.hpp>
-#include <asio/io_context.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/timing/steady_clock.hpp>
 
 #include <atomic>
-#include <chrono>
 #include <cstddef>
-#include <functional>
-#include <memory>
 #include <string>
-#include <system_error>
 
 namespace hpx { namespace threads { namespace detail {
     ///////////////////////////////////////////////////////////////////////////
@@ -279,52 +274,63 @@ namespace hpx { namespace threads { namespace detail {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    /// This thread function is used by the at_timer thread below to trigger
-    /// the required action.
-    inline thread_result_type wake_timer_thread(thread_id_type const& thrd,
-        thread_schedule_state /*newstate*/,
-        thread_restart_state /*newstate_ex*/, thread_priority /*priority*/,
-        thread_id_type const& timer_id,
-        std::shared_ptr<std::atomic<bool>> const& triggered,
-        bool retry_on_active, thread_restart_state my_statex)
+    /// A timer which sets the calling HPX thread to pending (with the restart
+    /// state timeout) once it expires. The timer is armed on the timer wheel
+    /// of the worker thread the calling thread runs on. The timer is expired
+    /// by that worker thread or by an idle one, it wakes up the thread
+    /// directly, without scheduling helper threads. A timer expiring while
+    /// the thread is still active is retried on the next tick. The timer has
+    /// to be canceled before the calling thread continues after it has been
+    /// woken up by any other means.
+    class wake_timer : public timer_wheel_entry
     {
-        if (HPX_UNLIKELY(!thrd))
+    public:
+        explicit wake_timer(hpx::chrono::steady_time_point const& abs_time)
+          : timer_wheel_entry(&wake_timer::expire)
+          , id_(get_self_id())
+          , timers_(get_thread_id_data(id_)
+                        ->get_scheduler_base()
+                        ->get_timer_wheel(get_local_worker_thread_num()))
         {
-            HPX_THROW_EXCEPTION(null_thread_id,
-                "threads::detail::wake_timer_thread",
-                "null thread id encountered (id)");
-            return thread_result_type(
-                thread_schedule_state::terminated, invalid_thread_id);
+            timers_.add(*this, abs_time.value());
         }
-        if (HPX_UNLIKELY(!timer_id))
+
+        ~wake_timer()
         {
-            HPX_THROW_EXCEPTION(null_thread_id,
-                "threads::detail::wake_timer_thread",
-                "null thread id encountered (timer_id)");
-            return thread_result_type(
-                thread_schedule_state::terminated, invalid_thread_id);
+            cancel();
         }
 
-        HPX_ASSERT(my_statex == thread_restart_state::abort ||
-            my_statex == thread_restart_state::timeout);
+        // returns true if the timer was canceled before it expired
+        bool cancel()
+        {
+            return timers_.cancel(*this);
+        }
 
-        if (!triggered->load())
+    private:
+        static bool expire(timer_wheel_entry& e)
         {
+            // An active thread has either not been suspended yet (if another
+            // worker thread expires the timer) or it has been woken up by
+            // other means and is about to cancel this timer. Retry in both
+            // cases, canceling the timer stops the retries.
             error_code ec(lightweight);    // do not throw
-            detail::set_thread_state(timer_id, thread_schedule_state::pending,
-                my_statex, thread_priority::boost, thread_schedule_hint(),
-                retry_on_active, ec);
+            thread_state const previous =
+                detail::set_thread_state(static_cast<wake_timer&>(e).id_,
+                    thread_schedule_state::pending,
+                    thread_restart_state::timeout, thread_priority::boost,
+                    thread_schedule_hint(), false, ec);
+            return ec ||
+                previous.state() != thread_schedule_state::active;
         }
 
-        return thread_result_type(
-            thread_schedule_state::terminated, invalid_thread_id);
-    }
+        thread_id_type id_;
+        timer_wheel& timers_;
+    };
 
     /// This thread function initiates the required set_state action (on
     /// behalf of one of the threads#detail#set_thread_state functions).
-    template <typename SchedulingPolicy>
-    thread_result_type at_timer(SchedulingPolicy& scheduler,
-        std::chrono::steady_clock::time_point& abs_time,
+    inline thread_result_type at_timer(
+        hpx::chrono::steady_time_point const& abs_time,
         thread_id_type const& thrd, thread_schedule_state newstate,
         thread_restart_state newstate_ex, thread_priority priority,
         std::atomic<bool>* started, bool retry_on_active)
@@ -337,71 +343,27 @@ namespace hpx { namespace threads { namespace detail {
                 thread_schedule_state::terminated, invalid_thread_id);
         }
 
-        // create a new thread in suspended state, which will execute the
-        // requested set_state when timer fires and will re-awaken this thread,
-        // allowing the deadline_timer to go out of scope gracefully
-        thread_id_type self_id = get_self_id();
-
-        std::shared_ptr<std::atomic<bool>> triggered(
-            std::make_shared<std::atomic<bool>>(false));
-
-        thread_init_data data(
-            util::bind_front(&wake_timer_thread, thrd, newstate, newstate_ex,
-                priority, self_id, triggered, retry_on_active),
-            "wake_timer", priority, thread_schedule_hint(),
-            thread_stacksize::small_, thread_schedule_state::suspended, true);
-
-        thread_id_type wake_id = invalid_thread_id;
-        create_thread(&scheduler, data, wake_id);
-
-        // create timer firing in correspondence with given time
-        using deadline_timer =
-            asio::basic_waitable_timer<std::chrono::steady_clock>;
-
-        asio::io_context* s = get_default_timer_service();
-        HPX_ASSERT(s);
-        deadline_timer t(*s, abs_time);
-
-        // let the timer invoke the set_state on the new (suspended) thread
-        t.async_wait([wake_id, priority, retry_on_active](
-                         std::error_code const& ec) {
-            if (ec == std::make_error_code(std::errc::operation_canceled))
-            {
-                detail::set_thread_state(wake_id,
-                    thread_schedule_state::pending, thread_restart_state::abort,
-                    priority, thread_schedule_hint(), retry_on_active, throws);
-            }
-            else
-            {
-                detail::set_thread_state(wake_id,
-                    thread_schedule_state::pending,
-                    thread_restart_state::timeout, priority,
-                    thread_schedule_hint(), retry_on_active, throws);
-            }
-        });
+        thread_restart_state statex = thread_restart_state::unknown;
+        {
+            // re-awaken this thread when the timer fires, the timer is
+            // canceled if this thread gets aborted before
+            wake_timer timer(abs_time);
 
-        if (started != nullptr)
-            started->store(true);
+            if (started != nullptr)
+                started->store(true);
 
-        // this waits for the thread to be reactivated when the timer fired
-        // if it returns signaled the timer has been canceled, otherwise
-        // the timer fired and the wake_timer_thread above has been executed
-        thread_restart_state statex = get_self().yield(thread_result_type(
-            thread_schedule_state::suspended, invalid_thread_id));
+            statex = get_self().yield(thread_result_type(
+                thread_schedule_state::suspended, invalid_thread_id));
+        }
 
         HPX_ASSERT(statex == thread_restart_state::abort ||
             statex == thread_restart_state::timeout);
 
-        // NOLINTNEXTLINE(bugprone-branch-clone)
-        if (thread_restart_state::timeout != statex)    //-V601
+        if (thread_restart_state::timeout == statex)    //-V601
         {
-            triggered->store(true);
-            // wake_timer_thread has not been executed yet, cancel timer
-            t.cancel();
-        }
-        else
-        {
-            detail::set_thread_state(thrd, newstate, newstate_ex, priority);
+            error_code ec(lightweight);    // do not throw
+            detail::set_thread_state(thrd, newstate, newstate_ex, priority,
+                thread_schedule_hint(), retry_on_active, ec);
         }
 
         return thread_result_type(
@@ -429,9 +391,8 @@ namespace hpx { namespace threads { namespace detail {
         // this creates a new thread which creates the timer and handles the
         // requested actions
         thread_init_data data(
-            util::bind(&at_timer<SchedulingPolicy>, std::ref(scheduler),
-                abs_time.value(), thrd, newstate, newstate_ex, priority,
-                started, retry_on_active),
+            util::bind(&at_timer, abs_time, thrd, newstate, newstate_ex,
+                priority, started, retry_on_active),
             "at_timer (expire at)", priority, schedulehint,
             thread_stacksize::small_, thread_schedule_state::pending, true);
 
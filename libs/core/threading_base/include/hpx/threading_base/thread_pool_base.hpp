@@ -233,6 +233,11 @@ namespace hpx { namespace threads {
             thread_init_data& data, thread_id_type& id, error_code& ec) = 0;
         virtual void create_work(thread_init_data& data, error_code& ec) = 0;
 
+        /// Create a contiguous batch of work items. The default implementation
+        /// creates the work items one by one.
+        virtual void create_work_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
         virtual thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) = 0;
@@ -489,6 +494,45 @@ namespace hpx { namespace threads {
         virtual std::int64_t get_busy_loop_count(
             std::size_t num, bool reset) = 0;
 
+        virtual std::int64_t get_idle_park_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_idle_unpark_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_idle_wake_latency(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        virtual std::int64_t get_num_steals(policies::steal_level /*level*/,
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        std::int64_t get_num_steals_same_core(std::size_t num, bool reset)
+        {
+            return get_num_steals(policies::steal_level::core, num, reset);
+        }
+        std::int64_t get_num_steals_same_cache(std::size_t num, bool reset)
+        {
+            return get_num_steals(policies::steal_level::cache, num, reset);
+        }
+        std::int64_t get_num_steals_same_numa(std::size_t num, bool reset)
+        {
+            return get_num_steals(policies::steal_level::numa, num, reset);
+        }
+        std::int64_t get_num_steals_remote(std::size_t num, bool reset)
+        {
+            return get_num_steals(policies::steal_level::remote, num, reset);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         virtual bool enumerate_threads(
             util::function_nonser<bool(thread_id_type)> const& /*f*/,
@@ -6,6 +6,10 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_stack_pool.hpp>
+#endif
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
@@ -37,7 +41,10 @@ namespace hpx { namespace threads { namespace policies {
     scheduler_base::scheduler_base(std::size_t num_threads,
         char const* description, thread_queue_init_parameters thread_queue_init,
         scheduler_mode mode)
-      : suspend_mtxs_(num_threads)
+      : parking_data_(num_threads)
+      , num_parked_(0)
+      , timer_wheels_(num_threads)
+      , suspend_mtxs_(num_threads)
       , suspend_conds_(num_threads)
       , pu_mtxs_(num_threads)
       , states_(num_threads)
@@ -61,6 +68,14 @@ namespace hpx { namespace threads { namespace policies {
         }
 #endif
 
+        for (auto&& data : parking_data_)
+        {
+            data.data_.parked_.store(false, std::memory_order_relaxed);
+            data.data_.notified_ = false;
+            data.data_.spin_rounds_ = 1;
+            data.data_.stacks_trimmed_ = false;
+        }
+
         for (std::size_t i = 0; i != num_threads; ++i)
             states_[i].store(state_initialized);
     }
@@ -68,7 +83,10 @@ namespace hpx { namespace threads { namespace policies {
     void scheduler_base::idle_callback(std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        if (mode_.data_.load(std::memory_order_relaxed) &
+        // idle parking supersedes the exponential back-off
+        if ((mode_.data_.load(std::memory_order_relaxed) &
+                (policies::enable_idle_backoff |
+                    policies::enable_idle_parking)) ==
             policies::enable_idle_backoff)
         {
             // Put this thread to sleep for some time, additionally it gets
@@ -85,6 +103,23 @@ namespace hpx { namespace threads { namespace policies {
 
             ++data.wait_count_;
 
+            // wake up in time for the next timer this worker has to expire
+            auto const next_timer = next_timer_expiry(num_thread);
+            if (next_timer != std::chrono::steady_clock::time_point::max())
+            {
+                auto const until_next_timer =
+                    next_timer - std::chrono::steady_clock::now();
+                if (until_next_timer <= std::chrono::milliseconds(0))
+                {
+                    return;
+                }
+                if (until_next_timer < period)
+                {
+                    period = std::chrono::duration_cast<
+                        std::chrono::milliseconds>(until_next_timer);
+                }
+            }
+
             std::unique_lock<pu_mutex_type> l(mtx_);
             if (cond_.wait_for(l, period) == std::cv_status::no_timeout)
             {
@@ -100,7 +135,7 @@ namespace hpx { namespace threads { namespace policies {
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    void scheduler_base::do_some_work(std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         if (mode_.data_.load(std::memory_order_relaxed) &
@@ -109,6 +144,347 @@ namespace hpx { namespace threads { namespace policies {
             cond_.notify_all();
         }
 #endif
+
+        if (!(mode_.data_.load(std::memory_order_relaxed) &
+                policies::enable_idle_parking))
+        {
+            return;
+        }
+
+        // The new work has been made visible before this function is called.
+        // Pairs with the fence in park_idle_worker: either the parking worker
+        // sees the new work or we see the worker being parked.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (num_parked_.load(std::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+
+        // work without a hint may have been placed on any of the queues
+        std::size_t const num_workers = parking_data_.size();
+        if (num_thread == std::size_t(-1))
+        {
+            for (std::size_t i = 0; i != num_workers; ++i)
+            {
+                unpark_idle_worker(i);
+            }
+            return;
+        }
+
+        // otherwise wake up the worker owning the queue the work was meant
+        // for, any other worker can pick it up only if stealing is enabled
+        num_thread %= num_workers;
+        if (unpark_idle_worker(num_thread) ||
+            !(mode_.data_.load(std::memory_order_relaxed) &
+                policies::enable_stealing))
+        {
+            return;
+        }
+
+        for (std::size_t i = 1; i != num_workers; ++i)
+        {
+            if (unpark_idle_worker((num_thread + i) % num_workers))
+            {
+                return;
+            }
+        }
+    }
+
+    namespace {
+        // give back the memory held by the idle thread stacks cached by the
+        // calling worker thread, at most once per idle period
+        void trim_idle_stacks(bool& stacks_trimmed)
+        {
+            if (stacks_trimmed)
+            {
+                return;
+            }
+            stacks_trimmed = true;
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+            coroutines::detail::posix::trim_stack_pool();
+#endif
+        }
+
+        std::chrono::milliseconds stack_trim_delay()
+        {
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+            return std::chrono::milliseconds(
+                coroutines::detail::posix::stack_pool_trim_delay);
+#else
+            return std::chrono::milliseconds(0);
+#endif
+        }
+    }    // namespace
+
+    bool scheduler_base::park_idle_worker(
+        std::size_t num_thread, std::size_t idle_rounds)
+    {
+        HPX_ASSERT(num_thread < parking_data_.size());
+        idle_parking_data& data = parking_data_[num_thread].data_;
+
+        auto const now = std::chrono::steady_clock::now();
+        if (idle_rounds <= 1)
+        {
+            data.idle_start_ = now;
+            data.stacks_trimmed_ = false;
+        }
+
+        // The cached stacks are kept warm for short idle periods, they are
+        // trimmed only once this worker has been idle for a while.
+        if (now - data.idle_start_ >= stack_trim_delay())
+        {
+            trim_idle_stacks(data.stacks_trimmed_);
+        }
+
+        if (!(mode_.data_.load(std::memory_order_relaxed) &
+                policies::enable_idle_parking))
+        {
+            return false;
+        }
+
+        // keep spinning until the (adaptive) spin phase is over
+        if (idle_rounds < data.spin_rounds_)
+        {
+            return false;
+        }
+
+        // the average time a single idle round took while spinning
+        auto const round_time = (now - data.idle_start_) / idle_rounds;
+
+        // don't sleep past the expiry of the next timer this worker has to
+        // expire
+        auto period = std::chrono::duration_cast<
+            std::chrono::steady_clock::duration>(std::chrono::microseconds(
+            std::lround(1000. * thread_queue_init_.max_idle_backoff_time_)));
+
+        auto const next_timer = next_timer_expiry(num_thread);
+        if (next_timer != std::chrono::steady_clock::time_point::max())
+        {
+            auto const until_next_timer = next_timer - now;
+            if (until_next_timer <= round_time)
+            {
+                return false;
+            }
+            period = (std::min)(period, until_next_timer);
+        }
+
+        std::unique_lock<pu_mutex_type> l(data.mtx_);
+
+        data.notified_ = false;
+        data.parked_.store(true, std::memory_order_relaxed);
+        num_parked_.fetch_add(1, std::memory_order_relaxed);
+
+        // Pairs with the fence in do_some_work and unpark_all_idle_workers.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // make sure no new work this worker could pick up (from its own
+        // queues or, if stealing is enabled, from any other queue) has been
+        // added and nobody asked this thread to change its state in between
+        bool const stealing = mode_.data_.load(std::memory_order_relaxed) &
+            policies::enable_stealing;
+        if (states_[num_thread].load(std::memory_order_relaxed) !=
+                state_running ||
+            get_queue_length(stealing ? std::size_t(-1) : num_thread) != 0)
+        {
+            data.parked_.store(false, std::memory_order_relaxed);
+            num_parked_.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        data.park_count_.fetch_add(1, std::memory_order_relaxed);
+
+        // a parked worker does not need its cached stacks to be resident
+        trim_idle_stacks(data.stacks_trimmed_);
+
+        auto const park_start = std::chrono::steady_clock::now();
+
+        bool const notified =
+            data.cond_.wait_for(l, period, [&] { return data.notified_; });
+
+        auto const park_end = std::chrono::steady_clock::now();
+        if (notified)
+        {
+            data.unpark_count_.fetch_add(1, std::memory_order_relaxed);
+            data.wake_latency_.fetch_add(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    park_end - data.notify_time_)
+                    .count(),
+                std::memory_order_relaxed);
+            data.wake_latency_count_.fetch_add(1, std::memory_order_relaxed);
+
+            // new work arrived shortly after parking, spin longer next time
+            if (park_end - park_start < round_time)
+            {
+                data.spin_rounds_ =
+                    (std::min)(2 * data.spin_rounds_, std::size_t(64));
+            }
+        }
+        else
+        {
+            data.parked_.store(false, std::memory_order_relaxed);
+            num_parked_.fetch_sub(1, std::memory_order_relaxed);
+
+            // nothing to do for a long time, park earlier next time
+            data.spin_rounds_ =
+                (std::max)(data.spin_rounds_ / 2, std::size_t(1));
+        }
+
+        return notified;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool scheduler_base::poll_other_timers(std::size_t num_thread)
+    {
+        std::size_t const num_workers = timer_wheels_.size();
+        auto const now = std::chrono::steady_clock::now();
+
+        bool expired = false;
+        for (std::size_t i = 1; i < num_workers; ++i)
+        {
+            // don't wait for the lock, the wheel is being polled already if
+            // it is taken
+            threads::detail::timer_wheel& timers =
+                timer_wheels_[(num_thread + i) % num_workers].data_;
+            if (timers.next_expiry() <= now && timers.try_poll() != 0)
+            {
+                expired = true;
+            }
+        }
+        return expired;
+    }
+
+    std::chrono::steady_clock::time_point scheduler_base::next_timer_expiry(
+        std::size_t num_thread) const
+    {
+        HPX_ASSERT(num_thread < timer_wheels_.size());
+        auto next = timer_wheels_[num_thread].data_.next_expiry();
+
+        // the timers of other sleeping workers are expired by their owners
+        std::size_t const num_workers = timer_wheels_.size();
+        for (std::size_t i = 1; i < num_workers; ++i)
+        {
+            std::size_t const other = (num_thread + i) % num_workers;
+            if (!parking_data_[other].data_.parked_.load(
+                    std::memory_order_relaxed))
+            {
+                next = (std::min)(
+                    next, timer_wheels_[other].data_.next_expiry());
+            }
+        }
+        return next;
+    }
+
+    bool scheduler_base::unpark_idle_worker(std::size_t num_thread)
+    {
+        idle_parking_data& data = parking_data_[num_thread].data_;
+        if (!data.parked_.load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        {
+            // the parked flag is modified only while holding the lock
+            std::lock_guard<pu_mutex_type> l(data.mtx_);
+            if (!data.parked_.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            data.parked_.store(false, std::memory_order_relaxed);
+            num_parked_.fetch_sub(1, std::memory_order_relaxed);
+
+            data.notified_ = true;
+            data.notify_time_ = std::chrono::steady_clock::now();
+        }
+        data.cond_.notify_one();
+        return true;
+    }
+
+    void scheduler_base::unpark_all_idle_workers()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (num_parked_.load(std::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+
+        for (std::size_t i = 0; i != parking_data_.size(); ++i)
+        {
+            unpark_idle_worker(i);
+        }
+    }
+
+    namespace detail {
+        inline std::int64_t get_and_reset_value(
+            std::atomic<std::int64_t>& value, bool reset)
+        {
+            if (reset)
+                return value.exchange(0, std::memory_order_acq_rel);
+            return value.load(std::memory_order_relaxed);
+        }
+    }    // namespace detail
+
+    std::int64_t scheduler_base::get_idle_park_count(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread != std::size_t(-1))
+        {
+            HPX_ASSERT(num_thread < parking_data_.size());
+            return detail::get_and_reset_value(
+                parking_data_[num_thread].data_.park_count_, reset);
+        }
+
+        std::int64_t result = 0;
+        for (auto&& data : parking_data_)
+        {
+            result +=
+                detail::get_and_reset_value(data.data_.park_count_, reset);
+        }
+        return result;
+    }
+
+    std::int64_t scheduler_base::get_idle_unpark_count(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread != std::size_t(-1))
+        {
+            HPX_ASSERT(num_thread < parking_data_.size());
+            return detail::get_and_reset_value(
+                parking_data_[num_thread].data_.unpark_count_, reset);
+        }
+
+        std::int64_t result = 0;
+        for (auto&& data : parking_data_)
+        {
+            result +=
+                detail::get_and_reset_value(data.data_.unpark_count_, reset);
+        }
+        return result;
+    }
+
+    // average time (in nanoseconds) between a parked worker being notified
+    // and the worker resuming execution
+    std::int64_t scheduler_base::get_idle_wake_latency(
+        std::size_t num_thread, bool reset)
+    {
+        std::int64_t latency = 0;
+        std::int64_t count = 0;
+        for (std::size_t i = 0; i != parking_data_.size(); ++i)
+        {
+            if (num_thread != std::size_t(-1) && num_thread != i)
+            {
+                continue;
+            }
+
+            idle_parking_data& data = parking_data_[i].data_;
+            latency += detail::get_and_reset_value(data.wake_latency_, reset);
+            count +=
+                detail::get_and_reset_value(data.wake_latency_count_, reset);
+        }
+        return count == 0 ? 0 : latency / count;
     }
 
     void scheduler_base::suspend(std::size_t num_thread)
@@ -145,6 +521,18 @@ namespace hpx { namespace threads { namespace policies {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    void scheduler_base::create_threads_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            create_thread(data[i], nullptr, ec);
+            if (ec)
+                return;
+        }
+    }
+
     std::size_t scheduler_base::select_active_pu(
         std::unique_lock<pu_mutex_type>& l, std::size_t num_thread,
         bool allow_fallback)
@@ -257,6 +645,9 @@ namespace hpx { namespace threads { namespace policies {
         {
             state.store(s);
         }
+
+        // parked workers have to observe the new state
+        unpark_all_idle_workers();
     }
 
     void scheduler_base::set_all_states_at_least(hpx::state s)
@@ -269,6 +660,9 @@ namespace hpx { namespace threads { namespace policies {
                 state.store(s);
             }
         }
+
+        // parked workers have to observe the new state
+        unpark_all_idle_workers();
     }
 
     // return whether all states are at least at the given one
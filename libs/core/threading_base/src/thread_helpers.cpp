@@ -500,7 +500,7 @@ namespace hpx { namespace this_thread {
         threads::thread_id_type const& nextid,
         util::thread_description const& description, error_code& ec)
     {
-        // schedule a thread waking us up at_time
+        // arm a timer waking us up at abs_time
         threads::thread_self& self = threads::get_self();
         threads::thread_id_type id = self.get_thread_id();
 
@@ -526,14 +526,9 @@ namespace hpx { namespace this_thread {
 #ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
             threads::detail::reset_backtrace bt(id, ec);
 #endif
-            std::atomic<bool> timer_started(false);
-            threads::thread_id_type timer_id =
-                threads::set_thread_state(id, abs_time, &timer_started,
-                    threads::thread_schedule_state::pending,
-                    threads::thread_restart_state::timeout,
-                    threads::thread_priority::boost, true, ec);
-            if (ec)
-                return threads::thread_restart_state::unknown;
+            // arm a timer on the timer wheel of this worker thread which
+            // wakes up this thread once it expires
+            threads::detail::wake_timer timer(abs_time);
 
             // We might need to dispatch 'nextid' to it's correct scheduler
             // only if our current scheduler is the same, we should yield the id
@@ -555,19 +550,11 @@ namespace hpx { namespace this_thread {
                     threads::thread_schedule_state::suspended, nextid));
             }
 
-            if (statex != threads::thread_restart_state::timeout)
-            {
-                HPX_ASSERT(statex == threads::thread_restart_state::abort ||
-                    statex == threads::thread_restart_state::signaled);
-                error_code ec1(lightweight);    // do not throw
-                hpx::util::yield_while(
-                    [&timer_started]() { return !timer_started.load(); },
-                    "set_thread_state_timed");
-                threads::set_thread_state(timer_id,
-                    threads::thread_schedule_state::pending,
-                    threads::thread_restart_state::abort,
-                    threads::thread_priority::boost, true, ec1);
-            }
+            // the timer is canceled when going out of scope if this thread
+            // was woken up before it expired
+            HPX_ASSERT(statex == threads::thread_restart_state::timeout ||
+                statex == threads::thread_restart_state::abort ||
+                statex == threads::thread_restart_state::signaled);
         }
 
         // handle interruption, if needed
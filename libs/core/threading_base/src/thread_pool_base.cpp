@@ -107,4 +107,15 @@ namespace hpx { namespace threads {
     {
         thread_offset_ = threads_offset;
     }
+
+    void thread_pool_base::create_work_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            create_work(data[i], ec);
+            if (ec)
+                return;
+        }
+    }
 }}    // namespace hpx::threads
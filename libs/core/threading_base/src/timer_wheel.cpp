@@ -0,0 +1,400 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+#if defined(HPX_MSVC)
+#include <intrin.h>
+#endif
+
+namespace hpx { namespace threads { namespace detail {
+    namespace {
+        constexpr std::uint64_t no_tick =
+            (std::numeric_limits<std::uint64_t>::max)();
+
+        std::uint64_t to_ticks(
+            timer_wheel::clock_type::time_point t, bool round_up) noexcept
+        {
+            auto const ns =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    t.time_since_epoch())
+                    .count();
+            if (ns <= 0)
+            {
+                return 0;
+            }
+
+            std::uint64_t ticks = static_cast<std::uint64_t>(ns);
+            if (round_up)
+            {
+                ticks += (std::uint64_t(1) << timer_wheel::tick_bits) - 1;
+            }
+            return ticks >> timer_wheel::tick_bits;
+        }
+
+        // mask of the given number of low bits
+        constexpr std::uint64_t low_bits(std::size_t bits) noexcept
+        {
+            return bits >= 64 ? no_tick : (std::uint64_t(1) << bits) - 1;
+        }
+
+        // index of the lowest bit set in the given (non-zero) value
+        std::size_t lowest_bit(std::uint64_t value) noexcept
+        {
+            HPX_ASSERT(value != 0);
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            return static_cast<std::size_t>(__builtin_ctzll(value));
+#elif defined(HPX_MSVC) && defined(_WIN64)
+            unsigned long index = 0;
+            _BitScanForward64(&index, value);
+            return static_cast<std::size_t>(index);
+#else
+            std::size_t index = 0;
+            while ((value & 1) == 0)
+            {
+                value >>= 1;
+                ++index;
+            }
+            return index;
+#endif
+        }
+
+        constexpr std::size_t slot_of(
+            std::uint64_t ticks, std::size_t level) noexcept
+        {
+            return static_cast<std::size_t>(
+                (ticks >> (level * timer_wheel::slot_bits)) &
+                (timer_wheel::num_slots - 1));
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    timer_wheel::timer_wheel()
+      : now_(to_ticks(clock_type::now(), false))
+      , next_tick_(no_tick)
+      , size_(0)
+    {
+        for (std::size_t level = 0; level != num_levels; ++level)
+        {
+            occupied_[level] = 0;
+            for (std::size_t slot = 0; slot != num_slots; ++slot)
+            {
+                slots_[level][slot] = nullptr;
+            }
+        }
+    }
+
+    timer_wheel::~timer_wheel()
+    {
+        HPX_ASSERT(empty());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Timers are placed on the level of the highest digit in which their
+    // expiry differs from the current time. The digit of the expiry on that
+    // level is always larger than the one of the current time, the timer is
+    // moved to a lower level once the current time reaches the start of its
+    // slot. Timers which are already due are placed into the current slot of
+    // the lowest level.
+    void timer_wheel::link(timer_wheel_entry& e) noexcept
+    {
+        if (e.expiry_ < now_)
+        {
+            e.expiry_ = now_;
+        }
+
+        std::uint64_t const diff = e.expiry_ ^ now_;
+        std::size_t level = 0;
+        while (level + 1 != num_levels &&
+            (diff >> ((level + 1) * slot_bits)) != 0)
+        {
+            ++level;
+        }
+
+        std::size_t const slot = slot_of(e.expiry_, level);
+        timer_wheel_entry*& head = slots_[level][slot];
+
+        e.level_ = static_cast<std::uint8_t>(level);
+        e.next_ = head;
+        e.prev_ = &head;
+        if (head != nullptr)
+        {
+            head->prev_ = &e.next_;
+        }
+        head = &e;
+
+        occupied_[level] |= std::uint64_t(1) << slot;
+    }
+
+    void timer_wheel::unlink(timer_wheel_entry& e) noexcept
+    {
+        *e.prev_ = e.next_;
+        if (e.next_ != nullptr)
+        {
+            e.next_->prev_ = e.prev_;
+        }
+
+        std::size_t const slot = slot_of(e.expiry_, e.level_);
+        if (slots_[e.level_][slot] == nullptr)
+        {
+            occupied_[e.level_] &= ~(std::uint64_t(1) << slot);
+        }
+
+        e.next_ = nullptr;
+        e.prev_ = nullptr;
+    }
+
+    timer_wheel_entry* timer_wheel::take_slot(
+        std::size_t level, std::size_t slot)
+    {
+        timer_wheel_entry* head = slots_[level][slot];
+        slots_[level][slot] = nullptr;
+        occupied_[level] &= ~(std::uint64_t(1) << slot);
+        return head;
+    }
+
+    // Returns the tick at which the next timer expires or has to be moved to
+    // a lower level. All occupied slots on a level lie before the end of the
+    // current slot of the next higher level, so the first occupied level
+    // determines the result.
+    std::uint64_t timer_wheel::next_event() const noexcept
+    {
+        for (std::size_t level = 0; level != num_levels; ++level)
+        {
+            std::uint64_t occupied = occupied_[level];
+            if (occupied == 0)
+            {
+                continue;
+            }
+
+            // the current slot is relevant on the lowest level only
+            std::size_t const current = slot_of(now_, level);
+            std::size_t const first = level == 0 ? current : current + 1;
+            occupied &= first == num_slots ? 0 : (no_tick << first);
+            if (occupied == 0)
+            {
+                continue;
+            }
+
+            return (now_ & ~low_bits((level + 1) * slot_bits)) |
+                (std::uint64_t(lowest_bit(occupied)) << (level * slot_bits));
+        }
+        return no_tick;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void timer_wheel::add(timer_wheel_entry& e, clock_type::time_point abs_time)
+    {
+        HPX_ASSERT(
+            e.state_.load(std::memory_order_relaxed) ==
+            timer_wheel_entry::state::idle);
+
+        e.expiry_ = to_ticks(abs_time, true);
+
+        std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+        link(e);
+        e.state_.store(
+            timer_wheel_entry::state::armed, std::memory_order_relaxed);
+        size_.fetch_add(1, std::memory_order_relaxed);
+
+        if (e.expiry_ < next_tick_.load(std::memory_order_relaxed))
+        {
+            next_tick_.store(e.expiry_, std::memory_order_relaxed);
+        }
+    }
+
+    bool timer_wheel::cancel(timer_wheel_entry& e)
+    {
+        while (true)
+        {
+            {
+                std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+                auto const state = e.state_.load(std::memory_order_relaxed);
+                if (state == timer_wheel_entry::state::armed)
+                {
+                    // the earliest expiry is a lower bound only, no need to
+                    // update it here
+                    unlink(e);
+                    e.state_.store(timer_wheel_entry::state::idle,
+                        std::memory_order_relaxed);
+                    size_.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+
+                if (state == timer_wheel_entry::state::idle)
+                {
+                    return false;
+                }
+            }
+
+            // the timer has expired, wait for its callback to finish, the
+            // callback may arm it again
+            hpx::util::yield_while(
+                [&e]() {
+                    return e.state_.load(std::memory_order_acquire) ==
+                        timer_wheel_entry::state::firing;
+                },
+                "timer_wheel::cancel", false);
+        }
+    }
+
+    std::size_t timer_wheel::poll(
+        clock_type::time_point now, bool wait_for_lock)
+    {
+        std::uint64_t target = to_ticks(now, false);
+        if (target < next_tick_.load(std::memory_order_relaxed))
+        {
+            return 0;
+        }
+
+        timer_wheel_entry* expired = nullptr;
+        std::size_t count = 0;
+
+        {
+            std::unique_lock<hpx::util::detail::spinlock> l(
+                mtx_, std::defer_lock);
+            if (wait_for_lock)
+            {
+                l.lock();
+            }
+            else if (!l.try_lock())
+            {
+                return 0;
+            }
+
+            if (target < now_)
+            {
+                target = now_;
+            }
+
+            while (true)
+            {
+                // collect the timers which are due now
+                timer_wheel_entry* e = take_slot(0, slot_of(now_, 0));
+                while (e != nullptr)
+                {
+                    timer_wheel_entry* next = e->next_;
+                    e->state_.store(timer_wheel_entry::state::firing,
+                        std::memory_order_relaxed);
+                    e->next_ = expired;
+                    expired = e;
+                    ++count;
+                    e = next;
+                }
+
+                if (now_ == target)
+                {
+                    break;
+                }
+
+                // skip ahead to the next tick at which anything happens
+                std::uint64_t const next = next_event();
+                if (next > target)
+                {
+                    now_ = target;
+                    break;
+                }
+                now_ = next;
+
+                // move the timers of all slots starting now to lower levels
+                for (std::size_t level = num_levels - 1; level != 0; --level)
+                {
+                    if ((now_ & low_bits(level * slot_bits)) != 0)
+                    {
+                        continue;
+                    }
+
+                    e = take_slot(level, slot_of(now_, level));
+                    while (e != nullptr)
+                    {
+                        timer_wheel_entry* next_entry = e->next_;
+                        link(*e);
+                        e = next_entry;
+                    }
+                }
+            }
+
+            std::size_t const size =
+                size_.fetch_sub(count, std::memory_order_relaxed) - count;
+            next_tick_.store(
+                size == 0 ? no_tick : next_event(), std::memory_order_relaxed);
+        }
+
+        // invoke the callbacks without holding the lock, the entries may be
+        // destroyed as soon as they are not marked as firing anymore
+        timer_wheel_entry* retry = nullptr;
+        while (expired != nullptr)
+        {
+            timer_wheel_entry* next = expired->next_;
+            expired->next_ = nullptr;
+            expired->prev_ = nullptr;
+
+            if (expired->callback_(*expired))
+            {
+                expired->state_.store(
+                    timer_wheel_entry::state::idle, std::memory_order_release);
+            }
+            else
+            {
+                expired->next_ = retry;
+                retry = expired;
+                --count;
+            }
+
+            expired = next;
+        }
+
+        // arm the timers again whose callbacks asked to be retried
+        if (retry != nullptr)
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+            while (retry != nullptr)
+            {
+                timer_wheel_entry* next = retry->next_;
+                retry->expiry_ = now_ + 1;
+                link(*retry);
+                retry->state_.store(
+                    timer_wheel_entry::state::armed, std::memory_order_release);
+                size_.fetch_add(1, std::memory_order_relaxed);
+                if (retry->expiry_ < next_tick_.load(std::memory_order_relaxed))
+                {
+                    next_tick_.store(
+                        retry->expiry_, std::memory_order_relaxed);
+                }
+                retry = next;
+            }
+        }
+
+        return count;
+    }
+
+    timer_wheel::clock_type::time_point timer_wheel::next_expiry()
+        const noexcept
+    {
+        std::uint64_t const tick = next_tick_.load(std::memory_order_relaxed);
+        if (tick > (std::uint64_t((std::numeric_limits<std::int64_t>::max)()) >>
+                       tick_bits))
+        {
+            return clock_type::time_point::max();
+        }
+
+        return clock_type::time_point(
+            std::chrono::duration_cast<clock_type::duration>(
+                std::chrono::nanoseconds(
+                    static_cast<std::int64_t>(tick << tick_bits))));
+    }
+}}}    // namespace hpx::threads::detail
@@ -0,0 +1,276 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using hpx::threads::detail::timer_wheel;
+using hpx::threads::detail::timer_wheel_entry;
+using clock_type = timer_wheel::clock_type;
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_timer : timer_wheel_entry
+{
+    test_timer()
+      : timer_wheel_entry(&on_expire)
+    {
+    }
+
+    static bool on_expire(timer_wheel_entry& e)
+    {
+        test_timer& t = static_cast<test_timer&>(e);
+        if (t.retries != 0)
+        {
+            --t.retries;
+            return false;
+        }
+        ++t.count;
+        t.fired_at = t.now != nullptr ? *t.now : clock_type::now();
+        return true;
+    }
+
+    clock_type::time_point expiry;
+    clock_type::time_point fired_at;
+    clock_type::time_point const* now = nullptr;
+    int count = 0;
+    int retries = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_expire_in_order()
+{
+    timer_wheel wheel;
+    auto const start = clock_type::now();
+
+    std::vector<std::chrono::nanoseconds> const delays = {
+        std::chrono::nanoseconds(0), std::chrono::microseconds(1),
+        std::chrono::microseconds(50), std::chrono::microseconds(63),
+        std::chrono::microseconds(64), std::chrono::microseconds(65),
+        std::chrono::milliseconds(1), std::chrono::milliseconds(17),
+        std::chrono::seconds(1), std::chrono::seconds(70),
+        std::chrono::hours(5), std::chrono::hours(24 * 400)};
+
+    std::vector<test_timer> timers(delays.size());
+    clock_type::time_point now = start;
+    for (std::size_t i = 0; i != delays.size(); ++i)
+    {
+        timers[i].expiry = start + delays[i];
+        timers[i].now = &now;
+        wheel.add(timers[i], timers[i].expiry);
+    }
+    HPX_TEST_EQ(wheel.size(), delays.size());
+    HPX_TEST(wheel.next_expiry() <= start + std::chrono::microseconds(1));
+
+    // advance time in irregular steps, no timer may fire early or late
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::int64_t> dist(0, 100);
+
+    std::size_t fired = 0;
+    auto const end = start + std::chrono::hours(24 * 401);
+    auto step = std::chrono::nanoseconds(1);
+    while (now < end)
+    {
+        fired += wheel.poll(now);
+
+        for (auto const& t : timers)
+        {
+            HPX_TEST_LTE(t.count, 1);
+            if (t.count == 0)
+            {
+                HPX_TEST(now < t.expiry + std::chrono::microseconds(2));
+            }
+            else
+            {
+                HPX_TEST(t.fired_at >= t.expiry);
+            }
+        }
+
+        now += step;
+        step = step * 2 + std::chrono::nanoseconds(dist(gen));
+    }
+
+    fired += wheel.poll(now);
+    HPX_TEST_EQ(fired, delays.size());
+    HPX_TEST(wheel.empty());
+    HPX_TEST(wheel.next_expiry() == clock_type::time_point::max());
+
+    for (auto const& t : timers)
+    {
+        HPX_TEST_EQ(t.count, 1);
+    }
+}
+
+void test_cancel()
+{
+    timer_wheel wheel;
+    auto const start = clock_type::now();
+
+    std::size_t const num_timers = 1000;
+    std::vector<test_timer> timers(num_timers);
+    for (std::size_t i = 0; i != num_timers; ++i)
+    {
+        timers[i].expiry = start + std::chrono::microseconds(7 * i);
+        wheel.add(timers[i], timers[i].expiry);
+        HPX_TEST(timers[i].is_armed());
+    }
+
+    // cancel every other timer
+    for (std::size_t i = 0; i < num_timers; i += 2)
+    {
+        HPX_TEST(wheel.cancel(timers[i]));
+        HPX_TEST(!timers[i].is_armed());
+    }
+    HPX_TEST_EQ(wheel.size(), num_timers / 2);
+
+    HPX_TEST_EQ(wheel.poll(start + std::chrono::microseconds(7 * num_timers)),
+        num_timers / 2);
+    HPX_TEST(wheel.empty());
+
+    for (std::size_t i = 0; i != num_timers; ++i)
+    {
+        HPX_TEST_EQ(timers[i].count, i % 2 == 0 ? 0 : 1);
+
+        // canceling an expired timer fails
+        HPX_TEST(!wheel.cancel(timers[i]));
+    }
+
+    // timers may be armed again after they expired or were canceled
+    for (std::size_t i = 0; i != num_timers; ++i)
+    {
+        wheel.add(timers[i], start);
+    }
+    HPX_TEST_EQ(wheel.poll(start + std::chrono::microseconds(7 * num_timers)),
+        num_timers);
+    for (std::size_t i = 0; i != num_timers; ++i)
+    {
+        HPX_TEST_EQ(timers[i].count, i % 2 == 0 ? 1 : 2);
+    }
+}
+
+void test_random()
+{
+    timer_wheel wheel;
+    auto const start = clock_type::now();
+
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<std::int64_t> delay(0, 100000000);
+    std::uniform_int_distribution<int> action(0, 3);
+
+    std::size_t const num_timers = 10000;
+    std::vector<test_timer> timers(num_timers);
+
+    clock_type::time_point now = start;
+    std::size_t expected = 0;
+    for (std::size_t i = 0; i != num_timers; ++i)
+    {
+        timers[i].now = &now;
+        timers[i].expiry = now + std::chrono::nanoseconds(delay(gen));
+        wheel.add(timers[i], timers[i].expiry);
+
+        switch (action(gen))
+        {
+        case 0:
+            // cancel a random armed timer
+            {
+                std::uniform_int_distribution<std::size_t> which(0, i);
+                test_timer& t = timers[which(gen)];
+                if (t.is_armed())
+                {
+                    HPX_TEST(wheel.cancel(t));
+                    t.expiry = clock_type::time_point::max();
+                }
+            }
+            break;
+
+        case 1:
+            now += std::chrono::nanoseconds(delay(gen) / 1000);
+            wheel.poll(now);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    now += std::chrono::milliseconds(200);
+    wheel.poll(now);
+    HPX_TEST(wheel.empty());
+
+    for (auto const& t : timers)
+    {
+        if (t.expiry == clock_type::time_point::max())
+        {
+            HPX_TEST_EQ(t.count, 0);
+        }
+        else
+        {
+            HPX_TEST_EQ(t.count, 1);
+            HPX_TEST(t.fired_at >= t.expiry);
+            ++expected;
+        }
+    }
+    HPX_TEST(expected != 0);
+}
+
+void test_retry()
+{
+    timer_wheel wheel;
+    auto const start = clock_type::now();
+    auto const tick = std::chrono::nanoseconds(1 << timer_wheel::tick_bits);
+
+    // a timer whose callback fails is armed again for the next tick
+    test_timer t;
+    t.retries = 2;
+    wheel.add(t, start);
+
+    clock_type::time_point now = start + tick;
+    HPX_TEST_EQ(wheel.poll(now), std::size_t(0));
+    HPX_TEST(t.is_armed());
+    HPX_TEST_EQ(wheel.size(), std::size_t(1));
+
+    now += tick;
+    HPX_TEST_EQ(wheel.poll(now), std::size_t(0));
+    HPX_TEST(t.is_armed());
+
+    now += tick;
+    HPX_TEST_EQ(wheel.poll(now), std::size_t(1));
+    HPX_TEST(!t.is_armed());
+    HPX_TEST(wheel.empty());
+    HPX_TEST_EQ(t.count, 1);
+
+    // canceling a timer which is retried stops it
+    t.retries = 1;
+    wheel.add(t, now);
+    now += tick;
+    HPX_TEST_EQ(wheel.poll(now), std::size_t(0));
+    HPX_TEST(wheel.cancel(t));
+    HPX_TEST(wheel.empty());
+    HPX_TEST_EQ(t.count, 1);
+
+    // timers which are due are expired by try_poll as well
+    wheel.add(t, clock_type::now());
+    while (wheel.try_poll() == 0)
+    {
+    }
+    HPX_TEST(wheel.empty());
+    HPX_TEST_EQ(t.count, 2);
+}
+
+int main()
+{
+    test_expire_in_order();
+    test_cancel();
+    test_random();
+    test_retry();
+
+    return hpx::util::report_errors();
+}
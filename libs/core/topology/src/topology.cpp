@@ -118,6 +118,15 @@ namespace hpx { namespace threads { namespace detail {
         return node;
     }
 
+    bool is_cache_obj(hwloc_obj_t obj) noexcept
+    {
+#if HWLOC_API_VERSION >= 0x00020000
+        return hwloc_obj_type_is_dcache(obj->type) != 0;
+#else
+        return obj->type == HWLOC_OBJ_CACHE;
+#endif
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // abstract away memory page size
     std::size_t get_memory_page_size_impl()
@@ -283,6 +292,7 @@ namespace hpx { namespace threads {
         socket_affinity_masks_.reserve(num_of_pus_);
         numa_node_affinity_masks_.reserve(num_of_pus_);
         core_affinity_masks_.reserve(num_of_pus_);
+        cache_affinity_masks_.reserve(num_of_pus_);
         thread_affinity_masks_.reserve(num_of_pus_);
 
         for (std::size_t i = 0; i < num_of_pus_; ++i)
@@ -301,6 +311,11 @@ namespace hpx { namespace threads {
             core_affinity_masks_.push_back(init_core_affinity_mask(i));
         }
 
+        for (std::size_t i = 0; i < num_of_pus_; ++i)
+        {
+            cache_affinity_masks_.push_back(init_cache_affinity_mask(i));
+        }
+
         for (std::size_t i = 0; i < num_of_pus_; ++i)
         {
             thread_affinity_masks_.push_back(init_thread_affinity_mask(i));
@@ -338,6 +353,8 @@ namespace hpx { namespace threads {
         detail::write_to_log_mask(
             "numa_node_affinity_mask", numa_node_affinity_masks_);
         detail::write_to_log_mask("core_affinity_mask", core_affinity_masks_);
+        detail::write_to_log_mask(
+            "cache_affinity_mask", cache_affinity_masks_);
         detail::write_to_log_mask(
             "thread_affinity_mask", thread_affinity_masks_);
     }
@@ -457,6 +474,25 @@ namespace hpx { namespace threads {
         return empty_mask;
     }
 
+    mask_cref_type topology::get_cache_affinity_mask(
+        std::size_t num_thread, error_code& ec) const
+    {
+        std::size_t num_pu = num_thread % num_of_pus_;
+
+        if (num_pu < cache_affinity_masks_.size())
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return cache_affinity_masks_[num_pu];
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter,
+            "hpx::threads::topology::get_cache_affinity_mask",
+            "thread number {1} is out of range", num_thread);
+        return empty_mask;
+    }
+
     mask_cref_type topology::get_thread_affinity_mask(
         std::size_t num_thread, error_code& ec) const
     {    // {{{
@@ -1119,6 +1155,36 @@ namespace hpx { namespace threads {
         return default_mask;
     }    // }}}
 
+    mask_type topology::init_cache_affinity_mask(std::size_t num_thread) const
+    {    // {{{
+        std::size_t num_pu = (num_thread + pu_offset) % num_of_pus_;
+
+        // the last level cache is the outermost cache object above the
+        // processing unit
+        hwloc_obj_t cache_obj = nullptr;
+        {
+            std::unique_lock<mutex_type> lk(topo_mtx);
+            hwloc_obj_t obj = hwloc_get_obj_by_type(
+                topo, HWLOC_OBJ_PU, static_cast<unsigned>(num_pu));
+            for (/**/; obj != nullptr; obj = obj->parent)
+            {
+                if (detail::is_cache_obj(obj))
+                    cache_obj = obj;
+            }
+        }
+
+        if (cache_obj)
+        {
+            mask_type cache_affinity_mask = mask_type();
+            resize(cache_affinity_mask, get_number_of_pus());
+
+            extract_node_mask(cache_obj, cache_affinity_mask);
+            return cache_affinity_mask;
+        }
+
+        return numa_node_affinity_masks_[num_thread];
+    }    // }}}
+
     mask_type topology::init_thread_affinity_mask(std::size_t num_thread) const
     {    // {{{
 
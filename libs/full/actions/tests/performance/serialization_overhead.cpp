@@ -14,6 +14,7 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/serialization.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/serialization/detail/buffer_pool.hpp>
 #include <hpx/serialization/detail/preprocess_container.hpp>
 #include <hpx/util/from_string.hpp>
 
@@ -47,7 +48,7 @@ std::size_t get_archive_size(hpx::parcelset::parcel const& p,
 
 ///////////////////////////////////////////////////////////////////////////////
 double benchmark_serialization(std::size_t data_size, std::size_t iterations,
-    bool continuation, bool zerocopy)
+    bool continuation, bool zerocopy, bool buffer_pool)
 {
     hpx::naming::id_type const here = hpx::find_here();
     hpx::naming::address addr(hpx::get_locality(),
@@ -127,7 +128,15 @@ double benchmark_serialization(std::size_t data_size, std::size_t iterations,
             get_archive_size(outp, out_archive_flags, chunks);
         std::vector<char> out_buffer;
 
-        out_buffer.resize(arg_size + HPX_PARCEL_SERIALIZATION_OVERHEAD);
+        if (buffer_pool)
+        {
+            hpx::serialization::detail::resize_buffer(
+                out_buffer, arg_size + HPX_PARCEL_SERIALIZATION_OVERHEAD);
+        }
+        else
+        {
+            out_buffer.resize(arg_size + HPX_PARCEL_SERIALIZATION_OVERHEAD);
+        }
 
         {
             // create an output archive and serialize the parcel
@@ -149,6 +158,9 @@ double benchmark_serialization(std::size_t data_size, std::size_t iterations,
 
         if (chunks)
             chunks->clear();
+
+        if (buffer_pool)
+            hpx::serialization::detail::release_buffer(out_buffer);
     }
 
     return t.elapsed();
@@ -164,12 +176,13 @@ int hpx_main(hpx::program_options::variables_map& vm)
     bool print_header = vm.count("no-header") == 0;
     bool continuation = vm.count("continuation") != 0;
     bool zerocopy = vm.count("zerocopy") != 0;
+    bool buffer_pool = vm.count("buffer-pool") != 0;
 
     std::vector<hpx::future<double>> timings;
     for (std::size_t i = 0; i != concurrency; ++i)
     {
         timings.push_back(hpx::async(&benchmark_serialization, data_size,
-            iterations, continuation, zerocopy));
+            iterations, continuation, zerocopy, buffer_pool));
     }
 
     double overall_time = 0;
@@ -212,6 +225,9 @@ int main(int argc, char* argv[])
         ("zerocopy",
             "use zero copy serialization of bitwise copyable "
             "arguments")
+        ("buffer-pool",
+            "draw the serialization buffers from the pool of reusable "
+            "buffers")
         ("no-header", "do not print out the csv header row")
         ;
     // clang-format on
@@ -11,8 +11,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/agas/agas_fwd.hpp>
-#include <hpx/cache/lru_cache.hpp>
-#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/agas/gva_cache.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/agas_base.hpp>
@@ -62,15 +61,12 @@ namespace hpx { namespace agas {
         using mutex_type = hpx::lcos::local::spinlock;
 
         // gva cache
-        struct gva_cache_key;
-
-        using gva_cache_type = hpx::util::cache::lru_cache<gva_cache_key, gva,
-            hpx::util::cache::statistics::local_full_statistics>;
+        using gva_cache_type = agas::gva_cache;
 
         using migrated_objects_table_type = std::set<naming::gid_type>;
         using refcnt_requests_type = std::map<naming::gid_type, std::int64_t>;
 
-        mutable mutex_type gva_cache_mtx_;
+        // the gva cache is internally synchronized
         std::shared_ptr<gva_cache_type> gva_cache_;
 
         mutable mutex_type migrated_objects_mtx_;
@@ -0,0 +1,159 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/agas_base/gva.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace agas {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The \a gva_cache is the local AGAS address resolution cache.
+    ///
+    /// The cache is split into a number of independent shards, each of which
+    /// is protected by its own reader-writer spinlock. Lookups only acquire
+    /// the shard lock in shared mode, so concurrent resolutions from
+    /// different worker threads do not serialize. Entries are assigned to
+    /// shards based on the block of global ids they belong to (ids are
+    /// grouped into small blocks of 2^block_bits consecutive ids, consecutive
+    /// blocks map to different shards). Entries covering a range of ids
+    /// spanning more than one block are held in a separate range shard which
+    /// is consulted whenever a lookup in the block shard misses.
+    ///
+    /// Modifications of the cache are serialized, which guarantees that no
+    /// two overlapping ranges are ever inserted. The shard locks prefer
+    /// writers, a steady stream of lookups does not prevent updates.
+    ///
+    /// The capacity of the cache is shared by all shards. Eviction is
+    /// approximate LRU: whenever the cache is full, a small random sample of
+    /// the entries of the larger of the updated shard and a randomly chosen
+    /// shard is inspected and the least recently accessed one is evicted.
+    class HPX_EXPORT gva_cache
+    {
+    public:
+        HPX_NON_COPYABLE(gva_cache);
+
+        static constexpr std::size_t block_bits = 4;
+
+        /// \brief Construct an instance of a gva_cache.
+        ///
+        /// \param num_shards [in] The number of shards to use. This will be
+        ///                   rounded up to the next power of two. If zero,
+        ///                   the number of shards is derived from the number
+        ///                   of cores available on this node.
+        explicit gva_cache(std::size_t num_shards = 0);
+        ~gva_cache();
+
+        /// \brief Change the maximum number of entries this cache can hold
+        void reserve(std::size_t max_size);
+
+        /// \brief Return the current number of entries held by the cache
+        std::size_t size() const;
+
+        /// \brief Return the maximum number of entries held by the cache
+        std::size_t capacity() const;
+
+        /// \brief Return the number of shards of this cache
+        std::size_t num_shards() const
+        {
+            return num_shards_;
+        }
+
+        /// \brief Look up the entry covering the given global id.
+        ///
+        /// \param gid    [in] The global id to resolve.
+        /// \param idbase [out] On success, this will be set to the first
+        ///               global id of the cached range of ids covering
+        ///               \a gid.
+        /// \param g      [out] On success, this will be set to the cached
+        ///               address information.
+        ///
+        /// \returns      This function returns \a true if the cache holds an
+        ///               entry covering \a gid, otherwise it returns \a false.
+        bool get_entry(
+            naming::gid_type const& gid, naming::gid_type& idbase, gva& g);
+
+        /// \brief Insert or update the entry for the given range of ids.
+        ///
+        /// \param gid    [in] The first global id of the range.
+        /// \param count  [in] The number of global ids in the range.
+        /// \param g      [in] The address information to store.
+        /// \param old_gid [out] If the range collides with a different range
+        ///               held in the cache, this is set to the first global
+        ///               id of the cached range.
+        /// \param old_count [out] If the range collides with a different
+        ///               range held in the cache, this is set to the number of
+        ///               global ids of the cached range.
+        ///
+        /// \returns      This function returns \a false if the given range
+        ///               collides with a different range already held by the
+        ///               cache (the cache is left unchanged in this case),
+        ///               otherwise it returns \a true.
+        bool update(naming::gid_type const& gid, std::uint64_t count,
+            gva const& g, naming::gid_type& old_gid, std::uint64_t& old_count);
+
+        /// \brief Remove the entry whose range starts at the given global id.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        std::size_t erase(naming::gid_type const& gid);
+
+        /// \brief Unconditionally remove all entries from the cache.
+        std::size_t clear();
+
+        // Statistics collected across all shards.
+        std::uint64_t hits(bool reset);
+        std::uint64_t misses(bool reset);
+        std::uint64_t evictions(bool reset);
+        std::uint64_t insertions(bool reset);
+
+        std::uint64_t get_get_entry_count(bool reset);
+        std::uint64_t get_insert_entry_count(bool reset);
+        std::uint64_t get_update_entry_count(bool reset);
+        std::uint64_t get_erase_entry_count(bool reset);
+
+        std::uint64_t get_get_entry_time(bool reset);
+        std::uint64_t get_insert_entry_time(bool reset);
+        std::uint64_t get_update_entry_time(bool reset);
+        std::uint64_t get_erase_entry_time(bool reset);
+
+    private:
+        using mutex_type = hpx::lcos::local::spinlock;
+
+        struct range_key;
+        struct shard;
+
+        shard& get_shard(std::uint64_t msb, std::uint64_t block) const;
+        shard& get_shard(naming::gid_type const& gid) const;
+        shard& get_range_shard() const;
+
+        bool find_collision(
+            range_key const& key, shard const& s, range_key& found) const;
+        void evict_excess(shard& s);
+
+        std::size_t const num_shards_;
+        std::size_t max_size_;
+
+        // serializes all modifications of the cache
+        mutex_type mtx_;
+        std::atomic<std::size_t> size_;
+        std::uint64_t seed_;
+
+        // num_shards_ block shards followed by the range shard
+        std::unique_ptr<shard[]> shards_;
+    };
+}}    // namespace hpx::agas
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -51,72 +51,6 @@
 
 namespace hpx { namespace agas {
 
-    struct addressing_service::gva_cache_key
-    {    // {{{ gva_cache_key implementation
-    private:
-        using key_type = std::pair<naming::gid_type, naming::gid_type>;
-
-        key_type key_;
-
-    public:
-        gva_cache_key()
-          : key_()
-        {
-        }
-
-        explicit gva_cache_key(
-            naming::gid_type const& id, std::uint64_t count = 1)
-          : key_(naming::detail::get_stripped_gid(id),
-                naming::detail::get_stripped_gid(id) + (count - 1))
-        {
-            HPX_ASSERT(count);
-        }
-
-        naming::gid_type get_gid() const
-        {
-            return key_.first;
-        }
-
-        std::uint64_t get_count() const
-        {
-            naming::gid_type const size = key_.second - key_.first;
-            HPX_ASSERT(size.get_msb() == 0);
-            return size.get_lsb();
-        }
-
-        friend bool operator<(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            return lhs.key_.second < rhs.key_.first;
-        }
-
-        friend bool operator==(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            // Direct hit
-            if (lhs.key_ == rhs.key_)
-            {
-                return true;
-            }
-
-            // Is lhs in rhs?
-            if (1 == lhs.get_count() && 1 != rhs.get_count())
-            {
-                return rhs.key_.first <= lhs.key_.first &&
-                    lhs.key_.second <= rhs.key_.second;
-            }
-
-            // Is rhs in lhs?
-            else if (1 != lhs.get_count() && 1 == rhs.get_count())
-            {
-                return lhs.key_.first <= rhs.key_.first &&
-                    rhs.key_.second <= lhs.key_.second;
-            }
-
-            return false;
-        }
-    };    // }}}
-
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
       : gva_cache_(new gva_cache_type)
@@ -1582,15 +1516,6 @@ namespace hpx { namespace agas {
         return symbol_ns_.iterate_async(pattern);
     }    // }}}
 
-    // This function has to return false if the key is already in the cache (true
-    // means go ahead with the cache update).
-    bool check_for_collisions(addressing_service::gva_cache_key const& new_key,
-        addressing_service::gva_cache_key const& old_key)
-    {
-        return (new_key.get_gid() != old_key.get_gid()) ||
-            (new_key.get_count() != old_key.get_count());
-    }
-
     void addressing_service::update_cache_entry(
         naming::gid_type const& id, gva const& g, error_code& ec)
     {    // {{{
@@ -1651,37 +1576,16 @@ namespace hpx { namespace agas {
                 "addressing_service::update_cache_entry, gid({1}), count({2})",
                 gid, count);
 
-            const gva_cache_key key(gid, count);
-
+            naming::gid_type old_gid;
+            std::uint64_t old_count = 0;
+            if (!gva_cache_->update(gid, count, g, old_gid, old_count))
             {
-                std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-                if (!gva_cache_->update_if(key, g, check_for_collisions))
-                {
-                    if (LAGAS_ENABLED(warning))
-                    {
-                        // Figure out who we collided with.
-                        addressing_service::gva_cache_key idbase;
-                        addressing_service::gva_cache_type::entry_type e;
-
-                        if (!gva_cache_->get_entry(key, idbase, e))
-                        {
-                            // This is impossible under sane conditions.
-                            lock.unlock();
-                            HPX_THROWS_IF(ec, invalid_data,
-                                "addressing_service::update_cache_entry",
-                                "data corruption or lock error occurred in "
-                                "cache");
-                            return;
-                        }
-
-                        LAGAS_(warning).format(
-                            "addressing_service::update_cache_entry, aborting "
-                            "update due to key collision in cache, "
-                            "new_gid({1}), new_count({2}), old_gid({3}), "
-                            "old_count({4})",
-                            gid, count, idbase.get_gid(), idbase.get_count());
-                    }
-                }
+                LAGAS_(warning).format(
+                    "addressing_service::update_cache_entry, aborting "
+                    "update due to key collision in cache, "
+                    "new_gid({1}), new_count({2}), old_gid({3}), "
+                    "old_count({4})",
+                    gid, count, old_gid, old_count);
             }
 
             if (&ec != &throws)
@@ -1701,25 +1605,19 @@ namespace hpx { namespace agas {
         {
             return false;
         }
-        gva_cache_key k(gid);
-        gva_cache_key idbase_key;
-
-        std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-        if (gva_cache_->get_entry(k, idbase_key, gva))
+        if (gva_cache_->get_entry(gid, idbase, gva))
         {
             const std::uint64_t id_msb =
                 naming::detail::strip_internal_bits_from_gid(gid.get_msb());
 
-            if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
+            if (HPX_UNLIKELY(id_msb != idbase.get_msb()))
             {
-                lock.unlock();
                 HPX_THROWS_IF(ec, internal_server_error,
                     "addressing_service::get_cache_entry",
                     "bad entry in cache, MSBs of GID base and GID do not "
                     "match");
                 return false;
             }
-            idbase = idbase_key.get_gid();
             return true;
         }
 
@@ -1741,8 +1639,6 @@ namespace hpx { namespace agas {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
             gva_cache_->clear();
 
             if (&ec != &throws)
@@ -1788,11 +1684,7 @@ namespace hpx { namespace agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
-            gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
-                return gid == p.first.get_gid();
-            });
+            gva_cache_->erase(gid);
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1819,82 +1711,69 @@ namespace hpx { namespace agas {
     // Helper functions to access the current cache statistics
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
         return gva_cache_->size();
     }
 
     std::uint64_t addressing_service::get_cache_hits(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().hits(reset);
+        return gva_cache_->hits(reset);
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().misses(reset);
+        return gva_cache_->misses(reset);
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().evictions(reset);
+        return gva_cache_->evictions(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().insertions(reset);
+        return gva_cache_->insertions(reset);
     }
 
     ///////////////////////////////////////////////////////////////////////////
     std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_count(reset);
+        return gva_cache_->get_get_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_count(
         bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_count(reset);
+        return gva_cache_->get_insert_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_count(reset);
+        return gva_cache_->get_update_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_count(reset);
+        return gva_cache_->get_erase_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_time(reset);
+        return gva_cache_->get_get_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_time(reset);
+        return gva_cache_->get_insert_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_time(reset);
+        return gva_cache_->get_update_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_time(reset);
+        return gva_cache_->get_erase_entry_time(reset);
     }
 
     void addressing_service::register_server_instances()
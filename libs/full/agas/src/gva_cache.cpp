@@ -0,0 +1,666 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/agas/gva_cache.hpp>
+#include <hpx/agas_base/gva.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/modules/topology.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace agas {
+
+    namespace {
+        ///////////////////////////////////////////////////////////////////////
+        // Reader-writer spinlock preferring writers: once a writer announced
+        // itself, no new readers are admitted until the writer is done.
+        class rw_spinlock
+        {
+            static constexpr std::int32_t locked = 0x40000000;
+            static constexpr std::int32_t pending = 0x20000000;
+            static constexpr std::int32_t readers_mask = pending - 1;
+
+        public:
+            HPX_NON_COPYABLE(rw_spinlock);
+
+            rw_spinlock() = default;
+
+            void lock()
+            {
+                // announce the writer, this blocks new readers
+                std::int32_t s = state_.load(std::memory_order_relaxed);
+                while ((s & (locked | pending)) != 0 ||
+                    !state_.compare_exchange_weak(
+                        s, s | pending, std::memory_order_relaxed))
+                {
+                    util::yield_while(
+                        [this] {
+                            return (state_.load(std::memory_order_relaxed) &
+                                       (locked | pending)) != 0;
+                        },
+                        "hpx::agas::gva_cache::rw_spinlock::lock");
+                    s = state_.load(std::memory_order_relaxed);
+                }
+
+                // wait for the active readers to leave
+                std::int32_t expected = pending;
+                while (!state_.compare_exchange_weak(
+                    expected, locked, std::memory_order_acquire))
+                {
+                    util::yield_while(
+                        [this] {
+                            return state_.load(std::memory_order_relaxed) !=
+                                pending;
+                        },
+                        "hpx::agas::gva_cache::rw_spinlock::lock");
+                    expected = pending;
+                }
+            }
+
+            void unlock()
+            {
+                state_.store(0, std::memory_order_release);
+            }
+
+            void lock_shared()
+            {
+                while (!try_lock_shared())
+                {
+                    util::yield_while(
+                        [this] {
+                            return (state_.load(std::memory_order_relaxed) &
+                                       (locked | pending)) != 0;
+                        },
+                        "hpx::agas::gva_cache::rw_spinlock::lock_shared");
+                }
+            }
+
+            bool try_lock_shared()
+            {
+                std::int32_t s = state_.load(std::memory_order_relaxed);
+                return (s & (locked | pending)) == 0 &&
+                    state_.compare_exchange_weak(
+                        s, s + 1, std::memory_order_acquire);
+            }
+
+            void unlock_shared()
+            {
+                state_.fetch_sub(1, std::memory_order_release);
+            }
+
+        private:
+            // bit 30: locked exclusively, bit 29: writer waiting, bits 0-28:
+            // number of readers
+            std::atomic<std::int32_t> state_{0};
+        };
+
+        struct shared_lock_guard
+        {
+            explicit shared_lock_guard(rw_spinlock& mtx)
+              : mtx_(mtx)
+            {
+                mtx_.lock_shared();
+            }
+
+            ~shared_lock_guard()
+            {
+                mtx_.unlock_shared();
+            }
+
+            rw_spinlock& mtx_;
+        };
+
+        // access times are updated only if they changed by more than this
+        // (in ns) to avoid writing to the cache line of hot entries on every
+        // lookup
+        constexpr std::uint64_t touch_granularity = 1000;
+
+        // number of entries inspected when looking for an eviction victim
+        constexpr std::size_t eviction_samples = 8;
+
+        std::uint64_t block_of(naming::gid_type const& gid)
+        {
+            return gid.get_lsb() >> gva_cache::block_bits;
+        }
+
+        std::size_t next_power_of_two(std::size_t n)
+        {
+            std::size_t result = 1;
+            while (result < n)
+                result <<= 1;
+            return result;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A range of global ids [first, last]. The ordering treats all overlapping
+    // ranges as equivalent, which allows looking up the range covering a
+    // single id.
+    struct gva_cache::range_key
+    {
+        naming::gid_type first_;
+        naming::gid_type last_;
+
+        friend bool operator<(range_key const& lhs, range_key const& rhs)
+        {
+            return lhs.last_ < rhs.first_;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct gva_cache::shard
+    {
+        struct entry
+        {
+            entry(range_key const& key, gva const& g, std::uint64_t now)
+              : key_(key)
+              , gva_(g)
+              , last_access_(now)
+            {
+            }
+
+            // entries are moved only while holding the exclusive lock
+            entry(entry&& rhs)
+              : key_(rhs.key_)
+              , gva_(rhs.gva_)
+              , last_access_(
+                    rhs.last_access_.load(std::memory_order_relaxed))
+            {
+            }
+
+            entry& operator=(entry&& rhs)
+            {
+                key_ = rhs.key_;
+                gva_ = rhs.gva_;
+                last_access_.store(
+                    rhs.last_access_.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+                return *this;
+            }
+
+            void touch(std::uint64_t now)
+            {
+                std::uint64_t last =
+                    last_access_.load(std::memory_order_relaxed);
+                if (now > last + touch_granularity)
+                    last_access_.store(now, std::memory_order_relaxed);
+            }
+
+            range_key key_;
+            gva gva_;
+            std::atomic<std::uint64_t> last_access_;
+        };
+
+        struct api_counter
+        {
+            void update(std::uint64_t start, std::uint64_t end)
+            {
+                count_.fetch_add(1, std::memory_order_relaxed);
+                time_.fetch_add(end - start, std::memory_order_relaxed);
+            }
+
+            std::atomic<std::int64_t> count_{0};
+            std::atomic<std::int64_t> time_{0};
+        };
+
+        using index_type = std::map<range_key, std::size_t>;
+
+        ///////////////////////////////////////////////////////////////////////
+        bool lookup(naming::gid_type const& gid, naming::gid_type& idbase,
+            gva& g, std::uint64_t now)
+        {
+            if (size_.load(std::memory_order_relaxed) == 0)
+                return false;
+
+            shared_lock_guard l(mtx_);
+
+            auto it = index_.find(range_key{gid, gid});
+            if (it == index_.end())
+                return false;
+
+            entry& e = entries_[it->second];
+            e.touch(now);
+
+            idbase = e.key_.first_;
+            g = e.gva_;
+            return true;
+        }
+
+        // returns the key of any range overlapping with the given one
+        bool find_overlapping(range_key const& key, range_key& found)
+        {
+            if (size_.load(std::memory_order_relaxed) == 0)
+                return false;
+
+            shared_lock_guard l(mtx_);
+
+            auto it = index_.find(key);
+            if (it == index_.end())
+                return false;
+
+            found = it->first;
+            return true;
+        }
+
+        // returns false on a collision with a different range, 'inserted'
+        // is set if a new entry was added
+        bool update(range_key const& key, gva const& g, range_key& found,
+            std::uint64_t now, bool& inserted)
+        {
+            std::lock_guard<rw_spinlock> l(mtx_);
+
+            inserted = false;
+
+            auto it = index_.find(key);
+            if (it != index_.end())
+            {
+                if (it->first.first_ != key.first_ ||
+                    it->first.last_ != key.last_)
+                {
+                    found = it->first;
+                    return false;    // collision
+                }
+
+                entry& e = entries_[it->second];
+                e.gva_ = g;
+                e.touch(now);
+                return true;
+            }
+
+            index_.emplace(key, entries_.size());
+            entries_.emplace_back(key, g, now);
+
+            size_.store(entries_.size(), std::memory_order_relaxed);
+            insertions_.fetch_add(1, std::memory_order_relaxed);
+            inserted = true;
+            return true;
+        }
+
+        // evict the approximately least recently used entry
+        bool evict_one()
+        {
+            std::lock_guard<rw_spinlock> l(mtx_);
+
+            if (entries_.empty())
+                return false;
+
+            evict();
+            size_.store(entries_.size(), std::memory_order_relaxed);
+            return true;
+        }
+
+        std::size_t erase(naming::gid_type const& gid)
+        {
+            if (size_.load(std::memory_order_relaxed) == 0)
+                return 0;
+
+            std::lock_guard<rw_spinlock> l(mtx_);
+
+            auto it = index_.find(range_key{gid, gid});
+            if (it == index_.end() || it->first.first_ != gid)
+                return 0;
+
+            remove(it);
+            size_.store(entries_.size(), std::memory_order_relaxed);
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+            return 1;
+        }
+
+        std::size_t clear()
+        {
+            std::lock_guard<rw_spinlock> l(mtx_);
+
+            std::size_t erased = entries_.size();
+            index_.clear();
+            entries_.clear();
+            size_.store(0, std::memory_order_relaxed);
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // all functions below are called while holding the exclusive lock
+        std::size_t random_index()
+        {
+            // xorshift64
+            seed_ ^= seed_ << 13;
+            seed_ ^= seed_ >> 7;
+            seed_ ^= seed_ << 17;
+            return static_cast<std::size_t>(seed_ % entries_.size());
+        }
+
+        void evict()
+        {
+            HPX_ASSERT(!entries_.empty());
+
+            // approximate LRU: evict the least recently accessed of a small
+            // random sample of entries
+            std::size_t victim = random_index();
+            std::size_t const samples =
+                (std::min)(eviction_samples, entries_.size());
+            for (std::size_t i = 1; i < samples; ++i)
+            {
+                std::size_t candidate = random_index();
+                if (entries_[candidate].last_access_.load(
+                        std::memory_order_relaxed) <
+                    entries_[victim].last_access_.load(
+                        std::memory_order_relaxed))
+                {
+                    victim = candidate;
+                }
+            }
+
+            auto it = index_.find(entries_[victim].key_);
+            HPX_ASSERT(it != index_.end());
+            remove(it);
+
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void remove(index_type::iterator it)
+        {
+            std::size_t const pos = it->second;
+            index_.erase(it);
+
+            std::size_t const last = entries_.size() - 1;
+            if (pos != last)
+            {
+                entries_[pos] = std::move(entries_[last]);
+
+                auto moved = index_.find(entries_[pos].key_);
+                HPX_ASSERT(moved != index_.end());
+                moved->second = pos;
+            }
+            entries_.pop_back();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        rw_spinlock mtx_;
+        index_type index_;
+        std::vector<entry> entries_;
+        std::uint64_t seed_ = 0x9e3779b97f4a7c15ull;
+
+        std::atomic<std::size_t> size_{0};
+
+        std::atomic<std::int64_t> hits_{0};
+        std::atomic<std::int64_t> misses_{0};
+        std::atomic<std::int64_t> evictions_{0};
+        std::atomic<std::int64_t> insertions_{0};
+
+        api_counter get_entry_;
+        api_counter insert_entry_;
+        api_counter update_entry_;
+        api_counter erase_entry_;
+
+        // avoid false sharing between neighboring shards
+        char cacheline_pad_[threads::get_cache_line_size()];
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    gva_cache::gva_cache(std::size_t num_shards)
+      : num_shards_(next_power_of_two(num_shards != 0 ?
+                num_shards :
+                2 * static_cast<std::size_t>(threads::hardware_concurrency())))
+      , max_size_(0)
+      , size_(0)
+      , seed_(0x9e3779b97f4a7c15ull)
+      , shards_(new shard[num_shards_ + 1])
+    {
+    }
+
+    gva_cache::~gva_cache() = default;
+
+    gva_cache::shard& gva_cache::get_shard(
+        std::uint64_t msb, std::uint64_t block) const
+    {
+        std::uint64_t h = msb * 0x9e3779b97f4a7c15ull;
+        h ^= block * 0xc2b2ae3d27d4eb4full;
+        h ^= h >> 29;
+        return shards_[static_cast<std::size_t>(h) & (num_shards_ - 1)];
+    }
+
+    gva_cache::shard& gva_cache::get_shard(naming::gid_type const& gid) const
+    {
+        return get_shard(gid.get_msb(), block_of(gid));
+    }
+
+    gva_cache::shard& gva_cache::get_range_shard() const
+    {
+        return shards_[num_shards_];
+    }
+
+    // Called while holding mtx_. Entries are inserted while holding mtx_ only,
+    // so no colliding entry can appear while this check is in progress.
+    bool gva_cache::find_collision(
+        range_key const& key, shard const& s, range_key& found) const
+    {
+        shard& range_shard = get_range_shard();
+        if (&s != &range_shard)
+        {
+            // the new range is (partially) covered by a multi-block range
+            return range_shard.find_overlapping(key, found);
+        }
+
+        // The new range spans more than one block, check the shards of all
+        // blocks covered by the range.
+        std::uint64_t const msb = key.first_.get_msb();
+        std::uint64_t const first_block = block_of(key.first_);
+        std::uint64_t const last_block = block_of(key.last_);
+        if (msb == key.last_.get_msb() &&
+            last_block - first_block < num_shards_)
+        {
+            for (std::uint64_t b = first_block; b <= last_block; ++b)
+            {
+                if (get_shard(msb, b).find_overlapping(key, found))
+                    return true;
+            }
+            return false;
+        }
+
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            if (shards_[i].find_overlapping(key, found))
+                return true;
+        }
+        return false;
+    }
+
+    // Called while holding mtx_. The capacity of the cache is shared by all
+    // shards, an entry is evicted from the larger of the shard which just
+    // received a new entry and a randomly selected shard.
+    void gva_cache::evict_excess(shard& s)
+    {
+        while (size_.load(std::memory_order_relaxed) > max_size_)
+        {
+            // xorshift64
+            seed_ ^= seed_ << 13;
+            seed_ ^= seed_ >> 7;
+            seed_ ^= seed_ << 17;
+
+            shard& other = shards_[seed_ % (num_shards_ + 1)];
+
+            shard* victim = &s;
+            if (other.size_.load(std::memory_order_relaxed) >
+                s.size_.load(std::memory_order_relaxed))
+            {
+                victim = &other;
+            }
+
+            bool evicted = victim->evict_one();
+            for (std::size_t i = 0; !evicted && i != num_shards_ + 1; ++i)
+            {
+                evicted = shards_[i].evict_one();
+            }
+
+            if (!evicted)
+            {
+                // the cache is empty
+                HPX_ASSERT(size_.load(std::memory_order_relaxed) == 0);
+                break;
+            }
+            size_.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    void gva_cache::reserve(std::size_t max_size)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        max_size_ = max_size;
+        evict_excess(get_range_shard());
+    }
+
+    std::size_t gva_cache::size() const
+    {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    std::size_t gva_cache::capacity() const
+    {
+        return max_size_;
+    }
+
+    bool gva_cache::get_entry(
+        naming::gid_type const& gid, naming::gid_type& idbase, gva& g)
+    {
+        std::uint64_t const start = chrono::high_resolution_clock::now();
+
+        naming::gid_type const id = naming::detail::get_stripped_gid(gid);
+
+        shard& s = get_shard(id);
+        bool const found =
+            s.lookup(id, idbase, g, start) ||
+            get_range_shard().lookup(id, idbase, g, start);
+
+        if (found)
+            s.hits_.fetch_add(1, std::memory_order_relaxed);
+        else
+            s.misses_.fetch_add(1, std::memory_order_relaxed);
+
+        s.get_entry_.update(start, chrono::high_resolution_clock::now());
+        return found;
+    }
+
+    bool gva_cache::update(naming::gid_type const& gid, std::uint64_t count,
+        gva const& g, naming::gid_type& old_gid, std::uint64_t& old_count)
+    {
+        HPX_ASSERT(count != 0);
+
+        std::uint64_t const start = chrono::high_resolution_clock::now();
+
+        naming::gid_type const id = naming::detail::get_stripped_gid(gid);
+        range_key const key{id, id + naming::gid_type(count - 1)};
+
+        shard& s = (block_of(key.first_) == block_of(key.last_) &&
+                       key.first_.get_msb() == key.last_.get_msb()) ?
+            get_shard(key.first_) :
+            get_range_shard();
+
+        range_key found;
+        bool updated = false;
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            if (!find_collision(key, s, found))
+            {
+                bool inserted = false;
+                updated = s.update(key, g, found, start, inserted);
+                if (inserted)
+                {
+                    size_.fetch_add(1, std::memory_order_relaxed);
+                    evict_excess(s);
+
+                    s.insert_entry_.update(
+                        start, chrono::high_resolution_clock::now());
+                }
+            }
+        }
+
+        if (!updated)
+        {
+            old_gid = found.first_;
+            old_count = (found.last_ - found.first_).get_lsb() + 1;
+        }
+
+        s.update_entry_.update(start, chrono::high_resolution_clock::now());
+        return updated;
+    }
+
+    std::size_t gva_cache::erase(naming::gid_type const& gid)
+    {
+        std::uint64_t const start = chrono::high_resolution_clock::now();
+
+        naming::gid_type const id = naming::detail::get_stripped_gid(gid);
+
+        shard& s = get_shard(id);
+        std::size_t erased = 0;
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            erased = s.erase(id) + get_range_shard().erase(id);
+            size_.fetch_sub(erased, std::memory_order_relaxed);
+        }
+
+        s.erase_entry_.update(start, chrono::high_resolution_clock::now());
+        return erased;
+    }
+
+    std::size_t gva_cache::clear()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        std::size_t erased = 0;
+        for (std::size_t i = 0; i != num_shards_ + 1; ++i)
+        {
+            erased += shards_[i].clear();
+        }
+        size_.store(0, std::memory_order_relaxed);
+        return erased;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+#define HPX_AGAS_GVA_CACHE_STATISTICS(name, member)                            \
+    std::uint64_t gva_cache::name(bool reset)                                  \
+    {                                                                          \
+        std::uint64_t result = 0;                                              \
+        for (std::size_t i = 0; i != num_shards_ + 1; ++i)                     \
+        {                                                                      \
+            result += static_cast<std::uint64_t>(                              \
+                util::get_and_reset_value(shards_[i].member, reset));          \
+        }                                                                      \
+        return result;                                                         \
+    }                                                                          \
+    /**/
+
+    HPX_AGAS_GVA_CACHE_STATISTICS(hits, hits_)
+    HPX_AGAS_GVA_CACHE_STATISTICS(misses, misses_)
+    HPX_AGAS_GVA_CACHE_STATISTICS(evictions, evictions_)
+    HPX_AGAS_GVA_CACHE_STATISTICS(insertions, insertions_)
+
+    HPX_AGAS_GVA_CACHE_STATISTICS(get_get_entry_count, get_entry_.count_)
+    HPX_AGAS_GVA_CACHE_STATISTICS(get_insert_entry_count, insert_entry_.count_)
+    HPX_AGAS_GVA_CACHE_STATISTICS(get_update_entry_count, update_entry_.count_)
+    HPX_AGAS_GVA_CACHE_STATISTICS(get_erase_entry_count, erase_entry_.count_)
+
+    HPX_AGAS_GVA_CACHE_STATISTICS(get_get_entry_time, get_entry_.time_)
+    HPX_AGAS_GVA_CACHE_STATISTICS(get_insert_entry_time, insert_entry_.time_)
+    HPX_AGAS_GVA_CACHE_STATISTICS(get_update_entry_time, update_entry_.time_)
+    HPX_AGAS_GVA_CACHE_STATISTICS(get_erase_entry_time, erase_entry_.time_)
+
+#undef HPX_AGAS_GVA_CACHE_STATISTICS
+}}    // namespace hpx::agas
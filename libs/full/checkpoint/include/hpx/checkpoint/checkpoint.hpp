@@ -41,6 +41,7 @@ namespace hpx { namespace util {
     ///////////////////////////////////////////////////////////////////////////
     // Forward declarations
     class checkpoint;
+    class incremental_checkpoint;
 
     std::ostream& operator<<(std::ostream& ost, checkpoint const& ckp);
     std::istream& operator>>(std::istream& ist, checkpoint& ckp);
@@ -48,6 +49,14 @@ namespace hpx { namespace util {
     namespace detail {
         struct save_funct_obj;
         struct prepare_checkpoint;
+
+        template <typename T>
+        struct is_checkpoint
+          : std::integral_constant<bool,
+                std::is_same<T, checkpoint>::value ||
+                    std::is_same<T, incremental_checkpoint>::value>
+        {
+        };
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -284,8 +293,8 @@ namespace hpx { namespace util {
     template <typename T, typename... Ts,
         typename U =
             typename std::enable_if<!hpx::traits::is_launch_policy<T>::value &&
-                !std::is_same<typename std::decay<T>::type,
-                    checkpoint>::value>::type>
+                !detail::is_checkpoint<
+                    typename std::decay<T>::type>::value>::type>
     hpx::future<checkpoint> save_checkpoint(T&& t, Ts&&... ts)
     {
         return hpx::dataflow(detail::save_funct_obj{}, checkpoint{},
@@ -387,8 +396,8 @@ namespace hpx { namespace util {
     ///          a checkpoint.
     ///
     template <typename T, typename... Ts,
-        typename U = typename std::enable_if<!std::is_same<
-            typename std::decay<T>::type, checkpoint>::value>::type>
+        typename U = typename std::enable_if<!detail::is_checkpoint<
+            typename std::decay<T>::type>::value>::type>
     hpx::future<checkpoint> save_checkpoint(hpx::launch p, T&& t, Ts&&... ts)
     {
         return hpx::dataflow(p, detail::save_funct_obj{}, checkpoint{},
@@ -496,8 +505,8 @@ namespace hpx { namespace util {
     ///          values checkpoint.
     ///
     template <typename T, typename... Ts,
-        typename U = typename std::enable_if<!std::is_same<
-            typename std::decay<T>::type, checkpoint>::value>::type>
+        typename U = typename std::enable_if<!detail::is_checkpoint<
+            typename std::decay<T>::type>::value>::type>
     checkpoint save_checkpoint(
         hpx::launch::sync_policy sync_p, T&& t, Ts&&... ts)
     {
@@ -0,0 +1,1243 @@
+// Copyright (c) 2021 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines the incremental_checkpoint object. An incremental
+/// checkpoint splits the byte stream produced by save_checkpoint into chunks
+/// at content defined boundaries and keeps a hash for each of those. Saving
+/// into an existing incremental checkpoint stores only the chunks whose
+/// content was not part of the checkpoint before. Incremental checkpoints can
+/// be kept in memory or can be backed by a file, in which case the byte stream
+/// is written to the file while it is produced.
+
+/// \file hpx/checkpoint/incremental_checkpoint.hpp
+
+#pragma once
+
+#include <hpx/assert.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/filesystem.hpp>
+#include <hpx/runtime_local/run_as_os_thread.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Forward declarations
+    namespace detail {
+        struct save_incremental_funct_obj;
+        class incremental_checkpoint_writer;
+        class incremental_checkpoint_reader;
+    }    // namespace detail
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // 64 bit hash of a chunk of the checkpoint byte stream (based on
+        // MurmurHash64A)
+        inline std::uint64_t checkpoint_chunk_hash(
+            char const* data, std::size_t size) noexcept
+        {
+            constexpr std::uint64_t m = 0xc6a4a7935bd1e995ULL;
+            constexpr int r = 47;
+
+            std::uint64_t h = 0x9e3779b97f4a7c15ULL ^ (size * m);
+
+            char const* end = data + (size & ~std::size_t(7));
+            for (/**/; data != end; data += 8)
+            {
+                std::uint64_t k;
+                std::memcpy(&k, data, sizeof(k));
+
+                k *= m;
+                k ^= k >> r;
+                k *= m;
+
+                h ^= k;
+                h *= m;
+            }
+
+            std::size_t const rest = size & 7;
+            if (rest != 0)
+            {
+                std::uint64_t k = 0;
+                std::memcpy(&k, data, rest);
+                h ^= k;
+                h *= m;
+            }
+
+            h ^= h >> r;
+            h *= m;
+            h ^= h >> r;
+            return h;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Description of one chunk of the byte stream: its hash, its size,
+        // and its location in the backing file (if any)
+        struct incremental_checkpoint_chunk
+        {
+            std::uint64_t hash;
+            std::uint64_t offset;
+            std::uint64_t size;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Random values used by the rolling (gear) hash which determines the
+        // chunk boundaries
+        struct checkpoint_gear_table
+        {
+            std::uint64_t values[256];
+        };
+
+        constexpr checkpoint_gear_table make_checkpoint_gear_table() noexcept
+        {
+            // splitmix64
+            checkpoint_gear_table table{};
+            std::uint64_t x = 0;
+            for (std::size_t i = 0; i != 256; ++i)
+            {
+                x += 0x9e3779b97f4a7c15ULL;
+                std::uint64_t z = x;
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+                table.values[i] = z ^ (z >> 31);
+            }
+            return table;
+        }
+
+        inline std::uint64_t const* checkpoint_gear_values() noexcept
+        {
+            static constexpr checkpoint_gear_table table =
+                make_checkpoint_gear_table();
+            return table.values;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Content defined chunking: a chunk ends after a byte for which the
+        // rolling hash of the preceding 64 bytes has its topmost bits cleared.
+        // The chunk boundaries therefore depend on the local content only and
+        // inserting or removing data shifts the boundaries along with the
+        // data, which keeps the chunks following the modification intact.
+        // The chunks are between a quarter and four times the requested
+        // average size.
+        class content_defined_chunker
+        {
+        public:
+            explicit content_defined_chunker(std::size_t chunk_size) noexcept
+              : min_size_(chunk_size / 4)
+              , max_size_((std::max)(chunk_size * 4, std::size_t(1)))
+              , mask_(make_mask(chunk_size - chunk_size / 4))
+              , hash_(0)
+            {
+            }
+
+            // Return the number of the given bytes which belong to the
+            // current chunk, 'filled' is the number of bytes the current
+            // chunk holds already. Sets 'cut' if the current chunk ends with
+            // the last of the returned bytes.
+            std::size_t next(char const* data, std::size_t count,
+                std::size_t filled, bool& cut) noexcept
+            {
+                HPX_ASSERT(filled < max_size_);
+
+                // no boundary may occur before the minimal chunk size
+                if (filled < min_size_)
+                {
+                    cut = false;
+                    return (std::min)(count, min_size_ - filled);
+                }
+
+                std::uint64_t const* gear = checkpoint_gear_values();
+                std::size_t const limit =
+                    (std::min)(count, max_size_ - filled);
+                for (std::size_t i = 0; i != limit; ++i)
+                {
+                    hash_ = (hash_ << 1) +
+                        gear[static_cast<unsigned char>(data[i])];
+                    if ((hash_ & mask_) == 0)
+                    {
+                        hash_ = 0;
+                        cut = true;
+                        return i + 1;
+                    }
+                }
+
+                cut = filled + limit == max_size_;
+                if (cut)
+                    hash_ = 0;
+                return limit;
+            }
+
+        private:
+            // select the topmost log2(size) bits of the hash, which yields an
+            // expected distance between two boundaries of about 'size' bytes
+            static std::uint64_t make_mask(std::size_t size) noexcept
+            {
+                int bits = 0;
+                while (bits != 63 && (std::size_t(2) << bits) <= size)
+                    ++bits;
+                return bits == 0 ? 0 : ~std::uint64_t(0) << (64 - bits);
+            }
+
+            std::size_t min_size_;
+            std::size_t max_size_;
+            std::uint64_t mask_;
+            std::uint64_t hash_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The file backing an incremental checkpoint. The file starts with
+        // two header slots, followed by the chunks and the table describing
+        // the chunks of the byte stream. New chunks and the new table are
+        // appended after everything the current header refers to, the header
+        // is written last to the slot not used by the current header. An
+        // interrupted save operation therefore leaves the previous checkpoint
+        // intact. If most of the file is not referenced anymore the live
+        // chunks are copied to a temporary file which then replaces the
+        // backing file. The chunks are written by the threads of the I/O pool.
+        class incremental_checkpoint_file
+        {
+        public:
+            static constexpr std::size_t header_size = 64;
+            static constexpr std::size_t data_offset = 2 * header_size;
+            static constexpr std::uint64_t version = 2;
+
+            struct header
+            {
+                char magic[8];
+                std::uint64_t version;
+                std::uint64_t sequence;
+                std::uint64_t chunk_size;
+                std::uint64_t size;
+                std::uint64_t num_chunks;
+                std::uint64_t table_offset;
+                std::uint64_t checksum;
+            };
+
+            static_assert(sizeof(header) == header_size,
+                "the header has to fill its slot exactly");
+
+            explicit incremental_checkpoint_file(std::string const& filename)
+              : filename_(filename)
+              , slot_(0)
+              , valid_(false)
+            {
+                open();
+                read_current_header();
+            }
+
+            std::string const& filename() const noexcept
+            {
+                return filename_;
+            }
+
+            void write(std::size_t offset, void const* data, std::size_t size)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                write_locked(file_, offset, data, size);
+            }
+
+            void read(std::size_t offset, void* data, std::size_t size)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                read_locked(offset, data, size);
+            }
+
+            // return the header of the last committed checkpoint, returns
+            // false if the file does not hold a checkpoint
+            bool current_header(header& h)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+
+                h = current_;
+                return valid_;
+            }
+
+            // read the table of the last committed checkpoint
+            std::vector<incremental_checkpoint_chunk> read_table()
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+
+                std::vector<incremental_checkpoint_chunk> table;
+                if (valid_)
+                {
+                    table.resize(
+                        static_cast<std::size_t>(current_.num_chunks));
+                    read_locked(
+                        static_cast<std::size_t>(current_.table_offset),
+                        table.data(),
+                        table.size() * sizeof(incremental_checkpoint_chunk));
+                }
+                return table;
+            }
+
+            // the offset new chunks can be appended at without touching
+            // anything the last committed checkpoint refers to
+            std::size_t append_offset()
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+
+                if (!valid_)
+                    return data_offset;
+
+                return static_cast<std::size_t>(current_.table_offset) +
+                    static_cast<std::size_t>(current_.num_chunks) *
+                    sizeof(incremental_checkpoint_chunk);
+            }
+
+            // Make the given table the current checkpoint. All chunks are
+            // written already, the table is appended at 'table_offset'.
+            void commit(std::size_t table_offset, std::size_t chunk_size,
+                std::size_t size,
+                std::vector<incremental_checkpoint_chunk> const& table)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+
+                write_locked(file_, table_offset, table.data(),
+                    table.size() * sizeof(incremental_checkpoint_chunk));
+
+                // the chunks and the table have to be in place before the
+                // header referring to them is written
+                flush_locked(file_);
+
+                header h = make_header(
+                    valid_ ? current_.sequence + 1 : 0, chunk_size, size,
+                    table.size(), table_offset);
+                std::size_t const slot = valid_ ? 1 - slot_ : 0;
+
+                write_locked(file_, slot * header_size, &h, sizeof(h));
+                flush_locked(file_);
+
+                current_ = h;
+                slot_ = slot;
+                valid_ = true;
+            }
+
+            // Copy the chunks of the current checkpoint to a new file which
+            // replaces the backing file if the chunks which are not referred
+            // to anymore occupy most of the file. Updates the offsets stored
+            // in the given table.
+            void compact(std::vector<incremental_checkpoint_chunk>& table)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+
+                if (!valid_)
+                    return;
+
+                std::size_t live = data_offset +
+                    table.size() * sizeof(incremental_checkpoint_chunk);
+                for (auto const& chunk : table)
+                    live += static_cast<std::size_t>(chunk.size);
+
+                std::size_t const end =
+                    static_cast<std::size_t>(current_.table_offset) +
+                    table.size() * sizeof(incremental_checkpoint_chunk);
+                if (end <= 2 * live)
+                    return;
+
+                std::string const tmp_filename = filename_ + ".tmp";
+                std::fstream tmp(tmp_filename,
+                    std::ios::out | std::ios::trunc | std::ios::binary);
+                if (!tmp.is_open())
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "incremental_checkpoint_file::compact",
+                        "could not create checkpoint file: {}", tmp_filename);
+                }
+
+                // chunks occurring several times in the byte stream are
+                // copied once
+                std::vector<incremental_checkpoint_chunk> new_table(table);
+                std::unordered_map<std::uint64_t, std::uint64_t> copied;
+                std::vector<char> buffer;
+                std::size_t offset = data_offset;
+                for (auto& chunk : new_table)
+                {
+                    auto it = copied.find(chunk.offset);
+                    if (it != copied.end())
+                    {
+                        chunk.offset = it->second;
+                        continue;
+                    }
+
+                    buffer.resize(static_cast<std::size_t>(chunk.size));
+                    read_locked(static_cast<std::size_t>(chunk.offset),
+                        buffer.data(), buffer.size());
+                    write_locked(tmp, offset, buffer.data(), buffer.size());
+
+                    copied.emplace(chunk.offset, offset);
+                    chunk.offset = offset;
+                    offset += buffer.size();
+                }
+
+                write_locked(tmp, offset, new_table.data(),
+                    new_table.size() * sizeof(incremental_checkpoint_chunk));
+
+                header h = make_header(current_.sequence + 1,
+                    static_cast<std::size_t>(current_.chunk_size),
+                    static_cast<std::size_t>(current_.size), new_table.size(),
+                    offset);
+                write_locked(tmp, 0, &h, sizeof(h));
+                flush_locked(tmp);
+                tmp.close();
+
+                // the backing file is replaced as a whole, which leaves
+                // either the old or the new file in place
+                file_.close();
+                try
+                {
+                    hpx::filesystem::rename(tmp_filename, filename_);
+                }
+                catch (std::exception const& e)
+                {
+                    open();
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "incremental_checkpoint_file::compact",
+                        "could not replace checkpoint file: {}: {}", filename_,
+                        e.what());
+                }
+                open();
+
+                current_ = h;
+                slot_ = 0;
+                table = std::move(new_table);
+            }
+
+        private:
+            static char const* magic() noexcept
+            {
+                return "HPXICKP";
+            }
+
+            static std::uint64_t header_checksum(header const& h) noexcept
+            {
+                return checkpoint_chunk_hash(reinterpret_cast<char const*>(&h),
+                    offsetof(header, checksum));
+            }
+
+            static header make_header(std::uint64_t sequence,
+                std::size_t chunk_size, std::size_t size,
+                std::size_t num_chunks, std::size_t table_offset) noexcept
+            {
+                header h;
+                std::memcpy(h.magic, magic(), sizeof(h.magic));
+                h.version = version;
+                h.sequence = sequence;
+                h.chunk_size = chunk_size;
+                h.size = size;
+                h.num_chunks = num_chunks;
+                h.table_offset = table_offset;
+                h.checksum = header_checksum(h);
+                return h;
+            }
+
+            void open()
+            {
+                // open an existing file without truncating it, create it
+                // otherwise
+                file_.clear();
+                file_.open(
+                    filename_, std::ios::in | std::ios::out | std::ios::binary);
+                if (!file_.is_open())
+                {
+                    file_.clear();
+                    file_.open(filename_, std::ios::out | std::ios::binary);
+                    file_.close();
+                    file_.open(filename_,
+                        std::ios::in | std::ios::out | std::ios::binary);
+                }
+
+                if (!file_.is_open())
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "incremental_checkpoint_file::open",
+                        "could not open checkpoint file: {}", filename_);
+                }
+            }
+
+            // use the valid header with the highest sequence number, a
+            // header which was only partially written is ignored
+            void read_current_header()
+            {
+                for (std::size_t slot = 0; slot != 2; ++slot)
+                {
+                    header h;
+                    if (try_read(slot * header_size, &h, sizeof(h)) &&
+                        std::memcmp(h.magic, magic(), sizeof(h.magic)) == 0 &&
+                        h.version == version && h.chunk_size != 0 &&
+                        h.checksum == header_checksum(h) &&
+                        (!valid_ || h.sequence > current_.sequence))
+                    {
+                        current_ = h;
+                        slot_ = slot;
+                        valid_ = true;
+                    }
+                }
+            }
+
+            void write_locked(std::fstream& file, std::size_t offset,
+                void const* data, std::size_t size)
+            {
+                file.clear();
+                file.seekp(static_cast<std::streamoff>(offset));
+                file.write(static_cast<char const*>(data),
+                    static_cast<std::streamsize>(size));
+                if (!file)
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "incremental_checkpoint_file::write",
+                        "could not write to checkpoint file: {}", filename_);
+                }
+            }
+
+            void read_locked(std::size_t offset, void* data, std::size_t size)
+            {
+                if (!try_read(offset, data, size))
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "incremental_checkpoint_file::read",
+                        "could not read from checkpoint file: {}",
+                        filename_);
+                }
+            }
+
+            void flush_locked(std::fstream& file)
+            {
+                file.flush();
+                if (!file)
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "incremental_checkpoint_file::flush",
+                        "could not write to checkpoint file: {}", filename_);
+                }
+            }
+
+            bool try_read(std::size_t offset, void* data, std::size_t size)
+            {
+                file_.clear();
+                file_.seekg(static_cast<std::streamoff>(offset));
+                file_.read(static_cast<char*>(data),
+                    static_cast<std::streamsize>(size));
+                return static_cast<std::size_t>(file_.gcount()) == size;
+            }
+
+            std::mutex mtx_;
+            std::fstream file_;
+            std::string filename_;
+
+            header current_;
+            std::size_t slot_;
+            bool valid_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Incremental Checkpoint Object
+    ///
+    /// An incremental_checkpoint is a checkpoint which can be repeatedly
+    /// passed to save_checkpoint. The serialized byte stream is split into
+    /// chunks of about chunk_size bytes and only the chunks whose content was
+    /// not part of the previous save operation are stored. This reduces the
+    /// memory traffic (or the amount of data written to disk) for
+    /// applications that modify only parts of their state between two
+    /// checkpoints. The chunk boundaries are derived from the content of the
+    /// byte stream, data inserted or removed in the middle of the byte stream
+    /// causes only the chunks around the modification to be stored again.
+    ///
+    /// An incremental_checkpoint constructed from a file name writes the
+    /// chunks directly to that file while the objects are serialized, so the
+    /// full byte stream is never held in memory. If the file already holds an
+    /// incremental checkpoint it is used as the previous checkpoint, which
+    /// allows restoring the stored objects after a restart of the
+    /// application. A save operation which fails (or is interrupted) leaves
+    /// the previously stored checkpoint in the file intact.
+    ///
+    /// Copies of a file backed incremental_checkpoint refer to the same file,
+    /// only the most recently saved copy may be used.
+    class incremental_checkpoint
+    {
+    public:
+        static constexpr std::size_t default_chunk_size = 1024 * 1024;
+
+        /// Create an empty incremental checkpoint that keeps its chunks in
+        /// memory. The byte stream is split into chunks of about
+        /// \a chunk_size bytes.
+        ///
+        /// \throws hpx::exception (bad_parameter) if \a chunk_size is zero
+        explicit incremental_checkpoint(
+            std::size_t chunk_size = default_chunk_size)
+          : chunk_size_(chunk_size)
+          , size_(0)
+          , num_stored_chunks_(0)
+        {
+            check_chunk_size();
+        }
+
+        /// Create an incremental checkpoint backed by the given file. If the
+        /// file holds an incremental checkpoint already its content (and its
+        /// chunk size) is used as the previous checkpoint.
+        ///
+        /// \throws hpx::exception (bad_parameter) if \a chunk_size is zero
+        explicit incremental_checkpoint(std::string const& filename,
+            std::size_t chunk_size = default_chunk_size)
+          : chunk_size_(chunk_size)
+          , size_(0)
+          , num_stored_chunks_(0)
+        {
+            check_chunk_size();
+
+            file_ =
+                std::make_shared<detail::incremental_checkpoint_file>(filename);
+
+            detail::incremental_checkpoint_file::header h;
+            if (file_->current_header(h))
+            {
+                chunk_size_ = static_cast<std::size_t>(h.chunk_size);
+                size_ = static_cast<std::size_t>(h.size);
+                chunks_ = file_->read_table();
+            }
+        }
+
+        incremental_checkpoint(incremental_checkpoint const&) = default;
+        incremental_checkpoint(incremental_checkpoint&&) noexcept = default;
+
+        incremental_checkpoint& operator=(
+            incremental_checkpoint const&) = default;
+        incremental_checkpoint& operator=(
+            incremental_checkpoint&&) noexcept = default;
+
+        /// Return the size of the stored byte stream
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// Return the average size of the chunks the byte stream is split
+        /// into
+        std::size_t chunk_size() const noexcept
+        {
+            return chunk_size_;
+        }
+
+        /// Return the number of chunks of the stored byte stream
+        std::size_t num_chunks() const noexcept
+        {
+            return chunks_.size();
+        }
+
+        /// Return the number of chunks which were stored by the last
+        /// save_checkpoint operation, the remaining chunks were unchanged
+        std::size_t num_stored_chunks() const noexcept
+        {
+            return num_stored_chunks_;
+        }
+
+        /// Return the name of the backing file (empty for in-memory
+        /// checkpoints)
+        std::string filename() const
+        {
+            return file_ ? file_->filename() : std::string();
+        }
+
+    private:
+        friend class detail::incremental_checkpoint_writer;
+        friend class detail::incremental_checkpoint_reader;
+
+        void check_chunk_size() const
+        {
+            if (chunk_size_ == 0)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "incremental_checkpoint::incremental_checkpoint",
+                    "the chunk size of an incremental checkpoint must not be "
+                    "zero");
+            }
+        }
+
+        std::size_t chunk_size_;
+        std::size_t size_;
+        std::size_t num_stored_chunks_;
+
+        std::vector<detail::incremental_checkpoint_chunk> chunks_;
+
+        // the content of the chunks of in-memory checkpoints, unchanged
+        // chunks are shared between copies of the checkpoint
+        std::vector<std::shared_ptr<std::vector<char> const>> data_;
+
+        std::shared_ptr<detail::incremental_checkpoint_file> file_;
+    };
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Serialization container splitting the byte stream into chunks while
+        // it is being produced. Chunks that are not part of the previous
+        // content of the checkpoint are stored in memory or appended to the
+        // backing file asynchronously. The checkpoint is updated by finalize
+        // only, after all chunks have been stored.
+        class incremental_checkpoint_writer
+        {
+        public:
+            // maximal number of chunks concurrently being written to file
+            static constexpr std::size_t max_pending_writes = 4;
+
+            explicit incremental_checkpoint_writer(incremental_checkpoint& c)
+              : c_(c)
+              , chunker_(c.chunk_size_)
+              , size_(0)
+              , stream_size_(0)
+              , offset_(0)
+              , num_stored_chunks_(0)
+            {
+                buffer_.reserve(c_.chunk_size_);
+
+                previous_.reserve(c_.chunks_.size());
+                for (std::size_t i = 0; i != c_.chunks_.size(); ++i)
+                    previous_.emplace(c_.chunks_[i].hash, i);
+
+                if (c_.file_)
+                    offset_ = c_.file_->append_offset();
+            }
+
+            incremental_checkpoint_writer(
+                incremental_checkpoint_writer const&) = delete;
+            incremental_checkpoint_writer& operator=(
+                incremental_checkpoint_writer const&) = delete;
+
+            ~incremental_checkpoint_writer()
+            {
+                // make sure no write operation refers to the checkpoint
+                // anymore, errors have been reported by finalize already
+                for (auto& f : pending_)
+                {
+                    if (f.valid())
+                        f.wait();
+                }
+            }
+
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            void resize(std::size_t count) noexcept
+            {
+                size_ += count;
+            }
+
+            void write(
+                std::size_t count, std::size_t current, void const* address)
+            {
+                HPX_ASSERT(current == stream_size_ + buffer_.size());
+                (void) current;
+
+                char const* data = static_cast<char const*>(address);
+                while (count != 0)
+                {
+                    bool cut = false;
+                    std::size_t const n =
+                        chunker_.next(data, count, buffer_.size(), cut);
+                    buffer_.insert(buffer_.end(), data, data + n);
+                    data += n;
+                    count -= n;
+
+                    if (cut)
+                        store_chunk();
+                }
+            }
+
+            // store the last (partial) chunk, wait for all pending write
+            // operations and update the checkpoint
+            void finalize()
+            {
+                if (!buffer_.empty())
+                    store_chunk();
+
+                wait_for_pending_writes();
+
+                if (c_.file_)
+                {
+                    c_.file_->commit(offset_, c_.chunk_size_, size_, chunks_);
+                    c_.file_->compact(chunks_);
+                }
+
+                c_.size_ = size_;
+                c_.num_stored_chunks_ = num_stored_chunks_;
+                c_.chunks_ = std::move(chunks_);
+                c_.data_ = std::move(data_);
+            }
+
+        private:
+            void wait_for_pending_writes()
+            {
+                for (auto& f : pending_)
+                    f.get();
+                pending_.clear();
+            }
+
+            // The hash identifies the candidates for reusing a chunk only,
+            // the content of the candidate is compared to the current chunk.
+            // Chunks of file backed checkpoints are read back from the file.
+            bool has_same_content(incremental_checkpoint_chunk const& chunk,
+                std::vector<char> const* data)
+            {
+                if (chunk.size != buffer_.size())
+                    return false;
+
+                if (data != nullptr)
+                {
+                    return std::memcmp(data->data(), buffer_.data(),
+                               buffer_.size()) == 0;
+                }
+
+                std::vector<char> stored(buffer_.size());
+                std::shared_ptr<incremental_checkpoint_file> file = c_.file_;
+                hpx::threads::run_as_os_thread([&]() {
+                    file->read(static_cast<std::size_t>(chunk.offset),
+                        stored.data(), stored.size());
+                }).get();
+                return stored == buffer_;
+            }
+
+            void store_chunk()
+            {
+                std::uint64_t const hash =
+                    checkpoint_chunk_hash(buffer_.data(), buffer_.size());
+                stream_size_ += buffer_.size();
+
+                // reuse chunks with the same content, regardless of where in
+                // the byte stream they occurred before (the hash covers the
+                // size of the chunk as well)
+                auto it = current_.find(hash);
+                if (it != current_.end())
+                {
+                    // the chunk may still be being written to the file
+                    if (c_.file_)
+                        wait_for_pending_writes();
+
+                    std::size_t const index = it->second;
+                    if (has_same_content(chunks_[index], data_at(data_, index)))
+                    {
+                        reuse_chunk(chunks_[index],
+                            c_.file_ ? nullptr : data_[index]);
+                        return;
+                    }
+                }
+
+                it = previous_.find(hash);
+                if (it != previous_.end())
+                {
+                    std::size_t const index = it->second;
+                    if (has_same_content(
+                            c_.chunks_[index], data_at(c_.data_, index)))
+                    {
+                        reuse_chunk(c_.chunks_[index],
+                            c_.file_ ? nullptr : c_.data_[index]);
+                        return;
+                    }
+                }
+
+                ++num_stored_chunks_;
+                current_.emplace(hash, chunks_.size());
+
+                incremental_checkpoint_chunk const chunk = {
+                    hash, offset_, buffer_.size()};
+                chunks_.push_back(chunk);
+
+                auto data = std::make_shared<std::vector<char> const>(
+                    std::move(buffer_));
+
+                buffer_ = std::vector<char>();
+                buffer_.reserve(c_.chunk_size_);
+
+                if (!c_.file_)
+                {
+                    data_.push_back(std::move(data));
+                    return;
+                }
+
+                // limit the amount of memory held by pending write
+                // operations
+                if (pending_.size() == max_pending_writes)
+                {
+                    pending_.front().get();
+                    pending_.erase(pending_.begin());
+                }
+
+                // new chunks are appended after the data of the previous
+                // checkpoint, which stays intact until the new checkpoint has
+                // been committed, the (blocking) file operations are run on
+                // the I/O pool
+                std::shared_ptr<incremental_checkpoint_file> file = c_.file_;
+                std::size_t const offset = offset_;
+                offset_ += data->size();
+
+                pending_.push_back(
+                    hpx::threads::run_as_os_thread([file, offset, data]() {
+                        file->write(offset, data->data(), data->size());
+                    }));
+            }
+
+            // the content held for the given chunk of an in-memory checkpoint
+            static std::vector<char> const* data_at(
+                std::vector<std::shared_ptr<std::vector<char> const>> const&
+                    data,
+                std::size_t index) noexcept
+            {
+                return index < data.size() ? data[index].get() : nullptr;
+            }
+
+            void reuse_chunk(incremental_checkpoint_chunk const& chunk,
+                std::shared_ptr<std::vector<char> const> data)
+            {
+                current_.emplace(chunk.hash, chunks_.size());
+                chunks_.push_back(chunk);
+                if (!c_.file_)
+                    data_.push_back(std::move(data));
+                buffer_.clear();
+            }
+
+            incremental_checkpoint& c_;
+            content_defined_chunker chunker_;
+            std::size_t size_;
+            std::size_t stream_size_;    // size of all completed chunks
+            std::size_t offset_;         // next free offset in the file
+            std::size_t num_stored_chunks_;
+            std::vector<char> buffer_;
+            std::vector<hpx::future<void>> pending_;
+
+            // the chunks of the new byte stream
+            std::vector<incremental_checkpoint_chunk> chunks_;
+            std::vector<std::shared_ptr<std::vector<char> const>> data_;
+
+            // map the hashes of known chunks to their index in the previous
+            // and the new list of chunks
+            std::unordered_map<std::uint64_t, std::size_t> previous_;
+            std::unordered_map<std::uint64_t, std::size_t> current_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Serialization container reading the byte stream of an incremental
+        // checkpoint one chunk at a time.
+        class incremental_checkpoint_reader
+        {
+        public:
+            explicit incremental_checkpoint_reader(
+                incremental_checkpoint const& c)
+              : c_(c)
+              , current_chunk_(std::size_t(-1))
+            {
+                // the position of each of the chunks in the byte stream
+                starts_.reserve(c_.chunks_.size());
+                std::size_t start = 0;
+                for (auto const& chunk : c_.chunks_)
+                {
+                    starts_.push_back(start);
+                    start += static_cast<std::size_t>(chunk.size);
+                }
+            }
+
+            std::size_t size() const noexcept
+            {
+                return c_.size_;
+            }
+
+            void read(std::size_t count, std::size_t current, void* address)
+            {
+                char* dest = static_cast<char*>(address);
+                while (count != 0)
+                {
+                    std::size_t const index = find_chunk(current);
+                    std::size_t const offset = current - starts_[index];
+
+                    char const* chunk = get_chunk(index);
+                    std::size_t const n = (std::min)(count,
+                        static_cast<std::size_t>(c_.chunks_[index].size) -
+                            offset);
+                    std::memcpy(dest, chunk + offset, n);
+
+                    dest += n;
+                    current += n;
+                    count -= n;
+                }
+            }
+
+        private:
+            std::size_t find_chunk(std::size_t current) const
+            {
+                // the byte stream is usually read sequentially
+                if (current_chunk_ != std::size_t(-1) &&
+                    current >= starts_[current_chunk_] &&
+                    current - starts_[current_chunk_] <
+                        c_.chunks_[current_chunk_].size)
+                {
+                    return current_chunk_;
+                }
+
+                HPX_ASSERT(!starts_.empty() && current < c_.size_);
+                return static_cast<std::size_t>(
+                    std::upper_bound(starts_.begin(), starts_.end(), current) -
+                    starts_.begin() - 1);
+            }
+
+            char const* get_chunk(std::size_t index)
+            {
+                HPX_ASSERT(index < c_.chunks_.size());
+                if (!c_.file_)
+                {
+                    HPX_ASSERT(c_.data_[index]);
+                    current_chunk_ = index;
+                    return c_.data_[index]->data();
+                }
+
+                if (index != current_chunk_)
+                {
+                    buffer_.resize(
+                        static_cast<std::size_t>(c_.chunks_[index].size));
+                    c_.file_->read(
+                        static_cast<std::size_t>(c_.chunks_[index].offset),
+                        buffer_.data(), buffer_.size());
+                    current_chunk_ = index;
+                }
+                return buffer_.data();
+            }
+
+            incremental_checkpoint const& c_;
+            std::vector<std::size_t> starts_;
+            std::size_t current_chunk_;
+            std::vector<char> buffer_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct save_incremental_funct_obj
+        {
+            template <typename... Ts>
+            incremental_checkpoint operator()(
+                incremental_checkpoint&& c, Ts&&... ts) const
+            {
+                {
+                    incremental_checkpoint_writer writer(c);
+                    hpx::util::save_checkpoint_data(
+                        writer, std::forward<Ts>(ts)...);
+                    writer.finalize();
+                }
+                return std::move(c);
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint - Take an incremental checkpoint
+    ///
+    /// \tparam T            Containers passed to save_checkpoint to be
+    ///                      serialized and placed into a checkpoint object.
+    ///
+    /// \tparam Ts           More containers passed to save_checkpoint
+    ///                      to be serialized and placed into a
+    ///                      checkpoint object.
+    ///
+    /// \param c             Takes an incremental checkpoint holding the
+    ///                      result of a previous save operation (if any).
+    ///
+    /// \param t             A container to save.
+    ///
+    /// \param ts            Other containers to save.
+    ///
+    /// Save_checkpoint serializes the given objects into the incremental
+    /// checkpoint. Only the chunks of the resulting byte stream which differ
+    /// from the content of the checkpoint are stored.
+    ///
+    /// \returns Save_checkpoint returns a future to the incremental
+    ///          checkpoint.
+    template <typename T, typename... Ts>
+    hpx::future<incremental_checkpoint> save_checkpoint(
+        incremental_checkpoint&& c, T&& t, Ts&&... ts)
+    {
+        return hpx::dataflow(detail::save_incremental_funct_obj{},
+            std::move(c), detail::prepare_client(std::forward<T>(t)),
+            detail::prepare_client(std::forward<Ts>(ts))...);
+    }
+
+    /// \cond NOINTERNAL
+    // Same as above, just nullary
+    inline hpx::future<incremental_checkpoint> save_checkpoint(
+        incremental_checkpoint&& c)
+    {
+        return hpx::make_ready_future(std::move(c));
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint - Policy overload & incremental checkpoint
+    ///
+    /// \param p             Takes an HPX launch policy. Allows the user
+    ///                      to change the way the function is launched
+    ///                      i.e. async, sync, etc.
+    ///
+    /// \param c             Takes an incremental checkpoint holding the
+    ///                      result of a previous save operation (if any).
+    ///
+    /// \param t             A container to save.
+    ///
+    /// \param ts            Other containers to save.
+    ///
+    /// \returns Save_checkpoint returns a future to the incremental
+    ///          checkpoint.
+    template <typename T, typename... Ts>
+    hpx::future<incremental_checkpoint> save_checkpoint(
+        hpx::launch p, incremental_checkpoint&& c, T&& t, Ts&&... ts)
+    {
+        return hpx::dataflow(p, detail::save_incremental_funct_obj{},
+            std::move(c), detail::prepare_client(std::forward<T>(t)),
+            detail::prepare_client(std::forward<Ts>(ts))...);
+    }
+
+    /// \cond NOINTERNAL
+    // Same as above, just nullary
+    inline hpx::future<incremental_checkpoint> save_checkpoint(
+        hpx::launch, incremental_checkpoint&& c)
+    {
+        return hpx::make_ready_future(std::move(c));
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint - Sync_policy overload & incremental checkpoint
+    ///
+    /// \param sync_p        hpx::launch::sync_policy
+    ///
+    /// \param c             Takes an incremental checkpoint holding the
+    ///                      result of a previous save operation (if any).
+    ///
+    /// \param t             A container to save.
+    ///
+    /// \param ts            Other containers to save.
+    ///
+    /// \returns Save_checkpoint which is passed hpx::launch::sync_policy
+    ///          will return the updated incremental checkpoint.
+    template <typename T, typename... Ts>
+    incremental_checkpoint save_checkpoint(hpx::launch::sync_policy sync_p,
+        incremental_checkpoint&& c, T&& t, Ts&&... ts)
+    {
+        hpx::future<incremental_checkpoint> f_chk =
+            hpx::dataflow(sync_p, detail::save_incremental_funct_obj{},
+                std::move(c), detail::prepare_client(std::forward<T>(t)),
+                detail::prepare_client(std::forward<Ts>(ts))...);
+        return f_chk.get();
+    }
+
+    /// \cond NOINTERNAL
+    // Same as above, just nullary
+    inline incremental_checkpoint save_checkpoint(
+        hpx::launch::sync_policy, incremental_checkpoint&& c)
+    {
+        return std::move(c);
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_checkpoint - Restore from an incremental checkpoint
+    ///
+    /// \tparam T           A container to restore.
+    ///
+    /// \tparam Ts          Other containers to restore. Containers
+    ///                     must be in the same order that they were
+    ///                     inserted into the checkpoint.
+    ///
+    /// \param c            The incremental checkpoint to restore.
+    ///
+    /// \param t            A container to restore.
+    ///
+    /// \param ts           Other containers to restore Containers
+    ///                     must be in the same order that they were
+    ///                     inserted into the checkpoint.
+    ///
+    /// The byte stream is read one chunk at a time, a file backed checkpoint
+    /// is never loaded into memory as a whole.
+    ///
+    /// \returns Restore_checkpoint returns void.
+    template <typename T, typename... Ts>
+    void restore_checkpoint(incremental_checkpoint const& c, T& t, Ts&... ts)
+    {
+        detail::incremental_checkpoint_reader reader(c);
+        hpx::util::restore_checkpoint_data_func(
+            reader, detail::restore_impl{}, t, ts...);
+    }
+
+    /// \cond NOINTERNAL
+    // Same as above, just nullary
+    inline void restore_checkpoint(incremental_checkpoint const&) {}
+    /// \endcond
+}}    // namespace hpx::util
+
+namespace hpx { namespace traits {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <>
+    struct serialization_access_data<
+        util::detail::incremental_checkpoint_writer>
+      : default_serialization_access_data<
+            util::detail::incremental_checkpoint_writer>
+    {
+        static std::size_t size(
+            util::detail::incremental_checkpoint_writer const& cont)
+        {
+            return cont.size();
+        }
+
+        static void resize(util::detail::incremental_checkpoint_writer& cont,
+            std::size_t count)
+        {
+            cont.resize(count);
+        }
+
+        static void write(util::detail::incremental_checkpoint_writer& cont,
+            std::size_t count, std::size_t current, void const* address)
+        {
+            cont.write(count, current, address);
+        }
+    };
+
+    template <>
+    struct serialization_access_data<
+        util::detail::incremental_checkpoint_reader>
+      : default_serialization_access_data<
+            util::detail::incremental_checkpoint_reader>
+    {
+        static std::size_t size(
+            util::detail::incremental_checkpoint_reader const& cont)
+        {
+            return cont.size();
+        }
+
+        // the reader caches the last chunk read from the backing file
+        static void read(
+            util::detail::incremental_checkpoint_reader const& cont,
+            std::size_t count, std::size_t current, void* address)
+        {
+            const_cast<util::detail::incremental_checkpoint_reader&>(cont).read(
+                count, current, address);
+        }
+    };
+}}    // namespace hpx::traits
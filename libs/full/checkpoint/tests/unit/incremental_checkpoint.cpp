@@ -0,0 +1,203 @@
+// Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This example tests the functionality of save_checkpoint and
+// restore_checkpoint for incremental checkpoints.
+//
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <exception>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using hpx::util::incremental_checkpoint;
+using hpx::util::restore_checkpoint;
+using hpx::util::save_checkpoint;
+
+constexpr std::size_t chunk_size = 4096;
+
+void test_in_memory()
+{
+    std::vector<double> data(100000);
+    std::iota(data.begin(), data.end(), 0.0);
+    std::string str = "I am a string of characters";
+
+    //[incremental_check_test_1
+    incremental_checkpoint c(chunk_size);
+
+    // the first save operation stores all chunks
+    c = save_checkpoint(std::move(c), data, str).get();
+    HPX_TEST(c.num_chunks() != 0);
+    HPX_TEST_EQ(c.num_stored_chunks(), c.num_chunks());
+
+    // subsequent save operations store the modified chunks only
+    data[data.size() / 2] = -1.0;
+    c = save_checkpoint(hpx::launch::sync, std::move(c), data, str);
+    HPX_TEST(c.num_stored_chunks() <= std::size_t(2));
+    //]
+
+    std::vector<double> data2;
+    std::string str2;
+    restore_checkpoint(c, data2, str2);
+
+    HPX_TEST(data == data2);
+    HPX_TEST_EQ(str, str2);
+
+    // an unmodified state does not store anything
+    c = save_checkpoint(std::move(c), data, str).get();
+    HPX_TEST_EQ(c.num_stored_chunks(), std::size_t(0));
+
+    // inserting data stores the chunks around the insertion only
+    data.insert(data.begin() + data.size() / 3, 100, 42.0);
+    c = save_checkpoint(std::move(c), data, str).get();
+    HPX_TEST(c.num_stored_chunks() <= std::size_t(3));
+    HPX_TEST(c.num_stored_chunks() < c.num_chunks() / 10);
+
+    data2.clear();
+    restore_checkpoint(c, data2, str2);
+    HPX_TEST(data == data2);
+
+    // a smaller state shrinks the checkpoint
+    data.resize(data.size() / 4);
+    std::size_t num_chunks = c.num_chunks();
+    c = save_checkpoint(std::move(c), data, str).get();
+    HPX_TEST(c.num_chunks() < num_chunks);
+
+    data2.clear();
+    restore_checkpoint(c, data2, str2);
+    HPX_TEST(data == data2);
+    HPX_TEST_EQ(str, str2);
+}
+
+void test_file()
+{
+    std::string const filename = "incremental_checkpoint_test.dat";
+    std::remove(filename.c_str());
+
+    std::vector<int> data(100000);
+    std::iota(data.begin(), data.end(), 0);
+
+    {
+        //[incremental_check_test_2
+        incremental_checkpoint c(filename, chunk_size);
+        c = save_checkpoint(std::move(c), data).get();
+        //]
+        HPX_TEST_EQ(c.num_stored_chunks(), c.num_chunks());
+
+        data.front() = -1;
+        data.back() = -1;
+        c = save_checkpoint(std::move(c), data).get();
+        HPX_TEST(c.num_stored_chunks() >= std::size_t(2));
+        HPX_TEST(c.num_stored_chunks() <= std::size_t(4));
+
+        std::vector<int> data2;
+        restore_checkpoint(c, data2);
+        HPX_TEST(data == data2);
+    }
+
+    // reopen the file, its content is used as the previous checkpoint
+    {
+        incremental_checkpoint c(filename);
+        HPX_TEST_EQ(c.chunk_size(), chunk_size);
+
+        std::vector<int> data2;
+        restore_checkpoint(c, data2);
+        HPX_TEST(data == data2);
+
+        c = save_checkpoint(std::move(c), data).get();
+        HPX_TEST_EQ(c.num_stored_chunks(), std::size_t(0));
+    }
+
+    std::remove(filename.c_str());
+}
+
+// an object whose serialization fails on request
+struct failing
+{
+    bool fail = false;
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+        if (fail)
+            throw std::runtime_error("failing::serialize");
+    }
+};
+
+void test_failed_save()
+{
+    std::string const filename = "incremental_checkpoint_failed_test.dat";
+    std::remove(filename.c_str());
+
+    std::vector<int> data(100000);
+    std::iota(data.begin(), data.end(), 0);
+    std::vector<int> const saved_data = data;
+
+    {
+        failing f;
+        incremental_checkpoint c(filename, chunk_size);
+        c = save_checkpoint(std::move(c), data, f).get();
+
+        // a failing save operation does not modify the stored checkpoint
+        data[data.size() / 2] = -1;
+        f.fail = true;
+
+        bool caught_exception = false;
+        try
+        {
+            c = save_checkpoint(std::move(c), data, f).get();
+        }
+        catch (std::exception const&)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    {
+        incremental_checkpoint c(filename);
+
+        std::vector<int> data2;
+        failing f;
+        restore_checkpoint(c, data2, f);
+        HPX_TEST(saved_data == data2);
+    }
+
+    std::remove(filename.c_str());
+}
+
+void test_zero_chunk_size()
+{
+    bool caught_exception = false;
+    try
+    {
+        incremental_checkpoint c(0);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = e.get_error() == hpx::bad_parameter;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int main()
+{
+    test_in_memory();
+    test_file();
+    test_failed_save();
+    test_zero_chunk_size();
+
+    return hpx::util::report_errors();
+}
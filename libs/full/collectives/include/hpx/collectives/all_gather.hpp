@@ -97,20 +97,26 @@ namespace hpx { namespace lcos {
 
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 
+#include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/async_local/dataflow.hpp>
 #include <hpx/collectives/detail/communicator.hpp>
+#include <hpx/collectives/detail/mailbox.hpp>
 #include <hpx/components/basename_registration.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/acquire_shared_state.hpp>
 #include <hpx/modules/execution_base.hpp>
 #include <hpx/naming_base/id_type.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/vector.hpp>
 #include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -199,6 +205,92 @@ namespace hpx { namespace lcos {
             basename, num_sites, generation, this_site);
     }
 
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Recursive doubling: in each of the log2(num_sites) steps every site
+        // exchanges all values it has collected so far with the site whose
+        // number differs in one bit. If the number of sites is not a power of
+        // two, the sites beyond the largest power of two hand their value to
+        // a partner before the exchange and receive the result from it
+        // afterwards.
+        template <typename T>
+        std::vector<T> all_gather_tree(std::string const& basename,
+            std::size_t generation, T value, std::size_t num_sites,
+            std::size_t this_site)
+        {
+            using block_type = std::vector<std::pair<std::size_t, T>>;
+
+            auto make_result = [num_sites](block_type&& block) {
+                HPX_ASSERT(block.size() == num_sites);
+                std::vector<T> result(num_sites);
+                for (auto& p : block)
+                {
+                    result[p.first] = std::move(p.second);
+                }
+                return result;
+            };
+
+            std::size_t const pof2 = power_of_two_floor(num_sites);
+            std::size_t const rem = num_sites - pof2;
+
+            block_type block;
+            block.reserve(num_sites);
+            block.emplace_back(this_site, std::move(value));
+
+            mailbox<block_type> mb(basename, generation, this_site);
+            if (this_site >= pof2)
+            {
+                mb.send(this_site - pof2, 0, std::move(block));
+                return make_result(mb.receive(0).get());
+            }
+
+            // the partners of the additional sites receive one more message
+            auto first_slot = [rem](std::size_t site) -> std::size_t {
+                return site < rem ? 1 : 0;
+            };
+
+            auto append = [&block](block_type&& other) {
+                std::move(
+                    other.begin(), other.end(), std::back_inserter(block));
+            };
+
+            if (this_site < rem)
+            {
+                append(mb.receive(0).get());
+            }
+
+            std::size_t step = 0;
+            for (std::size_t mask = 1; mask != pof2; mask *= 2, ++step)
+            {
+                std::size_t const partner = this_site ^ mask;
+                mb.send(partner, first_slot(partner) + step, block);
+                append(mb.receive(first_slot(this_site) + step).get());
+            }
+
+            if (this_site < rem)
+            {
+                mb.send(this_site + pof2, 0, block);
+            }
+
+            mb.flush();
+            return make_result(std::move(block));
+        }
+
+        template <typename T>
+        hpx::future<std::vector<T>> all_gather_tree_async(
+            std::string basename, std::size_t generation, T local_result,
+            std::size_t num_sites, std::size_t this_site)
+        {
+            return hpx::async([basename = std::move(basename), generation,
+                                  local_result = std::move(local_result),
+                                  num_sites, this_site]() mutable {
+                return all_gather_tree(basename, generation,
+                    std::move(local_result), num_sites, this_site);
+            });
+        }
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     hpx::future<std::vector<T>> all_gather(hpx::future<hpx::id_type>&& fid,
@@ -248,6 +340,19 @@ namespace hpx { namespace lcos {
             this_site = static_cast<std::size_t>(agas::get_locality_id());
         }
 
+        // avoid funneling all values through the root site for larger numbers
+        // of sites
+        if (detail::select_collective_algorithm(num_sites) !=
+            detail::collective_algorithm::direct)
+        {
+            return local_result.then(hpx::launch::sync,
+                [basename = std::string(basename), generation, num_sites,
+                    this_site](hpx::future<T>&& f) mutable {
+                    return detail::all_gather_tree_async(std::move(basename),
+                        generation, f.get(), num_sites, this_site);
+                });
+        }
+
         if (this_site == root_site)
         {
             return all_gather(
@@ -319,6 +424,16 @@ namespace hpx { namespace lcos {
             this_site = static_cast<std::size_t>(agas::get_locality_id());
         }
 
+        // avoid funneling all values through the root site for larger numbers
+        // of sites
+        if (detail::select_collective_algorithm(num_sites) !=
+            detail::collective_algorithm::direct)
+        {
+            return detail::all_gather_tree_async(basename, generation,
+                typename std::decay<T>::type(std::forward<T>(local_result)),
+                num_sites, this_site);
+        }
+
         if (this_site == root_site)
         {
             return all_gather(
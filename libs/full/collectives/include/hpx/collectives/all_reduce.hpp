@@ -41,6 +41,14 @@ namespace hpx { namespace lcos {
     ///             usage of the \a HPX_REGISTER_ALLREDUCE macro to define the
     ///             necessary internal facilities used by \a all_reduce.
     ///
+    /// \note       If \a op combines single elements of a std::vector the
+    ///             vectors are reduced element by element. Starting at
+    ///             hpx.collectives.tree_min_sites sites (default: 8) the values
+    ///             are combined by recursive doubling instead of being sent to
+    ///             the root site, element-wise reductions of at least
+    ///             hpx.collectives.ring_min_bytes bytes (default: 65536) use a
+    ///             ring algorithm.
+    ///
     /// \returns    This function returns a future holding a value calculated
     ///             based on the values send by all participating sites. It will
     ///             become ready once the all_reduce operation has been completed.
@@ -79,6 +87,14 @@ namespace hpx { namespace lcos {
     ///             usage of the \a HPX_REGISTER_ALLREDUCE macro to define the
     ///             necessary internal facilities used by \a all_reduce.
     ///
+    /// \note       If \a op combines single elements of a std::vector the
+    ///             vectors are reduced element by element. Starting at
+    ///             hpx.collectives.tree_min_sites sites (default: 8) the values
+    ///             are combined by recursive doubling instead of being sent to
+    ///             the root site, element-wise reductions of at least
+    ///             hpx.collectives.ring_min_bytes bytes (default: 65536) use a
+    ///             ring algorithm.
+    ///
     /// \returns    This function returns a future holding a vector with all
     ///             values send by all participating sites. It will become
     ///             ready once the all_reduce operation has been completed.
@@ -97,17 +113,21 @@ namespace hpx { namespace lcos {
 
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 
+#include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/async_local/dataflow.hpp>
 #include <hpx/collectives/detail/communicator.hpp>
+#include <hpx/collectives/detail/mailbox.hpp>
 #include <hpx/components/basename_registration.hpp>
 #include <hpx/components_base/agas_interface.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/acquire_shared_state.hpp>
 #include <hpx/modules/execution_base.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
+#include <hpx/serialization/vector.hpp>
 #include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/type_support/unused.hpp>
 
@@ -207,6 +227,236 @@ namespace hpx { namespace lcos {
             basename, num_sites, generation, this_site);
     }
 
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // An all_reduce of std::vector<T> whose reduction operation combines
+        // single elements reduces the vectors element by element.
+        template <typename T, typename F>
+        struct is_elementwise_reduction : std::false_type
+        {
+        };
+
+        template <typename T, typename F>
+        struct is_elementwise_reduction<std::vector<T>, F>
+          : std::conditional<hpx::is_invocable<F const&,
+                                 std::vector<T> const&,
+                                 std::vector<T> const&>::value,
+                std::false_type,
+                hpx::is_invocable<F const&, T const&, T const&>>::type
+        {
+        };
+
+        template <typename F>
+        struct elementwise_reduction
+        {
+            template <typename T>
+            std::vector<T> operator()(
+                std::vector<T> lhs, std::vector<T> const& rhs) const
+            {
+                HPX_ASSERT(lhs.size() == rhs.size());
+                for (std::size_t i = 0; i != lhs.size(); ++i)
+                {
+                    lhs[i] = op_(lhs[i], rhs[i]);
+                }
+                return lhs;
+            }
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & op_;
+                // clang-format on
+            }
+
+            F op_;
+        };
+
+        template <typename F>
+        typename std::decay<F>::type make_reduction_op(
+            F&& op, std::false_type)
+        {
+            return std::forward<F>(op);
+        }
+
+        template <typename F>
+        elementwise_reduction<typename std::decay<F>::type> make_reduction_op(
+            F&& op, std::true_type)
+        {
+            return {std::forward<F>(op)};
+        }
+
+        // the number of bytes an element-wise reduction has to combine
+        template <typename T>
+        std::size_t reduction_payload_size(T const&, std::false_type)
+        {
+            return 0;
+        }
+
+        template <typename T>
+        std::size_t reduction_payload_size(
+            std::vector<T> const& value, std::true_type)
+        {
+            return value.size() * sizeof(T);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Recursive doubling: in each of the log2(num_sites) steps every site
+        // exchanges its partial result with the site whose number differs in
+        // one bit. If the number of sites is not a power of two, the sites
+        // beyond the largest power of two hand their value to a partner
+        // before the exchange and receive the result from it afterwards.
+        template <typename T, typename F>
+        T all_reduce_tree(std::string const& basename, std::size_t generation,
+            T value, F const& op, std::size_t num_sites, std::size_t this_site)
+        {
+            std::size_t const pof2 = power_of_two_floor(num_sites);
+            std::size_t const rem = num_sites - pof2;
+
+            mailbox<T> mb(basename, generation, this_site);
+            if (this_site >= pof2)
+            {
+                mb.send(this_site - pof2, 0, std::move(value));
+                return mb.receive(0).get();
+            }
+
+            // the partners of the additional sites receive one more message
+            auto first_slot = [rem](std::size_t site) -> std::size_t {
+                return site < rem ? 1 : 0;
+            };
+
+            if (this_site < rem)
+            {
+                value = op(std::move(value), mb.receive(0).get());
+            }
+
+            std::size_t step = 0;
+            for (std::size_t mask = 1; mask != pof2; mask *= 2, ++step)
+            {
+                std::size_t const partner = this_site ^ mask;
+                mb.send(partner, first_slot(partner) + step, value);
+
+                // both partners have to arrive at the same result
+                T other = mb.receive(first_slot(this_site) + step).get();
+                value = this_site < partner ?
+                    op(std::move(value), std::move(other)) :
+                    op(std::move(other), std::move(value));
+            }
+
+            if (this_site < rem)
+            {
+                mb.send(this_site + pof2, 0, value);
+            }
+
+            mb.flush();
+            return value;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Ring based reduce-scatter followed by an all-gather. The vectors
+        // are split into num_sites segments, in each of the 2*(num_sites-1)
+        // steps every site sends one segment to its right neighbor. A site
+        // does not wait for its previous messages to be delivered, which
+        // pipelines the transfers around the ring. Every site sends and
+        // receives 2*(num_sites-1)/num_sites times the size of the vector.
+        template <typename T, typename F>
+        std::vector<T> all_reduce_ring(std::string const& basename,
+            std::size_t generation, std::vector<T> value, F const& op,
+            std::size_t num_sites, std::size_t this_site)
+        {
+            std::size_t const size = value.size();
+            auto segment_begin = [size, num_sites](std::size_t segment) {
+                return segment * size / num_sites;
+            };
+
+            std::size_t const right = (this_site + 1) % num_sites;
+            mailbox<std::vector<T>> mb(basename, generation, this_site);
+
+            auto send_segment = [&](std::size_t segment, std::size_t slot) {
+                mb.send(right, slot,
+                    std::vector<T>(value.begin() + segment_begin(segment),
+                        value.begin() + segment_begin(segment + 1)));
+            };
+
+            // reduce-scatter, afterwards this site holds the reduced values
+            // of the segment following its own
+            for (std::size_t step = 0; step != num_sites - 1; ++step)
+            {
+                send_segment((this_site + num_sites - step) % num_sites, step);
+
+                std::size_t const segment =
+                    (this_site + 2 * num_sites - step - 1) % num_sites;
+                std::size_t const first = segment_begin(segment);
+
+                std::vector<T> other = mb.receive(step).get();
+                HPX_ASSERT(other.size() == segment_begin(segment + 1) - first);
+
+                for (std::size_t i = 0; i != other.size(); ++i)
+                {
+                    value[first + i] = op(other[i], value[first + i]);
+                }
+            }
+
+            // all-gather, circulate the reduced segments
+            for (std::size_t step = 0; step != num_sites - 1; ++step)
+            {
+                send_segment((this_site + num_sites + 1 - step) % num_sites,
+                    num_sites - 1 + step);
+
+                std::size_t const segment =
+                    (this_site + num_sites - step) % num_sites;
+                std::size_t const first = segment_begin(segment);
+
+                std::vector<T> other = mb.receive(num_sites - 1 + step).get();
+                HPX_ASSERT(other.size() == segment_begin(segment + 1) - first);
+
+                std::move(other.begin(), other.end(), value.begin() + first);
+            }
+
+            mb.flush();
+            return value;
+        }
+
+        template <typename T, typename F>
+        hpx::future<T> all_reduce_scalable(collective_algorithm,
+            std::string basename, std::size_t generation, T local_result,
+            F op, std::size_t num_sites, std::size_t this_site,
+            std::false_type)
+        {
+            return hpx::async([basename = std::move(basename), generation,
+                                  local_result = std::move(local_result),
+                                  op = std::move(op), num_sites,
+                                  this_site]() mutable -> T {
+                return all_reduce_tree(basename, generation,
+                    std::move(local_result), op, num_sites, this_site);
+            });
+        }
+
+        template <typename T, typename F>
+        hpx::future<std::vector<T>> all_reduce_scalable(
+            collective_algorithm algorithm, std::string basename,
+            std::size_t generation, std::vector<T> local_result, F op,
+            std::size_t num_sites, std::size_t this_site, std::true_type)
+        {
+            return hpx::async([algorithm, basename = std::move(basename),
+                                  generation,
+                                  local_result = std::move(local_result),
+                                  op = std::move(op), num_sites,
+                                  this_site]() mutable -> std::vector<T> {
+                if (algorithm == collective_algorithm::ring)
+                {
+                    return all_reduce_ring(basename, generation,
+                        std::move(local_result), op, num_sites, this_site);
+                }
+                return all_reduce_tree(basename, generation,
+                    std::move(local_result),
+                    make_reduction_op(std::move(op), std::true_type()),
+                    num_sites, this_site);
+            });
+        }
+    }    // namespace detail
+
     ////////////////////////////////////////////////////////////////////////////
     // destination site needs to be handled differently
     template <typename T, typename F>
@@ -243,40 +493,6 @@ namespace hpx { namespace lcos {
             std::move(fid), std::move(local_result));
     }
 
-    template <typename T, typename F>
-    hpx::future<T> all_reduce(char const* basename,
-        hpx::future<T>&& local_result, F&& op,
-        std::size_t num_sites = std::size_t(-1),
-        std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
-    {
-        if (num_sites == std::size_t(-1))
-        {
-            num_sites = static_cast<std::size_t>(
-                agas::get_num_localities(hpx::launch::sync));
-        }
-        if (this_site == std::size_t(-1))
-        {
-            this_site = static_cast<std::size_t>(agas::get_locality_id());
-        }
-
-        if (this_site == root_site)
-        {
-            return all_reduce(
-                create_all_reduce(basename, num_sites, generation, root_site),
-                std::move(local_result), std::forward<F>(op), this_site);
-        }
-
-        std::string name(basename);
-        if (generation != std::size_t(-1))
-        {
-            name += std::to_string(generation) + "/";
-        }
-
-        return all_reduce(hpx::find_from_basename(std::move(name), root_site),
-            std::move(local_result), std::forward<F>(op), this_site);
-    }
-
     ////////////////////////////////////////////////////////////////////////////
     // all_reduce plain values
     template <typename T, typename F>
@@ -332,19 +548,102 @@ namespace hpx { namespace lcos {
             this_site = static_cast<std::size_t>(agas::get_locality_id());
         }
 
+        using arg_type = typename std::decay<T>::type;
+        using func_type = typename std::decay<F>::type;
+        using is_elementwise =
+            detail::is_elementwise_reduction<arg_type, func_type>;
+
+        // avoid funneling all values through the root site for larger numbers
+        // of sites or payloads
+        detail::collective_algorithm const algorithm =
+            detail::select_collective_algorithm(num_sites,
+                detail::reduction_payload_size(local_result, is_elementwise()));
+
+        if (algorithm != detail::collective_algorithm::direct)
+        {
+            return detail::all_reduce_scalable(algorithm, basename, generation,
+                arg_type(std::forward<T>(local_result)),
+                func_type(std::forward<F>(op)), num_sites, this_site,
+                is_elementwise());
+        }
+
+        if (this_site == root_site)
+        {
+            return all_reduce(
+                create_all_reduce(basename, num_sites, generation, root_site),
+                std::forward<T>(local_result),
+                detail::make_reduction_op(
+                    std::forward<F>(op), is_elementwise()),
+                this_site);
+        }
+
+        std::string name(basename);
+        if (generation != std::size_t(-1))
+            name += std::to_string(generation) + "/";
+
+        return all_reduce(hpx::find_from_basename(std::move(name), root_site),
+            std::forward<T>(local_result),
+            detail::make_reduction_op(
+                std::forward<F>(op), is_elementwise()),
+            this_site);
+    }
+
+    template <typename T, typename F>
+    hpx::future<T> all_reduce(char const* basename,
+        hpx::future<T>&& local_result, F&& op,
+        std::size_t num_sites = std::size_t(-1),
+        std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
+    {
+        if (num_sites == std::size_t(-1))
+        {
+            num_sites = static_cast<std::size_t>(
+                agas::get_num_localities(hpx::launch::sync));
+        }
+        if (this_site == std::size_t(-1))
+        {
+            this_site = static_cast<std::size_t>(agas::get_locality_id());
+        }
+
+        using func_type = typename std::decay<F>::type;
+        using is_elementwise = detail::is_elementwise_reduction<T, func_type>;
+
+        // the payload of element-wise reductions is known only once the
+        // local value is available
+        if (is_elementwise::value ||
+            detail::select_collective_algorithm(num_sites) !=
+                detail::collective_algorithm::direct)
+        {
+            return local_result.then(hpx::launch::sync,
+                [basename = std::string(basename), op = std::forward<F>(op),
+                    num_sites, generation, this_site,
+                    root_site](hpx::future<T>&& f) mutable -> hpx::future<T> {
+                    return all_reduce(basename.c_str(), f.get(), std::move(op),
+                        num_sites, generation, this_site, root_site);
+                });
+        }
+
         if (this_site == root_site)
         {
             return all_reduce(
                 create_all_reduce(basename, num_sites, generation, root_site),
-                std::forward<T>(local_result), std::forward<F>(op), this_site);
+                std::move(local_result),
+                detail::make_reduction_op(
+                    std::forward<F>(op), is_elementwise()),
+                this_site);
         }
 
         std::string name(basename);
         if (generation != std::size_t(-1))
+        {
             name += std::to_string(generation) + "/";
+        }
 
         return all_reduce(hpx::find_from_basename(std::move(name), root_site),
-            std::forward<T>(local_result), std::forward<F>(op), this_site);
+            std::move(local_result),
+            detail::make_reduction_op(
+                std::forward<F>(op), is_elementwise()),
+            this_site);
     }
 }}    // namespace hpx::lcos
 
@@ -100,6 +100,9 @@ namespace hpx { namespace lcos {
     /// \param this_site    The sequence number of this invocation (usually
     ///                     the locality id). This value is optional and
     ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \params root_site   The site that is responsible for creating the
+    ///                     broadcast support object. This value is optional
+    ///                     and defaults to '0' (zero).
     ///
     /// \note       Each broadcast operation has to be accompanied with a unique
     ///             usage of the \a HPX_REGISTER_BROADCAST macro to define the
@@ -111,9 +114,104 @@ namespace hpx { namespace lcos {
     ///
     template <typename T>
     hpx::future<T> broadcast_from(char const* basename,
+        std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1),
+        std::size_t root_site = 0)
+
+    /// Broadcast a value to different call sites along a tree
+    ///
+    /// This function sends a value to all call sites operating on the given
+    /// base name. Every site forwards the value to up to log2(num_sites)
+    /// other sites, which avoids sending all messages from the calling site.
+    /// The receiving sites have to call \a broadcast_from_tree.
+    ///
+    /// \param  basename    The base name identifying the broadcast operation
+    /// \param  local_result A future referring to the value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  num_sites   The number of participating sites. All sites have
+    ///                     to pass the same value.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the broadcast operation performed on the
+    ///                     given base name. This is optional and needs to be
+    ///                     supplied only if the broadcast operation on the
+    ///                     given base name has to be performed more than once.
+    /// \param this_site    The sequence number of this invocation (usually
+    ///                     the locality id), this is the root of the tree.
+    ///                     This value is optional and defaults to whatever
+    ///                     hpx::get_locality_id() returns.
+    ///
+    /// \returns    This function returns a future holding the sent value. It
+    ///             will become ready once this site has sent the value to all
+    ///             of its children in the tree.
+    ///
+    template <typename T>
+    hpx::future<T> broadcast_to_tree(char const* basename,
+        hpx::future<T>&& local_result, std::size_t num_sites,
         std::size_t generation = std::size_t(-1),
         std::size_t this_site = std::size_t(-1))
 
+    /// Broadcast a value to different call sites along a tree
+    ///
+    /// This function sends a value to all call sites operating on the given
+    /// base name. Every site forwards the value to up to log2(num_sites)
+    /// other sites, which avoids sending all messages from the calling site.
+    /// The receiving sites have to call \a broadcast_from_tree.
+    ///
+    /// \param  basename    The base name identifying the broadcast operation
+    /// \param  local_result A value to transmit to all participating sites
+    ///                     from this call site.
+    /// \param  num_sites   The number of participating sites. All sites have
+    ///                     to pass the same value.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the broadcast operation performed on the
+    ///                     given base name. This is optional and needs to be
+    ///                     supplied only if the broadcast operation on the
+    ///                     given base name has to be performed more than once.
+    /// \param this_site    The sequence number of this invocation (usually
+    ///                     the locality id), this is the root of the tree.
+    ///                     This value is optional and defaults to whatever
+    ///                     hpx::get_locality_id() returns.
+    ///
+    /// \returns    This function returns a future holding the sent value. It
+    ///             will become ready once this site has sent the value to all
+    ///             of its children in the tree.
+    ///
+    template <typename T>
+    hpx::future<typename std::decay<T>::type> broadcast_to_tree(
+        char const* basename, T&& local_result, std::size_t num_sites,
+        std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1))
+
+    /// Receive a value that was broadcast along a tree
+    ///
+    /// This function receives the value sent by \a broadcast_to_tree and
+    /// forwards it to the sites below this site in the tree.
+    ///
+    /// \param  basename    The base name identifying the broadcast operation
+    /// \param  num_sites   The number of participating sites. All sites have
+    ///                     to pass the same value.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the broadcast operation performed on the
+    ///                     given base name. This is optional and needs to be
+    ///                     supplied only if the broadcast operation on the
+    ///                     given base name has to be performed more than once.
+    /// \param this_site    The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \params root_site   The site that called \a broadcast_to_tree. This
+    ///                     value is optional and defaults to '0' (zero).
+    ///
+    /// \returns    This function returns a future holding the value that was
+    ///             sent to all participating sites. It will become ready once
+    ///             this site has forwarded the value to all of its children
+    ///             in the tree.
+    ///
+    template <typename T>
+    hpx::future<T> broadcast_from_tree(char const* basename,
+        std::size_t num_sites, std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1),
+        std::size_t root_site = 0)
+
 }}    // namespace hpx::lcos
 
 // clang-format on
@@ -123,10 +221,12 @@ namespace hpx { namespace lcos {
 
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 
+#include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/async_local/dataflow.hpp>
 #include <hpx/collectives/detail/communicator.hpp>
+#include <hpx/collectives/detail/mailbox.hpp>
 #include <hpx/components/basename_registration.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
@@ -250,6 +350,83 @@ namespace hpx { namespace lcos {
             basename, num_sites, generation, this_site, 1);
     }
 
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // The value sent along the broadcast tree, together with the number
+        // of sites the receiver is responsible for.
+        template <typename T>
+        struct broadcast_message
+        {
+            std::size_t extent_;    // number of sites reached through receiver
+            T value_;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & extent_ & value_;
+                // clang-format on
+            }
+        };
+
+        // Send the value to the sites [rank, rank + extent) (numbered relative
+        // to the root site). Every receiver forwards the value to the upper
+        // half of the sites it is responsible for, which results in a tree of
+        // depth log2(num_sites).
+        template <typename T>
+        void broadcast_forward(mailbox<broadcast_message<T>>& mb,
+            T const& value, std::size_t num_sites, std::size_t extent,
+            std::size_t rank, std::size_t root_site)
+        {
+            while (extent > 1)
+            {
+                std::size_t const half = (extent + 1) / 2;
+                mb.send((root_site + rank + half) % num_sites, 0,
+                    broadcast_message<T>{extent - half, value});
+                extent = half;
+            }
+            mb.flush();
+        }
+
+        template <typename T>
+        hpx::future<T> broadcast_tree_send(std::string basename,
+            T local_result, std::size_t num_sites, std::size_t generation,
+            std::size_t root_site)
+        {
+            return hpx::async([basename = std::move(basename),
+                                  local_result = std::move(local_result),
+                                  num_sites, generation,
+                                  root_site]() mutable -> T {
+                mailbox<broadcast_message<T>> mb(
+                    basename, generation, root_site);
+                broadcast_forward(
+                    mb, local_result, num_sites, num_sites, 0, root_site);
+                return std::move(local_result);
+            });
+        }
+
+        template <typename T>
+        hpx::future<T> broadcast_tree_receive(std::string basename,
+            std::size_t num_sites, std::size_t generation,
+            std::size_t this_site, std::size_t root_site)
+        {
+            return hpx::async([basename = std::move(basename), num_sites,
+                                  generation, this_site, root_site]() -> T {
+                mailbox<broadcast_message<T>> mb(
+                    basename, generation, this_site);
+                broadcast_message<T> msg = mb.receive(0).get();
+
+                std::size_t const rank =
+                    (this_site + num_sites - root_site) % num_sites;
+                broadcast_forward(
+                    mb, msg.value_, num_sites, msg.extent_, rank, root_site);
+
+                return std::move(msg.value_);
+            });
+        }
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     // destination site needs to be handled differently
     template <typename T>
@@ -408,12 +585,66 @@ namespace hpx { namespace lcos {
         return broadcast_from<T>(
             hpx::find_from_basename(std::move(name), root_site), this_site);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The tree based broadcast is a separate operation as all sites have to
+    // agree on the number of sites to arrive at the same tree.
+    template <typename T>
+    hpx::future<T> broadcast_to_tree(char const* basename,
+        hpx::future<T>&& local_result, std::size_t num_sites,
+        std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1))
+    {
+        if (this_site == std::size_t(-1))
+        {
+            this_site = static_cast<std::size_t>(agas::get_locality_id());
+        }
+
+        return local_result.then(hpx::launch::sync,
+            [basename = std::string(basename), num_sites, generation,
+                this_site](hpx::future<T>&& f) mutable {
+                return detail::broadcast_tree_send(std::move(basename),
+                    f.get(), num_sites, generation, this_site);
+            });
+    }
+
+    template <typename T>
+    hpx::future<typename std::decay<T>::type> broadcast_to_tree(
+        char const* basename, T&& local_result, std::size_t num_sites,
+        std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1))
+    {
+        if (this_site == std::size_t(-1))
+        {
+            this_site = static_cast<std::size_t>(agas::get_locality_id());
+        }
+
+        return detail::broadcast_tree_send(basename,
+            typename std::decay<T>::type(std::forward<T>(local_result)),
+            num_sites, generation, this_site);
+    }
+
+    template <typename T>
+    hpx::future<T> broadcast_from_tree(char const* basename,
+        std::size_t num_sites, std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
+    {
+        if (this_site == std::size_t(-1))
+        {
+            this_site = static_cast<std::size_t>(agas::get_locality_id());
+        }
+
+        return detail::broadcast_tree_receive<T>(
+            basename, num_sites, generation, this_site, root_site);
+    }
 }}    // namespace hpx::lcos
 
 ////////////////////////////////////////////////////////////////////////////////
 namespace hpx {
     using lcos::broadcast_from;
+    using lcos::broadcast_from_tree;
     using lcos::broadcast_to;
+    using lcos::broadcast_to_tree;
     using lcos::create_broadcast;
 }    // namespace hpx
 
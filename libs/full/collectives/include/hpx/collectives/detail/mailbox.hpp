@@ -0,0 +1,234 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/collectives/detail/communicator.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/naming_base/id_type.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace traits {
+
+    namespace communication {
+        struct mailbox_tag;
+    }    // namespace communication
+
+    ///////////////////////////////////////////////////////////////////////////
+    // support for point-to-point messages between the sites taking part in a
+    // tree or ring based collective operation. The messages are identified by
+    // the generation of the operation and a slot number, which allows to use
+    // the same mailbox for all operations on a base name.
+    template <typename Communicator>
+    struct communication_operation<Communicator, communication::mailbox_tag>
+      : std::enable_shared_from_this<
+            communication_operation<Communicator, communication::mailbox_tag>>
+    {
+        using slot_key = std::pair<std::size_t, std::size_t>;
+        using slot_map = std::map<slot_key, std::shared_ptr<void>>;
+
+        communication_operation(Communicator& comm)
+          : communicator_(comm)
+        {
+        }
+
+        template <typename Result>
+        Result get(std::size_t which, std::size_t generation)
+        {
+            using arg_type = typename Result::result_type;
+            using mutex_type = typename Communicator::mutex_type;
+
+            std::unique_lock<mutex_type> l(communicator_.mtx_);
+            return take_slot<arg_type>(which, generation, l)->get_future();
+        }
+
+        template <typename Result, typename T>
+        Result set(std::size_t which, std::size_t generation, T&& t)
+        {
+            using arg_type = typename std::decay<T>::type;
+            using mutex_type = typename Communicator::mutex_type;
+
+            std::shared_ptr<lcos::local::promise<arg_type>> p;
+            {
+                std::unique_lock<mutex_type> l(communicator_.mtx_);
+                p = take_slot<arg_type>(which, generation, l);
+            }
+
+            // the promise can be set after the lock was released
+            p->set_value(std::forward<T>(t));
+        }
+
+        // The receiver and the sender of a message both look for its slot,
+        // whoever comes second removes it from the mailbox. Operations with
+        // different value types can share the mailbox as each slot is used
+        // for exactly one message.
+        template <typename T, typename Lock>
+        std::shared_ptr<lcos::local::promise<T>> take_slot(
+            std::size_t which, std::size_t generation, Lock& l)
+        {
+            slot_map& slots =
+                communicator_.template access_data<slot_map>(l)[0];
+
+            slot_key const key(generation, which);
+            auto it = slots.find(key);
+            if (it == slots.end())
+            {
+                auto p = std::make_shared<lcos::local::promise<T>>();
+                slots.emplace(key, p);
+                return p;
+            }
+
+            auto p =
+                std::static_pointer_cast<lcos::local::promise<T>>(it->second);
+            slots.erase(it);
+            return p;
+        }
+
+        Communicator& communicator_;
+    };
+}}    // namespace hpx::traits
+
+namespace hpx { namespace lcos { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    enum class collective_algorithm
+    {
+        direct,    // all sites talk to a single communicator
+        tree,      // recursive doubling or binomial tree
+        ring       // reduce-scatter followed by all-gather
+    };
+
+    // The number of sites from which on the collective operations use tree
+    // based algorithms (hpx.collectives.tree_min_sites, default: 8).
+    HPX_EXPORT std::size_t get_tree_min_sites();
+
+    // The payload size in bytes from which on element-wise reductions use
+    // the ring algorithm (hpx.collectives.ring_min_bytes, default: 65536).
+    HPX_EXPORT std::size_t get_ring_min_bytes();
+
+    // All sites have to arrive at the same choice, the payload size is
+    // non-zero only for operations which support the ring algorithm.
+    inline collective_algorithm select_collective_algorithm(
+        std::size_t num_sites, std::size_t payload_size = 0)
+    {
+        if (num_sites > 1 && payload_size != 0 &&
+            payload_size >= get_ring_min_bytes())
+        {
+            return collective_algorithm::ring;
+        }
+        if (num_sites > 1 && num_sites >= get_tree_min_sites())
+        {
+            return collective_algorithm::tree;
+        }
+        return collective_algorithm::direct;
+    }
+
+    // the largest power of two not larger than the given number of sites
+    inline std::size_t power_of_two_floor(std::size_t num_sites)
+    {
+        std::size_t pof2 = 1;
+        while (pof2 <= num_sites / 2)
+        {
+            pof2 *= 2;
+        }
+        return pof2;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every site creates and registers its mailbox only once per base name,
+    // the mailboxes of the other sites are looked up only once as well. All
+    // of them are kept until the runtime shuts down.
+    HPX_EXPORT hpx::shared_future<hpx::id_type> get_local_mailbox(
+        std::string const& name, std::size_t this_site);
+
+    HPX_EXPORT hpx::shared_future<hpx::id_type> find_mailbox(
+        std::string const& name, std::size_t site);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The messages a site sends and receives during one generation of a tree
+    // or ring based collective operation. The slots are numbered in the
+    // order the receiving site consumes the messages.
+    template <typename T>
+    class mailbox
+    {
+        using get_action = communicator_server::communication_get_action<
+            traits::communication::mailbox_tag, hpx::future<T>, std::size_t>;
+        using set_action = communicator_server::communication_set_action<
+            traits::communication::mailbox_tag, void, std::size_t, T>;
+
+    public:
+        mailbox(std::string const& basename, std::size_t generation,
+            std::size_t this_site)
+          : name_(basename + "/mailbox/")
+          , generation_(generation)
+          , id_(get_local_mailbox(name_, this_site))
+        {
+        }
+
+        mailbox(mailbox const&) = delete;
+        mailbox& operator=(mailbox const&) = delete;
+
+        ~mailbox()
+        {
+            // make sure the messages are delivered before the mailbox of
+            // their destination could go away
+            hpx::wait_all(sends_);
+        }
+
+        hpx::future<T> receive(std::size_t slot)
+        {
+            return id_.then(hpx::launch::sync,
+                [slot, generation = generation_](
+                    hpx::shared_future<hpx::id_type>&& f) {
+                    return hpx::async(get_action(), f.get(), slot, generation);
+                });
+        }
+
+        void send(std::size_t site, std::size_t slot, T value)
+        {
+            sends_.push_back(find_mailbox(name_, site).then(hpx::launch::sync,
+                [slot, generation = generation_, value = std::move(value)](
+                    hpx::shared_future<hpx::id_type>&& f) mutable {
+                    return hpx::async(set_action(), f.get(), slot,
+                        generation, std::move(value));
+                }));
+        }
+
+        // wait for all messages sent from this site to be delivered
+        void flush()
+        {
+            for (auto& f : sends_)
+            {
+                f.get();    // propagate any exceptions
+            }
+            sends_.clear();
+        }
+
+    private:
+        std::string name_;
+        std::size_t generation_;
+        hpx::shared_future<hpx::id_type> id_;
+        std::vector<hpx::future<void>> sends_;
+    };
+}}}    // namespace hpx::lcos::detail
+
+#endif    // COMPUTE_HOST_CODE
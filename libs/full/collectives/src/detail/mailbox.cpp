@@ -0,0 +1,146 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/collectives/detail/communicator.hpp>
+#include <hpx/collectives/detail/mailbox.hpp>
+#include <hpx/components/basename_registration.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/runtime_local/shutdown_function.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/thread_support/assert_owns_lock.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace hpx { namespace lcos { namespace detail {
+
+    std::size_t get_tree_min_sites()
+    {
+        return hpx::util::from_string<std::size_t>(
+            get_config_entry("hpx.collectives.tree_min_sites", "8"),
+            std::size_t(8));
+    }
+
+    std::size_t get_ring_min_bytes()
+    {
+        return hpx::util::from_string<std::size_t>(
+            get_config_entry("hpx.collectives.ring_min_bytes", "65536"),
+            std::size_t(65536));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        struct mailbox_registry
+        {
+            using mutex_type = lcos::local::spinlock;
+            using key_type = std::pair<std::string, std::size_t>;
+            using map_type =
+                std::map<key_type, hpx::shared_future<hpx::id_type>>;
+
+            mutex_type mtx_;
+            map_type local_;     // the mailboxes created on this locality
+            map_type remote_;    // the mailboxes looked up by this locality
+            bool cleanup_registered_ = false;
+        };
+
+        mailbox_registry& get_mailbox_registry()
+        {
+            static mailbox_registry registry;
+            return registry;
+        }
+
+        // release all mailboxes before the runtime goes away
+        void unregister_mailboxes()
+        {
+            mailbox_registry::map_type local;
+            mailbox_registry::map_type remote;
+            {
+                mailbox_registry& registry = get_mailbox_registry();
+                std::lock_guard<mailbox_registry::mutex_type> l(registry.mtx_);
+                std::swap(local, registry.local_);
+                std::swap(remote, registry.remote_);
+                registry.cleanup_registered_ = false;
+            }
+
+            for (auto& p : local)
+            {
+                p.second.wait();
+                hpx::unregister_with_basename(p.first.first, p.first.second)
+                    .get();
+            }
+        }
+    }    // namespace
+
+    hpx::shared_future<hpx::id_type> get_local_mailbox(
+        std::string const& name, std::size_t this_site)
+    {
+        mailbox_registry& registry = get_mailbox_registry();
+
+        std::unique_lock<mailbox_registry::mutex_type> l(registry.mtx_);
+        util::ignore_while_checking<
+            std::unique_lock<mailbox_registry::mutex_type>>
+            il(&l);
+
+        auto it = registry.local_.find(std::make_pair(name, this_site));
+        if (it != registry.local_.end())
+        {
+            return it->second;
+        }
+
+        if (!registry.cleanup_registered_)
+        {
+            registry.cleanup_registered_ = true;
+            hpx::register_pre_shutdown_function(&unregister_mailboxes);
+        }
+
+        // every message takes a slot of its own, the communicator needs to
+        // hold a single map of them only
+        hpx::shared_future<hpx::id_type> id =
+            create_communicator(name.c_str(), 1, std::size_t(-1), this_site, 1);
+        registry.local_.emplace(std::make_pair(name, this_site), id);
+        return id;
+    }
+
+    hpx::shared_future<hpx::id_type> find_mailbox(
+        std::string const& name, std::size_t site)
+    {
+        mailbox_registry& registry = get_mailbox_registry();
+        auto const key = std::make_pair(name, site);
+
+        std::unique_lock<mailbox_registry::mutex_type> l(registry.mtx_);
+        util::ignore_while_checking<
+            std::unique_lock<mailbox_registry::mutex_type>>
+            il(&l);
+
+        auto it = registry.local_.find(key);
+        if (it != registry.local_.end())
+        {
+            return it->second;
+        }
+
+        it = registry.remote_.find(key);
+        if (it == registry.remote_.end())
+        {
+            it = registry.remote_
+                     .emplace(key, hpx::find_from_basename(name, site))
+                     .first;
+        }
+        return it->second;
+    }
+}}}    // namespace hpx::lcos::detail
+
+#endif
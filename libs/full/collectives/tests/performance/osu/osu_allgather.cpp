@@ -0,0 +1,130 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// OSU allgather latency test: the average time an all_gather of a vector of
+// doubles takes on all localities
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+#define SKIP 200
+#define SKIP_LARGE 10
+#define LARGE_MESSAGE_SIZE 8192
+#define LOOP_LARGE 100
+
+constexpr char const* allgather_basename = "/osu/allgather/";
+constexpr char const* latency_basename = "/osu/allgather/latency/";
+
+///////////////////////////////////////////////////////////////////////////////
+double run_allgather(std::size_t size, std::size_t loop, std::size_t skip,
+    std::size_t num_localities, std::size_t& generation)
+{
+    std::vector<double> data(size / sizeof(double), 1.0);
+
+    hpx::chrono::high_resolution_timer t;
+
+    for (std::size_t i = 0; i != loop + skip; ++i)
+    {
+        // do not measure warm up phase
+        if (i == skip)
+            t.restart();
+
+        hpx::all_gather(allgather_basename, data, num_localities, generation++)
+            .get();
+    }
+
+    double elapsed = (t.elapsed() * 1e6) / static_cast<double>(loop);
+
+    // report the average over all localities
+    return hpx::all_reduce(latency_basename, elapsed, std::plus<double>{},
+               num_localities, generation++)
+               .get() /
+        static_cast<double>(num_localities);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    bool const is_root = hpx::get_locality_id() == 0;
+
+    std::size_t loop = vm["loop"].as<std::size_t>();
+    std::size_t min_size = vm["min-size"].as<std::size_t>();
+    std::size_t max_size = vm["max-size"].as<std::size_t>();
+
+    if (min_size < sizeof(double))
+        min_size = sizeof(double);
+    if (max_size < min_size)
+        std::swap(max_size, min_size);
+
+    if (is_root)
+    {
+        std::cout << "# OSU HPX Allgather Latency Test (" << num_localities
+                  << " localities)\n"
+                  << "# Size    Avg Latency (microsec)" << std::endl;
+    }
+
+    std::size_t generation = 0;
+    for (std::size_t size = min_size; size <= max_size; size *= 2)
+    {
+        bool const large = size > LARGE_MESSAGE_SIZE;
+        double latency = run_allgather(size,
+            large ? (std::min)(loop, std::size_t(LOOP_LARGE)) : loop,
+            large ? SKIP_LARGE : SKIP, num_localities, generation);
+
+        if (is_root)
+        {
+            std::cout << std::left << std::setw(10) << size << latency
+                      << std::endl;
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description desc(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc.add_options()
+        ("loop",
+         hpx::program_options::value<std::size_t>()->default_value(1000),
+         "Number of loops")
+        ("min-size",
+         hpx::program_options::value<std::size_t>()->default_value(8),
+         "Minimum size of the data sent from each locality in bytes")
+        ("max-size",
+         hpx::program_options::value<std::size_t>()->default_value((1<<20)),
+         "Maximum size of the data sent from each locality in bytes");
+    // clang-format on
+
+    // all localities take part in the collective operations
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,196 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// OSU broadcast latency test: the average time a broadcast of a vector of
+// doubles takes if it is sent directly from the root site or along a tree.
+// By default the number of sites is the threshold from which on the other
+// collective operations use tree based algorithms
+// (hpx.collectives.tree_min_sites), the sites are spread over the localities.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+#define SKIP 200
+#define SKIP_LARGE 10
+#define LARGE_MESSAGE_SIZE 8192
+#define LOOP_LARGE 100
+
+constexpr char const* direct_basename = "/osu/bcast/direct/";
+constexpr char const* tree_basename = "/osu/bcast/tree/";
+constexpr char const* latency_basename = "/osu/bcast/latency/";
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::size_t> local_sites(
+    std::size_t num_sites, std::size_t num_localities)
+{
+    std::vector<std::size_t> sites;
+    for (std::size_t site = hpx::get_locality_id(); site < num_sites;
+         site += num_localities)
+    {
+        sites.push_back(site);
+    }
+    return sites;
+}
+
+hpx::future<std::vector<double>> bcast_direct(std::vector<double> const& data,
+    std::size_t num_sites, std::size_t generation, std::size_t site)
+{
+    if (site == 0)
+    {
+        return hpx::broadcast_to(
+            direct_basename, data, num_sites, generation, site);
+    }
+    return hpx::broadcast_from<std::vector<double>>(
+        direct_basename, generation, site);
+}
+
+hpx::future<std::vector<double>> bcast_tree(std::vector<double> const& data,
+    std::size_t num_sites, std::size_t generation, std::size_t site)
+{
+    if (site == 0)
+    {
+        return hpx::broadcast_to_tree(
+            tree_basename, data, num_sites, generation, site);
+    }
+    return hpx::broadcast_from_tree<std::vector<double>>(
+        tree_basename, num_sites, generation, site);
+}
+
+template <typename F>
+double run_bcast(F&& bcast, std::size_t size, std::size_t loop,
+    std::size_t skip, std::size_t num_sites, std::size_t num_localities,
+    std::size_t& generation)
+{
+    std::vector<double> data(size / sizeof(double), 1.0);
+    std::vector<std::size_t> const sites =
+        local_sites(num_sites, num_localities);
+
+    hpx::chrono::high_resolution_timer t;
+
+    for (std::size_t i = 0; i != loop + skip; ++i)
+    {
+        // do not measure warm up phase
+        if (i == skip)
+            t.restart();
+
+        std::vector<hpx::future<std::vector<double>>> results;
+        results.reserve(sites.size());
+        for (std::size_t site : sites)
+        {
+            results.push_back(bcast(data, num_sites, generation, site));
+        }
+        hpx::wait_all(results);
+        ++generation;
+    }
+
+    double elapsed = (t.elapsed() * 1e6) / static_cast<double>(loop);
+
+    // report the average over all localities
+    return hpx::all_reduce(latency_basename, elapsed, std::plus<double>{},
+               num_localities, generation++)
+               .get() /
+        static_cast<double>(num_localities);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    bool const is_root = hpx::get_locality_id() == 0;
+
+    std::size_t loop = vm["loop"].as<std::size_t>();
+    std::size_t min_size = vm["min-size"].as<std::size_t>();
+    std::size_t max_size = vm["max-size"].as<std::size_t>();
+    std::size_t num_sites = vm["num-sites"].as<std::size_t>();
+
+    if (num_sites == 0)
+    {
+        num_sites = std::stoul(
+            hpx::get_config_entry("hpx.collectives.tree_min_sites", "8"));
+    }
+    if (min_size < sizeof(double))
+        min_size = sizeof(double);
+    if (max_size < min_size)
+        std::swap(max_size, min_size);
+
+    if (is_root)
+    {
+        std::cout << "# OSU HPX Broadcast Latency Test (" << num_sites
+                  << " sites on " << num_localities << " localities)\n"
+                  << "# Size    Direct (microsec)   Tree (microsec)"
+                  << std::endl;
+    }
+
+    std::size_t generation = 0;
+    for (std::size_t size = min_size; size <= max_size; size *= 2)
+    {
+        bool const large = size > LARGE_MESSAGE_SIZE;
+        std::size_t const size_loop =
+            large ? (std::min)(loop, std::size_t(LOOP_LARGE)) : loop;
+        std::size_t const skip = large ? SKIP_LARGE : SKIP;
+
+        double direct = run_bcast(&bcast_direct, size, size_loop, skip,
+            num_sites, num_localities, generation);
+        double tree = run_bcast(&bcast_tree, size, size_loop, skip,
+            num_sites, num_localities, generation);
+
+        if (is_root)
+        {
+            std::cout << std::left << std::setw(10) << size << std::setw(20)
+                      << direct << tree << std::endl;
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description desc(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc.add_options()
+        ("loop",
+         hpx::program_options::value<std::size_t>()->default_value(1000),
+         "Number of loops")
+        ("min-size",
+         hpx::program_options::value<std::size_t>()->default_value(8),
+         "Minimum size of the broadcast data in bytes")
+        ("max-size",
+         hpx::program_options::value<std::size_t>()->default_value((1<<20)),
+         "Maximum size of the broadcast data in bytes")
+        ("num-sites",
+         hpx::program_options::value<std::size_t>()->default_value(0),
+         "Number of participating sites (default: "
+         "hpx.collectives.tree_min_sites)");
+    // clang-format on
+
+    // all localities take part in the collective operations
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
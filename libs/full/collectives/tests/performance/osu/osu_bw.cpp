@@ -47,7 +47,7 @@ unsigned long getpagesize()
 
 #define LARGE_MESSAGE_SIZE 8192
 
-#define MAX_MSG_SIZE (1 << 22)
+#define MAX_MSG_SIZE (1 << 26)
 #define MAX_ALIGNMENT 65536
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,208 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Exercise the tree and ring based algorithms of all_reduce, all_gather, and
+// broadcast. Every locality runs several of the participating sites to test
+// numbers of sites which are not a power of two.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+constexpr char const* all_reduce_basename = "/test/tree/all_reduce/";
+constexpr char const* all_reduce_future_basename =
+    "/test/tree/all_reduce_future/";
+constexpr char const* all_reduce_vector_basename =
+    "/test/tree/all_reduce_vector/";
+constexpr char const* all_gather_basename = "/test/tree/all_gather/";
+constexpr char const* broadcast_basename = "/test/tree/broadcast/";
+
+// every number of sites needs its own set of names
+std::string make_basename(char const* basename, std::size_t num_sites)
+{
+    return std::string(basename) + std::to_string(num_sites) + "/";
+}
+
+std::vector<std::size_t> local_sites(std::size_t num_sites)
+{
+    std::size_t num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+    std::size_t here = hpx::get_locality_id();
+
+    std::vector<std::size_t> sites;
+    for (std::size_t site = here; site < num_sites; site += num_localities)
+    {
+        sites.push_back(site);
+    }
+    return sites;
+}
+
+void test_all_reduce(std::size_t num_sites)
+{
+    std::string const all_reduce_name =
+        make_basename(all_reduce_basename, num_sites);
+    std::string const all_reduce_future_name =
+        make_basename(all_reduce_future_basename, num_sites);
+    std::uint32_t sum = 0;
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        sum += static_cast<std::uint32_t>(site);
+    }
+
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        std::vector<hpx::future<std::uint32_t>> results;
+        for (std::size_t site : local_sites(num_sites))
+        {
+            results.push_back(hpx::all_reduce(all_reduce_name.c_str(),
+                static_cast<std::uint32_t>(site), std::plus<std::uint32_t>{},
+                num_sites, i, site));
+            results.push_back(hpx::all_reduce(all_reduce_future_name.c_str(),
+                hpx::make_ready_future(static_cast<std::uint32_t>(site)),
+                std::plus<std::uint32_t>{}, num_sites, i, site));
+        }
+
+        for (auto& f : results)
+        {
+            HPX_TEST_EQ(sum, f.get());
+        }
+    }
+}
+
+// small vectors are reduced using the tree, large vectors using the ring
+void test_all_reduce_vector(std::size_t num_sites)
+{
+    std::string const all_reduce_vector_name =
+        make_basename(all_reduce_vector_basename, num_sites);
+    std::size_t const sizes[] = {0, 3, 1000};
+
+    std::size_t generation = 0;
+    for (std::size_t size : sizes)
+    {
+        std::vector<hpx::future<std::vector<double>>> results;
+        for (std::size_t site : local_sites(num_sites))
+        {
+            std::vector<double> values(size);
+            for (std::size_t j = 0; j != size; ++j)
+            {
+                values[j] = double(site * j);
+            }
+
+            results.push_back(hpx::all_reduce(all_reduce_vector_name.c_str(),
+                std::move(values), std::plus<double>{}, num_sites,
+                generation, site));
+        }
+
+        for (auto& f : results)
+        {
+            std::vector<double> result = f.get();
+            HPX_TEST_EQ(result.size(), size);
+            for (std::size_t j = 0; j != result.size(); ++j)
+            {
+                HPX_TEST_EQ(
+                    result[j], double(j * num_sites * (num_sites - 1) / 2));
+            }
+        }
+
+        ++generation;
+    }
+}
+
+void test_all_gather(std::size_t num_sites)
+{
+    std::string const all_gather_name =
+        make_basename(all_gather_basename, num_sites);
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        std::vector<hpx::future<std::vector<std::uint32_t>>> results;
+        for (std::size_t site : local_sites(num_sites))
+        {
+            results.push_back(hpx::all_gather(all_gather_name.c_str(),
+                static_cast<std::uint32_t>(site + i), num_sites, i, site));
+        }
+
+        for (auto& f : results)
+        {
+            std::vector<std::uint32_t> result = f.get();
+            HPX_TEST_EQ(result.size(), num_sites);
+            for (std::size_t j = 0; j != result.size(); ++j)
+            {
+                HPX_TEST_EQ(result[j], static_cast<std::uint32_t>(j + i));
+            }
+        }
+    }
+}
+
+void test_broadcast(std::size_t num_sites)
+{
+    std::string const broadcast_name =
+        make_basename(broadcast_basename, num_sites);
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        std::size_t const root_site = i % num_sites;
+
+        std::vector<hpx::future<std::uint32_t>> results;
+        for (std::size_t site : local_sites(num_sites))
+        {
+            if (site == root_site)
+            {
+                results.push_back(hpx::broadcast_to_tree(
+                    broadcast_name.c_str(), static_cast<std::uint32_t>(i + 42),
+                    num_sites, i, site));
+            }
+            else
+            {
+                results.push_back(hpx::broadcast_from_tree<std::uint32_t>(
+                    broadcast_name.c_str(), num_sites, i, site, root_site));
+            }
+        }
+
+        for (auto& f : results)
+        {
+            HPX_TEST_EQ(static_cast<std::uint32_t>(i + 42), f.get());
+        }
+    }
+}
+
+int hpx_main()
+{
+    // the configuration below selects the tree based algorithms from two
+    // sites on, broadcast uses the tree for any number of sites
+    test_all_reduce(2);
+    test_all_reduce(5);
+    test_all_reduce_vector(2);
+    test_all_reduce_vector(7);
+    test_all_gather(2);
+    test_all_gather(5);
+    test_broadcast(2);
+    test_broadcast(6);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1",
+        "hpx.collectives.tree_min_sites!=2",
+        "hpx.collectives.ring_min_bytes!=256"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
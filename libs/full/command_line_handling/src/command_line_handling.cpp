@@ -19,6 +19,7 @@
 #include <hpx/modules/program_options.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/modules/topology.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/modules/util.hpp>
 #include <hpx/preprocessor/stringize.hpp>
 #include <hpx/util/from_string.hpp>
@@ -1622,7 +1623,11 @@ namespace hpx { namespace util {
         // load plugin modules (after first pass of command line handling,
         // so that settings given on command line could propagate to modules)
         std::vector<std::shared_ptr<plugins::plugin_registry_base>>
+            plugin_registries;
+        {
+            util::detail::startup_phase_timer timer("module discovery");
             plugin_registries = rtcfg_.load_modules(component_registries);
+        }
 
         // Re-run program option analysis, ini settings (such as aliases)
         // will be considered now.
@@ -629,7 +629,9 @@ namespace hpx { namespace util {
                   "   'full' (prints all available counter infos)")
                 ("hpx:print-counter-format", value<std::string>(),
                   "print the performance counter(s) specified with --hpx:print-counter "
-                  "in a given format (default: normal)")
+                  "in a given format, possible values:\n"
+                  "   'normal' (default), 'csv', 'csv-short' (text output)\n"
+                  "   'json' (JSON lines), 'binary' (compact binary columns)")
                 ("hpx:csv-header",
                   "print the performance counter(s) specified with --hpx:print-counter "
                   "with header when format specified with --hpx:print-counter-format"
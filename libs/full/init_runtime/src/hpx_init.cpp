@@ -12,6 +12,10 @@
 #include <hpx/assert.hpp>
 #include <hpx/command_line_handling/command_line_handling.hpp>
 #include <hpx/coroutines/detail/context_impl.hpp>
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_stack_pool.hpp>
+#endif
 #include <hpx/execution/detail/execution_parameter_callbacks.hpp>
 #include <hpx/execution_base/register_locks.hpp>
 #include <hpx/executors/exception_list.hpp>
@@ -31,10 +35,12 @@
 #include <hpx/modules/schedulers.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/modules/topology.hpp>
 #include <hpx/parallel/util/detail/handle_exception_termination_handler.hpp>
 #include <hpx/program_options/parsers.hpp>
 #include <hpx/program_options/variables_map.hpp>
 #include <hpx/resource_partitioner/partitioner.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/custom_exception_info.hpp>
 #include <hpx/runtime_local/debugging.hpp>
@@ -80,6 +86,7 @@
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -339,6 +346,15 @@ namespace hpx {
             threads::coroutines::detail::posix::use_guard_pages =
                 cmdline.rtcfg_.use_stack_guard_pages();
 #endif
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+            threads::coroutines::detail::posix::use_stack_pool =
+                cmdline.rtcfg_.use_stack_pool();
+            threads::coroutines::detail::posix::stack_pool_max_cached =
+                cmdline.rtcfg_.get_stack_pool_size();
+            threads::coroutines::detail::posix::stack_pool_trim_delay =
+                cmdline.rtcfg_.get_stack_pool_trim_delay();
+#endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cmdline.rtcfg_.enable_lock_detection())
             {
@@ -643,6 +659,7 @@ namespace hpx {
             add_startup_functions(
                 rt, vm, mode, std::move(startup), std::move(shutdown));
 
+            util::detail::startup_phase_timer timer("runtime start");
             if (!f.empty())
             {
                 // Run this runtime instance using the given function f.
@@ -782,6 +799,18 @@ namespace hpx {
                     return result;
                 }
 
+                util::detail::reset_startup_phase_timings();
+
+                // Discovering the hardware topology is independent of the
+                // command line handling and of loading the modules, let it
+                // run concurrently. The topology is needed by the command
+                // line handling only after the modules were loaded.
+                std::future<void> topology = std::async(
+                    std::launch::async, []() {
+                        util::detail::startup_phase_timer timer("topology");
+                        threads::create_topology();
+                    });
+
                 hpx::util::command_line_handling cmdline{
                     hpx::util::runtime_configuration(argv[0], params.mode),
                     hpx_startup::user_main_config(params.cfg), f};
@@ -795,8 +824,14 @@ namespace hpx {
                         std::shared_ptr<components::component_registry_base>>
                         component_registries;
 
-                    result = cmdline.call(
-                        params.desc_cmdline, argc, argv, component_registries);
+                    {
+                        util::detail::startup_phase_timer timer(
+                            "command line handling");
+                        result = cmdline.call(params.desc_cmdline, argc, argv,
+                            component_registries);
+                    }
+
+                    topology.get();
 
                     hpx::threads::policies::detail::affinity_data
                         affinity_data{};
@@ -815,6 +850,8 @@ namespace hpx {
                         hpx::util::get_entry_as<bool>(
                             cmdline.rtcfg_, "hpx.use_process_mask", 0));
 
+                    util::detail::startup_phase_timer rp_timer(
+                        "resource partitioner");
                     hpx::resource::partitioner rp =
                         hpx::resource::detail::make_partitioner(
                             params.rp_mode, cmdline.rtcfg_, affinity_data);
@@ -862,33 +899,39 @@ namespace hpx {
 
                 // Command line handling should have updated this by now.
                 HPX_ASSERT(cmdline.rtcfg_.mode_ != runtime_mode::default_);
-                switch (cmdline.rtcfg_.mode_)
-                {
-                case runtime_mode::local:
-                {
-                    LPROGRESS_ << "creating local runtime";
-                    rt.reset(new hpx::runtime(cmdline.rtcfg_));
-                    break;
-                }
-                default:
+
                 {
+                    util::detail::startup_phase_timer timer(
+                        "runtime construction");
+                    switch (cmdline.rtcfg_.mode_)
+                    {
+                    case runtime_mode::local:
+                    {
+                        LPROGRESS_ << "creating local runtime";
+                        rt.reset(new hpx::runtime(cmdline.rtcfg_));
+                        break;
+                    }
+                    default:
+                    {
 #if defined(HPX_HAVE_DISTRIBUTED_RUNTIME)
-                    LPROGRESS_ << "creating distributed runtime";
-                    rt.reset(new hpx::runtime_distributed(
-                        cmdline.rtcfg_, &hpx::detail::pre_main));
-                    break;
+                        LPROGRESS_ << "creating distributed runtime";
+                        rt.reset(new hpx::runtime_distributed(
+                            cmdline.rtcfg_, &hpx::detail::pre_main));
+                        break;
 #else
-                    HPX_THROW_EXCEPTION(invalid_status, "run_or_start",
-                        "Attempted to start the runtime in the mode \"{1}\", "
-                        "but HPX was compiled with "
-                        "HPX_WITH_DISTRIBUTED_RUNTIME=OFF, and \"{1}\" "
-                        "requires HPX_WITH_DISTRIBUTED_RUNTIME=ON. "
-                        "Recompile HPX with HPX_WITH_DISTRIBUTED_RUNTIME=ON or "
-                        "change the runtime mode.",
-                        get_runtime_mode_name(cmdline.rtcfg_.mode_));
-                    break;
+                        HPX_THROW_EXCEPTION(invalid_status, "run_or_start",
+                            "Attempted to start the runtime in the mode "
+                            "\"{1}\", but HPX was compiled with "
+                            "HPX_WITH_DISTRIBUTED_RUNTIME=OFF, and \"{1}\" "
+                            "requires HPX_WITH_DISTRIBUTED_RUNTIME=ON. "
+                            "Recompile HPX with "
+                            "HPX_WITH_DISTRIBUTED_RUNTIME=ON or change the "
+                            "runtime mode.",
+                            get_runtime_mode_name(cmdline.rtcfg_.mode_));
+                        break;
 #endif
-                }
+                    }
+                    }
                 }
 
                 result = run_or_start(blocking, std::move(rt), cmdline,
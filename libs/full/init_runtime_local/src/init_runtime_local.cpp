@@ -10,6 +10,10 @@
 #include <hpx/assert.hpp>
 #include <hpx/command_line_handling_local/command_line_handling_local.hpp>
 #include <hpx/coroutines/detail/context_impl.hpp>
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_stack_pool.hpp>
+#endif
 #include <hpx/execution/detail/execution_parameter_callbacks.hpp>
 #include <hpx/execution_base/register_locks.hpp>
 #include <hpx/executors/exception_list.hpp>
@@ -236,6 +240,15 @@ namespace hpx {
                 threads::coroutines::detail::posix::use_guard_pages =
                     cmdline.rtcfg_.use_stack_guard_pages();
 #endif
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+                threads::coroutines::detail::posix::use_stack_pool =
+                    cmdline.rtcfg_.use_stack_pool();
+                threads::coroutines::detail::posix::stack_pool_max_cached =
+                    cmdline.rtcfg_.get_stack_pool_size();
+                threads::coroutines::detail::posix::stack_pool_trim_delay =
+                    cmdline.rtcfg_.get_stack_pool_trim_delay();
+#endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
                 if (cmdline.rtcfg_.enable_lock_detection())
                 {
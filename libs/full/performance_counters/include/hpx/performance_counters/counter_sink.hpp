@@ -0,0 +1,127 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/performance_counters/counters_fwd.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace performance_counters {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A counter_sample holds the values of all counters of a
+    /// performance_counter_set which were evaluated at the same time. The
+    /// values of the counters returning a single value are stored in values_,
+    /// the values of the counters returning arrays of values are stored in
+    /// arrays_, both in the order of the counters in the set.
+    struct counter_sample
+    {
+        std::uint64_t sequence_ = 0;
+        std::vector<counter_value> values_;
+        std::vector<counter_values_array> arrays_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A counter_sink receives the counter samples and writes them in a
+    /// particular format. Sinks are invoked from the sampling thread of a
+    /// \a counter_sink_writer only, they don't have to be thread-safe.
+    class HPX_EXPORT counter_sink
+    {
+    public:
+        virtual ~counter_sink() = default;
+
+        /// Write the description of the sampled counters. The first vector
+        /// describes the counters returning a single value, the second the
+        /// counters returning arrays of values.
+        virtual void write_header(std::vector<counter_info> const& infos,
+            std::vector<counter_info> const& array_infos) = 0;
+
+        /// Write the given sample
+        virtual void write_sample(counter_sample const& sample) = 0;
+
+        /// Flush all written data to the underlying destination
+        virtual void flush() = 0;
+    };
+
+    /// Return whether the given counter output format is handled by one of
+    /// the predefined counter sinks (currently 'json' and 'binary')
+    HPX_EXPORT bool is_counter_sink_format(std::string const& format);
+
+    /// Create a counter sink for the given format writing to the given
+    /// destination ('cout' or a file name).
+    HPX_EXPORT std::unique_ptr<counter_sink> create_counter_sink(
+        std::string const& format, std::string const& destination,
+        error_code& ec = throws);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The counter_sink_writer hands the counter samples to a counter sink
+    /// on a dedicated (non-HPX) thread. This keeps the formatting and I/O
+    /// off the HPX worker threads. The sample buffers are recycled, the
+    /// number of samples in flight is bounded, excess samples are dropped.
+    class HPX_EXPORT counter_sink_writer
+    {
+    public:
+        explicit counter_sink_writer(std::unique_ptr<counter_sink> sink,
+            std::size_t max_pending_samples = 16);
+        ~counter_sink_writer();
+
+        counter_sink_writer(counter_sink_writer const&) = delete;
+        counter_sink_writer& operator=(counter_sink_writer const&) = delete;
+
+        /// Write the description of the counters to sample
+        void write_header(std::vector<counter_info> const& infos);
+
+        /// Return an empty sample, reusing the buffers of a previously
+        /// written sample, if possible
+        counter_sample get_sample();
+
+        /// Queue the given sample for writing, return false if the sample
+        /// was dropped
+        bool post(counter_sample&& sample);
+
+        /// Wait for all queued samples to be written
+        void flush();
+
+        /// Return the number of samples dropped so far
+        std::size_t get_dropped_samples() const;
+
+    private:
+        void run();
+
+        std::unique_ptr<counter_sink> sink_;
+        std::size_t max_pending_samples_;
+
+        std::mutex mtx_;
+        std::condition_variable cond_;
+        std::deque<counter_sample> pending_;
+        std::vector<counter_sample> free_;
+        std::vector<counter_info> infos_;
+        std::vector<counter_info> array_infos_;
+        bool header_pending_;
+        bool busy_;
+        bool stop_;
+
+        std::uint64_t sequence_;
+        std::atomic<std::size_t> dropped_samples_;
+
+        std::thread thread_;
+    };
+}}    // namespace hpx::performance_counters
+
+#include <hpx/config/warnings_suffix.hpp>
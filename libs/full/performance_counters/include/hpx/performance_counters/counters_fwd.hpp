@@ -582,6 +582,10 @@ namespace hpx { namespace performance_counters {
         HPX_EXPORT naming::gid_type component_instance_counter_creator(
             counter_info const&, error_code&);
 
+        // Creation function for the adaptive chunk size counters.
+        HPX_EXPORT naming::gid_type adaptive_chunk_size_counter_creator(
+            counter_info const&, error_code&);
+
         // \brief Create a new statistics performance counter instance based on
         //        the given base counter name and given base time interval
         //        (milliseconds).
@@ -17,6 +17,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -25,6 +26,10 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace performance_counters {
+    namespace server {
+        class base_performance_counter;
+    }
+
     // Make a collection of performance counters available as a set
     class HPX_EXPORT performance_counter_set
     {
@@ -62,6 +67,14 @@ namespace hpx { namespace performance_counters {
         std::vector<counter_value> get_counter_values(launch::sync_policy,
             bool reset = false, error_code& ec = throws) const;
 
+        /// Retrieve the values for all counters in this set supporting
+        /// this operation into the given buffer, the buffer is reused across
+        /// invocations. Counters located on this locality are evaluated
+        /// directly, all other counters are queried concurrently.
+        void get_counter_values(launch::sync_policy,
+            std::vector<counter_value>& values, bool reset = false,
+            error_code& ec = throws) const;
+
         /// Retrieve the array-values for all counters in this set supporting
         /// this operation
         std::vector<hpx::future<counter_values_array>> get_counter_values_array(
@@ -69,6 +82,9 @@ namespace hpx { namespace performance_counters {
         std::vector<counter_values_array> get_counter_values_array(
             launch::sync_policy, bool reset = false,
             error_code& ec = throws) const;
+        void get_counter_values_array(launch::sync_policy,
+            std::vector<counter_values_array>& values, bool reset = false,
+            error_code& ec = throws) const;
 
         /// Reset all counters in this set
         std::vector<hpx::future<void>> reset();
@@ -123,12 +139,25 @@ namespace hpx { namespace performance_counters {
         }
 
     private:
+        template <typename Value, typename Local, typename Remote>
+        void evaluate_counters(std::vector<Value>& values, bool reset,
+            bool arrays, Local&& local, Remote&& remote) const;
+
+        // Return the pointers to the counters of this set which are located
+        // on this locality (empty for all other counters)
+        std::vector<std::shared_ptr<server::base_performance_counter>>
+        get_local_counters() const;
+
         mutable mutex_type mtx_;
 
         std::vector<counter_info> infos_;     // counter instance names
         std::vector<naming::id_type> ids_;    // global ids of counter instances
         std::vector<std::uint8_t> reset_;     // != 0 if counter should be reset
 
+        // local counters, resolved on first use
+        mutable std::vector<std::shared_ptr<server::base_performance_counter>>
+            local_counters_;
+
         mutable std::uint64_t invocation_count_;
         bool print_counters_locally_;    // handle only local counters
     };
@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/itt_notify.hpp>
+#include <hpx/performance_counters/counter_sink.hpp>
 #include <hpx/performance_counters/counters_fwd.hpp>
 #include <hpx/performance_counters/performance_counter_set.hpp>
 #include <hpx/runtime_local/interval_timer.hpp>
@@ -19,6 +20,7 @@
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
 #include <map>
 #endif
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -68,6 +70,9 @@ namespace hpx { namespace util {
             std::vector<performance_counters::counter_info> const& infos,
             error_code& ec);
 
+        // evaluate all counters at once and hand the values to the sink
+        bool sample_counters(bool reset, error_code& ec);
+
         template <typename Stream>
         void print_headers(Stream& output,
             std::vector<performance_counters::counter_info> const& infos);
@@ -118,6 +123,9 @@ namespace hpx { namespace util {
 
         interval_timer timer_;
 
+        // asynchronous writer used for the 'json' and 'binary' formats
+        std::unique_ptr<performance_counters::counter_sink_writer> writer_;
+
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
         std::map<std::string, util::itt::counter> itt_counters_;
 #endif
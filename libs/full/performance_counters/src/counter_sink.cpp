@@ -0,0 +1,560 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/counter_sink.hpp>
+#include <hpx/performance_counters/counters.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace performance_counters {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Calculate the scaled value without throwing, invalid values are
+        // reported as NaN
+        inline double get_scaled_value(counter_status status,
+            std::int64_t value, std::int64_t scaling, bool scale_inverse)
+        {
+            if (!status_is_valid(status) || scaling == 0)
+                return std::numeric_limits<double>::quiet_NaN();
+
+            double val = static_cast<double>(value);
+            if (scaling != 1)
+            {
+                if (scale_inverse)
+                    return val / static_cast<double>(scaling);
+                return val * static_cast<double>(scaling);
+            }
+            return val;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Base class for the predefined sinks, manages the output stream
+        class stream_counter_sink : public counter_sink
+        {
+        public:
+            explicit stream_counter_sink(std::string const& destination,
+                std::ios_base::openmode mode)
+              : out_(&std::cout)
+            {
+                if (destination != "cout")
+                {
+                    file_.open(destination.c_str(), mode | std::ios_base::app);
+                    out_ = &file_;
+                }
+            }
+
+            bool is_open() const
+            {
+                return out_ != &file_ || file_.is_open();
+            }
+
+            void flush() override
+            {
+                out_->flush();
+            }
+
+        protected:
+            std::ostream& out()
+            {
+                return *out_;
+            }
+
+        private:
+            std::ofstream file_;
+            std::ostream* out_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Write one JSON object per line. The first line describes the
+        // counters and the fields stored for each of them, all subsequent
+        // lines hold one sample each:
+        //
+        //   {"fields":["time","count","value"],
+        //    "counters":[{"name":...,"type":...,"unit":...},...],
+        //    "arrays":[{"name":...,"type":...,"unit":...},...]}
+        //   {"sequence":1,"values":[[time,count,value],...],
+        //    "arrays":[[time,count,[value,...]],...]}
+        //
+        // The values of a sample are listed in the order of the counters in
+        // the first line, invalid values are written as null.
+        class json_lines_sink : public stream_counter_sink
+        {
+        public:
+            explicit json_lines_sink(std::string const& destination)
+              : stream_counter_sink(destination, std::ios_base::out)
+            {
+            }
+
+            void write_header(std::vector<counter_info> const& infos,
+                std::vector<counter_info> const& array_infos) override
+            {
+                infos_ = infos;
+                array_infos_ = array_infos;
+
+                line_.clear();
+                line_ += "{\"fields\":[\"time\",\"count\",\"value\"]";
+                line_ += ",\"counters\":[";
+                append_infos(infos_);
+                line_ += "],\"arrays\":[";
+                append_infos(array_infos_);
+                line_ += "]}\n";
+
+                out().write(line_.data(), std::streamsize(line_.size()));
+            }
+
+            void write_sample(counter_sample const& sample) override
+            {
+                HPX_ASSERT(sample.values_.size() == infos_.size());
+                HPX_ASSERT(sample.arrays_.size() == array_infos_.size());
+
+                line_.clear();
+                line_ += "{\"sequence\":";
+                append_number(sample.sequence_);
+                line_ += ",\"values\":[";
+                for (std::size_t i = 0; i != sample.values_.size(); ++i)
+                {
+                    counter_value const& value = sample.values_[i];
+                    if (i != 0)
+                        line_ += ',';
+                    line_ += '[';
+                    append_time_and_count(value.time_, value.count_);
+                    append_value(get_scaled_value(value.status_, value.value_,
+                        value.scaling_, value.scale_inverse_));
+                    line_ += ']';
+                }
+                line_ += "],\"arrays\":[";
+                for (std::size_t i = 0; i != sample.arrays_.size(); ++i)
+                {
+                    counter_values_array const& value = sample.arrays_[i];
+                    if (i != 0)
+                        line_ += ',';
+                    line_ += '[';
+                    append_time_and_count(value.time_, value.count_);
+                    line_ += '[';
+                    for (std::size_t j = 0; j != value.values_.size(); ++j)
+                    {
+                        if (j != 0)
+                            line_ += ',';
+                        append_value(get_scaled_value(value.status_,
+                            value.values_[j], value.scaling_,
+                            value.scale_inverse_));
+                    }
+                    line_ += "]]";
+                }
+                line_ += "]}\n";
+
+                out().write(line_.data(), std::streamsize(line_.size()));
+            }
+
+        private:
+            void append_infos(std::vector<counter_info> const& infos)
+            {
+                bool first = true;
+                for (counter_info const& info : infos)
+                {
+                    if (!first)
+                        line_ += ',';
+                    first = false;
+
+                    line_ += "{\"name\":";
+                    append_string(info.fullname_);
+                    line_ += ",\"type\":";
+                    append_string(get_counter_type_name(info.type_));
+                    line_ += ",\"unit\":";
+                    append_string(info.unit_of_measure_);
+                    line_ += '}';
+                }
+            }
+
+            // the time is written in seconds
+            void append_time_and_count(std::uint64_t time, std::uint64_t count)
+            {
+                append_value(static_cast<double>(time) * 1e-9);
+                line_ += ',';
+                append_number(count);
+                line_ += ',';
+            }
+
+            void append_number(std::uint64_t value)
+            {
+                char buffer[32];
+                int len = std::snprintf(buffer, sizeof(buffer), "%llu",
+                    static_cast<unsigned long long>(value));
+                line_.append(buffer, std::size_t(len));
+            }
+
+            void append_value(double value)
+            {
+                if (value != value)    // NaN
+                {
+                    line_ += "null";
+                    return;
+                }
+
+                char buffer[32];
+                int len = std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+                line_.append(buffer, std::size_t(len));
+            }
+
+            void append_string(std::string const& s)
+            {
+                line_ += '"';
+                for (char c : s)
+                {
+                    switch (c)
+                    {
+                    case '"':
+                        line_ += "\\\"";
+                        break;
+                    case '\\':
+                        line_ += "\\\\";
+                        break;
+                    case '\n':
+                        line_ += "\\n";
+                        break;
+                    case '\t':
+                        line_ += "\\t";
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20)
+                        {
+                            char buffer[8];
+                            std::snprintf(buffer, sizeof(buffer), "\\u%04x",
+                                static_cast<unsigned int>(c));
+                            line_ += buffer;
+                        }
+                        else
+                        {
+                            line_ += c;
+                        }
+                        break;
+                    }
+                }
+                line_ += '"';
+            }
+
+            std::vector<counter_info> infos_;
+            std::vector<counter_info> array_infos_;
+            std::string line_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Write the samples in a compact binary format (host byte order):
+        //
+        //   header:  "HPXC", version (u32), number of counters (u32),
+        //            number of array counters (u32), followed by the
+        //            description of each counter: type (u8), name and unit
+        //            of measure (u32 length followed by the characters)
+        //   sample:  sequence number (u64), followed by the columns for the
+        //            counters: status (u8[n]), time (u64[n]), count (u64[n]),
+        //            value (f64[n]), followed by each array counter: status
+        //            (u8), time (u64), count (u64), number of values (u32),
+        //            values (f64[])
+        //
+        // Invalid values are stored as NaN.
+        class binary_sink : public stream_counter_sink
+        {
+        public:
+            static constexpr std::uint32_t version = 1;
+
+            explicit binary_sink(std::string const& destination)
+              : stream_counter_sink(
+                    destination, std::ios_base::out | std::ios_base::binary)
+            {
+            }
+
+            void write_header(std::vector<counter_info> const& infos,
+                std::vector<counter_info> const& array_infos) override
+            {
+                buffer_.clear();
+                append_bytes("HPXC", 4);
+                append(version);
+                append(static_cast<std::uint32_t>(infos.size()));
+                append(static_cast<std::uint32_t>(array_infos.size()));
+                for (counter_info const& info : infos)
+                    append_info(info);
+                for (counter_info const& info : array_infos)
+                    append_info(info);
+
+                write_buffer();
+            }
+
+            void write_sample(counter_sample const& sample) override
+            {
+                buffer_.clear();
+                append(sample.sequence_);
+
+                // the values of the counters are stored column by column
+                for (counter_value const& value : sample.values_)
+                    append(static_cast<std::uint8_t>(value.status_));
+                for (counter_value const& value : sample.values_)
+                    append(value.time_);
+                for (counter_value const& value : sample.values_)
+                    append(value.count_);
+                for (counter_value const& value : sample.values_)
+                {
+                    append(get_scaled_value(value.status_, value.value_,
+                        value.scaling_, value.scale_inverse_));
+                }
+
+                for (counter_values_array const& value : sample.arrays_)
+                {
+                    append(static_cast<std::uint8_t>(value.status_));
+                    append(value.time_);
+                    append(value.count_);
+                    append(static_cast<std::uint32_t>(value.values_.size()));
+                    for (std::int64_t v : value.values_)
+                    {
+                        append(get_scaled_value(value.status_, v,
+                            value.scaling_, value.scale_inverse_));
+                    }
+                }
+
+                write_buffer();
+            }
+
+        private:
+            void append_bytes(void const* data, std::size_t size)
+            {
+                char const* p = static_cast<char const*>(data);
+                buffer_.insert(buffer_.end(), p, p + size);
+            }
+
+            template <typename T>
+            void append(T value)
+            {
+                append_bytes(&value, sizeof(T));
+            }
+
+            void append_string(std::string const& s)
+            {
+                append(static_cast<std::uint32_t>(s.size()));
+                append_bytes(s.data(), s.size());
+            }
+
+            void append_info(counter_info const& info)
+            {
+                append(static_cast<std::uint8_t>(info.type_));
+                append_string(info.fullname_);
+                append_string(info.unit_of_measure_);
+            }
+
+            void write_buffer()
+            {
+                out().write(buffer_.data(), std::streamsize(buffer_.size()));
+            }
+
+            std::vector<char> buffer_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        inline bool is_array_counter(counter_info const& info)
+        {
+            return info.type_ == counter_histogram ||
+                info.type_ == counter_raw_values;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool is_counter_sink_format(std::string const& format)
+    {
+        return format == "json" || format == "binary";
+    }
+
+    std::unique_ptr<counter_sink> create_counter_sink(
+        std::string const& format, std::string const& destination,
+        error_code& ec)
+    {
+        std::unique_ptr<detail::stream_counter_sink> sink;
+        if (format == "json")
+        {
+            sink.reset(new detail::json_lines_sink(destination));
+        }
+        else if (format == "binary")
+        {
+            sink.reset(new detail::binary_sink(destination));
+        }
+        else
+        {
+            HPX_THROWS_IF(ec, bad_parameter,
+                "performance_counters::create_counter_sink",
+                "unknown counter output format: {}", format);
+            return nullptr;
+        }
+
+        if (!sink->is_open())
+        {
+            HPX_THROWS_IF(ec, filesystem_error,
+                "performance_counters::create_counter_sink",
+                "could not open counter output destination: {}",
+                destination);
+            return nullptr;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return std::unique_ptr<counter_sink>(sink.release());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    counter_sink_writer::counter_sink_writer(
+        std::unique_ptr<counter_sink> sink, std::size_t max_pending_samples)
+      : sink_(std::move(sink))
+      , max_pending_samples_(max_pending_samples)
+      , header_pending_(false)
+      , busy_(false)
+      , stop_(false)
+      , sequence_(0)
+      , dropped_samples_(0)
+      , thread_(&counter_sink_writer::run, this)
+    {
+        HPX_ASSERT(sink_ && max_pending_samples_ != 0);
+        free_.reserve(max_pending_samples_);
+    }
+
+    counter_sink_writer::~counter_sink_writer()
+    {
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            stop_ = true;
+        }
+        cond_.notify_one();
+        thread_.join();
+    }
+
+    void counter_sink_writer::write_header(
+        std::vector<counter_info> const& infos)
+    {
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+
+            infos_.clear();
+            array_infos_.clear();
+            for (counter_info const& info : infos)
+            {
+                if (detail::is_array_counter(info))
+                    array_infos_.push_back(info);
+                else
+                    infos_.push_back(info);
+            }
+            header_pending_ = true;
+        }
+        cond_.notify_one();
+    }
+
+    counter_sample counter_sink_writer::get_sample()
+    {
+        std::lock_guard<std::mutex> l(mtx_);
+        if (free_.empty())
+            return counter_sample();
+
+        counter_sample sample = std::move(free_.back());
+        free_.pop_back();
+        return sample;
+    }
+
+    bool counter_sink_writer::post(counter_sample&& sample)
+    {
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+
+            sample.sequence_ = ++sequence_;
+            if (pending_.size() >= max_pending_samples_)
+            {
+                // the sink does not keep up, drop the sample
+                ++dropped_samples_;
+                if (free_.size() < max_pending_samples_)
+                    free_.push_back(std::move(sample));
+                return false;
+            }
+            pending_.push_back(std::move(sample));
+        }
+        cond_.notify_one();
+        return true;
+    }
+
+    void counter_sink_writer::flush()
+    {
+        // this is called from HPX threads, avoid blocking the worker thread
+        hpx::util::yield_while([this]() {
+            std::lock_guard<std::mutex> l(mtx_);
+            return header_pending_ || busy_ || !pending_.empty();
+        });
+    }
+
+    std::size_t counter_sink_writer::get_dropped_samples() const
+    {
+        return dropped_samples_.load(std::memory_order_relaxed);
+    }
+
+    void counter_sink_writer::run()
+    {
+        std::unique_lock<std::mutex> l(mtx_);
+        while (true)
+        {
+            cond_.wait(l, [this]() {
+                return stop_ || header_pending_ || !pending_.empty();
+            });
+
+            if (header_pending_)
+            {
+                std::vector<counter_info> infos = infos_;
+                std::vector<counter_info> array_infos = array_infos_;
+
+                busy_ = true;
+                header_pending_ = false;
+                l.unlock();
+                sink_->write_header(infos, array_infos);
+                l.lock();
+                busy_ = false;
+            }
+
+            while (!pending_.empty())
+            {
+                counter_sample sample = std::move(pending_.front());
+                pending_.pop_front();
+
+                busy_ = true;
+                l.unlock();
+                sink_->write_sample(sample);
+                l.lock();
+                busy_ = false;
+
+                if (free_.size() < max_pending_samples_)
+                    free_.push_back(std::move(sample));
+            }
+
+            // all queued data has been written
+            busy_ = true;
+            l.unlock();
+            sink_->flush();
+            l.lock();
+            busy_ = false;
+
+            if (stop_ && !header_pending_ && pending_.empty())
+                break;
+        }
+    }
+}}    // namespace hpx::performance_counters
@@ -7,6 +7,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/components/get_ptr.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/modules/errors.hpp>
@@ -14,11 +15,14 @@
 #include <hpx/performance_counters/counters.hpp>
 #include <hpx/performance_counters/performance_counter.hpp>
 #include <hpx/performance_counters/performance_counter_set.hpp>
+#include <hpx/performance_counters/server/base_performance_counter.hpp>
 #include <hpx/runtime_local/get_locality_id.hpp>
 #include <hpx/runtime_local/runtime_local_fwd.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
@@ -45,11 +49,14 @@ namespace hpx { namespace performance_counters {
     void performance_counter_set::release()
     {
         std::vector<hpx::id_type> ids;
+        std::vector<std::shared_ptr<server::base_performance_counter>>
+            local_counters;
 
         {
             std::lock_guard<mutex_type> l(mtx_);
             infos_.clear();
             std::swap(ids_, ids);
+            std::swap(local_counters_, local_counters);
         }
     }
 
@@ -343,6 +350,31 @@ namespace hpx { namespace performance_counters {
         }
     }
 
+    void performance_counter_set::get_counter_values(launch::sync_policy,
+        std::vector<counter_value>& values, bool reset, error_code& ec) const
+    {
+        try
+        {
+            evaluate_counters(
+                values, reset, false,
+                [](server::base_performance_counter& c, bool reset) {
+                    return c.get_counter_value_nonvirt(reset);
+                },
+                [](hpx::id_type const& id, bool reset) {
+                    return performance_counter(id).get_counter_value(reset);
+                });
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_RETHROWS_IF(
+                ec, e, "performance_counter_set::get_counter_values");
+            values.clear();
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     std::vector<hpx::future<counter_values_array>>
     performance_counter_set::get_counter_values_array(bool reset) const
@@ -390,6 +422,123 @@ namespace hpx { namespace performance_counters {
         }
     }
 
+    void performance_counter_set::get_counter_values_array(launch::sync_policy,
+        std::vector<counter_values_array>& values, bool reset,
+        error_code& ec) const
+    {
+        try
+        {
+            evaluate_counters(
+                values, reset, true,
+                [](server::base_performance_counter& c, bool reset) {
+                    return c.get_counter_values_array_nonvirt(reset);
+                },
+                [](hpx::id_type const& id, bool reset) {
+                    return performance_counter(id).get_counter_values_array(
+                        reset);
+                });
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_RETHROWS_IF(
+                ec, e, "performance_counter_set::get_counter_values_array");
+            values.clear();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Evaluate the counters returning single values (or arrays of values) into
+    // the given buffer. The values of local counters are retrieved directly,
+    // the remote counters are queried concurrently.
+    template <typename Value, typename Local, typename Remote>
+    void performance_counter_set::evaluate_counters(std::vector<Value>& values,
+        bool reset, bool arrays, Local&& local, Remote&& remote) const
+    {
+        std::vector<std::shared_ptr<server::base_performance_counter>>
+            counters = get_local_counters();
+
+        std::vector<hpx::id_type> ids;
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            ids = ids_;
+            ++invocation_count_;
+        }
+
+        // counters added concurrently are queried using actions
+        counters.resize(ids.size());
+
+        std::vector<hpx::future<Value>> remote_values;
+        std::vector<std::size_t> remote_indices;
+
+        values.clear();
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            bool const is_array = infos_[i].type_ == counter_histogram ||
+                infos_[i].type_ == counter_raw_values;
+            if (is_array != arrays)
+            {
+                continue;
+            }
+
+            bool const reset_counter = reset || reset_[i];
+            if (counters[i])
+            {
+                values.push_back(local(*counters[i], reset_counter));
+            }
+            else
+            {
+                remote_indices.push_back(values.size());
+                values.emplace_back();
+                remote_values.push_back(remote(ids[i], reset_counter));
+            }
+        }
+
+        for (std::size_t i = 0; i != remote_values.size(); ++i)
+        {
+            values[remote_indices[i]] = remote_values[i].get();
+        }
+    }
+
+    std::vector<std::shared_ptr<server::base_performance_counter>>
+    performance_counter_set::get_local_counters() const
+    {
+        std::vector<hpx::id_type> ids;
+
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            if (local_counters_.size() == ids_.size())
+                return local_counters_;
+            ids = ids_;
+        }
+
+        // counters which can't be accessed directly are queried using
+        // actions
+        std::uint32_t const locality_id = hpx::get_locality_id();
+        std::vector<std::shared_ptr<server::base_performance_counter>>
+            counters(ids.size());
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            if (naming::get_locality_id_from_id(ids[i]) != locality_id)
+                continue;
+
+            error_code ec(lightweight);
+            counters[i] = hpx::get_ptr<server::base_performance_counter>(
+                launch::sync, ids[i], ec);
+            if (ec)
+                counters[i].reset();
+        }
+
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            if (ids_.size() == counters.size())
+                local_counters_ = counters;
+        }
+        return counters;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     std::size_t performance_counter_set::get_invocation_count() const
     {
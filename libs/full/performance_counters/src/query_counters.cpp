@@ -13,11 +13,13 @@
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/format.hpp>
 #include <hpx/performance_counters/apex_sample_value.hpp>
+#include <hpx/performance_counters/counter_sink.hpp>
 #include <hpx/performance_counters/counters.hpp>
 #include <hpx/performance_counters/performance_counter.hpp>
 #include <hpx/performance_counters/query_counters.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/get_thread_name.hpp>
+#include <hpx/runtime_local/run_as_os_thread.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/external_timer.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
@@ -28,6 +30,7 @@
 #include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -108,6 +111,15 @@ namespace hpx { namespace util {
 
         find_counters();
 
+        if (performance_counters::is_counter_sink_format(format_) &&
+            destination_ != "none")
+        {
+            writer_.reset(new performance_counters::counter_sink_writer(
+                performance_counters::create_counter_sink(
+                    format_, destination_)));
+            writer_->write_header(counters_.get_counter_infos());
+        }
+
         counters_.start(launch::sync);
 
         // this will invoke the evaluate function for the first time
@@ -118,6 +130,9 @@ namespace hpx { namespace util {
     {
         timer_.stop(terminate);
         counters_.stop(launch::sync);
+
+        if (writer_)
+            writer_->flush();
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -609,6 +624,33 @@ namespace hpx { namespace util {
         return true;
     }
 
+    bool query_counters::sample_counters(bool reset, error_code& ec)
+    {
+        // The counters are evaluated on one of the threads of the I/O pool,
+        // this keeps the evaluation of the local counters off the worker
+        // threads, the calling HPX thread is suspended meanwhile.
+        hpx::future<performance_counters::counter_sample> f =
+            hpx::threads::run_as_os_thread([this, reset]() {
+                performance_counters::counter_sample sample =
+                    writer_->get_sample();
+
+                counters_.get_counter_values(
+                    launch::sync, sample.values_, reset);
+                counters_.get_counter_values_array(
+                    launch::sync, sample.arrays_, reset);
+
+                return sample;
+            });
+
+        performance_counters::counter_sample sample = f.get(ec);
+        if (ec)
+            return false;
+
+        // formatting and writing the sample happens on the writer thread
+        writer_->post(std::move(sample));
+        return true;
+    }
+
     bool query_counters::evaluate_counters(
         bool reset, char const* description, bool force, error_code& ec)
     {
@@ -641,6 +683,9 @@ namespace hpx { namespace util {
             return false;
         }
 
+        if (writer_)
+            return sample_counters(reset, ec);
+
         bool result = false;
         std::vector<performance_counters::counter_info> infos =
             counters_.get_counter_infos();
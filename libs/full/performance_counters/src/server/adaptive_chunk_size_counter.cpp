@@ -0,0 +1,115 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/adaptive_chunk_size.hpp>
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace performance_counters { namespace detail {
+
+    using hpx::execution::detail::adaptive_chunk_size_model;
+
+    ///////////////////////////////////////////////////////////////////////////
+    static std::int64_t get_adaptive_chunk_size(
+        adaptive_chunk_size_model const* model)
+    {
+        return static_cast<std::int64_t>(model->get_last_chunk_size());
+    }
+
+    static std::int64_t get_adaptive_chunk_size_cost(
+        adaptive_chunk_size_model const* model)
+    {
+        return static_cast<std::int64_t>(model->get_cost());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Creation function for the counters exposing the models of the
+    /// adaptive_chunk_size executor parameters
+    naming::gid_type adaptive_chunk_size_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        switch (info.type_)
+        {
+        case counter_raw:
+        {
+            counter_path_elements paths;
+            get_counter_path_elements(info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "adaptive_chunk_size_counter_creator",
+                    "invalid adaptive chunk size counter name (instance name "
+                    "must not be a valid base counter name)");
+                return naming::invalid_gid;
+            }
+
+            adaptive_chunk_size_model const* model = nullptr;
+            if (!paths.parameters_.empty())
+            {
+                model = hpx::execution::detail::find_adaptive_chunk_size_model(
+                    paths.parameters_);
+            }
+
+            if (model == nullptr)
+            {
+                std::stringstream strm;
+                strm << "invalid adaptive chunk size counter parameter: must "
+                        "specify a known call site\n"
+                        "known call sites:\n";
+
+                for (std::string const& name : hpx::execution::detail::
+                         get_adaptive_chunk_size_model_names())
+                {
+                    strm << "  " << name << "\n";
+                }
+
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "adaptive_chunk_size_counter_creator", strm.str());
+                return naming::invalid_gid;
+            }
+
+            hpx::util::function_nonser<std::int64_t()> f;
+            if (paths.countername_ == "adaptive_chunk_size/chunk_size")
+            {
+                f = util::bind_front(&get_adaptive_chunk_size, model);
+            }
+            else if (paths.countername_ == "adaptive_chunk_size/cost")
+            {
+                f = util::bind_front(&get_adaptive_chunk_size_cost, model);
+            }
+            else
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "adaptive_chunk_size_counter_creator",
+                    "invalid adaptive chunk size counter name: {}",
+                    paths.countername_);
+                return naming::invalid_gid;
+            }
+
+            return create_raw_counter(info, std::move(f), ec);
+        }
+        break;
+
+        default:
+            HPX_THROWS_IF(ec, bad_parameter,
+                "adaptive_chunk_size_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+    }
+}}}    // namespace hpx::performance_counters::detail
@@ -10,6 +10,10 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_stack_pool.hpp>
+#endif
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
@@ -413,6 +417,24 @@ namespace hpx { namespace performance_counters { namespace detail {
                 util::bind_front(&threads::coroutine_type::impl_type::
                                      get_stack_unbind_count),
                 util::function_nonser<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-hits
+            {"count/stack-pool-hits",
+                util::bind_front(
+                    &threads::coroutines::detail::posix::
+                        get_stack_pool_hit_count),
+                util::function_nonser<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-misses
+            {"count/stack-pool-misses",
+                util::bind_front(
+                    &threads::coroutines::detail::posix::
+                        get_stack_pool_miss_count),
+                util::function_nonser<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-trims
+            {"count/stack-pool-trims",
+                util::bind_front(
+                    &threads::coroutines::detail::posix::
+                        get_stack_pool_trim_count),
+                util::function_nonser<std::uint64_t(bool)>(), "", 0},
 #endif
         };
         std::size_t const data_size = sizeof(data) / sizeof(data[0]);
@@ -692,6 +714,27 @@ namespace hpx { namespace performance_counters {
                 "operations performed for the referenced locality",
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-hits",
+                counter_monotonically_increasing,
+                "returns the total number of HPX-thread stacks which were "
+                "taken from the per-worker stack pools for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-misses",
+                counter_monotonically_increasing,
+                "returns the total number of HPX-thread stacks which had to "
+                "be newly allocated because the per-worker stack pools were "
+                "empty for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-trims",
+                counter_monotonically_increasing,
+                "returns the total number of idle HPX-thread stacks which were "
+                "trimmed (madvise) by the per-worker stack pools for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
 #endif
             {"/threads/count/objects", counter_monotonically_increasing,
                 "returns the overall number of created HPX-thread objects for "
@@ -782,6 +825,73 @@ namespace hpx { namespace performance_counters {
                 util::bind_front(
                     &detail::locality_pool_thread_no_total_counter_creator, &tm,
                     &threads::thread_pool_base::get_busy_loop_count),
+                &locality_pool_thread_no_total_counter_discoverer, ""},
+            // number of times idle worker threads were parked
+            {"/threads/count/idle-parks", counter_monotonically_increasing,
+                "returns the number of times the referenced worker thread "
+                "was parked because it was idle",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::locality_pool_thread_no_total_counter_creator, &tm,
+                    &threads::thread_pool_base::get_idle_park_count),
+                &locality_pool_thread_no_total_counter_discoverer, ""},
+            // number of times parked worker threads were woken up for new work
+            {"/threads/count/idle-unparks", counter_monotonically_increasing,
+                "returns the number of times the referenced parked worker "
+                "thread was woken up because of new work",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::locality_pool_thread_no_total_counter_creator, &tm,
+                    &threads::thread_pool_base::get_idle_unpark_count),
+                &locality_pool_thread_no_total_counter_discoverer, ""},
+            // average wake-up latency of parked worker threads
+            {"/threads/idle-wake-latency/average", counter_average_timer,
+                "returns the average time between a parked worker thread "
+                "being notified about new work and it resuming execution",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::locality_pool_thread_no_total_counter_creator, &tm,
+                    &threads::thread_pool_base::get_idle_wake_latency),
+                &locality_pool_thread_no_total_counter_discoverer, "ns"},
+            // number of tasks stolen from the same core
+            {"/threads/count/steals-same-core",
+                counter_monotonically_increasing,
+                "returns the number of times the referenced worker thread "
+                "stole work from a worker thread running on the same core",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::locality_pool_thread_no_total_counter_creator, &tm,
+                    &threads::thread_pool_base::get_num_steals_same_core),
+                &locality_pool_thread_no_total_counter_discoverer, ""},
+            // number of tasks stolen from the same last level cache
+            {"/threads/count/steals-same-cache",
+                counter_monotonically_increasing,
+                "returns the number of times the referenced worker thread "
+                "stole work from a worker thread sharing its last level cache",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::locality_pool_thread_no_total_counter_creator, &tm,
+                    &threads::thread_pool_base::get_num_steals_same_cache),
+                &locality_pool_thread_no_total_counter_discoverer, ""},
+            // number of tasks stolen from the same NUMA domain
+            {"/threads/count/steals-same-numa-domain",
+                counter_monotonically_increasing,
+                "returns the number of times the referenced worker thread "
+                "stole work from a worker thread in the same NUMA domain",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::locality_pool_thread_no_total_counter_creator, &tm,
+                    &threads::thread_pool_base::get_num_steals_same_numa),
+                &locality_pool_thread_no_total_counter_discoverer, ""},
+            // number of tasks stolen from other NUMA domains
+            {"/threads/count/steals-remote",
+                counter_monotonically_increasing,
+                "returns the number of times the referenced worker thread "
+                "stole work from a worker thread in a different NUMA domain",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::locality_pool_thread_no_total_counter_creator, &tm,
+                    &threads::thread_pool_base::get_num_steals_remote),
                 &locality_pool_thread_no_total_counter_discoverer, ""}
         };
 
@@ -66,6 +66,13 @@ char const* const locality_pool_thread_no_total_counter_names[] =
 {
     "/threads/idle-loop-count/instantaneous",
     "/threads/busy-loop-count/instantaneous",
+    "/threads/count/idle-parks",
+    "/threads/count/idle-unparks",
+    "/threads/idle-wake-latency/average",
+    "/threads/count/steals-same-core",
+    "/threads/count/steals-same-cache",
+    "/threads/count/steals-same-numa-domain",
+    "/threads/count/steals-remote",
     nullptr
 };
 // clang-format on
@@ -81,6 +88,9 @@ char const* const locality_counter_names[] = {
     "/threads/count/stack-recycles",
 #if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
     "/threads/count/stack-unbinds",
+    "/threads/count/stack-pool-hits",
+    "/threads/count/stack-pool-misses",
+    "/threads/count/stack-pool-trims",
 #endif
 #endif
     "/scheduler/utilization/instantaneous", nullptr};
@@ -0,0 +1,158 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/performance_counters/counter_sink.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// A counter sink recording everything it is handed
+struct recorded_data
+{
+    std::vector<hpx::performance_counters::counter_info> infos_;
+    std::vector<hpx::performance_counters::counter_info> array_infos_;
+    std::vector<hpx::performance_counters::counter_sample> samples_;
+    std::vector<std::thread::id> writer_threads_;
+};
+
+class recording_sink : public hpx::performance_counters::counter_sink
+{
+public:
+    explicit recording_sink(recorded_data& data)
+      : data_(data)
+    {
+    }
+
+    void write_header(
+        std::vector<hpx::performance_counters::counter_info> const& infos,
+        std::vector<hpx::performance_counters::counter_info> const&
+            array_infos) override
+    {
+        data_.infos_ = infos;
+        data_.array_infos_ = array_infos;
+    }
+
+    void write_sample(
+        hpx::performance_counters::counter_sample const& sample) override
+    {
+        data_.samples_.push_back(sample);
+        data_.writer_threads_.push_back(std::this_thread::get_id());
+    }
+
+    void flush() override {}
+
+private:
+    recorded_data& data_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map&)
+{
+    using namespace hpx::performance_counters;
+
+    std::vector<std::string> const names = {
+        "/runtime{locality#0/total}/uptime",
+        "/threads{locality#0/total}/count/cumulative",
+    };
+
+    performance_counter_set counters(names);
+    counters.start(hpx::launch::sync);
+
+    recorded_data data;
+    {
+        counter_sink_writer writer(
+            std::unique_ptr<counter_sink>(new recording_sink(data)));
+        writer.write_header(counters.get_counter_infos());
+
+        for (int i = 0; i != 10; ++i)
+        {
+            counter_sample sample = writer.get_sample();
+            counters.get_counter_values(hpx::launch::sync, sample.values_);
+            counters.get_counter_values_array(
+                hpx::launch::sync, sample.arrays_);
+            HPX_TEST(writer.post(std::move(sample)));
+            writer.flush();
+        }
+    }
+
+    counters.stop(hpx::launch::sync);
+
+    HPX_TEST_EQ(data.infos_.size(), names.size());
+    HPX_TEST(data.array_infos_.empty());
+
+    HPX_TEST_EQ(data.samples_.size(), std::size_t(10));
+    for (std::size_t i = 0; i != data.samples_.size(); ++i)
+    {
+        counter_sample const& sample = data.samples_[i];
+        HPX_TEST_EQ(sample.sequence_, std::uint64_t(i + 1));
+        HPX_TEST_EQ(sample.values_.size(), names.size());
+        HPX_TEST(sample.arrays_.empty());
+
+        for (counter_value const& value : sample.values_)
+        {
+            HPX_TEST(status_is_valid(value.status_));
+        }
+
+        // the samples are written on the dedicated writer thread
+        HPX_TEST(data.writer_threads_[i] != std::this_thread::get_id());
+    }
+
+    // the json and binary sinks are available
+    HPX_TEST(is_counter_sink_format("json"));
+    HPX_TEST(is_counter_sink_format("binary"));
+    HPX_TEST(!is_counter_sink_format("csv"));
+
+    // the json sink describes the counters once, the samples refer to the
+    // counters by position
+    std::string const filename = "counter_sink_test.json";
+    std::remove(filename.c_str());
+    {
+        std::unique_ptr<counter_sink> sink =
+            create_counter_sink("json", filename);
+        sink->write_header(data.infos_, data.array_infos_);
+        sink->write_sample(data.samples_.back());
+        sink->write_sample(data.samples_.back());
+        sink->flush();
+    }
+    {
+        std::ifstream in(filename.c_str());
+        std::string line;
+
+        HPX_TEST(std::getline(in, line).good());
+        HPX_TEST(line.find("\"fields\"") != std::string::npos);
+        HPX_TEST(line.find(names[0]) != std::string::npos);
+
+        for (int i = 0; i != 2; ++i)
+        {
+            HPX_TEST(std::getline(in, line).good());
+            HPX_TEST_EQ(line.find("{\"sequence\":"), std::size_t(0));
+            HPX_TEST(line.find("uptime") == std::string::npos);
+        }
+    }
+    std::remove(filename.c_str());
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,118 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that worker threads get parked when idle and are reliably woken up
+// again when new work is scheduled.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread_pool_util/thread_pool_suspension_helpers.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+int hpx_main()
+{
+    std::size_t const num_threads = hpx::resource::get_num_threads("default");
+
+    HPX_TEST_EQ(std::size_t(4), num_threads);
+
+    hpx::threads::thread_pool_base& tp =
+        hpx::resource::get_thread_pool("default");
+
+    // give the other worker threads some time to become idle and park, this
+    // thread keeps one of the workers busy
+    auto const start = std::chrono::steady_clock::now();
+    while (tp.get_idle_park_count(std::size_t(-1), false) == 0 &&
+        std::chrono::steady_clock::now() - start < std::chrono::seconds(10))
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    HPX_TEST_LT(
+        std::int64_t(0), tp.get_idle_park_count(std::size_t(-1), false));
+
+    // all work has to be executed even if scheduled onto parked workers
+    for (int round = 0; round != 10; ++round)
+    {
+        std::atomic<std::size_t> count(0);
+        std::vector<hpx::future<void>> futures;
+        futures.reserve(1000);
+        for (std::size_t i = 0; i != 1000; ++i)
+        {
+            futures.push_back(hpx::async([&count]() { ++count; }));
+        }
+        hpx::wait_all(futures);
+        HPX_TEST_EQ(count.load(), std::size_t(1000));
+
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    HPX_TEST_LTE(tp.get_idle_unpark_count(std::size_t(-1), false),
+        tp.get_idle_park_count(std::size_t(-1), false));
+
+    // suspending and resuming parked processing units has to work
+    for (std::size_t thread_num = 0; thread_num < num_threads - 1; ++thread_num)
+    {
+        hpx::threads::suspend_processing_unit(tp, thread_num).get();
+    }
+    for (std::size_t thread_num = 0; thread_num < num_threads - 1; ++thread_num)
+    {
+        hpx::threads::resume_processing_unit(tp, thread_num).get();
+    }
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(
+    int argc, char* argv[], hpx::resource::scheduling_policy scheduler)
+{
+    hpx::local::init_params init_args;
+
+    init_args.cfg = {"hpx.os_threads=4", "hpx.max_idle_loop_count=1000",
+        "hpx.max_idle_backoff_time=100"};
+    init_args.rp_callback = [scheduler](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default", scheduler,
+            hpx::threads::policies::scheduler_mode(
+                hpx::threads::policies::default_mode |
+                hpx::threads::policies::enable_elasticity |
+                hpx::threads::policies::enable_idle_parking));
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<hpx::resource::scheduling_policy> schedulers = {
+        hpx::resource::scheduling_policy::local,
+        hpx::resource::scheduling_policy::local_priority_fifo,
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+        hpx::resource::scheduling_policy::local_priority_lifo,
+#endif
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+        hpx::resource::scheduling_policy::abp_priority_fifo,
+        hpx::resource::scheduling_policy::abp_priority_lifo,
+#endif
+    };
+
+    for (auto const scheduler : schedulers)
+    {
+        test_scheduler(argc, argv, scheduler);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,114 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that work scheduled onto a single worker thread is stolen by the
+// other worker threads if topology aware work stealing is enabled, and that
+// the steals are accounted for per level of the hardware topology.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+std::int64_t get_num_steals(
+    hpx::threads::thread_pool_base& tp, std::size_t num_thread, bool reset)
+{
+    return tp.get_num_steals_same_core(num_thread, reset) +
+        tp.get_num_steals_same_cache(num_thread, reset) +
+        tp.get_num_steals_same_numa(num_thread, reset) +
+        tp.get_num_steals_remote(num_thread, reset);
+}
+
+int hpx_main()
+{
+    std::size_t const num_threads = hpx::resource::get_num_threads("default");
+
+    HPX_TEST_EQ(std::size_t(4), num_threads);
+
+    hpx::threads::thread_pool_base& tp =
+        hpx::resource::get_thread_pool("default");
+
+    // reset the counters
+    get_num_steals(tp, std::size_t(-1), true);
+
+    // schedule all work onto the first worker thread, the other worker
+    // threads are idle and have to steal
+    std::atomic<std::size_t> count(0);
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(1000);
+
+    auto exec = hpx::execution::parallel_executor(
+        hpx::threads::thread_priority::normal,
+        hpx::threads::thread_stacksize::default_,
+        hpx::threads::thread_schedule_hint(std::int16_t(0)));
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        futures.push_back(hpx::async(exec, [&count]() {
+            hpx::this_thread::sleep_for(std::chrono::microseconds(100));
+            ++count;
+        }));
+    }
+    hpx::wait_all(futures);
+    HPX_TEST_EQ(count.load(), std::size_t(1000));
+
+    // the total is the sum of the steals of all worker threads
+    std::int64_t per_thread = 0;
+    for (std::size_t thread_num = 0; thread_num != num_threads; ++thread_num)
+    {
+        per_thread += get_num_steals(tp, thread_num, false);
+    }
+    std::int64_t const total = get_num_steals(tp, std::size_t(-1), true);
+    HPX_TEST_LT(std::int64_t(0), total);
+    HPX_TEST_LTE(per_thread, total);
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(
+    int argc, char* argv[], hpx::resource::scheduling_policy scheduler)
+{
+    hpx::local::init_params init_args;
+
+    init_args.cfg = {"hpx.os_threads=4"};
+    init_args.rp_callback = [scheduler](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default", scheduler,
+            hpx::threads::policies::scheduler_mode(
+                hpx::threads::policies::default_mode |
+                hpx::threads::policies::enable_stealing_numa |
+                hpx::threads::policies::enable_stealing_topology));
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<hpx::resource::scheduling_policy> schedulers = {
+        hpx::resource::scheduling_policy::local_priority_fifo,
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+        hpx::resource::scheduling_policy::local_priority_lifo,
+#endif
+    };
+
+    for (auto const scheduler : schedulers)
+    {
+        test_scheduler(argc, argv, scheduler);
+    }
+
+    return hpx::util::report_errors();
+}
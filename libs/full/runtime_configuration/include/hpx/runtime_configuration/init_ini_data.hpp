@@ -12,6 +12,7 @@
 #include <hpx/modules/plugin.hpp>
 #include <hpx/runtime_configuration/component_registry_base.hpp>
 #include <hpx/runtime_configuration/plugin_registry_base.hpp>
+#include <hpx/runtime_configuration/startup_cache.hpp>
 
 #include <map>
 #include <memory>
@@ -45,11 +46,13 @@ namespace hpx { namespace util {
 
     ///////////////////////////////////////////////////////////////////////////
     // iterate over all shared libraries in the given directory and construct
-    // default ini settings assuming all of those are components
+    // default ini settings assuming all of those are components, the startup
+    // cache (if any) is used to avoid loading modules which are not needed
     std::vector<std::shared_ptr<plugins::plugin_registry_base>>
     init_ini_data_default(std::string const& libs, section& ini,
         std::map<std::string, filesystem::path>& basenames,
         std::map<std::string, hpx::util::plugin::dll>& modules,
         std::vector<std::shared_ptr<components::component_registry_base>>&
-            component_registries);
+            component_registries,
+        startup_cache* cache = nullptr);
 }}    // namespace hpx::util
@@ -17,6 +17,7 @@
 #include <hpx/runtime_configuration/plugin_registry_base.hpp>
 #include <hpx/runtime_configuration/runtime_configuration_fwd.hpp>
 #include <hpx/runtime_configuration/runtime_mode.hpp>
+#include <hpx/runtime_configuration/startup_cache.hpp>
 #include <hpx/runtime_configuration/static_factory_data.hpp>
 
 #include <cstddef>
@@ -110,6 +111,11 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+        // Recycle thread stacks through per-worker stack pools
+        bool use_stack_pool() const;
+        std::size_t get_stack_pool_size() const;
+        std::size_t get_stack_pool_trim_delay() const;
 #endif
 
         // return trace_depth for stack-backtraces
@@ -170,7 +176,8 @@ namespace hpx { namespace util {
             std::string const& component_base_paths,
             std::string const& component_path_suffixes,
             std::set<std::string>& component_paths,
-            std::map<std::string, filesystem::path>& basenames);
+            std::map<std::string, filesystem::path>& basenames,
+            util::startup_cache& cache);
 
         void load_component_path(
             std::vector<std::shared_ptr<plugins::plugin_registry_base>>&
@@ -178,7 +185,8 @@ namespace hpx { namespace util {
             std::vector<std::shared_ptr<components::component_registry_base>>&
                 component_registries,
             std::string const& path, std::set<std::string>& component_paths,
-            std::map<std::string, filesystem::path>& basenames);
+            std::map<std::string, filesystem::path>& basenames,
+            util::startup_cache& cache);
 
     public:
         runtime_mode mode_;
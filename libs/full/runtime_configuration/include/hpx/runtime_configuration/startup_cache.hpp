@@ -0,0 +1,83 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // What was found out about a shared library while searching one of the
+    // component directories.
+    struct startup_cache_module
+    {
+        enum module_flags
+        {
+            has_components = 0x01,
+            has_plugins = 0x02,
+            not_probed = 0x04    // the module was not loaded yet
+        };
+
+        std::string path_;    // canonical path of the library
+        std::string name_;    // module name
+        std::int64_t mtime_;
+        std::uint64_t size_;
+        unsigned flags_;
+
+        // the configuration data provided by the component registries
+        std::vector<std::string> ini_data_;
+    };
+
+    struct startup_cache_directory
+    {
+        std::int64_t mtime_;
+        std::vector<startup_cache_module> modules_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The startup cache (hpx.startup_cache) keeps the result of searching
+    // the component directories for modules across application runs. An
+    // entry is valid as long as neither the directory nor any of the
+    // modules was modified and the HPX core library was not rebuilt.
+    class HPX_EXPORT startup_cache
+    {
+    public:
+        // an empty file name disables the cache
+        explicit startup_cache(std::string filename);
+
+        bool enabled() const
+        {
+            return !filename_.empty();
+        }
+
+        // return the cached data for the given (canonical) directory, if
+        // that is still valid
+        startup_cache_directory const* find(std::string const& dir) const;
+
+        void update(std::string const& dir, startup_cache_directory data);
+
+        // write the cache file if any entry was updated
+        void save();
+
+        // the modification time of the given file or directory, or -1
+        static std::int64_t get_mtime(std::string const& path);
+
+    private:
+        void load();
+
+        std::string filename_;
+        std::string version_;
+        bool modified_;
+        std::map<std::string, startup_cache_directory> directories_;
+    };
+}}    // namespace hpx::util
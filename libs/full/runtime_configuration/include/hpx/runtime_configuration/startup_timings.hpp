@@ -0,0 +1,57 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return the time (in seconds) spent in the phases of the most recent
+    // startup of the runtime, in the order the phases were completed. Phases
+    // may be nested (module discovery is part of command line handling) or
+    // may overlap (the topology is discovered concurrently with other
+    // phases).
+    HPX_EXPORT std::vector<std::pair<std::string, double>>
+    get_startup_phase_timings();
+
+    namespace detail {
+
+        HPX_EXPORT void reset_startup_phase_timings();
+        HPX_EXPORT void add_startup_phase_timing(
+            std::string name, double elapsed);
+
+        // Record the time spent in the enclosing scope as a startup phase
+        class startup_phase_timer
+        {
+        public:
+            explicit startup_phase_timer(char const* name)
+              : name_(name)
+            {
+            }
+
+            startup_phase_timer(startup_phase_timer const&) = delete;
+            startup_phase_timer& operator=(
+                startup_phase_timer const&) = delete;
+
+            ~startup_phase_timer()
+            {
+                add_startup_phase_timing(name_, timer_.elapsed());
+            }
+
+        private:
+            char const* name_;
+            hpx::chrono::high_resolution_timer timer_;
+        };
+    }    // namespace detail
+}}    // namespace hpx::util
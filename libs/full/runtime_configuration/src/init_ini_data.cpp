@@ -16,6 +16,8 @@
 #include <hpx/runtime_configuration/component_registry_base.hpp>
 #include <hpx/runtime_configuration/init_ini_data.hpp>
 #include <hpx/runtime_configuration/plugin_registry_base.hpp>
+#include <hpx/runtime_configuration/startup_cache.hpp>
+#include <hpx/string_util/case_conv.hpp>
 #include <hpx/version.hpp>
 
 #include <boost/tokenizer.hpp>
@@ -291,7 +293,7 @@ namespace hpx { namespace util {
         std::string const& curr,
         std::vector<std::shared_ptr<components::component_registry_base>>&
             component_registries,
-        std::string name, error_code& ec)
+        std::string name, std::vector<std::string>& ini_data, error_code& ec)
     {
         hpx::util::plugin::plugin_factory<components::component_registry_base>
             pf(d, "registry");
@@ -302,7 +304,6 @@ namespace hpx { namespace util {
         if (ec)
             return;
 
-        std::vector<std::string> ini_data;
         if (names.empty())
         {
             // This HPX module does not export any factories, but
@@ -396,6 +397,50 @@ namespace hpx { namespace util {
         {
             return lhs.first == rhs.first;
         }
+
+        // the instance names of the components described by the given
+        // registry data
+        inline std::vector<std::string> get_component_instances(
+            std::vector<std::string> const& ini_data)
+        {
+            std::string const prefix("[hpx.components.");
+
+            std::vector<std::string> instances;
+            for (std::string const& line : ini_data)
+            {
+                if (line.size() > prefix.size() + 1 &&
+                    line.compare(0, prefix.size(), prefix) == 0 &&
+                    line.back() == ']')
+                {
+                    instances.push_back(line.substr(
+                        prefix.size(), line.size() - prefix.size() - 1));
+                }
+            }
+            return instances;
+        }
+
+        // Components explicitly disabled by the configuration will never be
+        // used, there is no need to load their module.
+        inline bool is_explicitly_disabled(util::section const& ini,
+            std::vector<std::string> const& instances)
+        {
+            if (instances.empty())
+                return false;
+
+            for (std::string const& instance : instances)
+            {
+                std::string const key =
+                    "hpx.components." + instance + ".enabled";
+                if (!ini.has_entry(key))
+                    return false;
+
+                std::string value = ini.get_entry(key);
+                hpx::string_util::to_lower(value);
+                if (value != "no" && value != "false" && value != "0")
+                    return false;
+            }
+            return true;
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -404,7 +449,8 @@ namespace hpx { namespace util {
         std::map<std::string, filesystem::path>& basenames,
         std::map<std::string, hpx::util::plugin::dll>& modules,
         std::vector<std::shared_ptr<components::component_registry_base>>&
-            component_registries)
+            component_registries,
+        startup_cache* cache)
     {
         namespace fs = filesystem;
 
@@ -413,6 +459,23 @@ namespace hpx { namespace util {
 
         plugin_list_type plugin_registries;
 
+        // what is known about the modules in this directory, either from the
+        // startup cache or collected while loading the modules below
+        bool const use_cache = cache != nullptr && cache->enabled();
+        startup_cache_directory const* cached =
+            use_cache ? cache->find(libs) : nullptr;
+        bool update_cache = use_cache && cached == nullptr;
+
+        startup_cache_directory found;
+        if (cached != nullptr)
+        {
+            found = *cached;
+        }
+        else
+        {
+            found.mtime_ = startup_cache::get_mtime(libs);
+        }
+
         // list of modules to load
         std::vector<std::pair<fs::path, std::string>> libdata;
         try
@@ -437,42 +500,58 @@ namespace hpx { namespace util {
             // generate component sections for all found shared libraries
             // this will create too many sections, but the non-components will
             // be filtered out during loading
-            for (fs::directory_iterator dir(libs_path); dir != nodir; ++dir)
+            if (cached == nullptr)
             {
-                fs::path curr(*dir);
-                if (curr.extension() != HPX_SHARED_LIB_EXTENSION)
-                    continue;
+                for (fs::directory_iterator dir(libs_path); dir != nodir;
+                     ++dir)
+                {
+                    fs::path curr(*dir);
+                    if (curr.extension() != HPX_SHARED_LIB_EXTENSION)
+                        continue;
 
-                // instance name and module name are the same
-                std::string name(fs::basename(curr));
+                    // instance name and module name are the same
+                    std::string name(fs::basename(curr));
 
 #if !defined(HPX_WINDOWS)
-                if (0 == name.find("lib"))
-                    name = name.substr(3);
+                    if (0 == name.find("lib"))
+                        name = name.substr(3);
 #endif
 #if defined(__APPLE__)    // shared library version is added berfore extension
-                const std::string version = hpx::full_version_as_string();
-                std::string::size_type i = name.find(version);
-                if (i != std::string::npos)
-                    name.erase(
-                        i - 1, version.length() + 1);    // - 1 for one more dot
+                    const std::string version = hpx::full_version_as_string();
+                    std::string::size_type i = name.find(version);
+                    if (i != std::string::npos)
+                        name.erase(i - 1,
+                            version.length() + 1);    // - 1 for one more dot
 #endif
-                // ensure base directory, remove symlinks, etc.
-                std::error_code fsec;
-                fs::path canonical_curr =
-                    fs::canonical(curr, fs::initial_path(), fsec);
-                if (fsec)
-                    canonical_curr = curr;
-
-                // make sure every module name is loaded exactly once, the
-                // first occurrence of a module name is used
+                    // ensure base directory, remove symlinks, etc.
+                    std::error_code fsec;
+                    fs::path canonical_curr =
+                        fs::canonical(curr, fs::initial_path(), fsec);
+                    if (fsec)
+                        canonical_curr = curr;
+
+                    startup_cache_module m;
+                    m.path_ = canonical_curr.string();
+                    m.name_ = name;
+                    m.mtime_ = startup_cache::get_mtime(m.path_);
+                    m.size_ = fs::file_size(canonical_curr, fsec);
+                    m.flags_ = startup_cache_module::not_probed;
+                    found.modules_.push_back(std::move(m));
+                }
+            }
+
+            // make sure every module name is loaded exactly once, the first
+            // occurrence of a module name is used
+            for (startup_cache_module const& m : found.modules_)
+            {
+                fs::path canonical_curr(m.path_);
                 std::string basename = canonical_curr.filename().string();
                 std::pair<std::map<std::string, fs::path>::iterator, bool> p =
                     basenames.insert(std::make_pair(basename, canonical_curr));
 
                 if (p.second)
                 {
-                    libdata.push_back(std::make_pair(canonical_curr, name));
+                    libdata.push_back(std::make_pair(canonical_curr, m.name_));
                 }
                 else
                 {
@@ -486,11 +565,16 @@ namespace hpx { namespace util {
         catch (fs::filesystem_error const& e)
         {
             LRT_(info).format("caught filesystem error: {}", e.what());
+            update_cache = false;    // the list of modules is incomplete
         }
 
-        // return if no new modules have been found
-        if (libdata.empty())
-            return plugin_registries;
+        // the module data collected while loading the modules, indexed by
+        // the module path
+        std::map<std::string, startup_cache_module*> module_data;
+        for (startup_cache_module& m : found.modules_)
+        {
+            module_data[m.path_] = &m;
+        }
 
         // make sure each node loads libraries in a different order
         std::random_device random_device;
@@ -500,6 +584,45 @@ namespace hpx { namespace util {
         typedef std::pair<fs::path, std::string> libdata_type;
         for (libdata_type const& p : libdata)
         {
+            startup_cache_module* m = module_data[p.first.string()];
+            HPX_ASSERT(m != nullptr);
+
+            if (cached != nullptr &&
+                !(m->flags_ & startup_cache_module::not_probed))
+            {
+                if (m->flags_ == 0)
+                {
+                    LRT_(debug).format(
+                        "skipping (cached, not a module): {}", p.first.string());
+                    continue;
+                }
+
+                if (m->flags_ == startup_cache_module::has_components)
+                {
+                    std::vector<std::string> instances =
+                        detail::get_component_instances(m->ini_data_);
+                    if (detail::is_explicitly_disabled(ini, instances))
+                    {
+                        // make the components known without loading them
+                        std::vector<std::string> ini_data = m->ini_data_;
+                        for (std::string const& instance : instances)
+                        {
+                            ini_data.push_back(
+                                "[hpx.components." + instance + "]");
+                            ini_data.push_back("enabled = 0");
+                            ini_data.push_back("lazy = 1");
+                        }
+                        ini.parse("<component registry>", ini_data, false,
+                            false);
+
+                        LRT_(info).format(
+                            "skipping (cached, components disabled): {}",
+                            p.first.string());
+                        continue;
+                    }
+                }
+            }
+
             LRT_(info).format("attempting to load: {}", p.first.string());
 
             // get the handle of the library
@@ -510,15 +633,24 @@ namespace hpx { namespace util {
             {
                 LRT_(info).format("skipping (load_library failed): {}: {}",
                     p.first.string(), get_error_what(ec));
+
+                // the failure may be transient, the module has not been
+                // probed and must not be cached as not being a module
+                update_cache = false;
                 continue;
             }
 
+            // from now on the module counts as probed
+            if (update_cache)
+                m->flags_ = 0;
+
             bool must_keep_loaded = false;
 
             // get the component factory
             std::string curr_fullname(p.first.parent_path().string());
-            load_component_factory(
-                d, ini, curr_fullname, component_registries, p.second, ec);
+            std::vector<std::string> component_ini_data;
+            load_component_factory(d, ini, curr_fullname, component_registries,
+                p.second, component_ini_data, ec);
             if (ec)
             {
                 LRT_(info).format(
@@ -531,6 +663,12 @@ namespace hpx { namespace util {
                 LRT_(debug).format(
                     "load_component_factory succeeded: {}", p.first.string());
                 must_keep_loaded = true;
+
+                if (update_cache)
+                {
+                    m->flags_ |= startup_cache_module::has_components;
+                    m->ini_data_ = std::move(component_ini_data);
+                }
             }
 
             // get the plugin factory
@@ -551,6 +689,9 @@ namespace hpx { namespace util {
                 std::copy(tmp_regs.begin(), tmp_regs.end(),
                     std::back_inserter(plugin_registries));
                 must_keep_loaded = true;
+
+                if (update_cache)
+                    m->flags_ |= startup_cache_module::has_plugins;
             }
 
             // store loaded library for future use
@@ -559,6 +700,10 @@ namespace hpx { namespace util {
                 modules.insert(std::make_pair(p.second, std::move(d)));
             }
         }
+
+        if (update_cache)
+            cache->update(libs, std::move(found));
+
         return plugin_registries;
     }
 }}    // namespace hpx::util
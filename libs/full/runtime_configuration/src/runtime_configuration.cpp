@@ -18,6 +18,7 @@
 #include <hpx/runtime_configuration/plugin_registry_base.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/runtime_configuration/runtime_mode.hpp>
+#include <hpx/runtime_configuration/startup_cache.hpp>
 #include <hpx/util/from_string.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/version.hpp>
@@ -118,6 +119,7 @@ namespace hpx { namespace util {
             "$[system.executable_prefix]/",
             "master_ini_path_suffixes = /share/" HPX_BASE_DIR_NAME
                 HPX_INI_PATH_DELIMITER "/../share/" HPX_BASE_DIR_NAME,
+            "startup_cache = ${HPX_STARTUP_CACHE:}",
 #ifdef HPX_HAVE_ITTNOTIFY
             "use_itt_notify = ${HPX_HAVE_ITTNOTIFY:0}",
 #endif
@@ -222,6 +224,9 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "use_pool = ${HPX_USE_STACK_POOL:1}",
+            "pool_size = ${HPX_STACK_POOL_SIZE:64}",
+            "pool_trim_delay = ${HPX_STACK_POOL_TRIM_DELAY:10}",
 #endif
 
             "[hpx.threadpools]",
@@ -557,7 +562,8 @@ namespace hpx { namespace util {
         std::vector<std::shared_ptr<components::component_registry_base>>&
             component_registries,
         std::string const& path, std::set<std::string>& component_paths,
-        std::map<std::string, filesystem::path>& basenames)
+        std::map<std::string, filesystem::path>& basenames,
+        util::startup_cache& cache)
     {
         namespace fs = filesystem;
 
@@ -584,7 +590,7 @@ namespace hpx { namespace util {
                 {
                     plugin_list_type tmp_regs =
                         util::init_ini_data_default(this_path.string(), *this,
-                            basenames, modules_, component_registries);
+                            basenames, modules_, component_registries, &cache);
 
                     std::copy(tmp_regs.begin(), tmp_regs.end(),
                         std::back_inserter(plugin_registries));
@@ -601,7 +607,8 @@ namespace hpx { namespace util {
         std::string const& component_base_paths,
         std::string const& component_path_suffixes,
         std::set<std::string>& component_paths,
-        std::map<std::string, filesystem::path>& basenames)
+        std::map<std::string, filesystem::path>& basenames,
+        util::startup_cache& cache)
     {
         namespace fs = filesystem;
 
@@ -629,13 +636,13 @@ namespace hpx { namespace util {
                     std::string p = path;
                     p += *jt;
                     load_component_path(plugin_registries, component_registries,
-                        p, component_paths, basenames);
+                        p, component_paths, basenames, cache);
                 }
             }
             else
             {
                 load_component_path(plugin_registries, component_registries,
-                    path, component_paths, basenames);
+                    path, component_paths, basenames, cache);
             }
         }
     }
@@ -658,6 +665,9 @@ namespace hpx { namespace util {
         // plugin registry object
         plugin_list_type plugin_registries;
 
+        // results of earlier searches for modules (if enabled)
+        util::startup_cache cache(get_entry("hpx.startup_cache", ""));
+
         // load plugin paths from component_base_paths and suffixes
         std::string component_base_paths(
             get_entry("hpx.component_base_paths", HPX_DEFAULT_COMPONENT_PATH));
@@ -666,12 +676,14 @@ namespace hpx { namespace util {
 
         load_component_paths(plugin_registries, component_registries,
             component_base_paths, component_path_suffixes, component_paths,
-            basenames);
+            basenames, cache);
 
         // load additional explicit plugin paths from plugin_paths key
         std::string plugin_paths(get_entry("hpx.component_paths", ""));
         load_component_paths(plugin_registries, component_registries,
-            plugin_paths, "", component_paths, basenames);
+            plugin_paths, "", component_paths, basenames, cache);
+
+        cache.save();
 
         // read system and user ini files _again_, to allow the user to
         // overwrite the settings from the default component ini's.
@@ -1202,6 +1214,47 @@ namespace hpx { namespace util {
         }
         return true;    // default is true
     }
+
+    bool runtime_configuration::use_stack_pool() const
+    {
+        if (has_section("hpx"))
+        {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<int>(*sec, "use_pool", 1) != 0;
+            }
+        }
+        return true;    // default is true
+    }
+
+    std::size_t runtime_configuration::get_stack_pool_size() const
+    {
+        if (has_section("hpx"))
+        {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "pool_size", 64);
+            }
+        }
+        return 64;
+    }
+
+    std::size_t runtime_configuration::get_stack_pool_trim_delay() const
+    {
+        if (has_section("hpx"))
+        {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "pool_trim_delay", 10);
+            }
+        }
+        return 10;
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
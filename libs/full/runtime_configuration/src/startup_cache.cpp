@@ -0,0 +1,243 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/filesystem.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/runtime_configuration/startup_cache.hpp>
+#include <hpx/version.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_WINDOWS)
+#include <process.h>
+#elif defined(HPX_HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        // std::filesystem and Boost.Filesystem use different types for the
+        // modification time of files
+        inline std::int64_t mtime_ticks(std::time_t t)
+        {
+            return static_cast<std::int64_t>(t);
+        }
+
+        template <typename Clock, typename Duration>
+        std::int64_t mtime_ticks(std::chrono::time_point<Clock, Duration> t)
+        {
+            return static_cast<std::int64_t>(t.time_since_epoch().count());
+        }
+
+        char const* const startup_cache_header = "hpx-startup-cache 1";
+
+        // The cache is invalidated whenever the HPX core library changes.
+        std::string startup_cache_version()
+        {
+            return hpx::full_version_as_string() + " " + hpx::build_type() +
+                " " + hpx::build_date_time();
+        }
+
+        // the remainder of the line after the leading space
+        std::string get_remainder(std::istream& is)
+        {
+            std::string rest;
+            std::getline(is, rest);
+            if (!rest.empty() && rest[0] == ' ')
+                rest.erase(0, 1);
+            return rest;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    startup_cache::startup_cache(std::string filename)
+      : filename_(std::move(filename))
+      , modified_(false)
+    {
+        if (enabled())
+        {
+            version_ = detail::startup_cache_version();
+            load();
+        }
+    }
+
+    std::int64_t startup_cache::get_mtime(std::string const& path)
+    {
+        std::error_code ec;
+        auto t = filesystem::last_write_time(filesystem::path(path), ec);
+        if (ec)
+            return -1;
+        return detail::mtime_ticks(t);
+    }
+
+    startup_cache_directory const* startup_cache::find(
+        std::string const& dir) const
+    {
+        auto it = directories_.find(dir);
+        if (it == directories_.end())
+            return nullptr;
+
+        // adding or removing modules changes the directory, replacing a
+        // module in place changes the module only
+        startup_cache_directory const& data = it->second;
+        if (data.mtime_ != get_mtime(dir))
+            return nullptr;
+
+        for (startup_cache_module const& m : data.modules_)
+        {
+            std::error_code ec;
+            std::uint64_t const size =
+                filesystem::file_size(filesystem::path(m.path_), ec);
+            if (ec || size != m.size_ || m.mtime_ != get_mtime(m.path_))
+                return nullptr;
+        }
+        return &data;
+    }
+
+    void startup_cache::update(std::string const& dir,
+        startup_cache_directory data)
+    {
+        directories_[dir] = std::move(data);
+        modified_ = true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void startup_cache::load()
+    {
+        std::ifstream in(filename_);
+        if (!in)
+            return;
+
+        std::string line;
+        if (!std::getline(in, line) || line != detail::startup_cache_header)
+            return;
+
+        if (!std::getline(in, line) || line != "version " + version_)
+        {
+            LRT_(info).format(
+                "startup cache {} was created by a different version of HPX",
+                filename_);
+            return;
+        }
+
+        startup_cache_directory* dir = nullptr;
+        startup_cache_module* module = nullptr;
+        while (std::getline(in, line))
+        {
+            std::istringstream is(line);
+            std::string kind;
+            is >> kind;
+
+            if (kind == "directory")
+            {
+                startup_cache_directory data;
+                if (!(is >> data.mtime_))
+                    break;
+
+                dir = &directories_[detail::get_remainder(is)];
+                *dir = std::move(data);
+                module = nullptr;
+            }
+            else if (kind == "module" && dir != nullptr)
+            {
+                startup_cache_module m;
+                if (!(is >> m.mtime_ >> m.size_ >> m.flags_ >> m.name_))
+                    break;
+
+                m.path_ = detail::get_remainder(is);
+
+                dir->modules_.push_back(std::move(m));
+                module = &dir->modules_.back();
+            }
+            else if (kind == "ini" && module != nullptr)
+            {
+                module->ini_data_.push_back(detail::get_remainder(is));
+            }
+            else
+            {
+                break;    // corrupted file, whatever was read is still valid
+            }
+        }
+
+        LRT_(info).format("loaded startup cache: {}", filename_);
+    }
+
+    // Several processes might write the cache at the same time, each of them
+    // writes to a private file first and replaces the cache afterwards.
+    void startup_cache::save()
+    {
+        if (!enabled() || !modified_)
+            return;
+
+#if defined(HPX_WINDOWS)
+        std::string tmp = filename_ + "." + std::to_string(_getpid());
+#else
+        std::string tmp = filename_ + "." + std::to_string(getpid());
+#endif
+        {
+            std::error_code ec;
+            filesystem::path parent = filesystem::path(filename_).parent_path();
+            if (!parent.empty())
+                filesystem::create_directories(parent, ec);
+
+            std::ofstream out(tmp, std::ios::trunc);
+            if (!out)
+            {
+                LRT_(warning).format("could not write startup cache: {}", tmp);
+                return;
+            }
+
+            out << detail::startup_cache_header << "\n";
+            out << "version " << version_ << "\n";
+            for (auto const& d : directories_)
+            {
+                out << "directory " << d.second.mtime_ << " " << d.first
+                    << "\n";
+                for (startup_cache_module const& m : d.second.modules_)
+                {
+                    out << "module " << m.mtime_ << " " << m.size_ << " "
+                        << m.flags_ << " " << m.name_ << " " << m.path_ << "\n";
+                    for (std::string const& s : m.ini_data_)
+                    {
+                        out << "ini " << s << "\n";
+                    }
+                }
+            }
+
+            if (!out)
+            {
+                out.close();
+                std::remove(tmp.c_str());
+                return;
+            }
+        }
+
+#if defined(HPX_WINDOWS)
+        std::remove(filename_.c_str());
+#endif
+        if (std::rename(tmp.c_str(), filename_.c_str()) != 0)
+        {
+            std::remove(tmp.c_str());
+            return;
+        }
+
+        modified_ = false;
+        LRT_(info).format("updated startup cache: {}", filename_);
+    }
+}}    // namespace hpx::util
@@ -0,0 +1,59 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
+
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        // the startup phases run on plain OS threads, before the runtime
+        // (and its synchronization primitives) are available
+        struct startup_phase_timings
+        {
+            std::mutex mtx_;
+            std::vector<std::pair<std::string, double>> timings_;
+        };
+
+        startup_phase_timings& get_startup_phase_timings_data()
+        {
+            static startup_phase_timings data;
+            return data;
+        }
+
+        void reset_startup_phase_timings()
+        {
+            startup_phase_timings& data = get_startup_phase_timings_data();
+
+            std::lock_guard<std::mutex> l(data.mtx_);
+            data.timings_.clear();
+        }
+
+        void add_startup_phase_timing(std::string name, double elapsed)
+        {
+            startup_phase_timings& data = get_startup_phase_timings_data();
+
+            std::lock_guard<std::mutex> l(data.mtx_);
+            data.timings_.emplace_back(std::move(name), elapsed);
+        }
+    }    // namespace detail
+
+    std::vector<std::pair<std::string, double>> get_startup_phase_timings()
+    {
+        detail::startup_phase_timings& data =
+            detail::get_startup_phase_timings_data();
+
+        std::lock_guard<std::mutex> l(data.mtx_);
+        return data.timings_;
+    }
+}}    // namespace hpx::util
@@ -1043,6 +1043,28 @@ namespace hpx {
                     local_action_invocation_counter_discoverer,
                 ""},
 
+            // adaptive chunk size counters
+            {"/parallel/adaptive_chunk_size/chunk_size",
+                performance_counters::counter_raw,
+                "returns the chunk size most recently chosen by the "
+                "adaptive_chunk_size executor parameters for a specific call "
+                "site on this locality (the call site has to be specified as "
+                "the counter parameter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::
+                    adaptive_chunk_size_counter_creator,
+                &performance_counters::locality_counter_discoverer, ""},
+            {"/parallel/adaptive_chunk_size/cost",
+                performance_counters::counter_raw,
+                "returns the cost of a single loop iteration as estimated by "
+                "the adaptive_chunk_size executor parameters for a specific "
+                "call site on this locality (the call site has to be "
+                "specified as the counter parameter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::
+                    adaptive_chunk_size_counter_creator,
+                &performance_counters::locality_counter_discoverer, "ns"},
+
 #if defined(HPX_HAVE_NETWORKING)
             {"/runtime/count/remote-action-invocation",
                 performance_counters::counter_raw,
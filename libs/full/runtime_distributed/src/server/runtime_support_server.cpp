@@ -1333,6 +1333,8 @@ namespace hpx { namespace components { namespace server {
         //  path = ...           # the path where to find this component module
         //  enabled = false      # optional (default is assumed to be true)
         //  static = false       # optional (default is assumed to be false)
+        //  lazy = false         # optional, set for disabled components known
+        //                       # from the startup cache
         //
         // # optional section defining additional properties for this module
         // [hpx.components.instance_name.settings]
@@ -1375,6 +1377,15 @@ namespace hpx { namespace components { namespace server {
                 }
             }
 
+            // the module of a disabled component is not loaded if the
+            // component was found in the startup cache
+            if (!isenabled && sect.get_entry("lazy", "0") == "1")
+            {
+                LRT_(info).format(
+                    "component module not loaded: {}", instance);
+                continue;
+            }
+
             // test whether this component section was generated
             bool isdefault = false;
             if (sect.has_entry("isdefault"))
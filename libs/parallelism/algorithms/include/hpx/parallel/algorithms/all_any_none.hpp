@@ -270,7 +270,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static bool sequential(
                 ExPolicy, Iter first, Sent last, F&& f, Proj&& proj)
             {
-                return detail::sequential_find_if(first, last,
+                return detail::sequential_find_if<
+                           hpx::execution::sequenced_policy>(first, last,
                            util::invoke_projected<F, Proj>(std::forward<F>(f),
                                std::forward<Proj>(proj))) == last;
             }
@@ -309,7 +310,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     std::forward<ExPolicy>(policy), first,
                     detail::distance(first, last), std::move(f1),
                     [](std::vector<hpx::future<bool>>&& results) {
-                        return detail::sequential_find_if_not(
+                        return detail::sequential_find_if_not<
+                                   hpx::execution::sequenced_policy>(
                                    hpx::util::begin(results),
                                    hpx::util::end(results),
                                    [](hpx::future<bool>& val) {
@@ -370,7 +372,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static bool sequential(
                 ExPolicy, Iter first, Sent last, F&& f, Proj&& proj)
             {
-                return detail::sequential_find_if(first, last,
+                return detail::sequential_find_if<
+                           hpx::execution::sequenced_policy>(first, last,
                            util::invoke_projected<F, Proj>(std::forward<F>(f),
                                std::forward<Proj>(proj))) != last;
             }
@@ -409,7 +412,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     std::forward<ExPolicy>(policy), first,
                     detail::distance(first, last), std::move(f1),
                     [](std::vector<hpx::future<bool>>&& results) {
-                        return detail::sequential_find_if(
+                        return detail::sequential_find_if<
+                                   hpx::execution::sequenced_policy>(
                                    hpx::util::begin(results),
                                    hpx::util::end(results),
                                    [](hpx::future<bool>& val) {
@@ -470,9 +474,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static bool sequential(
                 ExPolicy, Iter first, Sent last, F&& f, Proj&& proj)
             {
-                return detail::sequential_find_if_not(first, last,
-                           std::forward<F>(f),
-                           std::forward<Proj>(proj)) == last;
+                return detail::sequential_find_if_not<
+                           hpx::execution::sequenced_policy>(first, last,
+                           std::forward<F>(f), std::forward<Proj>(proj)) ==
+                    last;
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -509,7 +514,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     std::forward<ExPolicy>(policy), first,
                     detail::distance(first, last), std::move(f1),
                     [](std::vector<hpx::future<bool>>&& results) {
-                        return detail::sequential_find_if_not(
+                        return detail::sequential_find_if_not<
+                                   hpx::execution::sequenced_policy>(
                                    hpx::util::begin(results),
                                    hpx::util::end(results),
                                    [](hpx::future<bool>& val) {
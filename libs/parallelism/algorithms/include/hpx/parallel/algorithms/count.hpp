@@ -246,6 +246,33 @@ namespace hpx { namespace parallel { inline namespace v1 {
             }
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // Random access ranges are handed to the iteration object as a whole,
+        // which allows for vectorizing the sequential count.
+        template <typename ExPolicy, typename Iter, typename Sent, typename F>
+        typename std::enable_if<
+            hpx::traits::is_random_access_iterator<Iter>::value,
+            typename std::iterator_traits<Iter>::difference_type>::type
+        sequential_count(ExPolicy&&, Iter first, Sent last, F&& f)
+        {
+            return f(
+                first, static_cast<std::size_t>(detail::distance(first, last)));
+        }
+
+        template <typename ExPolicy, typename Iter, typename Sent, typename F>
+        typename std::enable_if<
+            !hpx::traits::is_random_access_iterator<Iter>::value,
+            typename std::iterator_traits<Iter>::difference_type>::type
+        sequential_count(ExPolicy&& policy, Iter first, Sent last, F&& f)
+        {
+            typename std::iterator_traits<Iter>::difference_type ret = 0;
+
+            util::loop(std::forward<ExPolicy>(policy), first, last,
+                hpx::util::bind_back(std::forward<F>(f), std::ref(ret)));
+
+            return ret;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Value>
         struct count : public detail::algorithm<count<Value>, Value>
@@ -266,12 +293,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     count_iteration<ExPolicy, detail::compare_to<T>, Proj>(
                         detail::compare_to<T>(value), std::forward<Proj>(proj));
 
-                typename std::iterator_traits<InIterB>::difference_type ret = 0;
-
-                util::loop(std::forward<ExPolicy>(policy), first, last,
-                    hpx::util::bind_back(std::move(f1), std::ref(ret)));
-
-                return ret;
+                return sequential_count(
+                    std::forward<ExPolicy>(policy), first, last, std::move(f1));
             }
 
             template <typename ExPolicy, typename IterB, typename IterE,
@@ -361,12 +384,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 auto f1 = count_iteration<ExPolicy, Pred, Proj>(
                     op, std::forward<Proj>(proj));
 
-                typename std::iterator_traits<InIterB>::difference_type ret = 0;
-
-                util::loop(std::forward<ExPolicy>(policy), first, last,
-                    hpx::util::bind_back(std::move(f1), std::ref(ret)));
-
-                return ret;
+                return sequential_count(
+                    std::forward<ExPolicy>(policy), first, last, std::move(f1));
             }
 
             template <typename ExPolicy, typename IterB, typename IterE,
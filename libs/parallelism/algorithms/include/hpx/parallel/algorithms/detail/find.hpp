@@ -9,55 +9,166 @@
 
 #include <hpx/config.hpp>
 #include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_fallback_invoke.hpp>
+#include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 
+#include <cstddef>
+#include <utility>
+
 namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
 
     // provide implementation of std::find supporting iterators/sentinels
-    template <typename Iterator, typename Sentinel, typename T,
-        typename Proj = util::projection_identity>
-    inline constexpr Iterator sequential_find(
-        Iterator first, Sentinel last, T const& value, Proj proj = Proj())
+    template <typename ExPolicy>
+    struct sequential_find_t final
+      : hpx::functional::tag_fallback<sequential_find_t<ExPolicy>>
     {
-        for (; first != last; ++first)
+    private:
+        template <typename Iterator, typename Sentinel, typename T,
+            typename Proj = util::projection_identity>
+        friend inline constexpr Iterator tag_fallback_invoke(sequential_find_t,
+            Iterator first, Sentinel last, T const& value, Proj proj = Proj())
         {
-            if (hpx::util::invoke(proj, *first) == value)
+            for (; first != last; ++first)
             {
-                return first;
+                if (hpx::util::invoke(proj, *first) == value)
+                {
+                    return first;
+                }
             }
+            return first;
         }
-        return first;
+
+        // find the first matching element in the given partition, cancel
+        // the token with its global index
+        template <typename FwdIter, typename Token, typename T, typename Proj>
+        friend inline void tag_fallback_invoke(sequential_find_t,
+            std::size_t base_idx, FwdIter part_begin, std::size_t part_count,
+            Token& tok, T const& val, Proj&& proj)
+        {
+            util::loop_idx_n(base_idx, part_begin, part_count, tok,
+                [&val, &proj, &tok](auto& v, std::size_t i) -> void {
+                    if (hpx::util::invoke(proj, v) == val)
+                    {
+                        tok.cancel(i);
+                    }
+                });
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_find_t<ExPolicy> sequential_find =
+        sequential_find_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_find(Args&&... args)
+    {
+        return sequential_find_t<ExPolicy>{}(std::forward<Args>(args)...);
     }
+#endif
 
     // provide implementation of std::find_if supporting iterators/sentinels
-    template <typename Iterator, typename Sentinel, typename Pred,
-        typename Proj = util::projection_identity>
-    inline constexpr Iterator sequential_find_if(
-        Iterator first, Sentinel last, Pred pred, Proj proj = Proj())
+    template <typename ExPolicy>
+    struct sequential_find_if_t final
+      : hpx::functional::tag_fallback<sequential_find_if_t<ExPolicy>>
     {
-        for (; first != last; ++first)
+    private:
+        template <typename Iterator, typename Sentinel, typename Pred,
+            typename Proj = util::projection_identity>
+        friend inline constexpr Iterator tag_fallback_invoke(
+            sequential_find_if_t, Iterator first, Sentinel last, Pred pred,
+            Proj proj = Proj())
         {
-            if (hpx::util::invoke(pred, hpx::util::invoke(proj, *first)))
+            for (; first != last; ++first)
             {
-                return first;
+                if (hpx::util::invoke(pred, hpx::util::invoke(proj, *first)))
+                {
+                    return first;
+                }
             }
+            return first;
+        }
+
+        // find the first element in the given partition satisfying the
+        // predicate, cancel the token with its global index
+        template <typename FwdIter, typename Token, typename F, typename Proj>
+        friend inline void tag_fallback_invoke(sequential_find_if_t,
+            std::size_t base_idx, FwdIter part_begin, std::size_t part_count,
+            Token& tok, F&& f, Proj&& proj)
+        {
+            util::loop_idx_n(base_idx, part_begin, part_count, tok,
+                [&f, &proj, &tok](auto& v, std::size_t i) -> void {
+                    if (hpx::util::invoke(f, hpx::util::invoke(proj, v)))
+                    {
+                        tok.cancel(i);
+                    }
+                });
         }
-        return first;
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_find_if_t<ExPolicy>
+        sequential_find_if = sequential_find_if_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_find_if(Args&&... args)
+    {
+        return sequential_find_if_t<ExPolicy>{}(std::forward<Args>(args)...);
     }
+#endif
 
-    // provide implementation of std::find_if supporting iterators/sentinels
-    template <typename Iterator, typename Sentinel, typename Pred,
-        typename Proj = util::projection_identity>
-    inline constexpr Iterator sequential_find_if_not(
-        Iterator first, Sentinel last, Pred pred, Proj proj = Proj())
+    // provide implementation of std::find_if_not supporting
+    // iterators/sentinels
+    template <typename ExPolicy>
+    struct sequential_find_if_not_t final
+      : hpx::functional::tag_fallback<sequential_find_if_not_t<ExPolicy>>
     {
-        for (; first != last; ++first)
+    private:
+        template <typename Iterator, typename Sentinel, typename Pred,
+            typename Proj = util::projection_identity>
+        friend inline constexpr Iterator tag_fallback_invoke(
+            sequential_find_if_not_t, Iterator first, Sentinel last, Pred pred,
+            Proj proj = Proj())
         {
-            if (!hpx::util::invoke(pred, hpx::util::invoke(proj, *first)))
+            for (; first != last; ++first)
             {
-                return first;
+                if (!hpx::util::invoke(pred, hpx::util::invoke(proj, *first)))
+                {
+                    return first;
+                }
             }
+            return first;
+        }
+
+        // find the first element in the given partition not satisfying the
+        // predicate, cancel the token with its global index
+        template <typename FwdIter, typename Token, typename F, typename Proj>
+        friend inline void tag_fallback_invoke(sequential_find_if_not_t,
+            std::size_t base_idx, FwdIter part_begin, std::size_t part_count,
+            Token& tok, F&& f, Proj&& proj)
+        {
+            util::loop_idx_n(base_idx, part_begin, part_count, tok,
+                [&f, &proj, &tok](auto& v, std::size_t i) -> void {
+                    if (!hpx::util::invoke(f, hpx::util::invoke(proj, v)))
+                    {
+                        tok.cancel(i);
+                    }
+                });
         }
-        return first;
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_find_if_not_t<ExPolicy>
+        sequential_find_if_not = sequential_find_if_not_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_find_if_not(Args&&... args)
+    {
+        return sequential_find_if_not_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
     }
+#endif
 }}}}    // namespace hpx::parallel::v1::detail
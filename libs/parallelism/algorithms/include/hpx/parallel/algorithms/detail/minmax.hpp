@@ -0,0 +1,184 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_fallback_invoke.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/loop.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // The partition based overloads below operate on iterators only, the
+    // scalar fallbacks are therefore always executed sequentially.
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_min_element_t final
+      : hpx::functional::tag_fallback<sequential_min_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename F, typename Proj>
+        friend inline FwdIter tag_fallback_invoke(sequential_min_element_t,
+            FwdIter first, FwdIter last, F&& f, Proj&& proj)
+        {
+            return std::min_element(first, last,
+                util::compare_projected<F, Proj>(
+                    std::forward<F>(f), std::forward<Proj>(proj)));
+        }
+
+        template <typename FwdIter, typename F, typename Proj>
+        friend inline FwdIter tag_fallback_invoke(sequential_min_element_t,
+            FwdIter it, std::size_t count, F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            FwdIter smallest = it;
+            util::detail::loop_n<hpx::execution::sequenced_policy>(++it,
+                count - 1,
+                [&f, &smallest, &proj](FwdIter const& curr) -> void {
+                    if (hpx::util::invoke(f, hpx::util::invoke(proj, *curr),
+                            hpx::util::invoke(proj, *smallest)))
+                    {
+                        smallest = curr;
+                    }
+                });
+
+            return smallest;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_min_element_t<ExPolicy>
+        sequential_min_element = sequential_min_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_min_element(Args&&... args)
+    {
+        return sequential_min_element_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_max_element_t final
+      : hpx::functional::tag_fallback<sequential_max_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename F, typename Proj>
+        friend inline FwdIter tag_fallback_invoke(sequential_max_element_t,
+            FwdIter first, FwdIter last, F&& f, Proj&& proj)
+        {
+            return std::max_element(first, last,
+                util::compare_projected<F, Proj>(
+                    std::forward<F>(f), std::forward<Proj>(proj)));
+        }
+
+        template <typename FwdIter, typename F, typename Proj>
+        friend inline FwdIter tag_fallback_invoke(sequential_max_element_t,
+            FwdIter it, std::size_t count, F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            FwdIter greatest = it;
+            util::detail::loop_n<hpx::execution::sequenced_policy>(++it,
+                count - 1,
+                [&f, &greatest, &proj](FwdIter const& curr) -> void {
+                    if (hpx::util::invoke(f, hpx::util::invoke(proj, *greatest),
+                            hpx::util::invoke(proj, *curr)))
+                    {
+                        greatest = curr;
+                    }
+                });
+
+            return greatest;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_max_element_t<ExPolicy>
+        sequential_max_element = sequential_max_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_max_element(Args&&... args)
+    {
+        return sequential_max_element_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_minmax_element_t final
+      : hpx::functional::tag_fallback<sequential_minmax_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename F, typename Proj>
+        friend inline std::pair<FwdIter, FwdIter> tag_fallback_invoke(
+            sequential_minmax_element_t, FwdIter first, FwdIter last, F&& f,
+            Proj&& proj)
+        {
+            return std::minmax_element(first, last,
+                util::compare_projected<F, Proj>(
+                    std::forward<F>(f), std::forward<Proj>(proj)));
+        }
+
+        template <typename FwdIter, typename F, typename Proj>
+        friend inline std::pair<FwdIter, FwdIter> tag_fallback_invoke(
+            sequential_minmax_element_t, FwdIter it, std::size_t count,
+            F const& f, Proj const& proj)
+        {
+            std::pair<FwdIter, FwdIter> result(it, it);
+
+            if (count == 0 || count == 1)
+                return result;
+
+            util::detail::loop_n<hpx::execution::sequenced_policy>(++it,
+                count - 1,
+                [&f, &result, &proj](FwdIter const& curr) -> void {
+                    if (hpx::util::invoke(f, hpx::util::invoke(proj, *curr),
+                            hpx::util::invoke(proj, *result.first)))
+                    {
+                        result.first = curr;
+                    }
+
+                    if (!hpx::util::invoke(f, hpx::util::invoke(proj, *curr),
+                            hpx::util::invoke(proj, *result.second)))
+                    {
+                        result.second = curr;
+                    }
+                });
+
+            return result;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_minmax_element_t<ExPolicy>
+        sequential_minmax_element = sequential_minmax_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_minmax_element(
+        Args&&... args)
+    {
+        return sequential_minmax_element_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
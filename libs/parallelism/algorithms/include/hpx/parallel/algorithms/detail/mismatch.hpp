@@ -0,0 +1,118 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_fallback_invoke.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    template <typename ExPolicy>
+    struct sequential_mismatch_binary_t final
+      : hpx::functional::tag_fallback<sequential_mismatch_binary_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter1, typename Sent1, typename Iter2,
+            typename Sent2, typename F, typename Proj1, typename Proj2>
+        friend inline util::in_in_result<Iter1, Iter2> tag_fallback_invoke(
+            sequential_mismatch_binary_t, Iter1 first1, Sent1 last1,
+            Iter2 first2, Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
+        {
+            while (first1 != last1 && first2 != last2 &&
+                hpx::util::invoke(f, hpx::util::invoke(proj1, *first1),
+                    hpx::util::invoke(proj2, *first2)))
+            {
+                ++first1, ++first2;
+            }
+            return {first1, first2};
+        }
+
+        // find the first mismatch in the given partition, cancel the token
+        // with its global index
+        template <typename ZipIterator, typename Token, typename F,
+            typename Proj1, typename Proj2>
+        friend inline void tag_fallback_invoke(sequential_mismatch_binary_t,
+            std::size_t base_idx, ZipIterator it, std::size_t part_count,
+            Token& tok, F&& f, Proj1&& proj1, Proj2&& proj2)
+        {
+            util::loop_idx_n(base_idx, it, part_count, tok,
+                [&f, &proj1, &proj2, &tok](auto t, std::size_t i) {
+                    if (!hpx::util::invoke(f,
+                            hpx::util::invoke(proj1, hpx::get<0>(t)),
+                            hpx::util::invoke(proj2, hpx::get<1>(t))))
+                    {
+                        tok.cancel(i);
+                    }
+                });
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_mismatch_binary_t<ExPolicy>
+        sequential_mismatch_binary = sequential_mismatch_binary_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_mismatch_binary(
+        Args&&... args)
+    {
+        return sequential_mismatch_binary_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_mismatch_t final
+      : hpx::functional::tag_fallback<sequential_mismatch_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter1, typename InIter2, typename F>
+        friend inline std::pair<InIter1, InIter2> tag_fallback_invoke(
+            sequential_mismatch_t, InIter1 first1, InIter1 last1,
+            InIter2 first2, F&& f)
+        {
+            return std::mismatch(first1, last1, first2, std::forward<F>(f));
+        }
+
+        // find the first mismatch in the given partition, cancel the token
+        // with its global index
+        template <typename ZipIterator, typename Token, typename F>
+        friend inline void tag_fallback_invoke(sequential_mismatch_t,
+            std::size_t base_idx, ZipIterator it, std::size_t part_count,
+            Token& tok, F&& f)
+        {
+            util::loop_idx_n(base_idx, it, part_count, tok,
+                [&f, &tok](auto t, std::size_t i) {
+                    if (!hpx::util::invoke(f, hpx::get<0>(t), hpx::get<1>(t)))
+                    {
+                        tok.cancel(i);
+                    }
+                });
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_mismatch_t<ExPolicy>
+        sequential_mismatch = sequential_mismatch_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_mismatch(Args&&... args)
+    {
+        return sequential_mismatch_t<ExPolicy>{}(std::forward<Args>(args)...);
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,477 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    /// \cond NOINTERNAL
+    static constexpr std::size_t radix_sort_limit_per_task = 65536ul;
+
+    // every pass of the radix sort distributes the elements based on one
+    // byte of the keys
+    static constexpr std::size_t radix_sort_bits = 8;
+    static constexpr std::size_t radix_sort_buckets = 1 << radix_sort_bits;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Map keys onto unsigned integers of the same size such that the order
+    // of the unsigned integers is the same as the order of the keys.
+    template <typename T, typename Enable = void>
+    struct radix_sort_key_traits
+    {
+        static constexpr bool is_sortable = false;
+    };
+
+    template <typename T>
+    struct radix_sort_key_traits<T,
+        typename std::enable_if<std::is_integral<T>::value &&
+            !std::is_same<T, bool>::value>::type>
+    {
+        static constexpr bool is_sortable = true;
+
+        using type = typename std::make_unsigned<T>::type;
+
+        static constexpr type to_unsigned(T key) noexcept
+        {
+            // flip the sign bit of signed keys
+            return std::is_signed<T>::value ?
+                type(type(key) ^ type(type(1) << (sizeof(T) * CHAR_BIT - 1))) :
+                type(key);
+        }
+    };
+
+    template <typename T>
+    struct radix_sort_key_traits<T,
+        typename std::enable_if<std::is_floating_point<T>::value &&
+            std::numeric_limits<T>::is_iec559 &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>::type>
+    {
+        static constexpr bool is_sortable = true;
+
+        using type = typename std::conditional<sizeof(T) ==
+                sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>::type;
+
+        static type to_unsigned(T key) noexcept
+        {
+            type bits;
+            std::memcpy(&bits, &key, sizeof(T));
+
+            // flip all bits of negative values, flip the sign bit of
+            // positive values
+            type const sign = type(1) << (sizeof(T) * CHAR_BIT - 1);
+            return (bits & sign) ? type(~bits) : type(bits | sign);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The radix sort is used in place of a comparison based sort whenever
+    // it produces the same result, i.e. for arithmetic keys compared using
+    // the default comparison operator.
+    template <typename Comp, typename T>
+    struct is_radix_sort_compare : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct is_radix_sort_compare<detail::less, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_radix_sort_compare<std::less<T>, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_radix_sort_compare<std::less<>, T> : std::true_type
+    {
+    };
+
+    template <typename Iter, typename Comp,
+        typename Proj = util::projection_identity>
+    struct is_radix_sortable
+      : std::integral_constant<bool,
+            radix_sort_key_traits<typename std::iterator_traits<
+                Iter>::value_type>::is_sortable &&
+                is_radix_sort_compare<typename std::decay<Comp>::type,
+                    typename std::iterator_traits<Iter>::value_type>::value &&
+                std::is_same<typename std::decay<Proj>::type,
+                    util::projection_identity>::value>
+    {
+    };
+
+    // the values sorted alongside the keys are moved through a temporary
+    // buffer
+    template <typename KeyIter, typename Comp, typename ValueIter>
+    struct is_radix_sortable_by_key
+      : std::integral_constant<bool,
+            is_radix_sortable<KeyIter, Comp>::value &&
+                std::is_default_constructible<typename std::iterator_traits<
+                    ValueIter>::value_type>::value &&
+                std::is_move_assignable<typename std::iterator_traits<
+                    ValueIter>::value_type>::value>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // placeholder used for sorting keys without values
+    struct radix_sort_no_values
+    {
+    };
+
+    template <typename ValueIter>
+    struct radix_sort_value_buffer
+    {
+        using value_type = typename std::iterator_traits<ValueIter>::value_type;
+
+        explicit radix_sort_value_buffer(std::size_t count)
+          : buffer_(new value_type[count])
+        {
+        }
+
+        value_type* data() const noexcept
+        {
+            return buffer_.get();
+        }
+
+        std::unique_ptr<value_type[]> buffer_;
+    };
+
+    template <>
+    struct radix_sort_value_buffer<radix_sort_no_values>
+    {
+        explicit radix_sort_value_buffer(std::size_t) {}
+
+        radix_sort_no_values data() const noexcept
+        {
+            return radix_sort_no_values();
+        }
+    };
+
+    template <typename Src, typename Dest>
+    void radix_sort_move_value(
+        Src src, std::size_t i, Dest dest, std::size_t j)
+    {
+        dest[j] = std::move(src[i]);
+    }
+
+    inline void radix_sort_move_value(
+        radix_sort_no_values, std::size_t, radix_sort_no_values, std::size_t)
+    {
+    }
+
+    template <typename Src, typename Dest>
+    void radix_sort_move_values(
+        Src src, std::size_t first, std::size_t last, Dest dest)
+    {
+        std::move(src + first, src + last, dest + first);
+    }
+
+    inline void radix_sort_move_values(
+        radix_sort_no_values, std::size_t, std::size_t, radix_sort_no_values)
+    {
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parallel least significant digit radix sort. Each pass distributes the
+    // elements into the buckets for one byte of the keys: the elements are
+    // divided into chunks, the number of elements per bucket and chunk is
+    // counted concurrently, and the elements of each chunk are then moved
+    // concurrently to the positions determined by the counts. Passes for
+    // which all keys have the same byte are skipped.
+    template <typename KeyIter, typename ValueIter>
+    class radix_sort_helper
+    {
+    public:
+        using key_type = typename std::iterator_traits<KeyIter>::value_type;
+        using key_traits = radix_sort_key_traits<key_type>;
+        using counts_type = std::array<std::size_t, radix_sort_buckets>;
+
+        static constexpr std::size_t num_passes = sizeof(key_type);
+
+        radix_sort_helper(KeyIter keys, ValueIter values, std::size_t count,
+            std::size_t chunk_size)
+          : keys_(keys)
+          , values_(values)
+          , count_(count)
+          , chunk_size_(chunk_size)
+          , num_chunks_((count + chunk_size - 1) / chunk_size)
+          , counts_(num_chunks_)
+        {
+        }
+
+        template <typename Exec>
+        void operator()(Exec& exec)
+        {
+            std::unique_ptr<key_type[]> key_buffer(new key_type[count_]);
+            radix_sort_value_buffer<ValueIter> value_buffer(count_);
+
+            std::array<bool, num_passes> skip_pass = skip_passes(exec);
+
+            bool in_buffer = false;
+            for (std::size_t pass = 0; pass != num_passes; ++pass)
+            {
+                if (skip_pass[pass])
+                    continue;
+
+                unsigned const shift = unsigned(pass * radix_sort_bits);
+                if (in_buffer)
+                {
+                    count_digits(exec, key_buffer.get(), shift);
+                    sort_pass(exec, key_buffer.get(), value_buffer.data(),
+                        keys_, values_, shift);
+                }
+                else
+                {
+                    // the keys were not moved yet, the counts collected
+                    // while checking for passes to skip are still valid
+                    for (std::size_t chunk = 0; chunk != num_chunks_; ++chunk)
+                    {
+                        counts_[chunk] = all_counts_[chunk][pass];
+                    }
+                    sort_pass(exec, keys_, values_, key_buffer.get(),
+                        value_buffer.data(), shift);
+                }
+                in_buffer = !in_buffer;
+            }
+
+            // move the sorted elements back into the input range
+            if (in_buffer)
+            {
+                key_type* keys = key_buffer.get();
+                auto values = value_buffer.data();
+                for_each_chunk(exec, [&](std::size_t first, std::size_t last) {
+                    std::move(keys + first, keys + last, keys_ + first);
+                    radix_sort_move_values(values, first, last, values_);
+                });
+            }
+        }
+
+    private:
+        static std::size_t get_digit(key_type key, unsigned shift) noexcept
+        {
+            return std::size_t(key_traits::to_unsigned(key) >> shift) &
+                (radix_sort_buckets - 1);
+        }
+
+        // invoke the given function concurrently for all chunks
+        template <typename Exec, typename F>
+        void for_each_chunk(Exec& exec, F&& f)
+        {
+            auto shape = hpx::util::make_iterator_range(
+                hpx::util::make_counting_iterator(std::size_t(0)),
+                hpx::util::make_counting_iterator(num_chunks_));
+
+            auto chunks = execution::bulk_async_execute(
+                exec,
+                [&](std::size_t chunk) {
+                    std::size_t first = chunk * chunk_size_;
+                    f(first, (std::min)(first + chunk_size_, count_));
+                },
+                shape);
+
+            // propagate exceptions thrown while moving the values
+            hpx::wait_all(chunks);
+            for (auto& chunk : chunks)
+            {
+                chunk.get();
+            }
+        }
+
+        // Count the occurrences of all bytes of the keys. A pass can be
+        // skipped if all keys have the same value for the corresponding byte.
+        template <typename Exec>
+        std::array<bool, num_passes> skip_passes(Exec& exec)
+        {
+            all_counts_.resize(num_chunks_);
+
+            for_each_chunk(exec, [&](std::size_t first, std::size_t last) {
+                std::array<counts_type, num_passes>& chunk_counts =
+                    all_counts_[first / chunk_size_];
+                for (counts_type& c : chunk_counts)
+                {
+                    c.fill(0);
+                }
+
+                for (std::size_t i = first; i != last; ++i)
+                {
+                    auto key = key_traits::to_unsigned(keys_[i]);
+                    for (std::size_t pass = 0; pass != num_passes; ++pass)
+                    {
+                        ++chunk_counts[pass][std::size_t(
+                                                 key >> (pass *
+                                                     radix_sort_bits)) &
+                            (radix_sort_buckets - 1)];
+                    }
+                }
+            });
+
+            std::array<bool, num_passes> skip_pass;
+            for (std::size_t pass = 0; pass != num_passes; ++pass)
+            {
+                std::size_t const digit =
+                    get_digit(keys_[0], unsigned(pass * radix_sort_bits));
+
+                std::size_t total = 0;
+                for (auto const& chunk_counts : all_counts_)
+                {
+                    total += chunk_counts[pass][digit];
+                }
+                skip_pass[pass] = total == count_;
+            }
+            return skip_pass;
+        }
+
+        // count the elements per bucket for each chunk
+        template <typename Exec, typename KeySrc>
+        void count_digits(Exec& exec, KeySrc keys, unsigned shift)
+        {
+            for_each_chunk(exec, [&](std::size_t first, std::size_t last) {
+                counts_type& counts = counts_[first / chunk_size_];
+                counts.fill(0);
+                for (std::size_t i = first; i != last; ++i)
+                {
+                    ++counts[get_digit(keys[i], shift)];
+                }
+            });
+        }
+
+        // distribute the elements based on the counts for this pass
+        template <typename Exec, typename KeySrc, typename ValueSrc,
+            typename KeyDest, typename ValueDest>
+        void sort_pass(Exec& exec, KeySrc keys, ValueSrc values,
+            KeyDest keys_dest, ValueDest values_dest, unsigned shift)
+        {
+            // turn the counts into the positions the elements of each chunk
+            // are moved to, this keeps the sort stable
+            std::size_t offset = 0;
+            for (std::size_t digit = 0; digit != radix_sort_buckets; ++digit)
+            {
+                for (counts_type& counts : counts_)
+                {
+                    std::size_t const n = counts[digit];
+                    counts[digit] = offset;
+                    offset += n;
+                }
+            }
+            HPX_ASSERT(offset == count_);
+
+            // move the elements of each chunk into their buckets
+            for_each_chunk(exec, [&](std::size_t first, std::size_t last) {
+                counts_type& offsets = counts_[first / chunk_size_];
+                for (std::size_t i = first; i != last; ++i)
+                {
+                    std::size_t const j = offsets[get_digit(keys[i], shift)]++;
+                    keys_dest[j] = keys[i];
+                    radix_sort_move_value(values, i, values_dest, j);
+                }
+            });
+        }
+
+        KeyIter keys_;
+        ValueIter values_;
+        std::size_t count_;
+        std::size_t chunk_size_;
+        std::size_t num_chunks_;
+        std::vector<counts_type> counts_;
+
+        // the counts for all passes, collected before the first pass
+        std::vector<std::array<counts_type, num_passes>> all_counts_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sort the keys in [first, last) and move the values starting at
+    // value_first alongside. Use radix_sort_no_values for sorting keys only.
+    // The sort runs asynchronously on the executor of the given policy, the
+    // returned future becomes ready with the given result once it is done.
+    template <typename ExPolicy, typename KeyIter, typename ValueIter,
+        typename Result>
+    hpx::future<Result> parallel_radix_sort(ExPolicy&& policy, KeyIter first,
+        KeyIter last, ValueIter value_first, Result result)
+    {
+        static_assert(radix_sort_key_traits<typename std::iterator_traits<
+                          KeyIter>::value_type>::is_sortable,
+            "radix sort requires integral or floating point keys");
+
+        std::size_t count = std::distance(first, last);
+        if (count < 2)
+            return hpx::make_ready_future(std::move(result));
+
+        // figure out the chunk size to use
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+
+        std::size_t max_chunks = execution::maximal_number_of_chunks(
+            policy.parameters(), policy.executor(), cores, count);
+
+        std::size_t chunk_size = execution::get_chunk_size(
+            policy.parameters(), policy.executor(),
+            [](std::size_t) { return 0; }, cores, count);
+
+        util::detail::adjust_chunk_size_and_max_chunks(
+            cores, count, max_chunks, chunk_size);
+
+        // we should not get smaller than our radix_sort_limit_per_task
+        chunk_size = (std::max)(chunk_size, radix_sort_limit_per_task);
+
+        using executor_type =
+            typename std::decay<ExPolicy>::type::executor_type;
+
+        return execution::async_execute(policy.executor(),
+            [exec = executor_type(policy.executor()), first, value_first,
+                count, chunk_size,
+                result = std::move(result)]() mutable -> Result {
+                radix_sort_helper<KeyIter, ValueIter> sorter(
+                    first, value_first, count, chunk_size);
+                sorter(exec);
+                return std::move(result);
+            });
+    }
+
+    template <typename ExPolicy, typename RandomIt>
+    hpx::future<RandomIt> parallel_radix_sort(
+        ExPolicy&& policy, RandomIt first, RandomIt last)
+    {
+        if (std::size_t(std::distance(first, last)) <
+            radix_sort_limit_per_task)
+        {
+            // the comparison based sort is faster for small ranges
+            std::sort(first, last);
+            return hpx::make_ready_future(last);
+        }
+
+        return parallel_radix_sort(std::forward<ExPolicy>(policy), first,
+            last, radix_sort_no_values(), last);
+    }
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
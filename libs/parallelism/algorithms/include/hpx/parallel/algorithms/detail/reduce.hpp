@@ -0,0 +1,89 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_fallback_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/accumulate.hpp>
+#include <hpx/parallel/util/loop.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // Sequential reduction of a range or of a partition of a range. This is
+    // a customization point allowing for vectorized implementations to be
+    // provided for the datapar execution policies.
+    template <typename ExPolicy>
+    struct sequential_reduce_t final
+      : hpx::functional::tag_fallback<sequential_reduce_t<ExPolicy>>
+    {
+    private:
+        template <typename InIterB, typename InIterE, typename T,
+            typename Reduce>
+        friend constexpr T tag_fallback_invoke(sequential_reduce_t,
+            InIterB first, InIterE last, T init, Reduce&& r)
+        {
+            return detail::accumulate(
+                first, last, std::move(init), std::forward<Reduce>(r));
+        }
+
+        template <typename FwdIterB, typename T, typename Reduce>
+        friend T tag_fallback_invoke(sequential_reduce_t,
+            FwdIterB part_begin, std::size_t part_size, T init, Reduce&& r)
+        {
+            return util::accumulate_n(part_begin, part_size, std::move(init),
+                std::forward<Reduce>(r));
+        }
+
+        template <typename InIterB, typename InIterE, typename T,
+            typename Reduce, typename Convert>
+        friend constexpr T tag_fallback_invoke(sequential_reduce_t,
+            InIterB first, InIterE last, T init, Reduce&& r, Convert&& conv)
+        {
+            using value_type =
+                typename std::iterator_traits<InIterB>::value_type;
+
+            return detail::accumulate(first, last, std::move(init),
+                [&r, &conv](T const& res, value_type const& next) -> T {
+                    return hpx::util::invoke(
+                        r, res, hpx::util::invoke(conv, next));
+                });
+        }
+
+        template <typename FwdIterB, typename T, typename Reduce,
+            typename Convert>
+        friend T tag_fallback_invoke(sequential_reduce_t,
+            FwdIterB part_begin, std::size_t part_size, T init, Reduce&& r,
+            Convert&& conv)
+        {
+            using reference =
+                typename std::iterator_traits<FwdIterB>::reference;
+
+            return util::accumulate_n(part_begin, part_size, std::move(init),
+                [&r, &conv](T const& res, reference next) -> T {
+                    return hpx::util::invoke(
+                        r, res, hpx::util::invoke(conv, next));
+                });
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_reduce_t<ExPolicy>
+        sequential_reduce = sequential_reduce_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_reduce(Args&&... args)
+    {
+        return sequential_reduce_t<ExPolicy>{}(std::forward<Args>(args)...);
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
@@ -419,7 +419,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static constexpr Iter sequential(ExPolicy, Iter first, Sent last,
                 T const& val, Proj&& proj = Proj())
             {
-                return sequential_find(
+                return sequential_find<ExPolicy>(
                     first, last, val, std::forward<Proj>(proj));
             }
 
@@ -430,7 +430,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 Proj&& proj = Proj())
             {
                 typedef util::detail::algorithm_result<ExPolicy, Iter> result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -443,13 +442,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 auto f1 = [val, proj = std::forward<Proj>(proj), tok](Iter it,
                               std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&val, &proj, &tok](type& v, std::size_t i) -> void {
-                            if (hpx::util::invoke(proj, v) == val)
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    sequential_find<std::decay_t<ExPolicy>>(
+                        base_idx, it, part_size, tok, val, proj);
                 };
 
                 auto f2 =
@@ -516,7 +510,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static constexpr Iter sequential(
                 ExPolicy, Iter first, Sent last, F&& f, Proj&& proj = Proj())
             {
-                return sequential_find_if(
+                return sequential_find_if<ExPolicy>(
                     first, last, std::forward<F>(f), std::forward<Proj>(proj));
             }
 
@@ -527,7 +521,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 Proj&& proj = Proj())
             {
                 typedef util::detail::algorithm_result<ExPolicy, Iter> result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -541,14 +534,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                               proj = std::forward<Proj>(proj),
                               tok](Iter it, std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&f, &proj, &tok](type& v, std::size_t i) -> void {
-                            if (hpx::util::invoke(
-                                    f, hpx::util::invoke(proj, v)))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    sequential_find_if<std::decay_t<ExPolicy>>(
+                        base_idx, it, part_size, tok, f, proj);
                 };
 
                 auto f2 =
@@ -621,7 +608,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static constexpr Iter sequential(
                 ExPolicy, Iter first, Sent last, F&& f, Proj&& proj = Proj())
             {
-                return sequential_find_if_not(
+                return sequential_find_if_not<ExPolicy>(
                     first, last, std::forward<F>(f), std::forward<Proj>(proj));
             }
 
@@ -632,7 +619,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 Proj&& proj = Proj())
             {
                 typedef util::detail::algorithm_result<ExPolicy, Iter> result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -646,14 +632,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                               proj = std::forward<Proj>(proj),
                               tok](Iter it, std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&f, &proj, &tok](type& v, std::size_t i) -> void {
-                            if (!hpx::util::invoke(
-                                    f, hpx::util::invoke(proj, v)))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    sequential_find_if_not<std::decay_t<ExPolicy>>(
+                        base_idx, it, part_size, tok, f, proj);
                 };
 
                 auto f2 =
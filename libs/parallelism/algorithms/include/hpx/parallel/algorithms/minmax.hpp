@@ -21,6 +21,7 @@
 #include <hpx/algorithms/traits/projected.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
 #include <hpx/parallel/tagspec.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -40,27 +41,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // min_element
     namespace detail {
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        FwdIter sequential_min_element(ExPolicy&&, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
-        {
-            if (count == 0 || count == 1)
-                return it;
-
-            FwdIter smallest = it;
-            util::detail::loop_n<std::decay_t<ExPolicy>>(++it, count - 1,
-                [&f, &smallest, &proj](FwdIter const& curr) -> void {
-                    if (hpx::util::invoke(f, hpx::util::invoke(proj, *curr),
-                            hpx::util::invoke(proj, *smallest)))
-                    {
-                        smallest = curr;
-                    }
-                });
-
-            return smallest;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct min_element : public detail::algorithm<min_element<Iter>, Iter>
@@ -80,7 +60,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typename std::iterator_traits<FwdIter>::value_type smallest =
                     *it;
-                util::detail::loop_n<std::decay_t<ExPolicy>>(++it, count - 1,
+                util::detail::loop_n<hpx::execution::sequenced_policy>(++it,
+                    count - 1,
                     [&f, &smallest, &proj](FwdIter const& curr) -> void {
                         if (hpx::util::invoke(f,
                                 hpx::util::invoke(proj, **curr),
@@ -103,9 +84,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static FwdIter sequential(
                 ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
             {
-                return std::min_element(first, last,
-                    util::compare_projected<F, Proj>(
-                        std::forward<F>(f), std::forward<Proj>(proj)));
+                return sequential_min_element<ExPolicy>(first, last,
+                    std::forward<F>(f), std::forward<Proj>(proj));
             }
 
             template <typename ExPolicy, typename FwdIter, typename F,
@@ -123,8 +103,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 auto f1 = [f, proj, policy](
                               FwdIter it, std::size_t part_count) -> FwdIter {
-                    return sequential_min_element(
-                        policy, it, part_count, f, proj);
+                    return sequential_min_element<std::decay_t<ExPolicy>>(
+                        it, part_count, f, proj);
                 };
                 auto f2 = [policy, f = std::forward<F>(f),
                               proj = std::forward<Proj>(proj)](
@@ -253,27 +233,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // max_element
     namespace detail {
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        FwdIter sequential_max_element(ExPolicy&&, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
-        {
-            if (count == 0 || count == 1)
-                return it;
-
-            FwdIter greatest = it;
-            util::detail::loop_n<std::decay_t<ExPolicy>>(++it, count - 1,
-                [&f, &greatest, &proj](FwdIter const& curr) -> void {
-                    if (hpx::util::invoke(f, hpx::util::invoke(proj, *greatest),
-                            hpx::util::invoke(proj, *curr)))
-                    {
-                        greatest = curr;
-                    }
-                });
-
-            return greatest;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct max_element : public detail::algorithm<max_element<Iter>, Iter>
@@ -293,7 +252,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typename std::iterator_traits<FwdIter>::value_type greatest =
                     *it;
-                util::detail::loop_n<std::decay_t<ExPolicy>>(++it, count - 1,
+                util::detail::loop_n<hpx::execution::sequenced_policy>(++it,
+                    count - 1,
                     [&f, &greatest, &proj](FwdIter const& curr) -> void {
                         if (hpx::util::invoke(f,
                                 hpx::util::invoke(proj, *greatest),
@@ -316,9 +276,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static FwdIter sequential(
                 ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
             {
-                return std::max_element(first, last,
-                    util::compare_projected<F, Proj>(
-                        std::forward<F>(f), std::forward<Proj>(proj)));
+                return sequential_max_element<ExPolicy>(first, last,
+                    std::forward<F>(f), std::forward<Proj>(proj));
             }
 
             template <typename ExPolicy, typename FwdIter, typename F,
@@ -336,8 +295,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 auto f1 = [f, proj, policy](
                               FwdIter it, std::size_t part_count) -> FwdIter {
-                    return sequential_max_element(
-                        policy, it, part_count, f, proj);
+                    return sequential_max_element<std::decay_t<ExPolicy>>(
+                        it, part_count, f, proj);
                 };
                 auto f2 = [policy, f = std::forward<F>(f),
                               proj = std::forward<Proj>(proj)](
@@ -467,34 +426,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // minmax_element
     namespace detail {
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        std::pair<FwdIter, FwdIter> sequential_minmax_element(ExPolicy&&,
-            FwdIter it, std::size_t count, F const& f, Proj const& proj)
-        {
-            std::pair<FwdIter, FwdIter> result(it, it);
-
-            if (count == 0 || count == 1)
-                return result;
-
-            util::detail::loop_n<std::decay_t<ExPolicy>>(++it, count - 1,
-                [&f, &result, &proj](FwdIter const& curr) -> void {
-                    if (hpx::util::invoke(f, hpx::util::invoke(proj, *curr),
-                            hpx::util::invoke(proj, *result.first)))
-                    {
-                        result.first = curr;
-                    }
-
-                    if (!hpx::util::invoke(f, hpx::util::invoke(proj, *curr),
-                            hpx::util::invoke(proj, *result.second)))
-                    {
-                        result.second = curr;
-                    }
-                });
-
-            return result;
-        }
-
         template <typename Iter>
         struct minmax_element
           : public detail::algorithm<minmax_element<Iter>,
@@ -515,7 +446,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typename std::iterator_traits<PairIter>::value_type result =
                     *it;
-                util::detail::loop_n<std::decay_t<ExPolicy>>(++it, count - 1,
+                util::detail::loop_n<hpx::execution::sequenced_policy>(++it,
+                    count - 1,
                     [&f, &result, &proj](PairIter const& curr) -> void {
                         if (hpx::util::invoke(f,
                                 hpx::util::invoke(proj, *curr->first),
@@ -545,9 +477,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static std::pair<FwdIter, FwdIter> sequential(
                 ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
             {
-                return std::minmax_element(first, last,
-                    util::compare_projected<F, Proj>(
-                        std::forward<F>(f), std::forward<Proj>(proj)));
+                return sequential_minmax_element<ExPolicy>(first, last,
+                    std::forward<F>(f), std::forward<Proj>(proj));
             }
 
             template <typename ExPolicy, typename FwdIter, typename F,
@@ -569,8 +500,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 auto f1 =
                     [f, proj, policy](FwdIter it,
                         std::size_t part_count) -> std::pair<FwdIter, FwdIter> {
-                    return sequential_minmax_element(
-                        policy, it, part_count, f, proj);
+                    return sequential_minmax_element<std::decay_t<ExPolicy>>(
+                        it, part_count, f, proj);
                 };
                 auto f2 =
                     [policy, f = std::forward<F>(f),
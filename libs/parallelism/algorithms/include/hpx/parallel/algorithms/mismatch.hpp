@@ -182,6 +182,7 @@ namespace hpx {
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/mismatch.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
@@ -200,22 +201,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // mismatch (binary)
     namespace detail {
 
-        ///////////////////////////////////////////////////////////////////////
-        template <typename Iter1, typename Sent1, typename Iter2,
-            typename Sent2, typename F, typename Proj1, typename Proj2>
-        util::in_in_result<Iter1, Iter2> sequential_mismatch_binary(
-            Iter1 first1, Sent1 last1, Iter2 first2, Sent2 last2, F&& f,
-            Proj1&& proj1, Proj2&& proj2)
-        {
-            while (first1 != last1 && first2 != last2 &&
-                hpx::util::invoke(f, hpx::util::invoke(proj1, *first1),
-                    hpx::util::invoke(proj2, *first2)))
-            {
-                ++first1, ++first2;
-            }
-            return {first1, first2};
-        }
-
         template <typename IterPair>
         struct mismatch_binary
           : public detail::algorithm<mismatch_binary<IterPair>, IterPair>
@@ -232,9 +217,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 Iter1 first1, Sent1 last1, Iter2 first2, Sent2 last2, F&& f,
                 Proj1&& proj1, Proj2&& proj2)
             {
-                return sequential_mismatch_binary(first1, last1, first2, last2,
-                    std::forward<F>(f), std::forward<Proj1>(proj1),
-                    std::forward<Proj2>(proj2));
+                return sequential_mismatch_binary<ExPolicy>(first1, last1,
+                    first2, last2, std::forward<F>(f),
+                    std::forward<Proj1>(proj1), std::forward<Proj2>(proj2));
             }
 
             template <typename ExPolicy, typename Iter1, typename Sent1,
@@ -274,7 +259,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
 
                 typedef hpx::util::zip_iterator<Iter1, Iter2> zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<std::size_t> tok(count1);
 
@@ -283,15 +267,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                               proj2 = std::forward<Proj2>(proj2)](
                               zip_iterator it, std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&f, &proj1, &proj2, &tok](reference t, std::size_t i) {
-                            if (!hpx::util::invoke(f,
-                                    hpx::util::invoke(proj1, hpx::get<0>(t)),
-                                    hpx::util::invoke(proj2, hpx::get<1>(t))))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    sequential_mismatch_binary<std::decay_t<ExPolicy>>(
+                        base_idx, it, part_count, tok, f, proj1, proj2);
                 };
 
                 auto f2 = [=](std::vector<hpx::future<void>>&&) mutable
@@ -392,7 +369,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static IterPair sequential(
                 ExPolicy, InIter1 first1, InIter1 last1, InIter2 first2, F&& f)
             {
-                return std::mismatch(first1, last1, first2, std::forward<F>(f));
+                return sequential_mismatch<ExPolicy>(
+                    first1, last1, first2, std::forward<F>(f));
             }
 
             template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
@@ -414,21 +392,14 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
                     zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<std::size_t> tok(count);
 
                 auto f1 = [tok, f = std::forward<F>(f)](zip_iterator it,
                               std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&f, &tok](reference t, std::size_t i) {
-                            if (!hpx::util::invoke(
-                                    f, hpx::get<0>(t), hpx::get<1>(t)))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    sequential_mismatch<std::decay_t<ExPolicy>>(
+                        base_idx, it, part_count, tok, f);
                 };
                 auto f2 = [=](std::vector<hpx::future<void>>&&) mutable
                     -> std::pair<FwdIter1, FwdIter2> {
@@ -0,0 +1,379 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/nth_element.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx {
+
+    /// nth_element is a partial sorting algorithm that rearranges elements in
+    /// [first, last) such that the element pointed at by nth is changed to
+    /// whatever element would occur in that position if [first, last) were
+    /// sorted and all of the elements before this new nth element are less
+    /// than or equal to the elements after the new nth element.
+    ///
+    /// \note   Complexity: Linear in std::distance(first, last) on average.
+    ///
+    /// \tparam RandomIt    The type of the source begin, nth, and end
+    ///                     iterators used (deduced). This iterator type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam Pred        Comparison function object which returns true if
+    ///                     the first argument is less than the second.
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param nth          Refers to the iterator defining the sort partition
+    ///                     point
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param pred         Specifies the comparison function object which
+    ///                     returns true if the first argument is less than
+    ///                     (i.e. is ordered before) the second.
+    ///                     The signature of this comparison function should be
+    ///                     equivalent to:
+    ///                     \code
+    ///                     bool cmp(const Type1 &a, const Type2 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The type \a Type1 and \a Type2 must be such that
+    ///                     an object of type \a RandomIt can be dereferenced
+    ///                     and then implicitly converted to both \a Type1 and
+    ///                     \a Type2. This defaults to std::less<>.
+    ///
+    /// The comparison operations in the parallel \a nth_element
+    /// algorithm invoked without an execution policy object execute in
+    /// sequential order in the calling thread.
+    ///
+    /// \returns  The \a nth_element algorithm returns nothing.
+    ///
+    template <typename RandomIt,
+        typename Pred = hpx::parallel::v1::detail::less>
+    void nth_element(
+        RandomIt first, RandomIt nth, RandomIt last, Pred&& pred = Pred());
+
+    /// nth_element is a partial sorting algorithm that rearranges elements in
+    /// [first, last) such that the element pointed at by nth is changed to
+    /// whatever element would occur in that position if [first, last) were
+    /// sorted and all of the elements before this new nth element are less
+    /// than or equal to the elements after the new nth element.
+    ///
+    /// \note   Complexity: Linear in std::distance(first, last) on average.
+    ///         The parallel version repeatedly partitions the range in
+    ///         parallel around a pivot sampled from the range, the remaining
+    ///         (small) range is handled sequentially.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandomIt    The type of the source begin, nth, and end
+    ///                     iterators used (deduced). This iterator type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam Pred        Comparison function object which returns true if
+    ///                     the first argument is less than the second.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param nth          Refers to the iterator defining the sort partition
+    ///                     point
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param pred         Specifies the comparison function object which
+    ///                     returns true if the first argument is less than
+    ///                     (i.e. is ordered before) the second.
+    ///                     This defaults to std::less<>.
+    ///
+    /// The comparison operations in the parallel \a nth_element invoked
+    /// with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The comparison operations in the parallel \a nth_element invoked
+    /// with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a nth_element algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns void otherwise.
+    ///
+    template <typename ExPolicy, typename RandomIt,
+        typename Pred = hpx::parallel::v1::detail::less>
+    typename util::detail::algorithm_result<ExPolicy>::type nth_element(
+        ExPolicy&& policy, RandomIt first, RandomIt nth, RandomIt last,
+        Pred&& pred = Pred());
+
+}    // namespace hpx
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_fallback_invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/partial_sort.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // nth_element
+    namespace detail {
+
+        /// \cond NOINTERNAL
+
+        // Ranges smaller than this are handled by std::nth_element
+        constexpr std::size_t nth_element_limit_per_task = 65536;
+
+        ///////////////////////////////////////////////////////////////////////
+        // Introselect: partition the range in parallel around the median of
+        // nine samples until the remaining range containing nth is small
+        // enough. Falls back to the sequential algorithm (which guarantees
+        // the overall complexity) if the partitioning makes no progress.
+        template <typename ExPolicy, typename RandomIt, typename Comp>
+        void parallel_nth_element(ExPolicy&& policy, RandomIt first,
+            RandomIt nth, RandomIt last, Comp&& comp)
+        {
+            using value_type =
+                typename std::iterator_traits<RandomIt>::value_type;
+
+            if (first == last || nth == last)
+            {
+                return;
+            }
+
+            std::uint32_t level = nbits64(last - first) * 2;
+            while (std::size_t(last - first) > nth_element_limit_per_task &&
+                level-- != 0)
+            {
+                std::size_t chunk = (last - first) >> 3;
+                value_type const pivot = *mid9(first + 1, first + chunk,
+                    first + 2 * chunk, first + 3 * chunk, first + 4 * chunk,
+                    first + 5 * chunk, first + 6 * chunk, first + 7 * chunk,
+                    last - 1, comp);
+
+                // move all elements less than the pivot to the front
+                RandomIt middle = partition_helper::call(
+                    policy, first, last,
+                    [&comp, &pivot](value_type const& v) -> bool {
+                        return HPX_INVOKE(comp, v, pivot);
+                    },
+                    util::projection_identity());
+
+                if (nth < middle)
+                {
+                    last = middle;
+                    continue;
+                }
+
+                if (middle == first)
+                {
+                    // the pivot is the smallest element, move all elements
+                    // equivalent to it to the front
+                    middle = partition_helper::call(
+                        policy, first, last,
+                        [&comp, &pivot](value_type const& v) -> bool {
+                            return !HPX_INVOKE(comp, pivot, v);
+                        },
+                        util::projection_identity());
+
+                    if (nth < middle)
+                    {
+                        return;
+                    }
+                }
+
+                first = middle;
+            }
+
+            std::nth_element(first, nth, last, std::forward<Comp>(comp));
+        }
+
+        template <typename Iter>
+        struct nth_element
+          : public detail::algorithm<nth_element<Iter>, Iter>
+        {
+            nth_element()
+              : nth_element::algorithm("nth_element")
+            {
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Sent,
+                typename Comp, typename Proj>
+            static RandomIt sequential(ExPolicy, RandomIt first, RandomIt nth,
+                Sent last, Comp&& comp, Proj&& proj)
+            {
+                RandomIt end = detail::advance_to_sentinel(first, last);
+                std::nth_element(first, nth, end,
+                    util::compare_projected<Comp, Proj>(
+                        std::forward<Comp>(comp), std::forward<Proj>(proj)));
+                return end;
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Sent,
+                typename Comp, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            nth_element_thread(ExPolicy&& policy, RandomIt first, RandomIt nth,
+                Sent last, Comp&& comp, Proj&& proj)
+            {
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, RandomIt>;
+
+                RandomIt end = detail::advance_to_sentinel(first, last);
+                try
+                {
+                    parallel_nth_element(policy, first, nth, end,
+                        util::compare_projected<Comp, Proj>(
+                            std::forward<Comp>(comp),
+                            std::forward<Proj>(proj)));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+                return algorithm_result::get(std::move(end));
+            }
+
+            // synchronous policies run the algorithm on the calling thread
+            template <typename ExPolicy, typename RandomIt, typename Sent,
+                typename Comp, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            nth_element_async(std::false_type, ExPolicy&& policy,
+                RandomIt first, RandomIt nth, Sent last, Comp&& comp,
+                Proj&& proj)
+            {
+                return nth_element_thread(std::forward<ExPolicy>(policy), first,
+                    nth, last, std::forward<Comp>(comp),
+                    std::forward<Proj>(proj));
+            }
+
+            // asynchronous policies run it on the executor of the policy
+            template <typename ExPolicy, typename RandomIt, typename Sent,
+                typename Comp, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            nth_element_async(std::true_type, ExPolicy&& policy,
+                RandomIt first, RandomIt nth, Sent last, Comp&& comp,
+                Proj&& proj)
+            {
+                return execution::async_execute(policy.executor(),
+                    [=, comp = std::forward<Comp>(comp),
+                        proj = std::forward<Proj>(proj)]() mutable {
+                        return nth_element_thread(policy, first, nth, last,
+                            std::forward<Comp>(comp), std::forward<Proj>(proj));
+                    });
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Sent,
+                typename Comp, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt nth, Sent last,
+                Comp&& comp, Proj&& proj)
+            {
+                using is_async = std::integral_constant<bool,
+                    hpx::is_async_execution_policy_v<std::decay_t<ExPolicy>>>;
+
+                return nth_element_async(is_async(),
+                    std::forward<ExPolicy>(policy), first, nth, last,
+                    std::forward<Comp>(comp), std::forward<Proj>(proj));
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::nth_element
+    HPX_INLINE_CONSTEXPR_VARIABLE struct nth_element_t final
+      : hpx::functional::tag_fallback<nth_element_t>
+    {
+    private:
+        // clang-format off
+        template <typename RandomIt,
+            typename Pred = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator<RandomIt>::value &&
+                hpx::is_invocable_v<Pred,
+                    typename std::iterator_traits<RandomIt>::value_type,
+                    typename std::iterator_traits<RandomIt>::value_type
+                >
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(nth_element_t, RandomIt first,
+            RandomIt nth, RandomIt last, Pred&& pred = Pred())
+        {
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandomIt>::value,
+                "Requires at least random access iterator.");
+
+            hpx::parallel::v1::detail::nth_element<RandomIt>().call(
+                hpx::execution::seq, first, nth, last, std::forward<Pred>(pred),
+                hpx::parallel::util::projection_identity{});
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandomIt,
+            typename Pred = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator<RandomIt>::value &&
+                hpx::is_invocable_v<Pred,
+                    typename std::iterator_traits<RandomIt>::value_type,
+                    typename std::iterator_traits<RandomIt>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<
+            ExPolicy>::type
+        tag_fallback_invoke(nth_element_t, ExPolicy&& policy, RandomIt first,
+            RandomIt nth, RandomIt last, Pred&& pred = Pred())
+        {
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandomIt>::value,
+                "Requires at least random access iterator.");
+
+            return hpx::parallel::util::detail::algorithm_result<ExPolicy>::get(
+                hpx::parallel::v1::detail::nth_element<RandomIt>().call(
+                    std::forward<ExPolicy>(policy), first, nth, last,
+                    std::forward<Pred>(pred),
+                    hpx::parallel::util::projection_identity{}));
+        }
+    } nth_element{};
+}    // namespace hpx
+
+#endif    // DOXYGEN
@@ -0,0 +1,454 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/partial_sort_copy.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx {
+
+    /// Sorts some of the elements in the range [first, last) in ascending
+    /// order, storing the result in the range [d_first, d_last). At most
+    /// d_last - d_first of the elements are placed sorted to the range
+    /// [d_first, d_first + n) where n is the number of elements to sort
+    /// (n = min(last - first, d_last - d_first)). The order of equal elements
+    /// is not guaranteed to be preserved.
+    ///
+    /// \note   Complexity: O(N log(min(D,N))), where N =
+    ///         std::distance(first, last) and D = std::distance(d_first,
+    ///         d_last) comparisons.
+    ///
+    /// \tparam InIter      The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of
+    ///                     an input iterator.
+    /// \tparam RandIter    The type of the destination iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param d_first      Refers to the beginning of the destination range.
+    /// \param d_last       Refers to the end of the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator. This defaults to std::less<>.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a \a RandIter
+    ///           referring to the element defining the upper boundary of the
+    ///           sorted range, i.e. d_first + min(last - first,
+    ///           d_last - d_first).
+    ///
+    template <typename InIter, typename RandIter,
+        typename Comp = hpx::parallel::v1::detail::less>
+    RandIter partial_sort_copy(InIter first, InIter last, RandIter d_first,
+        RandIter d_last, Comp&& comp = Comp());
+
+    /// Sorts some of the elements in the range [first, last) in ascending
+    /// order, storing the result in the range [d_first, d_last). At most
+    /// d_last - d_first of the elements are placed sorted to the range
+    /// [d_first, d_first + n) where n is the number of elements to sort
+    /// (n = min(last - first, d_last - d_first)). The order of equal elements
+    /// is not guaranteed to be preserved.
+    ///
+    /// \note   Complexity: O(N log(min(D,N))), where N =
+    ///         std::distance(first, last) and D = std::distance(d_first,
+    ///         d_last) comparisons. The parallel version selects the
+    ///         candidates for the result from separate chunks of the input
+    ///         range concurrently and sorts the selected elements in parallel.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of
+    ///                     a forward iterator.
+    /// \tparam RandIter    The type of the destination iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param d_first      Refers to the beginning of the destination range.
+    /// \param d_last       Refers to the end of the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. This defaults to
+    ///                     std::less<>.
+    ///
+    /// The comparison operations in the parallel \a partial_sort_copy
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the calling thread.
+    ///
+    /// The comparison operations in the parallel \a partial_sort_copy
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<RandIter> if the execution policy is of
+    ///           type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandIter otherwise.
+    ///           The iterator returned refers to the element defining the
+    ///           upper boundary of the sorted range, i.e. d_first +
+    ///           min(last - first, d_last - d_first).
+    ///
+    template <typename ExPolicy, typename FwdIter, typename RandIter,
+        typename Comp = hpx::parallel::v1::detail::less>
+    typename util::detail::algorithm_result<ExPolicy, RandIter>::type
+    partial_sort_copy(ExPolicy&& policy, FwdIter first, FwdIter last,
+        RandIter d_first, RandIter d_last, Comp&& comp = Comp());
+
+}    // namespace hpx
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/tag_fallback_invoke.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort_copy
+    namespace detail {
+
+        /// \cond NOINTERNAL
+
+        // Input ranges smaller than this are handled by
+        // std::partial_sort_copy
+        constexpr std::size_t partial_sort_copy_limit_per_task = 65536;
+
+        ///////////////////////////////////////////////////////////////////////
+        // Each chunk of the input range selects (at most) the count smallest
+        // of its elements concurrently. The overall count smallest elements
+        // are then selected from those candidates and sorted in place in the
+        // destination range.
+        template <typename ExPolicy, typename FwdIter, typename RandomIt,
+            typename Comp>
+        RandomIt parallel_partial_sort_copy(ExPolicy&& policy, FwdIter first,
+            FwdIter last, RandomIt d_first, RandomIt d_last, Comp&& comp)
+        {
+            using value_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+            using candidates_type = std::vector<value_type>;
+
+            std::size_t const size = std::distance(first, last);
+            std::size_t const count =
+                (std::min)(size, std::size_t(d_last - d_first));
+            if (count == 0)
+            {
+                return d_first;
+            }
+
+            if (size < partial_sort_copy_limit_per_task)
+            {
+                return std::partial_sort_copy(
+                    first, last, d_first, d_last, std::forward<Comp>(comp));
+            }
+
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+
+            // there is no benefit in creating chunks smaller than count
+            std::size_t const chunk_size =
+                (std::max)((size + cores - 1) / cores, count);
+
+            std::vector<hpx::future<candidates_type>> workitems;
+            workitems.reserve(size / chunk_size + 1);
+
+            std::list<std::exception_ptr> errors;
+            try
+            {
+                for (std::size_t pos = 0; pos < size; pos += chunk_size)
+                {
+                    FwdIter chunk_first = first;
+                    std::advance(first, (std::min)(chunk_size, size - pos));
+
+                    workitems.push_back(execution::async_execute(
+                        policy.executor(),
+                        [chunk_first, chunk_last = first, count,
+                            comp]() mutable -> candidates_type {
+                            candidates_type candidates(chunk_first, chunk_last);
+                            if (candidates.size() > count)
+                            {
+                                std::nth_element(candidates.begin(),
+                                    candidates.begin() + count,
+                                    candidates.end(), comp);
+                                candidates.erase(
+                                    candidates.begin() + count,
+                                    candidates.end());
+                            }
+                            return candidates;
+                        }));
+                }
+
+                hpx::wait_all(workitems);
+            }
+            catch (...)
+            {
+                util::detail::handle_local_exceptions<ExPolicy>::call(
+                    std::current_exception(), errors);
+            }
+
+            // rethrow exceptions, if any
+            util::detail::handle_local_exceptions<ExPolicy>::call(
+                workitems, errors);
+
+            candidates_type candidates;
+            candidates.reserve(workitems.size() * count);
+            for (auto&& f : workitems)
+            {
+                candidates_type chunk_candidates = f.get();
+                std::move(chunk_candidates.begin(), chunk_candidates.end(),
+                    std::back_inserter(candidates));
+            }
+
+            parallel_nth_element(policy, candidates.begin(),
+                candidates.begin() + count, candidates.end(), comp);
+
+            RandomIt d_end = std::move(
+                candidates.begin(), candidates.begin() + count, d_first);
+
+            parallel_sort_async(std::forward<ExPolicy>(policy), d_first, d_end,
+                std::forward<Comp>(comp))
+                .get();
+            return d_end;
+        }
+
+        template <typename IterPair>
+        struct partial_sort_copy
+          : public detail::algorithm<partial_sort_copy<IterPair>, IterPair>
+        {
+            partial_sort_copy()
+              : partial_sort_copy::algorithm("partial_sort_copy")
+            {
+            }
+
+            template <typename ExPolicy, typename InIter, typename Sent1,
+                typename RandomIt, typename Sent2, typename Comp,
+                typename Proj>
+            static util::in_out_result<InIter, RandomIt> sequential(ExPolicy,
+                InIter first, Sent1 last, RandomIt d_first, Sent2 d_last,
+                Comp&& comp, Proj&& proj)
+            {
+                InIter end = detail::advance_to_sentinel(first, last);
+                RandomIt d_end = std::partial_sort_copy(first, end, d_first,
+                    detail::advance_to_sentinel(d_first, d_last),
+                    util::compare_projected<Comp, Proj>(
+                        std::forward<Comp>(comp), std::forward<Proj>(proj)));
+                return util::in_out_result<InIter, RandomIt>{end, d_end};
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Sent1,
+                typename RandomIt, typename Sent2, typename Comp,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                util::in_out_result<FwdIter, RandomIt>>::type
+            partial_sort_copy_thread(ExPolicy&& policy, FwdIter first,
+                Sent1 last, RandomIt d_first, Sent2 d_last, Comp&& comp,
+                Proj&& proj)
+            {
+                using result_type = util::in_out_result<FwdIter, RandomIt>;
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, result_type>;
+
+                FwdIter end = detail::advance_to_sentinel(first, last);
+                try
+                {
+                    RandomIt d_end = parallel_partial_sort_copy(policy, first,
+                        end, d_first,
+                        detail::advance_to_sentinel(d_first, d_last),
+                        util::compare_projected<Comp, Proj>(
+                            std::forward<Comp>(comp),
+                            std::forward<Proj>(proj)));
+
+                    return algorithm_result::get(result_type{end, d_end});
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, result_type>::call(
+                            std::current_exception()));
+                }
+            }
+
+            // synchronous policies run the algorithm on the calling thread
+            template <typename ExPolicy, typename FwdIter, typename Sent1,
+                typename RandomIt, typename Sent2, typename Comp,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                util::in_out_result<FwdIter, RandomIt>>::type
+            partial_sort_copy_async(std::false_type, ExPolicy&& policy,
+                FwdIter first, Sent1 last, RandomIt d_first, Sent2 d_last,
+                Comp&& comp, Proj&& proj)
+            {
+                return partial_sort_copy_thread(std::forward<ExPolicy>(policy),
+                    first, last, d_first, d_last, std::forward<Comp>(comp),
+                    std::forward<Proj>(proj));
+            }
+
+            // asynchronous policies run it on the executor of the policy
+            template <typename ExPolicy, typename FwdIter, typename Sent1,
+                typename RandomIt, typename Sent2, typename Comp,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                util::in_out_result<FwdIter, RandomIt>>::type
+            partial_sort_copy_async(std::true_type, ExPolicy&& policy,
+                FwdIter first, Sent1 last, RandomIt d_first, Sent2 d_last,
+                Comp&& comp, Proj&& proj)
+            {
+                return execution::async_execute(policy.executor(),
+                    [=, comp = std::forward<Comp>(comp),
+                        proj = std::forward<Proj>(proj)]() mutable {
+                        return partial_sort_copy_thread(policy, first, last,
+                            d_first, d_last, std::forward<Comp>(comp),
+                            std::forward<Proj>(proj));
+                    });
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Sent1,
+                typename RandomIt, typename Sent2, typename Comp,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                util::in_out_result<FwdIter, RandomIt>>::type
+            parallel(ExPolicy&& policy, FwdIter first, Sent1 last,
+                RandomIt d_first, Sent2 d_last, Comp&& comp, Proj&& proj)
+            {
+                using is_async = std::integral_constant<bool,
+                    hpx::is_async_execution_policy_v<std::decay_t<ExPolicy>>>;
+
+                return partial_sort_copy_async(is_async(),
+                    std::forward<ExPolicy>(policy), first, last, d_first,
+                    d_last, std::forward<Comp>(comp), std::forward<Proj>(proj));
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::partial_sort_copy
+    HPX_INLINE_CONSTEXPR_VARIABLE struct partial_sort_copy_t final
+      : hpx::functional::tag_fallback<partial_sort_copy_t>
+    {
+    private:
+        // clang-format off
+        template <typename InIter, typename RandIter,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator<InIter>::value &&
+                hpx::traits::is_iterator<RandIter>::value &&
+                hpx::is_invocable_v<Comp,
+                    typename std::iterator_traits<InIter>::value_type,
+                    typename std::iterator_traits<InIter>::value_type
+                >
+            )>
+        // clang-format on
+        friend RandIter tag_fallback_invoke(partial_sort_copy_t, InIter first,
+            InIter last, RandIter d_first, RandIter d_last,
+            Comp&& comp = Comp())
+        {
+            static_assert(hpx::traits::is_input_iterator<InIter>::value,
+                "Requires at least input iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandIter>::value,
+                "Requires at least random access iterator.");
+
+            using result_type =
+                hpx::parallel::util::in_out_result<InIter, RandIter>;
+
+            return hpx::parallel::util::get_second_element(
+                hpx::parallel::v1::detail::partial_sort_copy<result_type>()
+                    .call(hpx::execution::seq, first, last, d_first, d_last,
+                        std::forward<Comp>(comp),
+                        hpx::parallel::util::projection_identity{}));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename RandIter,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator<FwdIter>::value &&
+                hpx::traits::is_iterator<RandIter>::value &&
+                hpx::is_invocable_v<Comp,
+                    typename std::iterator_traits<FwdIter>::value_type,
+                    typename std::iterator_traits<FwdIter>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            RandIter>::type
+        tag_fallback_invoke(partial_sort_copy_t, ExPolicy&& policy,
+            FwdIter first, FwdIter last, RandIter d_first, RandIter d_last,
+            Comp&& comp = Comp())
+        {
+            static_assert(hpx::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandIter>::value,
+                "Requires at least random access iterator.");
+
+            using result_type =
+                hpx::parallel::util::in_out_result<FwdIter, RandIter>;
+
+            return hpx::parallel::util::get_second_element(
+                hpx::parallel::v1::detail::partial_sort_copy<result_type>()
+                    .call(std::forward<ExPolicy>(policy), first, last, d_first,
+                        d_last, std::forward<Comp>(comp),
+                        hpx::parallel::util::projection_identity{}));
+        }
+    } partial_sort_copy{};
+}    // namespace hpx
+
+#endif    // DOXYGEN
@@ -0,0 +1,191 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/radix_sort.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/util/tagged_pair.hpp>
+
+#include <hpx/executors/exception_list.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/tagspec.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/zip_iterator.hpp>
+
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    /// Sorts the integral or floating point values in the range [first, last)
+    /// in ascending order using a least significant digit radix sort. The
+    /// result is the same as the result of \a sort using the default
+    /// comparison operator<(). The sort is stable.
+    ///
+    /// \note   Complexity: O(N * sizeof(value_type)), where
+    ///                     N = std::distance(first, last). Passes over the
+    ///                     range for bytes which are the same for all values
+    ///                     are skipped.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator. Its value type must be an
+    ///                     integral (but not bool) or floating point type.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    ///
+    /// The algorithm needs a temporary buffer of the size of the input range.
+    ///
+    /// \returns  The \a radix_sort algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    // clang-format off
+    template <typename ExPolicy, typename RandomIt,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_iterator<RandomIt>::value
+        )>
+    // clang-format on
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    radix_sort(ExPolicy&& policy, RandomIt first, RandomIt last)
+    {
+        static_assert((hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+        using value_type = typename std::iterator_traits<RandomIt>::value_type;
+        static_assert(detail::radix_sort_key_traits<value_type>::is_sortable,
+            "Requires integral or floating point values.");
+
+        using algorithm_result =
+            util::detail::algorithm_result<ExPolicy, RandomIt>;
+
+        try
+        {
+            return algorithm_result::get(
+                detail::parallel_radix_sort(std::forward<ExPolicy>(policy),
+                    first, last, detail::radix_sort_no_values(), last));
+        }
+        catch (...)
+        {
+            return algorithm_result::get(
+                detail::handle_exception<ExPolicy, RandomIt>::call(
+                    std::current_exception()));
+        }
+    }
+
+    /// Sorts one range of data using the integral or floating point keys
+    /// supplied in another range. The key elements in the range
+    /// [key_first, key_last) are sorted in ascending order using a least
+    /// significant digit radix sort, with the corresponding elements in the
+    /// value range moved to follow the sorted order. The result is the same
+    /// as the result of \a sort_by_key using the default comparison
+    /// operator<(). The sort is stable.
+    ///
+    /// \note   Complexity: O(N * sizeof(key_type)), where
+    ///                     N = std::distance(key_first, key_last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam KeyIter     The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator. Its value type must be an
+    ///                     integral (but not bool) or floating point type.
+    /// \tparam ValueIter   The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator. Its value type must be
+    ///                     default constructible and move assignable.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of key
+    ///                     elements the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements
+    ///                     the algorithm will be applied to.
+    /// \param value_first  Refers to the beginning of the sequence of value
+    ///                     elements the algorithm will be applied to, the range
+    ///                     of elements must match [key_first, key_last)
+    ///
+    /// The algorithm needs temporary buffers of the size of the input ranges.
+    ///
+    /// \returns  The \a radix_sort_by_key algorithm returns a
+    /// \a hpx::future<tagged_pair<tag::in1(KeyIter>, tag::in2(ValueIter)> >
+    ///           if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a
+    ///           \a tagged_pair<tag::in1(KeyIter), tag::in2(ValueIter)>
+    ///           otherwise.
+    ///           The algorithm returns a pair holding an iterator pointing to
+    ///           the first element after the last element in the input key
+    ///           sequence and an iterator pointing to the first element after
+    ///           the last element in the input value sequence.
+    // clang-format off
+    template <typename ExPolicy, typename KeyIter, typename ValueIter,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_iterator<KeyIter>::value &&
+            hpx::traits::is_iterator<ValueIter>::value
+        )>
+    // clang-format on
+    typename util::detail::algorithm_result<ExPolicy,
+        hpx::util::tagged_pair<tag::in1(KeyIter), tag::in2(ValueIter)>>::type
+    radix_sort_by_key(ExPolicy&& policy, KeyIter key_first, KeyIter key_last,
+        ValueIter value_first)
+    {
+        static_assert((hpx::traits::is_random_access_iterator<KeyIter>::value),
+            "Requires a random access iterator.");
+        static_assert(
+            (hpx::traits::is_random_access_iterator<ValueIter>::value),
+            "Requires a random access iterator.");
+        using value_type = typename std::iterator_traits<KeyIter>::value_type;
+        static_assert(detail::radix_sort_key_traits<value_type>::is_sortable,
+            "Requires integral or floating point keys.");
+
+        using zip_iterator = hpx::util::zip_iterator<KeyIter, ValueIter>;
+        using algorithm_result =
+            util::detail::algorithm_result<ExPolicy, zip_iterator>;
+
+        ValueIter value_last = value_first;
+        std::advance(value_last, std::distance(key_first, key_last));
+
+        try
+        {
+            return detail::get_iter_tagged_pair<tag::in1, tag::in2>(
+                algorithm_result::get(detail::parallel_radix_sort(
+                    std::forward<ExPolicy>(policy), key_first, key_last,
+                    value_first,
+                    hpx::util::make_zip_iterator(key_last, value_last))));
+        }
+        catch (...)
+        {
+            return detail::get_iter_tagged_pair<tag::in1, tag::in2>(
+                algorithm_result::get(
+                    detail::handle_exception<ExPolicy, zip_iterator>::call(
+                        std::current_exception())));
+        }
+    }
+}}}    // namespace hpx::parallel::v1
@@ -221,9 +221,9 @@ namespace hpx {
 #include <hpx/pack_traversal/unwrap.hpp>
 
 #include <hpx/executors/execution_policy.hpp>
-#include <hpx/parallel/algorithms/detail/accumulate.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
@@ -254,8 +254,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static T sequential(
                 ExPolicy, InIterB first, InIterE last, T_&& init, Reduce&& r)
             {
-                return detail::accumulate(first, last, std::forward<T_>(init),
-                    std::forward<Reduce>(r));
+                return detail::sequential_reduce<ExPolicy>(first, last,
+                    std::forward<T_>(init), std::forward<Reduce>(r));
             }
 
             template <typename ExPolicy, typename FwdIterB, typename FwdIterE,
@@ -272,7 +272,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 auto f1 = [r](FwdIterB part_begin, std::size_t part_size) -> T {
                     T val = *part_begin;
-                    return util::accumulate_n(
+                    return detail::sequential_reduce<ExPolicy>(
                         ++part_begin, --part_size, std::move(val), r);
                 };
 
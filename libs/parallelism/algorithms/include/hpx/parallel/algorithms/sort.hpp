@@ -25,6 +25,7 @@
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -247,6 +248,30 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 std::forward<Comp>(comp), chunk_size);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // arithmetic values sorted using the default comparison are sorted
+        // using the radix sort
+        template <typename ExPolicy, typename RandomIt, typename Comp,
+            typename Proj>
+        hpx::future<RandomIt> parallel_sort_dispatch(std::false_type,
+            ExPolicy&& policy, RandomIt first, RandomIt last, Comp&& comp,
+            Proj&& proj)
+        {
+            return parallel_sort_async(std::forward<ExPolicy>(policy), first,
+                last,
+                util::compare_projected<Comp, Proj>(
+                    std::forward<Comp>(comp), std::forward<Proj>(proj)));
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Comp,
+            typename Proj>
+        hpx::future<RandomIt> parallel_sort_dispatch(std::true_type,
+            ExPolicy&& policy, RandomIt first, RandomIt last, Comp&&, Proj&&)
+        {
+            return parallel_radix_sort(
+                std::forward<ExPolicy>(policy), first, last);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // sort
         template <typename RandomIt>
@@ -280,11 +305,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 {
                     // call the sort routine and return the right type,
                     // depending on execution policy
-                    return algorithm_result::get(parallel_sort_async(
+                    return algorithm_result::get(parallel_sort_dispatch(
+                        is_radix_sortable<RandomIt, Comp, Proj>(),
                         std::forward<ExPolicy>(policy), first, last,
-                        util::compare_projected<Comp, Proj>(
-                            std::forward<Comp>(comp),
-                            std::forward<Proj>(proj))));
+                        std::forward<Comp>(comp), std::forward<Proj>(proj)));
                 }
                 catch (...)
                 {
@@ -305,6 +329,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// \note   Ranges of integral or floating point values sorted using the
+    ///         default comparison function object and projection are sorted
+    ///         using a parallel radix sort if executed with a parallel
+    ///         execution policy (see \a radix_sort).
+    ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
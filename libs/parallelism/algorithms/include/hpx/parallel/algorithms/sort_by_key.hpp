@@ -11,6 +11,7 @@
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/parallel/util/tagged_pair.hpp>
 
+#include <hpx/parallel/algorithms/radix_sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/tagspec.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
@@ -34,6 +35,41 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return hpx::get<0>(std::forward<Tuple>(t));
             }
         };
+
+        // integral and floating point keys sorted using the default
+        // comparison are sorted using the radix sort if executed in parallel
+        template <typename ExPolicy, typename KeyIter, typename ValueIter,
+            typename Compare>
+        typename util::detail::algorithm_result<ExPolicy,
+            hpx::util::tagged_pair<tag::in1(KeyIter),
+                tag::in2(ValueIter)>>::type
+        sort_by_key_dispatch(std::false_type, ExPolicy&& policy,
+            KeyIter key_first, KeyIter key_last, ValueIter value_first,
+            Compare&& comp)
+        {
+            ValueIter value_last = value_first;
+            std::advance(value_last, std::distance(key_first, key_last));
+
+            return detail::get_iter_tagged_pair<tag::in1, tag::in2>(
+                hpx::parallel::sort(std::forward<ExPolicy>(policy),
+                    hpx::util::make_zip_iterator(key_first, value_first),
+                    hpx::util::make_zip_iterator(key_last, value_last),
+                    std::forward<Compare>(comp), detail::extract_key()));
+        }
+
+        template <typename ExPolicy, typename KeyIter, typename ValueIter,
+            typename Compare>
+        typename util::detail::algorithm_result<ExPolicy,
+            hpx::util::tagged_pair<tag::in1(KeyIter),
+                tag::in2(ValueIter)>>::type
+        sort_by_key_dispatch(std::true_type, ExPolicy&& policy,
+            KeyIter key_first, KeyIter key_last, ValueIter value_first,
+            Compare&&)
+        {
+            return hpx::parallel::radix_sort_by_key(
+                std::forward<ExPolicy>(policy), key_first, key_last,
+                value_first);
+        }
         /// \endcond
     }    // namespace detail
 
@@ -50,6 +86,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// \note   Integral or floating point keys sorted using the default
+    ///         comparison function object are sorted using a parallel radix
+    ///         sort if executed with a parallel execution policy (see
+    ///         \a radix_sort_by_key).
+    ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
@@ -130,14 +171,15 @@ namespace hpx { namespace parallel { inline namespace v1 {
             (hpx::traits::is_random_access_iterator<ValueIter>::value),
             "Requires a random access iterator.");
 
-        ValueIter value_last = value_first;
-        std::advance(value_last, std::distance(key_first, key_last));
+        using use_radix_sort = std::integral_constant<bool,
+            hpx::is_parallel_execution_policy<
+                typename std::decay<ExPolicy>::type>::value &&
+                detail::is_radix_sortable_by_key<KeyIter, Compare,
+                    ValueIter>::value>;
 
-        return detail::get_iter_tagged_pair<tag::in1, tag::in2>(
-            hpx::parallel::sort(std::forward<ExPolicy>(policy),
-                hpx::util::make_zip_iterator(key_first, value_first),
-                hpx::util::make_zip_iterator(key_last, value_last),
-                std::forward<Compare>(comp), detail::extract_key()));
+        return detail::sort_by_key_dispatch(use_radix_sort(),
+            std::forward<ExPolicy>(policy), key_first, key_last, value_first,
+            std::forward<Compare>(comp));
 #endif
     }
 }}}    // namespace hpx::parallel::v1
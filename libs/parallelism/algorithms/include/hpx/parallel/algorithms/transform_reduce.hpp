@@ -264,7 +264,7 @@ namespace hpx {
 
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
-#include <hpx/parallel/algorithms/detail/accumulate.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -335,17 +335,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
             HPX_HOST_DEVICE HPX_FORCEINLINE T operator()(
                 Iter part_begin, std::size_t part_size)
             {
-                using reference =
-                    typename std::iterator_traits<Iter>::reference;
-
                 T val = hpx::util::invoke(convert_, *part_begin);
-                return util::accumulate_n(++part_begin, --part_size,
-                    std::move(val),
-                    [HPX_CXX20_CAPTURE_THIS(=)](
-                        T const& res, reference next) mutable -> T {
-                        return hpx::util::invoke(
-                            reduce_, res, hpx::util::invoke(convert_, next));
-                    });
+                return detail::sequential_reduce<execution_policy_type>(
+                    ++part_begin, --part_size, std::move(val), reduce_,
+                    convert_);
             }
         };
 
@@ -363,14 +356,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static T sequential(ExPolicy, Iter first, Sent last, T_&& init,
                 Reduce&& r, Convert&& conv)
             {
-                using value_type =
-                    typename std::iterator_traits<Iter>::value_type;
-
-                return detail::accumulate(first, last, std::forward<T_>(init),
-                    [&r, &conv](T const& res, value_type const& next) -> T {
-                        return hpx::util::invoke(
-                            r, res, hpx::util::invoke(conv, next));
-                    });
+                return detail::sequential_reduce<ExPolicy>(first, last,
+                    std::forward<T_>(init), std::forward<Reduce>(r),
+                    std::forward<Convert>(conv));
             }
 
             template <typename ExPolicy, typename Iter, typename Sent,
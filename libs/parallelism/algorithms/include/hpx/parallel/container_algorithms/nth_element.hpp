@@ -0,0 +1,221 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/container_algorithms/nth_element.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx { namespace ranges {
+    // clang-format off
+
+    /// nth_element is a partial sorting algorithm that rearranges elements in
+    /// [first, last) such that the element pointed at by nth is changed to
+    /// whatever element would occur in that position if [first, last) were
+    /// sorted and all of the elements before this new nth element are less
+    /// than or equal to the elements after the new nth element.
+    ///
+    /// \note   Complexity: Linear in std::distance(first, last) on average.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam Rng         The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rng          Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param nth          Refers to the iterator defining the sort partition
+    ///                     point
+    /// \param comp         Specifies the comparison function object which
+    ///                     returns true if the first argument is less than
+    ///                     (i.e. is ordered before) the second.
+    ///                     This defaults to std::less<>.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// The comparison operations in the parallel \a nth_element invoked
+    /// with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The comparison operations in the parallel \a nth_element invoked
+    /// with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a nth_element algorithm returns a
+    ///           \a hpx::future<Iter> if the execution policy is of
+    ///           type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a Iter otherwise.
+    ///           It returns \a last.
+    ///
+    template <typename ExPolicy, typename Rng,
+        typename Comp = hpx::ranges::less,
+        typename Proj = parallel::util::projection_identity>
+    typename parallel::util::detail::algorithm_result<ExPolicy,
+        typename hpx::traits::range_iterator<Rng>::type>::type
+    nth_element(ExPolicy&& policy, Rng&& rng,
+        typename hpx::traits::range_iterator<Rng>::type nth,
+        Comp&& comp = Comp(), Proj&& proj = Proj());
+
+    // clang-format on
+}}    // namespace hpx::ranges
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/algorithms/traits/projected_range.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace ranges {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::ranges::nth_element
+    HPX_INLINE_CONSTEXPR_VARIABLE struct nth_element_t final
+      : hpx::functional::tag<nth_element_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename Iter, typename Sent,
+            typename Comp = hpx::ranges::less,
+            typename Proj = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_sentinel_for<Sent, Iter>::value &&
+                hpx::parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    hpx::parallel::traits::projected<Proj, Iter>,
+                    hpx::parallel::traits::projected<Proj, Iter>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            Iter>::type
+        tag_invoke(nth_element_t, ExPolicy&& policy, Iter first, Iter nth,
+            Sent last, Comp&& comp = Comp(), Proj&& proj = Proj())
+        {
+            static_assert(hpx::traits::is_random_access_iterator<Iter>::value,
+                "Requires random access iterator.");
+
+            return hpx::parallel::v1::detail::nth_element<Iter>().call(
+                std::forward<ExPolicy>(policy), first, nth, last,
+                std::forward<Comp>(comp), std::forward<Proj>(proj));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename Rng,
+            typename Comp = hpx::ranges::less,
+            typename Proj = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::parallel::traits::is_projected_range<Proj, Rng>::value &&
+                hpx::parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    hpx::parallel::traits::projected_range<Proj, Rng>,
+                    hpx::parallel::traits::projected_range<Proj, Rng>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            typename hpx::traits::range_iterator<Rng>::type>::type
+        tag_invoke(nth_element_t, ExPolicy&& policy, Rng&& rng,
+            typename hpx::traits::range_iterator<Rng>::type nth,
+            Comp&& comp = Comp(), Proj&& proj = Proj())
+        {
+            using iterator_type =
+                typename hpx::traits::range_iterator<Rng>::type;
+
+            static_assert(
+                hpx::traits::is_random_access_iterator<iterator_type>::value,
+                "Requires random access iterator.");
+
+            return hpx::parallel::v1::detail::nth_element<iterator_type>()
+                .call(std::forward<ExPolicy>(policy), hpx::util::begin(rng),
+                    nth, hpx::util::end(rng), std::forward<Comp>(comp),
+                    std::forward<Proj>(proj));
+        }
+
+        // clang-format off
+        template <typename Iter, typename Sent,
+            typename Comp = hpx::ranges::less,
+            typename Proj = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_sentinel_for<Sent, Iter>::value &&
+                hpx::parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    hpx::parallel::traits::projected<Proj, Iter>,
+                    hpx::parallel::traits::projected<Proj, Iter>
+                >::value
+            )>
+        // clang-format on
+        friend Iter tag_invoke(nth_element_t, Iter first, Iter nth, Sent last,
+            Comp&& comp = Comp(), Proj&& proj = Proj())
+        {
+            static_assert(hpx::traits::is_random_access_iterator<Iter>::value,
+                "Requires random access iterator.");
+
+            return hpx::parallel::v1::detail::nth_element<Iter>().call(
+                hpx::execution::seq, first, nth, last,
+                std::forward<Comp>(comp), std::forward<Proj>(proj));
+        }
+
+        // clang-format off
+        template <typename Rng,
+            typename Comp = hpx::ranges::less,
+            typename Proj = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::parallel::traits::is_projected_range<Proj, Rng>::value &&
+                hpx::parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    hpx::parallel::traits::projected_range<Proj, Rng>,
+                    hpx::parallel::traits::projected_range<Proj, Rng>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::traits::range_iterator<Rng>::type tag_invoke(
+            nth_element_t, Rng&& rng,
+            typename hpx::traits::range_iterator<Rng>::type nth,
+            Comp&& comp = Comp(), Proj&& proj = Proj())
+        {
+            using iterator_type =
+                typename hpx::traits::range_iterator<Rng>::type;
+
+            static_assert(
+                hpx::traits::is_random_access_iterator<iterator_type>::value,
+                "Requires random access iterator.");
+
+            return hpx::parallel::v1::detail::nth_element<iterator_type>()
+                .call(hpx::execution::seq, hpx::util::begin(rng), nth,
+                    hpx::util::end(rng), std::forward<Comp>(comp),
+                    std::forward<Proj>(proj));
+        }
+    } nth_element{};
+}}    // namespace hpx::ranges
+
+#endif    // DOXYGEN
@@ -0,0 +1,271 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/container_algorithms/partial_sort_copy.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx { namespace ranges {
+    // clang-format off
+
+    /// Sorts some of the elements in the range \a rng in ascending order,
+    /// storing the result in the range \a d_rng. At most
+    /// size(d_rng) of the elements are placed sorted to the range
+    /// [begin(d_rng), begin(d_rng) + n) where n is the number of elements to
+    /// sort (n = min(size(rng), size(d_rng))). The order of equal elements is
+    /// not guaranteed to be preserved.
+    ///
+    /// \note   Complexity: O(N log(min(D,N))), where N = size(rng) and
+    ///         D = size(d_rng) comparisons.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam Rng1        The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam Rng2        The type of the destination range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rng          Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param d_rng        Refers to the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. This defaults to
+    ///                     std::less<>.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements (of
+    ///                     both ranges) as a projection operation before the
+    ///                     actual predicate \a comp is invoked.
+    ///
+    /// The comparison operations in the parallel \a partial_sort_copy
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the calling thread.
+    ///
+    /// The comparison operations in the parallel \a partial_sort_copy
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<partial_sort_copy_result<I, O>> if the
+    ///           execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns
+    ///           \a partial_sort_copy_result<I, O> otherwise. The returned
+    ///           object holds the end of the source range and the iterator
+    ///           referring to the element defining the upper boundary of the
+    ///           sorted range in the destination.
+    ///
+    template <typename ExPolicy, typename Rng1, typename Rng2,
+        typename Comp = hpx::ranges::less,
+        typename Proj = parallel::util::projection_identity>
+    typename parallel::util::detail::algorithm_result<ExPolicy,
+        partial_sort_copy_result<
+            typename hpx::traits::range_iterator<Rng1>::type,
+            typename hpx::traits::range_iterator<Rng2>::type>>::type
+    partial_sort_copy(ExPolicy&& policy, Rng1&& rng, Rng2&& d_rng,
+        Comp&& comp = Comp(), Proj&& proj = Proj());
+
+    // clang-format on
+}}    // namespace hpx::ranges
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/algorithms/traits/projected_range.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/partial_sort_copy.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace ranges {
+
+    template <typename I, typename O>
+    using partial_sort_copy_result = parallel::util::in_out_result<I, O>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::ranges::partial_sort_copy
+    HPX_INLINE_CONSTEXPR_VARIABLE struct partial_sort_copy_t final
+      : hpx::functional::tag<partial_sort_copy_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename Iter1, typename Sent1,
+            typename Iter2, typename Sent2,
+            typename Comp = hpx::ranges::less,
+            typename Proj = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_sentinel_for<Sent1, Iter1>::value &&
+                hpx::traits::is_sentinel_for<Sent2, Iter2>::value &&
+                hpx::parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    hpx::parallel::traits::projected<Proj, Iter1>,
+                    hpx::parallel::traits::projected<Proj, Iter1>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            partial_sort_copy_result<Iter1, Iter2>>::type
+        tag_invoke(partial_sort_copy_t, ExPolicy&& policy, Iter1 first,
+            Sent1 last, Iter2 d_first, Sent2 d_last, Comp&& comp = Comp(),
+            Proj&& proj = Proj())
+        {
+            static_assert(hpx::traits::is_forward_iterator<Iter1>::value,
+                "Requires at least forward iterator.");
+            static_assert(hpx::traits::is_random_access_iterator<Iter2>::value,
+                "Requires random access iterator.");
+
+            using result_type = partial_sort_copy_result<Iter1, Iter2>;
+
+            return hpx::parallel::v1::detail::partial_sort_copy<result_type>()
+                .call(std::forward<ExPolicy>(policy), first, last, d_first,
+                    d_last, std::forward<Comp>(comp),
+                    std::forward<Proj>(proj));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename Rng1, typename Rng2,
+            typename Comp = hpx::ranges::less,
+            typename Proj = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::parallel::traits::is_projected_range<Proj, Rng1>::value &&
+                hpx::traits::is_range<Rng2>::value &&
+                hpx::parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    hpx::parallel::traits::projected_range<Proj, Rng1>,
+                    hpx::parallel::traits::projected_range<Proj, Rng1>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            partial_sort_copy_result<
+                typename hpx::traits::range_iterator<Rng1>::type,
+                typename hpx::traits::range_iterator<Rng2>::type>>::type
+        tag_invoke(partial_sort_copy_t, ExPolicy&& policy, Rng1&& rng,
+            Rng2&& d_rng, Comp&& comp = Comp(), Proj&& proj = Proj())
+        {
+            using iterator_type1 =
+                typename hpx::traits::range_iterator<Rng1>::type;
+            using iterator_type2 =
+                typename hpx::traits::range_iterator<Rng2>::type;
+
+            static_assert(
+                hpx::traits::is_forward_iterator<iterator_type1>::value,
+                "Requires at least forward iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<iterator_type2>::value,
+                "Requires random access iterator.");
+
+            using result_type =
+                partial_sort_copy_result<iterator_type1, iterator_type2>;
+
+            return hpx::parallel::v1::detail::partial_sort_copy<result_type>()
+                .call(std::forward<ExPolicy>(policy), hpx::util::begin(rng),
+                    hpx::util::end(rng), hpx::util::begin(d_rng),
+                    hpx::util::end(d_rng), std::forward<Comp>(comp),
+                    std::forward<Proj>(proj));
+        }
+
+        // clang-format off
+        template <typename Iter1, typename Sent1, typename Iter2,
+            typename Sent2, typename Comp = hpx::ranges::less,
+            typename Proj = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_sentinel_for<Sent1, Iter1>::value &&
+                hpx::traits::is_sentinel_for<Sent2, Iter2>::value &&
+                hpx::parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    hpx::parallel::traits::projected<Proj, Iter1>,
+                    hpx::parallel::traits::projected<Proj, Iter1>
+                >::value
+            )>
+        // clang-format on
+        friend partial_sort_copy_result<Iter1, Iter2> tag_invoke(
+            partial_sort_copy_t, Iter1 first, Sent1 last, Iter2 d_first,
+            Sent2 d_last, Comp&& comp = Comp(), Proj&& proj = Proj())
+        {
+            static_assert(hpx::traits::is_input_iterator<Iter1>::value,
+                "Requires at least input iterator.");
+            static_assert(hpx::traits::is_random_access_iterator<Iter2>::value,
+                "Requires random access iterator.");
+
+            using result_type = partial_sort_copy_result<Iter1, Iter2>;
+
+            return hpx::parallel::v1::detail::partial_sort_copy<result_type>()
+                .call(hpx::execution::seq, first, last, d_first, d_last,
+                    std::forward<Comp>(comp), std::forward<Proj>(proj));
+        }
+
+        // clang-format off
+        template <typename Rng1, typename Rng2,
+            typename Comp = hpx::ranges::less,
+            typename Proj = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::parallel::traits::is_projected_range<Proj, Rng1>::value &&
+                hpx::traits::is_range<Rng2>::value &&
+                hpx::parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    hpx::parallel::traits::projected_range<Proj, Rng1>,
+                    hpx::parallel::traits::projected_range<Proj, Rng1>
+                >::value
+            )>
+        // clang-format on
+        friend partial_sort_copy_result<
+            typename hpx::traits::range_iterator<Rng1>::type,
+            typename hpx::traits::range_iterator<Rng2>::type>
+        tag_invoke(partial_sort_copy_t, Rng1&& rng, Rng2&& d_rng,
+            Comp&& comp = Comp(), Proj&& proj = Proj())
+        {
+            using iterator_type1 =
+                typename hpx::traits::range_iterator<Rng1>::type;
+            using iterator_type2 =
+                typename hpx::traits::range_iterator<Rng2>::type;
+
+            static_assert(
+                hpx::traits::is_input_iterator<iterator_type1>::value,
+                "Requires at least input iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<iterator_type2>::value,
+                "Requires random access iterator.");
+
+            using result_type =
+                partial_sort_copy_result<iterator_type1, iterator_type2>;
+
+            return hpx::parallel::v1::detail::partial_sort_copy<result_type>()
+                .call(hpx::execution::seq, hpx::util::begin(rng),
+                    hpx::util::end(rng), hpx::util::begin(d_rng),
+                    hpx::util::end(d_rng), std::forward<Comp>(comp),
+                    std::forward<Proj>(proj));
+        }
+    } partial_sort_copy{};
+}}    // namespace hpx::ranges
+
+#endif    // DOXYGEN
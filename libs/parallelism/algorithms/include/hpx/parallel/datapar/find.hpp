@@ -0,0 +1,300 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/find.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized search applies the predicate to whole vector packs, the
+    // predicate is expected to return the corresponding mask type.
+    template <typename Iter, typename Pred, typename Proj,
+        typename Enable = void>
+    struct datapar_find_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename Pred, typename Proj>
+    struct datapar_find_compatible<Iter, Pred, Proj,
+        typename std::enable_if<
+            util::detail::iterator_datapar_compatible<Iter>::value>::type>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::vector_pack_type<value_type>::type;
+
+        static constexpr bool value =
+            std::is_same<typename std::decay<Proj>::type,
+                util::projection_identity>::value &&
+            hpx::is_invocable<Pred&, V>::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter>
+    struct datapar_find
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::vector_pack_type<value_type>::type;
+
+        // Return the offset of the first element in [first, first + count)
+        // the predicate returns true for or count if there is none. The search
+        // is stopped early if was_cancelled(offset) returns true.
+        template <typename Pred, typename Cancelled>
+        static std::size_t call(Iter first, std::size_t count, Pred& pred,
+            Cancelled&& was_cancelled)
+        {
+            constexpr std::size_t size = traits::vector_pack_size<V>::value;
+
+            std::size_t offset = 0;
+
+            // handle leading elements until the data is properly aligned
+            for (/* */;
+                 offset != count && !util::detail::is_data_aligned(first);
+                 (void) ++offset, ++first)
+            {
+                if (HPX_INVOKE(pred, *first))
+                    return offset;
+            }
+
+            // look at whole packs, the masks tell whether there is a match
+            for (/* */; count - offset >= size; offset += size, first += size)
+            {
+                if (was_cancelled(offset))
+                    return count;
+
+                auto msk = HPX_INVOKE(pred,
+                    traits::vector_pack_load<V, value_type>::aligned(first));
+                if (traits::any_of(msk))
+                    return offset + traits::find_first_of(msk);
+            }
+
+            // handle remaining elements
+            for (/* */; offset != count; (void) ++offset, ++first)
+            {
+                if (HPX_INVOKE(pred, *first))
+                    return offset;
+            }
+
+            return count;
+        }
+    };
+
+    // Return the offset of the last element in [first, first + count) the
+    // predicate returns true for or count if there is none.
+    template <typename Iter>
+    struct datapar_find_last
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::vector_pack_type<value_type>::type;
+
+        template <typename Pred>
+        static std::size_t call(Iter first, std::size_t count, Pred& pred)
+        {
+            constexpr std::size_t size = traits::vector_pack_size<V>::value;
+
+            // determine the range of elements covered by aligned packs
+            std::size_t head = 0;
+            while (
+                head != count && !util::detail::is_data_aligned(first + head))
+            {
+                ++head;
+            }
+            std::size_t const packs_end =
+                head + ((count - head) / size) * size;
+
+            // handle trailing elements not covered by whole packs
+            std::size_t offset = count;
+            for (/* */; offset != packs_end; --offset)
+            {
+                if (HPX_INVOKE(pred, *(first + (offset - 1))))
+                    return offset - 1;
+            }
+
+            // look at whole packs, starting from the back
+            for (/* */; offset != head; offset -= size)
+            {
+                auto msk = HPX_INVOKE(pred,
+                    traits::vector_pack_load<V, value_type>::aligned(
+                        first + (offset - size)));
+                if (traits::any_of(msk))
+                    return offset - size + traits::find_last_of(msk);
+            }
+
+            // handle remaining elements
+            for (/* */; offset != 0; --offset)
+            {
+                if (HPX_INVOKE(pred, *(first + (offset - 1))))
+                    return offset - 1;
+            }
+
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct datapar_equal_to
+    {
+        T const& value;
+
+        template <typename U>
+        HPX_FORCEINLINE auto operator()(U const& u) const -> decltype(u == u)
+        {
+            return u == U(value);
+        }
+    };
+
+    template <typename T>
+    struct datapar_negate
+    {
+        T& pred;
+
+        template <typename U>
+        HPX_FORCEINLINE auto operator()(U const& u) const
+            -> decltype(!HPX_INVOKE(pred, u))
+        {
+            return !HPX_INVOKE(pred, u);
+        }
+    };
+
+    template <typename Iter, typename Pred>
+    Iter datapar_find_first(Iter first, std::size_t count, Pred& pred)
+    {
+        std::size_t offset = datapar_find<Iter>::call(
+            first, count, pred, [](std::size_t) { return false; });
+        return std::next(first, offset);
+    }
+
+    template <typename Iter, typename Token, typename Pred>
+    void datapar_find_first(std::size_t base_idx, Iter part_begin,
+        std::size_t part_count, Token& tok, Pred& pred)
+    {
+        std::size_t offset = datapar_find<Iter>::call(part_begin, part_count,
+            pred, [&tok, base_idx](std::size_t i) {
+                return tok.was_cancelled(base_idx + i);
+            });
+        if (offset != part_count)
+            tok.cancel(base_idx + offset);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A value can be compared to packs only if it has the value type of the
+    // sequence, otherwise the value would be converted before the comparison.
+    template <typename ExPolicy, typename Iter, typename T, typename Proj>
+    struct datapar_find_value_compatible
+      : std::integral_constant<bool,
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+                std::is_same<T,
+                    typename std::iterator_traits<Iter>::value_type>::value &&
+                datapar_find_compatible<Iter, datapar_equal_to<T>,
+                    Proj>::value>
+    {
+    };
+
+    template <typename ExPolicy, typename Iter, typename Sent, typename T,
+        typename Proj = util::projection_identity>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::traits::is_sentinel_for<Sent, Iter>::value &&
+            datapar_find_value_compatible<ExPolicy, Iter, T, Proj>::value,
+        Iter>::type
+    tag_invoke(sequential_find_t<ExPolicy>, Iter first, Sent last,
+        T const& value, Proj = Proj())
+    {
+        datapar_equal_to<T> pred{value};
+        return datapar_find_first(first,
+            static_cast<std::size_t>(detail::distance(first, last)), pred);
+    }
+
+    template <typename ExPolicy, typename Iter, typename Token, typename T,
+        typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        datapar_find_value_compatible<ExPolicy, Iter, T, Proj>::value>::type
+    tag_invoke(sequential_find_t<ExPolicy>, std::size_t base_idx,
+        Iter part_begin, std::size_t part_count, Token& tok, T const& value,
+        Proj&&)
+    {
+        datapar_equal_to<T> pred{value};
+        datapar_find_first(base_idx, part_begin, part_count, tok, pred);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename Sent, typename Pred,
+        typename Proj = util::projection_identity>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent, Iter>::value &&
+            datapar_find_compatible<Iter, Pred, Proj>::value,
+        Iter>::type
+    tag_invoke(sequential_find_if_t<ExPolicy>, Iter first, Sent last,
+        Pred pred, Proj = Proj())
+    {
+        return datapar_find_first(first,
+            static_cast<std::size_t>(detail::distance(first, last)), pred);
+    }
+
+    template <typename ExPolicy, typename Iter, typename Token, typename F,
+        typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_find_compatible<Iter, F, Proj>::value>::type
+    tag_invoke(sequential_find_if_t<ExPolicy>, std::size_t base_idx,
+        Iter part_begin, std::size_t part_count, Token& tok, F&& f, Proj&&)
+    {
+        datapar_find_first(base_idx, part_begin, part_count, tok, f);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename Sent, typename Pred,
+        typename Proj = util::projection_identity>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent, Iter>::value &&
+            datapar_find_compatible<Iter, Pred, Proj>::value,
+        Iter>::type
+    tag_invoke(sequential_find_if_not_t<ExPolicy>, Iter first, Sent last,
+        Pred pred, Proj = Proj())
+    {
+        datapar_negate<Pred> negated{pred};
+        return datapar_find_first(first,
+            static_cast<std::size_t>(detail::distance(first, last)), negated);
+    }
+
+    template <typename ExPolicy, typename Iter, typename Token, typename F,
+        typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_find_compatible<Iter, F, Proj>::value>::type
+    tag_invoke(sequential_find_if_not_t<ExPolicy>, std::size_t base_idx,
+        Iter part_begin, std::size_t part_count, Token& tok, F&& f, Proj&&)
+    {
+        datapar_negate<typename std::remove_reference<F>::type> negated{f};
+        datapar_find_first(base_idx, part_begin, part_count, tok, negated);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
@@ -0,0 +1,245 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
+#include <hpx/parallel/datapar/find.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The extreme values are determined pack by pack, this requires for the
+    // comparison to accept packs and to return the corresponding mask type.
+    template <typename Iter, typename F, typename Proj, typename Enable = void>
+    struct datapar_minmax_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename F, typename Proj>
+    struct datapar_minmax_compatible<Iter, F, Proj,
+        typename std::enable_if<
+            util::detail::iterator_datapar_compatible<Iter>::value>::type>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::vector_pack_type<value_type>::type;
+
+        static constexpr bool value =
+            std::is_same<typename std::decay<Proj>::type,
+                util::projection_identity>::value &&
+            hpx::is_invocable_r<typename V::mask_type, F const&, V, V>::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The smallest (largest) element is found in two steps: the extreme value
+    // is computed first, its position is searched for afterwards. Both steps
+    // operate on whole packs.
+    template <typename Iter>
+    struct datapar_minmax
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::vector_pack_type<value_type>::type;
+
+        // reduce the non-empty sequence using the given selection
+        template <typename Select>
+        static value_type reduce(
+            Iter first, std::size_t count, Select const& select)
+        {
+            constexpr std::size_t size = traits::vector_pack_size<V>::value;
+
+            value_type result = *first;
+
+            // handle leading elements until the data is properly aligned
+            for (++first, --count;
+                 count != 0 && !util::detail::is_data_aligned(first);
+                 (void) --count, ++first)
+            {
+                result = select(result, value_type(*first));
+            }
+
+            if (count >= size)
+            {
+                V accum =
+                    traits::vector_pack_load<V, value_type>::aligned(first);
+
+                for (first += size, count -= size; count >= size;
+                     first += size, count -= size)
+                {
+                    accum = select(accum,
+                        traits::vector_pack_load<V, value_type>::aligned(
+                            first));
+                }
+
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    result = select(result, value_type(accum[i]));
+                }
+            }
+
+            // handle remaining elements
+            for (/* */; count != 0; (void) --count, ++first)
+            {
+                result = select(result, value_type(*first));
+            }
+
+            return result;
+        }
+
+        template <typename F>
+        static value_type min_value(Iter first, std::size_t count, F const& f)
+        {
+            return reduce(first, count, [&f](auto const& curr, auto const& v) {
+                return traits::choose(HPX_INVOKE(f, v, curr), v, curr);
+            });
+        }
+
+        template <typename F>
+        static value_type max_value(Iter first, std::size_t count, F const& f)
+        {
+            return reduce(first, count, [&f](auto const& curr, auto const& v) {
+                return traits::choose(HPX_INVOKE(f, curr, v), v, curr);
+            });
+        }
+
+        // the first element not greater than the smallest value
+        template <typename F>
+        static Iter min_element(Iter first, std::size_t count, F const& f)
+        {
+            value_type const minval = min_value(first, count, f);
+            auto pred = [&f, &minval](auto const& v) {
+                using pack_type = typename std::decay<decltype(v)>::type;
+                return !HPX_INVOKE(f, pack_type(minval), v);
+            };
+            return std::next(first,
+                datapar_find<Iter>::call(
+                    first, count, pred, [](std::size_t) { return false; }));
+        }
+
+        // the first (last) element not less than the largest value
+        template <typename F>
+        static Iter max_element(
+            Iter first, std::size_t count, F const& f, bool last = false)
+        {
+            value_type const maxval = max_value(first, count, f);
+            auto pred = [&f, &maxval](auto const& v) {
+                using pack_type = typename std::decay<decltype(v)>::type;
+                return !HPX_INVOKE(f, v, pack_type(maxval));
+            };
+            if (last)
+            {
+                return std::next(
+                    first, datapar_find_last<Iter>::call(first, count, pred));
+            }
+            return std::next(first,
+                datapar_find<Iter>::call(
+                    first, count, pred, [](std::size_t) { return false; }));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename F, typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_minmax_compatible<Iter, F, Proj>::value,
+        Iter>::type
+    tag_invoke(sequential_min_element_t<ExPolicy>, Iter it, std::size_t count,
+        F const& f, Proj const&)
+    {
+        if (count == 0 || count == 1)
+            return it;
+
+        return datapar_minmax<Iter>::min_element(it, count, f);
+    }
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_minmax_compatible<Iter, F, Proj>::value,
+        Iter>::type
+    tag_invoke(sequential_min_element_t<ExPolicy> tag, Iter first, Iter last,
+        F&& f, Proj&& proj)
+    {
+        return tag_invoke(tag, first,
+            static_cast<std::size_t>(detail::distance(first, last)), f, proj);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename F, typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_minmax_compatible<Iter, F, Proj>::value,
+        Iter>::type
+    tag_invoke(sequential_max_element_t<ExPolicy>, Iter it, std::size_t count,
+        F const& f, Proj const&)
+    {
+        if (count == 0 || count == 1)
+            return it;
+
+        return datapar_minmax<Iter>::max_element(it, count, f);
+    }
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_minmax_compatible<Iter, F, Proj>::value,
+        Iter>::type
+    tag_invoke(sequential_max_element_t<ExPolicy> tag, Iter first, Iter last,
+        F&& f, Proj&& proj)
+    {
+        return tag_invoke(tag, first,
+            static_cast<std::size_t>(detail::distance(first, last)), f, proj);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename F, typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_minmax_compatible<Iter, F, Proj>::value,
+        std::pair<Iter, Iter>>::type
+    tag_invoke(sequential_minmax_element_t<ExPolicy>, Iter it,
+        std::size_t count, F const& f, Proj const&)
+    {
+        if (count == 0 || count == 1)
+            return std::make_pair(it, it);
+
+        // std::minmax_element returns the last of the largest elements
+        return std::make_pair(datapar_minmax<Iter>::min_element(it, count, f),
+            datapar_minmax<Iter>::max_element(it, count, f, true));
+    }
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_minmax_compatible<Iter, F, Proj>::value,
+        std::pair<Iter, Iter>>::type
+    tag_invoke(sequential_minmax_element_t<ExPolicy> tag, Iter first,
+        Iter last, F&& f, Proj&& proj)
+    {
+        return tag_invoke(tag, first,
+            static_cast<std::size_t>(detail::distance(first, last)), f, proj);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
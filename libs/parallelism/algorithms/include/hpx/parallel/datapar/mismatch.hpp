@@ -0,0 +1,318 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/iterator_support/zip_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/equal.hpp>
+#include <hpx/parallel/algorithms/detail/mismatch.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Both sequences are compared pack by pack, this requires for their value
+    // types to map onto packs of the same size and for the comparison to
+    // accept packs.
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2, typename Enable = void>
+    struct datapar_mismatch_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    struct datapar_mismatch_compatible<Iter1, Iter2, F, Proj1, Proj2,
+        typename std::enable_if<
+            util::detail::iterator_datapar_compatible<Iter1>::value &&
+            util::detail::iterator_datapar_compatible<Iter2>::value>::type>
+    {
+        using value1_type = typename std::iterator_traits<Iter1>::value_type;
+        using value2_type = typename std::iterator_traits<Iter2>::value_type;
+        using V1 = typename traits::vector_pack_type<value1_type>::type;
+        using V2 = typename traits::vector_pack_type<value2_type>::type;
+
+        static constexpr bool value =
+            util::detail::iterators_datapar_compatible<Iter1, Iter2>::value &&
+            std::is_same<typename std::decay<Proj1>::type,
+                util::projection_identity>::value &&
+            std::is_same<typename std::decay<Proj2>::type,
+                util::projection_identity>::value &&
+            hpx::is_invocable<F&, V1, V2>::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter1, typename Iter2>
+    struct datapar_mismatch
+    {
+        using value1_type = typename std::iterator_traits<Iter1>::value_type;
+        using value2_type = typename std::iterator_traits<Iter2>::value_type;
+        using V1 = typename traits::vector_pack_type<value1_type>::type;
+        using V2 = typename traits::vector_pack_type<value2_type>::type;
+
+        // compare whole packs, return true if the comparison is finished,
+        // offset then refers to the first mismatch (or is equal to count)
+        template <typename F, typename Load2, typename Cancelled>
+        static bool compare_packs(Iter1& first1, Iter2& first2,
+            std::size_t& offset, std::size_t count, F& f, Load2 load2,
+            Cancelled& was_cancelled)
+        {
+            constexpr std::size_t size = traits::vector_pack_size<V1>::value;
+
+            for (/* */; count - offset >= size;
+                 offset += size, first1 += size, first2 += size)
+            {
+                if (was_cancelled(offset))
+                {
+                    offset = count;
+                    return true;
+                }
+
+                auto msk = !HPX_INVOKE(f,
+                    traits::vector_pack_load<V1, value1_type>::aligned(first1),
+                    load2(first2));
+                if (traits::any_of(msk))
+                {
+                    offset += traits::find_first_of(msk);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Return the offset of the first pair of elements the comparison
+        // yields false for or count if there is none. The search is stopped
+        // early if was_cancelled(offset) returns true.
+        template <typename F, typename Cancelled>
+        static std::size_t call(Iter1 first1, Iter2 first2, std::size_t count,
+            F& f, Cancelled&& was_cancelled)
+        {
+            std::size_t offset = 0;
+
+            // handle leading elements until the first sequence is aligned
+            for (/* */;
+                 offset != count && !util::detail::is_data_aligned(first1);
+                 (void) ++offset, ++first1, ++first2)
+            {
+                if (!HPX_INVOKE(f, *first1, *first2))
+                    return offset;
+            }
+
+            // the second sequence may still be misaligned
+            bool done = false;
+            if (offset != count && util::detail::is_data_aligned(first2))
+            {
+                done = compare_packs(first1, first2, offset, count, f,
+                    [](Iter2 const& it) {
+                        return traits::vector_pack_load<V2,
+                            value2_type>::aligned(it);
+                    },
+                    was_cancelled);
+            }
+            else
+            {
+                done = compare_packs(first1, first2, offset, count, f,
+                    [](Iter2 const& it) {
+                        return traits::vector_pack_load<V2,
+                            value2_type>::unaligned(it);
+                    },
+                    was_cancelled);
+            }
+
+            if (done)
+                return offset;
+
+            // handle remaining elements
+            for (/* */; offset != count; (void) ++offset, ++first1, ++first2)
+            {
+                if (!HPX_INVOKE(f, *first1, *first2))
+                    return offset;
+            }
+
+            return count;
+        }
+    };
+
+    template <typename Iter1, typename Iter2, typename F>
+    std::size_t datapar_mismatch_offset(
+        Iter1 first1, Iter2 first2, std::size_t count, F& f)
+    {
+        return datapar_mismatch<Iter1, Iter2>::call(
+            first1, first2, count, f, [](std::size_t) { return false; });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter1, typename Sent1, typename Iter2,
+        typename Sent2, typename F, typename Proj1, typename Proj2>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent1, Iter1>::value &&
+            hpx::traits::is_sentinel_for<Sent2, Iter2>::value &&
+            datapar_mismatch_compatible<Iter1, Iter2, F, Proj1, Proj2>::value,
+        bool>::type
+    tag_invoke(sequential_equal_binary_t<ExPolicy>, Iter1 first1, Sent1 last1,
+        Iter2 first2, Sent2 last2, F&& f, Proj1&&, Proj2&&)
+    {
+        std::size_t count = detail::distance(first1, last1);
+        if (count != static_cast<std::size_t>(detail::distance(first2, last2)))
+            return false;
+
+        return datapar_mismatch_offset(first1, first2, count, f) == count;
+    }
+
+    template <typename ExPolicy, typename Iter1, typename Iter2,
+        typename Token, typename F, typename Proj1, typename Proj2>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_mismatch_compatible<Iter1, Iter2, F, Proj1,
+                Proj2>::value>::type
+    tag_invoke(sequential_equal_binary_t<ExPolicy>,
+        hpx::util::zip_iterator<Iter1, Iter2> it, std::size_t part_count,
+        Token& tok, F&& f, Proj1&&, Proj2&&)
+    {
+        auto const& t = it.get_iterator_tuple();
+        std::size_t offset = datapar_mismatch<Iter1, Iter2>::call(
+            hpx::get<0>(t), hpx::get<1>(t), part_count, f,
+            [&tok](std::size_t) { return tok.was_cancelled(); });
+        if (offset != part_count)
+            tok.cancel();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_mismatch_compatible<Iter1, Iter2, F,
+                util::projection_identity, util::projection_identity>::value,
+        bool>::type
+    tag_invoke(sequential_equal_t<ExPolicy>, Iter1 first1, Iter1 last1,
+        Iter2 first2, F&& f)
+    {
+        std::size_t count = detail::distance(first1, last1);
+        return datapar_mismatch_offset(first1, first2, count, f) == count;
+    }
+
+    template <typename ExPolicy, typename Iter1, typename Iter2,
+        typename Token, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_mismatch_compatible<Iter1, Iter2, F,
+                util::projection_identity,
+                util::projection_identity>::value>::type
+    tag_invoke(sequential_equal_t<ExPolicy>,
+        hpx::util::zip_iterator<Iter1, Iter2> it, std::size_t part_count,
+        Token& tok, F&& f)
+    {
+        auto const& t = it.get_iterator_tuple();
+        std::size_t offset = datapar_mismatch<Iter1, Iter2>::call(
+            hpx::get<0>(t), hpx::get<1>(t), part_count, f,
+            [&tok](std::size_t) { return tok.was_cancelled(); });
+        if (offset != part_count)
+            tok.cancel();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter1, typename Sent1, typename Iter2,
+        typename Sent2, typename F, typename Proj1, typename Proj2>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent1, Iter1>::value &&
+            hpx::traits::is_sentinel_for<Sent2, Iter2>::value &&
+            datapar_mismatch_compatible<Iter1, Iter2, F, Proj1, Proj2>::value,
+        util::in_in_result<Iter1, Iter2>>::type
+    tag_invoke(sequential_mismatch_binary_t<ExPolicy>, Iter1 first1,
+        Sent1 last1, Iter2 first2, Sent2 last2, F&& f, Proj1&&, Proj2&&)
+    {
+        std::size_t count = (std::min)(
+            static_cast<std::size_t>(detail::distance(first1, last1)),
+            static_cast<std::size_t>(detail::distance(first2, last2)));
+
+        std::size_t offset = datapar_mismatch_offset(first1, first2, count, f);
+        return {std::next(first1, offset), std::next(first2, offset)};
+    }
+
+    template <typename ExPolicy, typename Iter1, typename Iter2,
+        typename Token, typename F, typename Proj1, typename Proj2>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_mismatch_compatible<Iter1, Iter2, F, Proj1,
+                Proj2>::value>::type
+    tag_invoke(sequential_mismatch_binary_t<ExPolicy>, std::size_t base_idx,
+        hpx::util::zip_iterator<Iter1, Iter2> it, std::size_t part_count,
+        Token& tok, F&& f, Proj1&&, Proj2&&)
+    {
+        auto const& t = it.get_iterator_tuple();
+        std::size_t offset = datapar_mismatch<Iter1, Iter2>::call(
+            hpx::get<0>(t), hpx::get<1>(t), part_count, f,
+            [&tok, base_idx](std::size_t i) {
+                return tok.was_cancelled(base_idx + i);
+            });
+        if (offset != part_count)
+            tok.cancel(base_idx + offset);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_mismatch_compatible<Iter1, Iter2, F,
+                util::projection_identity, util::projection_identity>::value,
+        std::pair<Iter1, Iter2>>::type
+    tag_invoke(sequential_mismatch_t<ExPolicy>, Iter1 first1, Iter1 last1,
+        Iter2 first2, F&& f)
+    {
+        std::size_t offset = datapar_mismatch_offset(
+            first1, first2, detail::distance(first1, last1), f);
+        return std::make_pair(
+            std::next(first1, offset), std::next(first2, offset));
+    }
+
+    template <typename ExPolicy, typename Iter1, typename Iter2,
+        typename Token, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_mismatch_compatible<Iter1, Iter2, F,
+                util::projection_identity,
+                util::projection_identity>::value>::type
+    tag_invoke(sequential_mismatch_t<ExPolicy>, std::size_t base_idx,
+        hpx::util::zip_iterator<Iter1, Iter2> it, std::size_t part_count,
+        Token& tok, F&& f)
+    {
+        auto const& t = it.get_iterator_tuple();
+        std::size_t offset = datapar_mismatch<Iter1, Iter2>::call(
+            hpx::get<0>(t), hpx::get<1>(t), part_count, f,
+            [&tok, base_idx](std::size_t i) {
+                return tok.was_cancelled(base_idx + i);
+            });
+        if (offset != part_count)
+            tok.cancel(base_idx + offset);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
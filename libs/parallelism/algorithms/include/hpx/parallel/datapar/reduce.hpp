@@ -0,0 +1,168 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized reduction combines whole vector packs. This requires for
+    // the reduction to be performed in the value type of the sequence and for
+    // both, the reduction and the conversion operations to accept packs.
+    template <typename Iter, typename T, typename Reduce, typename Convert,
+        typename Enable = void>
+    struct datapar_reduce_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename T, typename Reduce, typename Convert>
+    struct datapar_reduce_compatible<Iter, T, Reduce, Convert,
+        typename std::enable_if<
+            util::detail::iterator_datapar_compatible<Iter>::value>::type>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::vector_pack_type<value_type>::type;
+
+        static constexpr bool value =
+            std::is_same<typename std::decay<T>::type, value_type>::value &&
+            hpx::is_invocable_r<V, Convert&, V>::value &&
+            hpx::is_invocable_r<V, Reduce&, V, V>::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter>
+    struct datapar_reduce
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::vector_pack_type<value_type>::type;
+
+        template <typename T, typename Reduce, typename Convert>
+        static T call(
+            Iter first, std::size_t count, T init, Reduce& r, Convert& conv)
+        {
+            constexpr std::size_t size = traits::vector_pack_size<V>::value;
+
+            // handle leading elements until the data is properly aligned
+            for (/* */; count != 0 && !util::detail::is_data_aligned(first);
+                 (void) --count, ++first)
+            {
+                init = HPX_INVOKE(r, init, HPX_INVOKE(conv, *first));
+            }
+
+            // combine whole packs, reduce the accumulated lanes at the end
+            if (count >= 2 * size)
+            {
+                V accum = HPX_INVOKE(conv,
+                    traits::vector_pack_load<V, value_type>::aligned(first));
+
+                for (first += size, count -= size; count >= size;
+                     first += size, count -= size)
+                {
+                    accum = HPX_INVOKE(r, accum,
+                        HPX_INVOKE(conv,
+                            traits::vector_pack_load<V, value_type>::aligned(
+                                first)));
+                }
+
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    init = HPX_INVOKE(r, init, value_type(accum[i]));
+                }
+            }
+
+            // handle remaining elements
+            for (/* */; count != 0; (void) --count, ++first)
+            {
+                init = HPX_INVOKE(r, init, HPX_INVOKE(conv, *first));
+            }
+
+            return init;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename Sent, typename T,
+        typename Reduce>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent, Iter>::value &&
+            datapar_reduce_compatible<Iter, T, Reduce,
+                util::projection_identity>::value,
+        T>::type
+    tag_invoke(sequential_reduce_t<ExPolicy>, Iter first, Sent last, T init,
+        Reduce&& r)
+    {
+        util::projection_identity conv;
+        return datapar_reduce<Iter>::call(first,
+            static_cast<std::size_t>(detail::distance(first, last)),
+            std::move(init), r, conv);
+    }
+
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_reduce_compatible<Iter, T, Reduce,
+                util::projection_identity>::value,
+        T>::type
+    tag_invoke(sequential_reduce_t<ExPolicy>, Iter part_begin,
+        std::size_t part_size, T init, Reduce&& r)
+    {
+        util::projection_identity conv;
+        return datapar_reduce<Iter>::call(
+            part_begin, part_size, std::move(init), r, conv);
+    }
+
+    template <typename ExPolicy, typename Iter, typename Sent, typename T,
+        typename Reduce, typename Convert>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_sentinel_for<Sent, Iter>::value &&
+            datapar_reduce_compatible<Iter, T, Reduce, Convert>::value,
+        T>::type
+    tag_invoke(sequential_reduce_t<ExPolicy>, Iter first, Sent last, T init,
+        Reduce&& r, Convert&& conv)
+    {
+        return datapar_reduce<Iter>::call(first,
+            static_cast<std::size_t>(detail::distance(first, last)),
+            std::move(init), r, conv);
+    }
+
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce,
+        typename Convert>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_reduce_compatible<Iter, T, Reduce, Convert>::value,
+        T>::type
+    tag_invoke(sequential_reduce_t<ExPolicy>, Iter part_begin,
+        std::size_t part_size, T init, Reduce&& r, Convert&& conv)
+    {
+        return datapar_reduce<Iter>::call(
+            part_begin, part_size, std::move(init), r, conv);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
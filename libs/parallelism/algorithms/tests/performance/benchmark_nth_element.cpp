@@ -0,0 +1,117 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// nth_element with different positions of the nth element.
+// accumulate all the times and compare the parallel and the sequential
+// algorithms
+void function01(std::size_t nelem)
+{
+    typedef std::less<std::uint64_t> compare_t;
+
+    std::vector<std::uint64_t> A, B;
+    A.reserve(nelem);
+    B.reserve(nelem);
+
+    for (std::uint64_t i = 0; i < nelem; ++i)
+    {
+        A.emplace_back(i);
+    }
+    std::shuffle(A.begin(), A.end(), gen);
+
+    std::uint64_t ac1 = 0, ac2 = 0;
+    std::size_t const step = (std::max)(nelem / 10, std::size_t(1));
+
+    for (std::size_t i = 0; i < nelem; i += step)
+    {
+        std::cout << "[" << i << "] \t";
+
+        B = A;
+        auto start = std::chrono::high_resolution_clock::now();
+        hpx::nth_element(hpx::execution::par, B.begin(), B.begin() + i,
+            B.end(), compare_t());
+        auto end = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<long unsigned, std::nano> nanotime1 = end - start;
+        ac1 += nanotime1.count();
+        std::cout << "hpx::nth_element :" << (nanotime1.count() / 1000000);
+
+        B = A;
+        start = std::chrono::high_resolution_clock::now();
+        std::nth_element(B.begin(), B.begin() + i, B.end(), compare_t());
+        end = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<long unsigned, std::nano> nanotime2 = end - start;
+        ac2 += nanotime2.count();
+        std::cout << "\t\tstd::nth_element :" << (nanotime2.count() / 1000000)
+                  << std::endl;
+    }
+
+    std::cout << "\n\n";
+    std::cout << "Accumulated (msec) hpx::nth_element " << ac1 / 1000000
+              << std::endl;
+    std::cout << "Accumulated (msec) std::nth_element " << ac2 / 1000000
+              << std::endl;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    std::cout << "--------------- nth_element parallel ----------------\n";
+    function01(vm["vector_size"].as<std::size_t>());
+    std::cout << "--------------------- end ---------------------------\n";
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ("vector_size", value<std::size_t>()->default_value(
+#if defined(HPX_DEBUG)
+            100000
+#else
+            10000000
+#endif
+            ), "number of elements to select from");
+    // clang-format on
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
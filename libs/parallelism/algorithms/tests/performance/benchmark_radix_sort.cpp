@@ -0,0 +1,213 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/parallel/algorithms/radix_sort.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+template <typename T>
+std::vector<T> make_data(std::size_t size, std::true_type)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<T> dist;
+
+    std::vector<T> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return dist(gen); });
+    return c;
+}
+
+template <typename T>
+std::vector<T> make_data(std::size_t size, std::false_type)
+{
+    std::mt19937 gen(seed);
+    std::normal_distribution<T> dist(T(0), T(1e6));
+
+    std::vector<T> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return dist(gen); });
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename F>
+double run_sort_benchmark(int test_count, std::vector<T> const& src, F&& f)
+{
+    std::uint64_t time = 0;
+    for (int i = 0; i < test_count; ++i)
+    {
+        std::vector<T> c = src;
+
+        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+        f(c);
+        time += hpx::chrono::high_resolution_clock::now() - start;
+
+        HPX_TEST(std::is_sorted(c.begin(), c.end()));
+    }
+    return (time * 1e-9) / test_count;
+}
+
+template <typename T, typename F>
+double run_sort_by_key_benchmark(
+    int test_count, std::vector<T> const& src, F&& f)
+{
+    std::uint64_t time = 0;
+    for (int i = 0; i < test_count; ++i)
+    {
+        std::vector<T> keys = src;
+        std::vector<std::uint32_t> values(keys.size());
+        std::iota(values.begin(), values.end(), std::uint32_t(0));
+
+        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+        f(keys, values);
+        time += hpx::chrono::high_resolution_clock::now() - start;
+
+        HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+    }
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void run_benchmark(std::string const& type, std::size_t vector_size,
+    int test_count)
+{
+    using namespace hpx::execution;
+
+    std::vector<T> const src = make_data<T>(vector_size,
+        std::integral_constant<bool, std::is_integral<T>::value>());
+
+    std::cout << "* Running Benchmark (" << type << ")..." << std::endl;
+
+    double time_std = run_sort_benchmark(test_count, src,
+        [](std::vector<T>& c) { std::sort(c.begin(), c.end()); });
+
+    // a user supplied comparison disables the radix sort
+    double time_par_compare =
+        run_sort_benchmark(test_count, src, [](std::vector<T>& c) {
+            hpx::parallel::sort(par, c.begin(), c.end(),
+                [](T lhs, T rhs) { return lhs < rhs; });
+        });
+
+    double time_par =
+        run_sort_benchmark(test_count, src, [](std::vector<T>& c) {
+            hpx::parallel::sort(par, c.begin(), c.end());
+        });
+
+    double time_radix_seq =
+        run_sort_benchmark(test_count, src, [](std::vector<T>& c) {
+            hpx::parallel::radix_sort(seq, c.begin(), c.end());
+        });
+
+    double time_by_key_compare = run_sort_by_key_benchmark(test_count, src,
+        [](std::vector<T>& keys, std::vector<std::uint32_t>& values) {
+            hpx::parallel::sort_by_key(par, keys.begin(), keys.end(),
+                values.begin(), [](T lhs, T rhs) { return lhs < rhs; });
+        });
+
+    double time_by_key = run_sort_by_key_benchmark(test_count, src,
+        [](std::vector<T>& keys, std::vector<std::uint32_t>& values) {
+            hpx::parallel::sort_by_key(
+                par, keys.begin(), keys.end(), values.begin());
+        });
+
+    std::cout << "\n-------------- Benchmark Result --------------"
+              << std::endl;
+    auto fmt = "sort {1} ({2}) : {3}(sec)";
+    hpx::util::format_to(std::cout, fmt, type, "std", time_std) << std::endl;
+    hpx::util::format_to(std::cout, fmt, type, "par, comparison sort",
+        time_par_compare)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, type, "par, radix sort", time_par)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, type, "seq, radix sort",
+        time_radix_seq)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, type, "par, by key, comparison sort",
+        time_by_key_compare)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, type, "par, by key, radix sort",
+        time_by_key)
+        << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    // pull values from cmd
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    int test_count = vm["test_count"].as<int>();
+
+    std::size_t const os_threads = hpx::get_os_thread_count();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "vector_size  : " << vector_size << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "os threads   : " << os_threads << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    run_benchmark<std::uint32_t>("uint32_t", vector_size, test_count);
+    run_benchmark<std::int64_t>("int64_t", vector_size, test_count);
+    run_benchmark<float>("float", vector_size, test_count);
+    run_benchmark<double>("double", vector_size, test_count);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size",
+            hpx::program_options::value<std::size_t>()->default_value(10000000),
+            "number of elements to sort (default: 10000000)")
+        ("test_count",
+            hpx::program_options::value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", hpx::program_options::value<unsigned int>(),
+            "the random number generator seed to use for this run");
+    // clang-format on
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,160 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename Comp>
+void verify_nth_element(std::vector<std::uint64_t> const& c,
+    std::vector<std::uint64_t> const& expected, std::size_t n, Comp comp)
+{
+    HPX_TEST_EQ(c[n], expected[n]);
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        HPX_TEST(!comp(c[n], c[i]));
+    }
+    for (std::size_t i = n + 1; i != c.size(); ++i)
+    {
+        HPX_TEST(!comp(c[i], c[n]));
+    }
+}
+
+// c holds (possibly duplicate) random values
+std::vector<std::uint64_t> make_data(std::size_t size, std::uint64_t range)
+{
+    std::vector<std::uint64_t> c(size);
+    std::uniform_int_distribution<std::uint64_t> dis(0, range - 1);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+    return c;
+}
+
+void test_nth_element(std::size_t size, std::uint64_t range)
+{
+    std::vector<std::uint64_t> const data = make_data(size, range);
+
+    std::vector<std::uint64_t> expected = data;
+    std::sort(expected.begin(), expected.end());
+
+    std::uniform_int_distribution<std::size_t> dis(0, size - 1);
+    std::size_t const n = dis(gen);
+
+    {
+        std::vector<std::uint64_t> c = data;
+        hpx::nth_element(c.begin(), c.begin() + n, c.end());
+        verify_nth_element(c, expected, n, std::less<std::uint64_t>());
+    }
+
+    {
+        std::vector<std::uint64_t> c = data;
+        hpx::nth_element(
+            hpx::execution::seq, c.begin(), c.begin() + n, c.end());
+        verify_nth_element(c, expected, n, std::less<std::uint64_t>());
+    }
+
+    {
+        std::vector<std::uint64_t> c = data;
+        hpx::nth_element(
+            hpx::execution::par, c.begin(), c.begin() + n, c.end());
+        verify_nth_element(c, expected, n, std::less<std::uint64_t>());
+    }
+
+    {
+        std::vector<std::uint64_t> c = data;
+        hpx::future<void> f = hpx::nth_element(
+            hpx::execution::par(hpx::execution::task), c.begin(),
+            c.begin() + n, c.end());
+        f.get();
+        verify_nth_element(c, expected, n, std::less<std::uint64_t>());
+    }
+
+    {
+        hpx::execution::parallel_executor exec;
+        std::vector<std::uint64_t> c = data;
+        hpx::future<void> f = hpx::nth_element(
+            hpx::execution::par(hpx::execution::task).on(exec), c.begin(),
+            c.begin() + n, c.end());
+        f.get();
+        verify_nth_element(c, expected, n, std::less<std::uint64_t>());
+    }
+}
+
+void test_nth_element_comp(std::size_t size)
+{
+    std::vector<std::uint64_t> const data = make_data(size, size);
+
+    std::vector<std::uint64_t> expected = data;
+    std::sort(expected.begin(), expected.end(), std::greater<std::uint64_t>());
+
+    for (std::size_t n : {std::size_t(0), size / 3, size - 1})
+    {
+        std::vector<std::uint64_t> c = data;
+        hpx::nth_element(hpx::execution::par, c.begin(), c.begin() + n,
+            c.end(), std::greater<std::uint64_t>());
+        verify_nth_element(c, expected, n, std::greater<std::uint64_t>());
+    }
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    // small ranges are handled sequentially, large ranges in parallel
+    test_nth_element(1, 10);
+    test_nth_element(1000, 1000);
+    test_nth_element(1000000, 1000000);
+
+    // many duplicates
+    test_nth_element(1000000, 16);
+    test_nth_element(1000000, 1);
+
+    test_nth_element_comp(1000000);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
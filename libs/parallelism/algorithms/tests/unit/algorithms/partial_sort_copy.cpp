@@ -0,0 +1,150 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/partial_sort_copy.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+std::vector<std::uint64_t> make_data(std::size_t size, std::uint64_t range)
+{
+    std::vector<std::uint64_t> c(size);
+    std::uniform_int_distribution<std::uint64_t> dis(0, range - 1);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+    return c;
+}
+
+void verify_partial_sort_copy(std::vector<std::uint64_t> const& expected,
+    std::vector<std::uint64_t> const& d, std::size_t count,
+    std::vector<std::uint64_t>::iterator result)
+{
+    HPX_TEST(result == d.begin() + count);
+    HPX_TEST(std::equal(d.begin(), d.begin() + count, expected.begin()));
+}
+
+void test_partial_sort_copy(
+    std::size_t size, std::size_t dest_size, std::uint64_t range)
+{
+    std::vector<std::uint64_t> const data = make_data(size, range);
+
+    std::vector<std::uint64_t> expected = data;
+    std::sort(expected.begin(), expected.end());
+
+    std::size_t const count = (std::min)(size, dest_size);
+
+    {
+        std::vector<std::uint64_t> d(dest_size);
+        auto result = hpx::partial_sort_copy(
+            data.begin(), data.end(), d.begin(), d.end());
+        verify_partial_sort_copy(expected, d, count, result);
+    }
+
+    {
+        std::vector<std::uint64_t> d(dest_size);
+        auto result = hpx::partial_sort_copy(hpx::execution::seq,
+            data.begin(), data.end(), d.begin(), d.end());
+        verify_partial_sort_copy(expected, d, count, result);
+    }
+
+    {
+        std::vector<std::uint64_t> d(dest_size);
+        auto result = hpx::partial_sort_copy(hpx::execution::par,
+            data.begin(), data.end(), d.begin(), d.end());
+        verify_partial_sort_copy(expected, d, count, result);
+    }
+
+    {
+        std::vector<std::uint64_t> d(dest_size);
+        auto f = hpx::partial_sort_copy(
+            hpx::execution::par(hpx::execution::task), data.begin(),
+            data.end(), d.begin(), d.end());
+        verify_partial_sort_copy(expected, d, count, f.get());
+    }
+
+    {
+        auto policy = hpx::execution::par(hpx::execution::task)
+                          .with(hpx::execution::static_chunk_size());
+        std::vector<std::uint64_t> d(dest_size);
+        auto f = hpx::partial_sort_copy(
+            policy, data.begin(), data.end(), d.begin(), d.end());
+        verify_partial_sort_copy(expected, d, count, f.get());
+    }
+}
+
+void test_partial_sort_copy_comp(std::size_t size, std::size_t dest_size)
+{
+    std::vector<std::uint64_t> const data = make_data(size, size);
+
+    std::vector<std::uint64_t> expected = data;
+    std::sort(expected.begin(), expected.end(), std::greater<std::uint64_t>());
+
+    std::vector<std::uint64_t> d(dest_size);
+    auto result = hpx::partial_sort_copy(hpx::execution::par, data.begin(),
+        data.end(), d.begin(), d.end(), std::greater<std::uint64_t>());
+    verify_partial_sort_copy(
+        expected, d, (std::min)(size, dest_size), result);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_partial_sort_copy(0, 10, 10);
+    test_partial_sort_copy(1000, 10, 1000);
+    test_partial_sort_copy(1000, 2000, 1000);
+
+    // large ranges are handled in parallel
+    test_partial_sort_copy(1000000, 1, 1000000);
+    test_partial_sort_copy(1000000, 1000, 1000000);
+    test_partial_sort_copy(1000000, 500000, 1000000);
+    test_partial_sort_copy(1000000, 2000000, 1000000);
+    test_partial_sort_copy(1000000, 1000, 16);
+
+    test_partial_sort_copy_comp(1000000, 1000);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
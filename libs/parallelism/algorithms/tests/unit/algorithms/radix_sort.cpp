@@ -0,0 +1,335 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/radix_sort.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_DEBUG)
+#define HPX_RADIX_SORT_TEST_SIZE (1 << 12)
+#else
+#define HPX_RADIX_SORT_TEST_SIZE (1 << 20)
+#endif
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> make_data(std::size_t size, std::true_type)
+{
+    // std::uniform_int_distribution does not support character types
+    using dist_type =
+        typename std::conditional<(sizeof(T) < sizeof(int)), int, T>::type;
+    std::uniform_int_distribution<dist_type> dis(
+        (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    std::vector<T> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return T(dis(gen)); });
+    return c;
+}
+
+template <typename T>
+std::vector<T> make_data(std::size_t size, std::false_type)
+{
+    std::normal_distribution<T> dis(T(0), T(1e6));
+
+    std::vector<T> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+
+    // make sure that the special values sort correctly as well
+    if (size > 4)
+    {
+        c[0] = T(-0.0);
+        c[1] = T(0.0);
+        c[2] = -(std::numeric_limits<T>::infinity)();
+        c[3] = (std::numeric_limits<T>::infinity)();
+    }
+    return c;
+}
+
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    return make_data<T>(
+        size, std::integral_constant<bool, std::is_integral<T>::value>());
+}
+
+// Return a sorted copy of the given data. Copying and sorting the data in
+// the test functions triggers bogus -Wfree-nonheap-object warnings for
+// std::int8_t with gcc 12 (-O3).
+template <typename T>
+std::vector<T> sorted(std::vector<T> c)
+{
+    std::sort(c.begin(), c.end());
+    return c;
+}
+
+// -0.0 and 0.0 are equivalent, their relative order after sorting is
+// unspecified
+template <typename T>
+bool equal_sorted(std::vector<T> const& lhs, std::vector<T> const& rhs)
+{
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(),
+        [](T a, T b) { return !(a < b) && !(b < a); });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy>
+void test_radix_sort(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<T> c = make_data<T>(size);
+    std::vector<T> const expected = sorted(c);
+
+    // explicit radix sort
+    std::vector<T> d = c;
+    auto result = hpx::parallel::radix_sort(policy, d.begin(), d.end());
+    HPX_TEST(result == d.end());
+    HPX_TEST(equal_sorted(d, expected));
+
+    // sort with the default comparison selects the radix sort for parallel
+    // policies
+    d = c;
+    hpx::parallel::sort(policy, d.begin(), d.end());
+    HPX_TEST(equal_sorted(d, expected));
+
+    // a user supplied comparison is always honored
+    d = c;
+    hpx::parallel::sort(policy, d.begin(), d.end(), std::greater<T>());
+    HPX_TEST(std::equal(d.begin(), d.end(), expected.rbegin(),
+        [](T a, T b) { return !(a < b) && !(b < a); }));
+}
+
+template <typename T, typename ExPolicy>
+void test_radix_sort_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<T> c = make_data<T>(size);
+    std::vector<T> const expected = sorted(c);
+
+    auto f = hpx::parallel::radix_sort(policy, c.begin(), c.end());
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST(equal_sorted(c, expected));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// executor running the scheduled work only after the gate was opened
+struct gated_executor : hpx::execution::parallel_executor
+{
+    explicit gated_executor(hpx::shared_future<void> gate)
+      : gate_(std::move(gate))
+    {
+    }
+
+    template <typename F>
+    hpx::future<typename hpx::util::invoke_result<F>::type> async_execute(
+        F&& f)
+    {
+        return gate_.then(hpx::launch::async,
+            [f = std::forward<F>(f)](
+                hpx::shared_future<void> const&) mutable { return f(); });
+    }
+
+    hpx::shared_future<void> gate_;
+};
+
+namespace hpx { namespace parallel { namespace execution {
+    template <>
+    struct is_two_way_executor<gated_executor> : std::true_type
+    {
+    };
+}}}    // namespace hpx::parallel::execution
+
+// the asynchronous algorithms return before sorting anything
+template <typename T>
+void test_radix_sort_nonblocking(std::size_t size)
+{
+    using namespace hpx::execution;
+
+    std::vector<T> const c = make_data<T>(size);
+    std::vector<T> const expected = sorted(c);
+
+    std::vector<std::size_t> values(size);
+    for (std::size_t i = 0; i != size; ++i)
+        values[i] = i;
+
+    hpx::lcos::local::promise<void> gate;
+    auto policy = par(task).on(gated_executor(gate.get_shared_future()));
+
+    std::vector<T> d1 = c;
+    auto f1 = hpx::parallel::radix_sort(policy, d1.begin(), d1.end());
+
+    std::vector<T> d2 = c;
+    auto f2 = hpx::parallel::sort(policy, d2.begin(), d2.end());
+
+    std::vector<T> d3 = c;
+    auto f3 = hpx::parallel::radix_sort_by_key(
+        policy, d3.begin(), d3.end(), values.begin());
+
+    HPX_TEST(!f1.is_ready());
+    HPX_TEST(!f2.is_ready());
+    HPX_TEST(!f3.is_ready());
+    HPX_TEST(d1 == c);
+    HPX_TEST(d2 == c);
+    HPX_TEST(d3 == c);
+
+    gate.set_value();
+
+    HPX_TEST(f1.get() == d1.end());
+    HPX_TEST(equal_sorted(d1, expected));
+    HPX_TEST(f2.get() == d2.end());
+    HPX_TEST(equal_sorted(d2, expected));
+    HPX_TEST(hpx::get<0>(f3.get()) == d3.end());
+    HPX_TEST(equal_sorted(d3, expected));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy>
+void test_radix_sort_by_key(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<T> keys = make_data<T>(size);
+    std::vector<std::size_t> values(size);
+    for (std::size_t i = 0; i != size; ++i)
+        values[i] = i;
+
+    std::vector<T> const o_keys = keys;
+
+    auto result = hpx::parallel::radix_sort_by_key(
+        policy, keys.begin(), keys.end(), values.begin());
+    HPX_TEST(hpx::get<0>(result) == keys.end());
+    HPX_TEST(hpx::get<1>(result) == values.end());
+
+    // the values must follow their keys, equal keys have to keep their
+    // original order
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+    bool is_stable = true;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        if (o_keys[values[i]] < keys[i] || keys[i] < o_keys[values[i]])
+            is_stable = false;
+        if (i != 0 && !(keys[i - 1] < keys[i]) && values[i - 1] > values[i])
+            is_stable = false;
+    }
+    HPX_TEST(is_stable);
+
+    // sort_by_key with the default comparison selects the radix sort for
+    // parallel policies
+    std::vector<T> keys2 = o_keys;
+    std::vector<std::size_t> values2(size);
+    for (std::size_t i = 0; i != size; ++i)
+        values2[i] = i;
+
+    hpx::parallel::sort_by_key(
+        policy, keys2.begin(), keys2.end(), values2.begin());
+    HPX_TEST(equal_sorted(keys2, keys));
+
+    bool values_follow_keys = true;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        if (o_keys[values2[i]] < keys2[i] || keys2[i] < o_keys[values2[i]])
+            values_follow_keys = false;
+    }
+    HPX_TEST(values_follow_keys);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void test_radix_sort()
+{
+    using namespace hpx::execution;
+
+    for (std::size_t size : {std::size_t(0), std::size_t(1),
+             std::size_t(1000), std::size_t(HPX_RADIX_SORT_TEST_SIZE)})
+    {
+        test_radix_sort<T>(seq, size);
+        test_radix_sort<T>(par, size);
+        test_radix_sort<T>(par_unseq, size);
+
+        test_radix_sort_async<T>(seq(task), size);
+        test_radix_sort_async<T>(par(task), size);
+
+        test_radix_sort_by_key<T>(seq, size);
+        test_radix_sort_by_key<T>(par, size);
+        test_radix_sort_by_key<T>(par_unseq, size);
+    }
+}
+
+// keys which differ in their lowest byte only
+void test_radix_sort_narrow_range()
+{
+    std::vector<std::int64_t> c(HPX_RADIX_SORT_TEST_SIZE);
+    std::uniform_int_distribution<std::int64_t> dis(-100, 100);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+
+    std::vector<std::int64_t> const expected = sorted(c);
+
+    hpx::parallel::radix_sort(hpx::execution::par, c.begin(), c.end());
+    HPX_TEST(c == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_radix_sort<std::int8_t>();
+    test_radix_sort<std::uint16_t>();
+    test_radix_sort<std::int32_t>();
+    test_radix_sort<std::uint32_t>();
+    test_radix_sort<std::int64_t>();
+    test_radix_sort<std::uint64_t>();
+    test_radix_sort<float>();
+    test_radix_sort<double>();
+
+    test_radix_sort_narrow_range();
+
+    test_radix_sort_nonblocking<std::int32_t>(std::size_t(1) << 17);
+    test_radix_sort_nonblocking<double>(std::size_t(1) << 17);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
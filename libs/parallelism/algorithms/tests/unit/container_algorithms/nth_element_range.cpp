@@ -0,0 +1,144 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/container_algorithms/nth_element.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+struct element
+{
+    std::uint64_t key;
+    std::uint64_t value;
+};
+
+template <typename ExPolicy>
+void test_nth_element_range(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::uint64_t> c(size);
+    std::uniform_int_distribution<std::uint64_t> dis(0, size);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+
+    std::vector<std::uint64_t> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    std::size_t const n = size / 2;
+    auto result = hpx::ranges::nth_element(policy, c, c.begin() + n);
+
+    HPX_TEST(result == c.end());
+    HPX_TEST_EQ(c[n], expected[n]);
+    HPX_TEST(std::all_of(c.begin(), c.begin() + n,
+        [&](std::uint64_t v) { return v <= c[n]; }));
+    HPX_TEST(std::all_of(c.begin() + n, c.end(),
+        [&](std::uint64_t v) { return v >= c[n]; }));
+}
+
+template <typename ExPolicy>
+void test_nth_element_range_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::uint64_t> c(size);
+    std::uniform_int_distribution<std::uint64_t> dis(0, size);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+
+    std::vector<std::uint64_t> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    std::size_t const n = size / 3;
+    auto f = hpx::ranges::nth_element(
+        policy, c.begin(), c.begin() + n, c.end(), std::less<>());
+
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST_EQ(c[n], expected[n]);
+}
+
+template <typename ExPolicy>
+void test_nth_element_range_projection(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<element> c(size);
+    std::uniform_int_distribution<std::uint64_t> dis(0, size);
+    std::generate(c.begin(), c.end(), [&]() {
+        return element{dis(gen), 0};
+    });
+
+    std::vector<element> expected = c;
+    std::sort(expected.begin(), expected.end(),
+        [](element const& lhs, element const& rhs) {
+            return lhs.key > rhs.key;
+        });
+
+    std::size_t const n = size / 4;
+    hpx::ranges::nth_element(policy, c, c.begin() + n,
+        std::greater<std::uint64_t>(), &element::key);
+
+    HPX_TEST_EQ(c[n].key, expected[n].key);
+}
+
+void nth_element_range_test(std::size_t size)
+{
+    using namespace hpx::execution;
+
+    {
+        std::vector<std::uint64_t> c(size);
+        std::iota(c.rbegin(), c.rend(), 0);
+        hpx::ranges::nth_element(c, c.begin() + size / 2);
+        HPX_TEST_EQ(c[size / 2], size / 2);
+    }
+
+    test_nth_element_range(seq, size);
+    test_nth_element_range(par, size);
+    test_nth_element_range(par_unseq, size);
+
+    test_nth_element_range_async(seq(task), size);
+    test_nth_element_range_async(par(task), size);
+
+    test_nth_element_range_projection(seq, size);
+    test_nth_element_range_projection(par, size);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    nth_element_range_test(10007);
+    nth_element_range_test(1000007);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with a non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,158 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/container_algorithms/partial_sort_copy.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+struct element
+{
+    std::uint64_t key;
+    std::uint64_t value;
+};
+
+std::vector<std::uint64_t> make_data(std::size_t size)
+{
+    std::vector<std::uint64_t> c(size);
+    std::uniform_int_distribution<std::uint64_t> dis(0, size);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+    return c;
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_range(
+    ExPolicy&& policy, std::size_t size, std::size_t dest_size)
+{
+    std::vector<std::uint64_t> const c = make_data(size);
+    std::vector<std::uint64_t> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    std::size_t const count = (std::min)(size, dest_size);
+
+    std::vector<std::uint64_t> d(dest_size);
+    auto result = hpx::ranges::partial_sort_copy(policy, c, d);
+
+    HPX_TEST(result.in == c.end());
+    HPX_TEST(result.out == d.begin() + count);
+    HPX_TEST(std::equal(d.begin(), d.begin() + count, expected.begin()));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_range_async(
+    ExPolicy&& policy, std::size_t size, std::size_t dest_size)
+{
+    std::vector<std::uint64_t> const c = make_data(size);
+    std::vector<std::uint64_t> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    std::size_t const count = (std::min)(size, dest_size);
+
+    std::vector<std::uint64_t> d(dest_size);
+    auto f = hpx::ranges::partial_sort_copy(
+        policy, c.begin(), c.end(), d.begin(), d.end());
+    auto result = f.get();
+
+    HPX_TEST(result.in == c.end());
+    HPX_TEST(result.out == d.begin() + count);
+    HPX_TEST(std::equal(d.begin(), d.begin() + count, expected.begin()));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_range_projection(
+    ExPolicy&& policy, std::size_t size, std::size_t dest_size)
+{
+    std::vector<element> c(size);
+    std::uniform_int_distribution<std::uint64_t> dis(0, size);
+    std::generate(c.begin(), c.end(), [&]() {
+        return element{dis(gen), 0};
+    });
+
+    std::vector<element> expected = c;
+    std::sort(expected.begin(), expected.end(),
+        [](element const& lhs, element const& rhs) {
+            return lhs.key > rhs.key;
+        });
+
+    std::size_t const count = (std::min)(size, dest_size);
+
+    std::vector<element> d(dest_size);
+    hpx::ranges::partial_sort_copy(
+        policy, c, d, std::greater<std::uint64_t>(), &element::key);
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(d[i].key, expected[i].key);
+    }
+}
+
+void partial_sort_copy_range_test(std::size_t size, std::size_t dest_size)
+{
+    using namespace hpx::execution;
+
+    {
+        std::vector<std::uint64_t> const c = make_data(size);
+        std::vector<std::uint64_t> d(dest_size);
+        auto result = hpx::ranges::partial_sort_copy(c, d);
+        HPX_TEST(result.out == d.begin() + (std::min)(size, dest_size));
+        HPX_TEST(std::is_sorted(d.begin(), result.out));
+    }
+
+    test_partial_sort_copy_range(seq, size, dest_size);
+    test_partial_sort_copy_range(par, size, dest_size);
+    test_partial_sort_copy_range(par_unseq, size, dest_size);
+
+    test_partial_sort_copy_range_async(seq(task), size, dest_size);
+    test_partial_sort_copy_range_async(par(task), size, dest_size);
+
+    test_partial_sort_copy_range_projection(seq, size, dest_size);
+    test_partial_sort_copy_range_projection(par, size, dest_size);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    partial_sort_copy_range_test(10007, 100);
+    partial_sort_copy_range_test(1000007, 1000);
+    partial_sort_copy_range_test(1000007, 2000000);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with a non-zero status");
+
+    return hpx::util::report_errors();
+}
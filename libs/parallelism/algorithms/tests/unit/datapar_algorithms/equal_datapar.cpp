@@ -0,0 +1,154 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/include/datapar.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/equal.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+std::uniform_int_distribution<> dis(0, 1000);
+
+// the second sequence is shifted against the first one to exercise the
+// handling of sequences with different alignment
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_equal(ExPolicy policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef typename std::vector<T>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<T> c1(10007);
+    std::generate(std::begin(c1), std::end(c1), []() { return T(dis(gen)); });
+
+    std::size_t shift = dis(gen) % 16;
+    std::vector<T> c2(c1.size() + shift);
+    std::copy(std::begin(c1), std::end(c1), std::begin(c2) + shift);
+
+    auto first2 = std::begin(c2) + shift;
+    auto equal_to = [](auto v1, auto v2) { return v1 == v2; };
+
+    bool result = hpx::equal(policy, iterator(std::begin(c1)),
+        iterator(std::end(c1)), iterator(first2), equal_to);
+    HPX_TEST(result);
+
+    result = hpx::equal(policy, iterator(std::begin(c1)),
+        iterator(std::end(c1)), iterator(first2), iterator(std::end(c2)),
+        equal_to);
+    HPX_TEST(result);
+
+    first2[dis(gen) % c1.size()] += T(1);
+
+    result = hpx::equal(policy, iterator(std::begin(c1)),
+        iterator(std::end(c1)), iterator(first2), equal_to);
+    HPX_TEST(!result);
+
+    result = hpx::equal(policy, iterator(std::begin(c1)),
+        iterator(std::end(c1)), iterator(first2), iterator(std::end(c2)),
+        equal_to);
+    HPX_TEST(!result);
+}
+
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_equal_async(ExPolicy p, IteratorTag)
+{
+    typedef typename std::vector<T>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<T> c1(10007);
+    std::generate(std::begin(c1), std::end(c1), []() { return T(dis(gen)); });
+
+    std::size_t shift = dis(gen) % 16;
+    std::vector<T> c2(c1.size() + shift);
+    std::copy(std::begin(c1), std::end(c1), std::begin(c2) + shift);
+
+    auto first2 = std::begin(c2) + shift;
+    auto equal_to = [](auto v1, auto v2) { return v1 == v2; };
+
+    hpx::future<bool> result = hpx::equal(p, iterator(std::begin(c1)),
+        iterator(std::end(c1)), iterator(first2), equal_to);
+    HPX_TEST(result.get());
+
+    first2[dis(gen) % c1.size()] += T(1);
+
+    result = hpx::equal(p, iterator(std::begin(c1)), iterator(std::end(c1)),
+        iterator(first2), iterator(std::end(c2)), equal_to);
+    HPX_TEST(!result.get());
+}
+
+template <typename T, typename IteratorTag>
+void test_equal()
+{
+    using namespace hpx::execution;
+
+    test_equal<T>(dataseq, IteratorTag());
+    test_equal<T>(datapar, IteratorTag());
+
+    test_equal_async<T>(dataseq(task), IteratorTag());
+    test_equal_async<T>(datapar(task), IteratorTag());
+}
+
+void equal_test()
+{
+    test_equal<std::int32_t, std::random_access_iterator_tag>();
+    test_equal<std::int64_t, std::random_access_iterator_tag>();
+    test_equal<float, std::random_access_iterator_tag>();
+    test_equal<double, std::random_access_iterator_tag>();
+    test_equal<std::int32_t, std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    equal_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,149 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/include/datapar.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/find.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+std::uniform_int_distribution<> dis(0, 1000);
+
+// the sequences start at a random offset to exercise the handling of data
+// which is not aligned for the vector packs
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_find(ExPolicy policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef typename std::vector<T>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<T> c(10007);
+    std::generate(std::begin(c), std::end(c), []() { return T(dis(gen)); });
+
+    auto first = std::begin(c) + dis(gen) % 16;
+    std::size_t pos = dis(gen) % (std::distance(first, std::end(c)) - 1);
+    first[pos] = T(2000);
+    first[pos + 1] = T(2000);
+
+    iterator it = hpx::find(
+        policy, iterator(first), iterator(std::end(c)), T(2000));
+    HPX_TEST(it.base() == first + pos);
+
+    it = hpx::find_if(policy, iterator(first), iterator(std::end(c)),
+        [](auto v) { return v > 1000; });
+    HPX_TEST(it.base() == first + pos);
+
+    it = hpx::find_if_not(policy, iterator(first), iterator(std::end(c)),
+        [](auto v) { return v <= 1000; });
+    HPX_TEST(it.base() == first + pos);
+
+    // no element satisfies the predicate
+    it = hpx::find_if(policy, iterator(first), iterator(std::end(c)),
+        [](auto v) { return v > 3000; });
+    HPX_TEST(it.base() == std::end(c));
+}
+
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_find_async(ExPolicy p, IteratorTag)
+{
+    typedef typename std::vector<T>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<T> c(10007);
+    std::generate(std::begin(c), std::end(c), []() { return T(dis(gen)); });
+
+    auto first = std::begin(c) + dis(gen) % 16;
+    std::size_t pos = dis(gen) % (std::distance(first, std::end(c)) - 1);
+    first[pos] = T(2000);
+    first[pos + 1] = T(2000);
+
+    hpx::future<iterator> f =
+        hpx::find(p, iterator(first), iterator(std::end(c)), T(2000));
+    HPX_TEST(f.get().base() == first + pos);
+
+    f = hpx::find_if(p, iterator(first), iterator(std::end(c)),
+        [](auto v) { return v > 1000; });
+    HPX_TEST(f.get().base() == first + pos);
+
+    f = hpx::find_if_not(p, iterator(first), iterator(std::end(c)),
+        [](auto v) { return v <= 1000; });
+    HPX_TEST(f.get().base() == first + pos);
+}
+
+template <typename T, typename IteratorTag>
+void test_find()
+{
+    using namespace hpx::execution;
+
+    test_find<T>(dataseq, IteratorTag());
+    test_find<T>(datapar, IteratorTag());
+
+    test_find_async<T>(dataseq(task), IteratorTag());
+    test_find_async<T>(datapar(task), IteratorTag());
+}
+
+void find_test()
+{
+    test_find<std::int32_t, std::random_access_iterator_tag>();
+    test_find<std::int64_t, std::random_access_iterator_tag>();
+    test_find<float, std::random_access_iterator_tag>();
+    test_find<double, std::random_access_iterator_tag>();
+    test_find<std::int32_t, std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    find_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
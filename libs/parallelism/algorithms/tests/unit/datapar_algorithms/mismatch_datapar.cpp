@@ -0,0 +1,158 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/include/datapar.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/mismatch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+std::uniform_int_distribution<> dis(0, 1000);
+
+// the second sequence is shifted against the first one to exercise the
+// handling of sequences with different alignment
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_mismatch(ExPolicy policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef typename std::vector<T>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<T> c1(10007);
+    std::generate(std::begin(c1), std::end(c1), []() { return T(dis(gen)); });
+
+    std::size_t shift = dis(gen) % 16;
+    std::vector<T> c2(c1.size() + shift);
+    std::copy(std::begin(c1), std::end(c1), std::begin(c2) + shift);
+
+    auto first2 = std::begin(c2) + shift;
+    auto equal_to = [](auto v1, auto v2) { return v1 == v2; };
+
+    auto result = hpx::mismatch(policy, iterator(std::begin(c1)),
+        iterator(std::end(c1)), iterator(first2), equal_to);
+    HPX_TEST(result.first.base() == std::end(c1));
+    HPX_TEST(result.second.base() == std::end(c2));
+
+    std::size_t pos = dis(gen) % c1.size();
+    first2[pos] += T(1);
+
+    result = hpx::mismatch(policy, iterator(std::begin(c1)),
+        iterator(std::end(c1)), iterator(first2), equal_to);
+    HPX_TEST(result.first.base() == std::begin(c1) + pos);
+    HPX_TEST(result.second.base() == first2 + pos);
+
+    result = hpx::mismatch(policy, iterator(std::begin(c1)),
+        iterator(std::end(c1)), iterator(first2), iterator(std::end(c2)),
+        equal_to);
+    HPX_TEST(result.first.base() == std::begin(c1) + pos);
+    HPX_TEST(result.second.base() == first2 + pos);
+}
+
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_mismatch_async(ExPolicy p, IteratorTag)
+{
+    typedef typename std::vector<T>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<T> c1(10007);
+    std::generate(std::begin(c1), std::end(c1), []() { return T(dis(gen)); });
+
+    std::size_t shift = dis(gen) % 16;
+    std::vector<T> c2(c1.size() + shift);
+    std::copy(std::begin(c1), std::end(c1), std::begin(c2) + shift);
+
+    auto first2 = std::begin(c2) + shift;
+    auto equal_to = [](auto v1, auto v2) { return v1 == v2; };
+
+    std::size_t pos = dis(gen) % c1.size();
+    first2[pos] += T(1);
+
+    auto f = hpx::mismatch(p, iterator(std::begin(c1)),
+        iterator(std::end(c1)), iterator(first2), equal_to);
+    auto result = f.get();
+    HPX_TEST(result.first.base() == std::begin(c1) + pos);
+    HPX_TEST(result.second.base() == first2 + pos);
+
+    f = hpx::mismatch(p, iterator(std::begin(c1)), iterator(std::end(c1)),
+        iterator(first2), iterator(std::end(c2)), equal_to);
+    result = f.get();
+    HPX_TEST(result.first.base() == std::begin(c1) + pos);
+    HPX_TEST(result.second.base() == first2 + pos);
+}
+
+template <typename T, typename IteratorTag>
+void test_mismatch()
+{
+    using namespace hpx::execution;
+
+    test_mismatch<T>(dataseq, IteratorTag());
+    test_mismatch<T>(datapar, IteratorTag());
+
+    test_mismatch_async<T>(dataseq(task), IteratorTag());
+    test_mismatch_async<T>(datapar(task), IteratorTag());
+}
+
+void mismatch_test()
+{
+    test_mismatch<std::int32_t, std::random_access_iterator_tag>();
+    test_mismatch<std::int64_t, std::random_access_iterator_tag>();
+    test_mismatch<float, std::random_access_iterator_tag>();
+    test_mismatch<double, std::random_access_iterator_tag>();
+    test_mismatch<std::int32_t, std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    mismatch_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
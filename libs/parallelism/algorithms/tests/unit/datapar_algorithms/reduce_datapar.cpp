@@ -0,0 +1,133 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/include/datapar.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/reduce.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+std::uniform_int_distribution<> dis(0, 1000);
+
+// the sequences start at a random offset to exercise the handling of data
+// which is not aligned for the vector packs
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_reduce(ExPolicy policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef typename std::vector<T>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<T> c(10007);
+    std::generate(std::begin(c), std::end(c), []() { return T(dis(gen)); });
+
+    auto first = std::begin(c) + dis(gen) % 16;
+
+    T val(42);
+    auto op = [](auto v1, auto v2) { return v1 + v2; };
+
+    T r1 = hpx::reduce(policy, iterator(first), iterator(std::end(c)), val, op);
+
+    // verify values
+    T r2 = std::accumulate(first, std::end(c), val);
+    HPX_TEST_EQ(r1, r2);
+}
+
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_reduce_async(ExPolicy p, IteratorTag)
+{
+    typedef typename std::vector<T>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<T> c(10007);
+    std::generate(std::begin(c), std::end(c), []() { return T(dis(gen)); });
+
+    auto first = std::begin(c) + dis(gen) % 16;
+
+    T val(42);
+    auto op = [](auto v1, auto v2) { return v1 + v2; };
+
+    hpx::future<T> f =
+        hpx::reduce(p, iterator(first), iterator(std::end(c)), val, op);
+    f.wait();
+
+    // verify values
+    T r2 = std::accumulate(first, std::end(c), val);
+    HPX_TEST_EQ(f.get(), r2);
+}
+
+template <typename T, typename IteratorTag>
+void test_reduce()
+{
+    using namespace hpx::execution;
+
+    test_reduce<T>(dataseq, IteratorTag());
+    test_reduce<T>(datapar, IteratorTag());
+
+    test_reduce_async<T>(dataseq(task), IteratorTag());
+    test_reduce_async<T>(datapar(task), IteratorTag());
+}
+
+void reduce_test()
+{
+    test_reduce<std::int32_t, std::random_access_iterator_tag>();
+    test_reduce<std::int64_t, std::random_access_iterator_tag>();
+    test_reduce<double, std::random_access_iterator_tag>();
+    test_reduce<std::int32_t, std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    reduce_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,36 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#if defined(HPX_HAVE_CXX17_STD_VARIANT)
+#include <hpx/execution/algorithms/on.hpp>
+#include <hpx/functional/tag_fallback_invoke.hpp>
+
+#include <utility>
+
+namespace hpx { namespace execution { namespace experimental {
+    // schedule_from(scheduler, s) returns a sender which completes on an
+    // execution agent of scheduler with the values sent by s. This is the
+    // same as on(s, scheduler), but with the argument order used by P2300 to
+    // allow schedulers to customize the transition onto their execution
+    // agents separately.
+    HPX_INLINE_CONSTEXPR_VARIABLE struct schedule_from_t final
+      : hpx::functional::tag_fallback<schedule_from_t>
+    {
+    private:
+        template <typename Scheduler, typename Sender>
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            schedule_from_t, Scheduler&& scheduler, Sender&& predecessor_sender)
+        {
+            return detail::on_sender<Sender, Scheduler>{
+                std::forward<Sender>(predecessor_sender),
+                std::forward<Scheduler>(scheduler)};
+        }
+    } schedule_from{};
+}}}    // namespace hpx::execution::experimental
+#endif
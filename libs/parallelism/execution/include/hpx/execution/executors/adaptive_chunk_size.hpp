@@ -0,0 +1,284 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/adaptive_chunk_size.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace execution {
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // The model of the cost of a single loop iteration for one call site
+        // of the parallel algorithms. The model is updated after each
+        // invocation of an algorithm using the call site.
+        class HPX_PARALLELISM_EXPORT adaptive_chunk_size_model
+        {
+        public:
+            explicit adaptive_chunk_size_model(std::string name)
+              : name_(std::move(name))
+            {
+            }
+
+            std::string const& name() const noexcept
+            {
+                return name_;
+            }
+
+            // return whether a cost estimate is available
+            bool has_estimate() const;
+
+            // seed the model with the cost of a single iteration (nanoseconds)
+            void seed(double cost);
+
+            // return the chunk size for the given number of iterations to be
+            // executed on the given number of cores
+            std::size_t get_chunk_size(std::size_t cores, std::size_t count,
+                std::uint64_t target_time);
+
+            // update the model based on the time (nanoseconds) it took to
+            // execute the given number of iterations, scheduling is the time
+            // (nanoseconds) spent creating the chunks
+            void update(std::uint64_t elapsed, std::uint64_t scheduling,
+                std::size_t cores, std::size_t count, std::size_t chunk_size);
+
+            std::size_t get_last_chunk_size() const;
+            std::uint64_t get_cost() const;
+
+        private:
+            mutable hpx::lcos::local::spinlock mtx_;
+            std::string name_;
+
+            double cost_ = 0.0;    // smoothed cost per iteration (nanoseconds)
+            std::size_t chunk_size_ = 0;
+        };
+
+        // Return the model for the given call site, create a new model if
+        // necessary. Models are never deleted.
+        HPX_PARALLELISM_EXPORT adaptive_chunk_size_model&
+        get_adaptive_chunk_size_model(std::string const& name);
+
+        // Return the model for the given call site, or nullptr
+        HPX_PARALLELISM_EXPORT adaptive_chunk_size_model*
+        find_adaptive_chunk_size_model(std::string const& name);
+
+        // Return the names of all known call sites
+        HPX_PARALLELISM_EXPORT std::vector<std::string>
+        get_adaptive_chunk_size_model_names();
+
+        // State of the currently running algorithm invocation, shared by all
+        // copies of an adaptive_chunk_size object.
+        struct adaptive_chunk_size_state
+        {
+            adaptive_chunk_size_model* tag_model_ = nullptr;
+            adaptive_chunk_size_model* model_ = nullptr;
+            std::uint64_t start_ = 0;
+            std::uint64_t scheduling_ = 0;
+            std::size_t cores_ = 0;
+            std::size_t count_ = 0;
+            std::size_t chunk_size_ = 0;
+        };
+        /// \endcond
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces and then assigned to threads.
+    /// The number of loop iterations combined is determined based on an
+    /// online model of the cost of a single loop iteration on a single core.
+    /// The model is kept per call site and is updated after each invocation of
+    /// an algorithm using this executor parameters object, which allows for
+    /// the chunk size to converge towards the configured per-task duration
+    /// even for loops whose cost changes over time.
+    ///
+    /// Call sites are identified by the given tag, or if no tag is given, by
+    /// the type of the function invoked by the algorithm. The models for all
+    /// call sites can be queried using the performance counters
+    /// /parallel/adaptive_chunk_size/chunk_size@<tag> and
+    /// /parallel/adaptive_chunk_size/cost@<tag>.
+    ///
+    /// \note The same adaptive_chunk_size object should not be used by
+    ///       concurrently running algorithms.
+    ///
+    struct adaptive_chunk_size
+    {
+    public:
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \param tag          [in] The name identifying the call site, the
+        ///                     type of the invoked function is used if
+        ///                     the tag is empty.
+        ///
+        /// \note Default constructed \a adaptive_chunk_size executor
+        ///       parameter types will create chunks running for 200
+        ///       microseconds.
+        ///
+        explicit adaptive_chunk_size(std::string tag = std::string())
+          : tag_(std::move(tag))
+          , target_time_(200000)
+          , state_(std::make_shared<detail::adaptive_chunk_size_state>())
+        {
+        }
+
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \param target_time  [in] The time duration each of the created
+        ///                     chunks should run for.
+        /// \param tag          [in] The name identifying the call site, the
+        ///                     type of the invoked function is used if
+        ///                     the tag is empty.
+        ///
+        explicit adaptive_chunk_size(
+            hpx::chrono::steady_duration const& target_time,
+            std::string tag = std::string())
+          : tag_(std::move(tag))
+          , target_time_(target_time.value().count())
+          , state_(std::make_shared<detail::adaptive_chunk_size_state>())
+        {
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        void mark_begin_execution(Executor&&)
+        {
+            state_->model_ = nullptr;
+            state_->start_ = 0;
+            state_->scheduling_ = 0;
+            state_->count_ = 0;
+        }
+
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(
+            Executor& /* exec */, F&& f, std::size_t cores, std::size_t count)
+        {
+            detail::adaptive_chunk_size_model& model = get_model<F>();
+
+            if (!model.has_estimate() && count > 1)
+            {
+                // nothing is known about this call site, measure how long
+                // the execution of 1% of the iterations takes
+                using hpx::chrono::high_resolution_clock;
+                std::uint64_t t = high_resolution_clock::now();
+
+                std::size_t test_chunk_size = f((count + 99) / 100);
+                if (test_chunk_size != 0)
+                {
+                    t = high_resolution_clock::now() - t;
+                    model.seed(double(t) / test_chunk_size);
+                    count -= (std::min)(count, test_chunk_size);
+                }
+            }
+
+            std::size_t chunk_size =
+                model.get_chunk_size(cores, count, target_time_);
+
+            // the iterations executed while seeding the model are not part
+            // of the measured execution
+            state_->model_ = &model;
+            state_->cores_ = cores;
+            state_->count_ = count;
+            state_->chunk_size_ = chunk_size;
+            state_->start_ = hpx::chrono::high_resolution_clock::now();
+
+            return chunk_size;
+        }
+
+        template <typename Executor>
+        void mark_end_of_scheduling(Executor&&)
+        {
+            detail::adaptive_chunk_size_state& state = *state_;
+            if (state.start_ != 0)
+            {
+                state.scheduling_ =
+                    hpx::chrono::high_resolution_clock::now() - state.start_;
+            }
+        }
+
+        template <typename Executor>
+        void mark_end_execution(Executor&&)
+        {
+            detail::adaptive_chunk_size_state& state = *state_;
+            if (state.model_ != nullptr && state.count_ != 0 &&
+                state.start_ != 0)
+            {
+                std::uint64_t elapsed =
+                    hpx::chrono::high_resolution_clock::now() - state.start_;
+                state.model_->update(elapsed, state.scheduling_, state.cores_,
+                    state.count_, state.chunk_size_);
+            }
+            state.model_ = nullptr;
+            state.start_ = 0;
+            state.scheduling_ = 0;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        template <typename F>
+        detail::adaptive_chunk_size_model& get_model()
+        {
+            if (tag_.empty())
+            {
+                // the model for each function type is looked up only once
+                static detail::adaptive_chunk_size_model& model =
+                    detail::get_adaptive_chunk_size_model(
+                        typeid(std::decay_t<F>).name());
+                return model;
+            }
+
+            if (state_->tag_model_ == nullptr)
+            {
+                state_->tag_model_ =
+                    &detail::get_adaptive_chunk_size_model(tag_);
+            }
+            return *state_->tag_model_;
+        }
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int /* version */)
+        {
+            // clang-format off
+            ar & tag_ & target_time_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::string tag_;
+        std::uint64_t target_time_;    // nanoseconds
+        std::shared_ptr<detail::adaptive_chunk_size_state> state_;
+        /// \endcond
+    };
+}}    // namespace hpx::execution
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<hpx::execution::adaptive_chunk_size>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
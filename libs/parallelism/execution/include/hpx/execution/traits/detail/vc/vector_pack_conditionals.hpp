@@ -0,0 +1,48 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_VC)
+#include <Vc/global.h>
+
+#if defined(Vc_IS_VERSION_1) && Vc_IS_VERSION_1
+
+#include <Vc/Vc>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::Vector<T, Abi> choose(
+        typename Vc::Vector<T, Abi>::mask_type const& msk,
+        Vc::Vector<T, Abi> const& v_true, Vc::Vector<T, Abi> const& v_false)
+    {
+        return Vc::iif(msk, v_true, v_false);
+    }
+}}}    // namespace hpx::parallel::traits
+
+#else
+
+#include <Vc/datapar>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::datapar<T, Abi> choose(
+        typename Vc::datapar<T, Abi>::mask_type const& msk,
+        Vc::datapar<T, Abi> const& v_true, Vc::datapar<T, Abi> const& v_false)
+    {
+        Vc::datapar<T, Abi> result = v_false;
+        Vc::where(msk, result) = v_true;
+        return result;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif    // Vc_IS_VERSION_1
+
+#endif
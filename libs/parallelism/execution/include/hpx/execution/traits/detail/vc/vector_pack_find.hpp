@@ -0,0 +1,63 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_VC)
+#include <Vc/global.h>
+
+#if defined(Vc_IS_VERSION_1) && Vc_IS_VERSION_1
+
+#include <Vc/Vc>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_first_of(
+        Vc::Mask<T, Abi> const& mask)
+    {
+        return mask.isEmpty() ? -1 : mask.firstOne();
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_last_of(
+        Vc::Mask<T, Abi> const& mask)
+    {
+        for (int i = int(mask.size()) - 1; i >= 0; --i)
+        {
+            if (mask[i])
+                return i;
+        }
+        return -1;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#else
+
+#include <Vc/datapar>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_first_of(
+        Vc::mask<T, Abi> const& mask)
+    {
+        return Vc::any_of(mask) ? Vc::find_first_set(mask) : -1;
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_last_of(
+        Vc::mask<T, Abi> const& mask)
+    {
+        return Vc::any_of(mask) ? Vc::find_last_set(mask) : -1;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif    // Vc_IS_VERSION_1
+
+#endif
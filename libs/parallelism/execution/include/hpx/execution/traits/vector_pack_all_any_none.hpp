@@ -0,0 +1,35 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits {
+    HPX_HOST_DEVICE HPX_FORCEINLINE bool all_of(bool value)
+    {
+        return value;
+    }
+
+    HPX_HOST_DEVICE HPX_FORCEINLINE bool any_of(bool value)
+    {
+        return value;
+    }
+
+    HPX_HOST_DEVICE HPX_FORCEINLINE bool none_of(bool value)
+    {
+        return !value;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#if defined(HPX_HAVE_DATAPAR)
+
+#if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/vc/vector_pack_all_any_none.hpp>
+#endif
+
+#endif
@@ -0,0 +1,29 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits {
+    // Select the elements of the first value where the mask is set and the
+    // elements of the second value otherwise.
+    template <typename T>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T choose(
+        bool msk, T const& v_true, T const& v_false)
+    {
+        return msk ? v_true : v_false;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#if defined(HPX_HAVE_DATAPAR)
+
+#if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/vc/vector_pack_conditionals.hpp>
+#endif
+
+#endif
@@ -0,0 +1,32 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits {
+    // Return the index of the first (last) element set in the given mask,
+    // or -1 if no element is set.
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_first_of(bool value)
+    {
+        return value ? 0 : -1;
+    }
+
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_last_of(bool value)
+    {
+        return value ? 0 : -1;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#if defined(HPX_HAVE_DATAPAR)
+
+#if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/vc/vector_pack_find.hpp>
+#endif
+
+#endif
@@ -0,0 +1,185 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/adaptive_chunk_size.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace execution { namespace detail {
+
+    namespace {
+
+        // weight of a new measurement when updating the cost estimate
+        constexpr double smoothing_factor = 0.25;
+
+        struct model_registry
+        {
+            hpx::lcos::local::spinlock mtx_;
+            std::map<std::string, std::unique_ptr<adaptive_chunk_size_model>>
+                models_;
+        };
+
+        model_registry& get_model_registry()
+        {
+            static model_registry registry;
+            return registry;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool adaptive_chunk_size_model::has_estimate() const
+    {
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+        return cost_ != 0.0;
+    }
+
+    void adaptive_chunk_size_model::seed(double cost)
+    {
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+        if (cost_ == 0.0)
+        {
+            cost_ = cost;
+        }
+    }
+
+    std::size_t adaptive_chunk_size_model::get_chunk_size(
+        std::size_t cores, std::size_t count, std::uint64_t target_time)
+    {
+        if (cores == 0)
+        {
+            cores = 1;
+        }
+
+        // don't create fewer chunks than cores to keep all of them busy
+        std::size_t const max_chunk_size =
+            (std::max)(std::size_t(1), (count + cores - 1) / cores);
+
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+
+        std::size_t chunk_size = max_chunk_size;
+        if (cost_ != 0.0)
+        {
+            double const iterations = double(target_time) / cost_;
+            if (iterations < double(max_chunk_size))
+            {
+                chunk_size = (std::max)(
+                    std::size_t(1), static_cast<std::size_t>(iterations));
+            }
+        }
+
+        chunk_size_ = chunk_size;
+        return chunk_size;
+    }
+
+    void adaptive_chunk_size_model::update(std::uint64_t elapsed,
+        std::uint64_t scheduling, std::size_t cores, std::size_t count,
+        std::size_t chunk_size)
+    {
+        if (count == 0 || chunk_size == 0)
+        {
+            return;
+        }
+
+        // the number of cores which were actually busy is limited by the
+        // number of created chunks
+        std::size_t const chunks = (count + chunk_size - 1) / chunk_size;
+        std::size_t const busy_cores = (std::max)(
+            std::size_t(1), (std::min)(cores, chunks));
+
+        // the chunks are executed in waves of busy_cores chunks each, the
+        // overall time is determined by the core executing the most
+        // iterations, the other cores are idle during the last wave
+        std::size_t const waves = (chunks + busy_cores - 1) / busy_cores;
+        std::size_t const iterations = (std::min)(count, waves * chunk_size);
+
+        // each chunk has to be created before it can run, remove the share
+        // of the scheduling overhead preceding the chunks on the most loaded
+        // core
+        double const overhead =
+            double(scheduling) * double(waves) / double(chunks);
+        if (double(elapsed) <= overhead)
+        {
+            return;
+        }
+
+        double const cost = (double(elapsed) - overhead) / double(iterations);
+
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+        if (cost_ == 0.0)
+        {
+            cost_ = cost;
+        }
+        else
+        {
+            cost_ += smoothing_factor * (cost - cost_);
+        }
+    }
+
+    std::size_t adaptive_chunk_size_model::get_last_chunk_size() const
+    {
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+        return chunk_size_;
+    }
+
+    std::uint64_t adaptive_chunk_size_model::get_cost() const
+    {
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+        return static_cast<std::uint64_t>(cost_);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    adaptive_chunk_size_model& get_adaptive_chunk_size_model(
+        std::string const& name)
+    {
+        model_registry& registry = get_model_registry();
+
+        std::lock_guard<hpx::lcos::local::spinlock> l(registry.mtx_);
+        auto it = registry.models_.find(name);
+        if (it == registry.models_.end())
+        {
+            it = registry.models_
+                     .emplace(name,
+                         std::unique_ptr<adaptive_chunk_size_model>(
+                             new adaptive_chunk_size_model(name)))
+                     .first;
+        }
+        return *it->second;
+    }
+
+    adaptive_chunk_size_model* find_adaptive_chunk_size_model(
+        std::string const& name)
+    {
+        model_registry& registry = get_model_registry();
+
+        std::lock_guard<hpx::lcos::local::spinlock> l(registry.mtx_);
+        auto it = registry.models_.find(name);
+        return it == registry.models_.end() ? nullptr : it->second.get();
+    }
+
+    std::vector<std::string> get_adaptive_chunk_size_model_names()
+    {
+        model_registry& registry = get_model_registry();
+
+        std::vector<std::string> names;
+
+        std::lock_guard<hpx::lcos::local::spinlock> l(registry.mtx_);
+        names.reserve(registry.models_.size());
+        for (auto const& model : registry.models_)
+        {
+            names.push_back(model.first);
+        }
+        return names;
+    }
+}}}    // namespace hpx::execution::detail
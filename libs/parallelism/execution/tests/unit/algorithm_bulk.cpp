@@ -0,0 +1,170 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include "algorithm_test_utils.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+// This overload is only used to check dispatching. It is not a useful
+// implementation.
+template <typename Shape, typename F>
+auto tag_invoke(ex::bulk_t, custom_sender_tag_invoke s, Shape&&, F&&)
+{
+    s.tag_invoke_overload_called = true;
+    return void_sender{};
+}
+
+int main()
+{
+    // Success path
+    {
+        std::atomic<bool> set_value_called{false};
+        std::vector<int> v(10, 0);
+        auto s = ex::bulk(ex::just(), 10, [&](int i) { ++v[i]; });
+        auto f = [] {};
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+        for (int x : v)
+        {
+            HPX_TEST_EQ(x, 1);
+        }
+    }
+
+    {
+        std::atomic<bool> set_value_called{false};
+        std::vector<int> v(10, 0);
+        auto s = ex::bulk(
+            ex::just(42), std::size_t(10), [&](std::size_t i, int x) {
+                HPX_TEST_EQ(x, 42);
+                v[i] += x;
+            });
+        auto f = [](int x) { HPX_TEST_EQ(x, 42); };
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+        for (int x : v)
+        {
+            HPX_TEST_EQ(x, 42);
+        }
+    }
+
+    {
+        std::atomic<bool> set_value_called{false};
+        std::vector<int> indices = {3, 1, 4, 1, 5};
+        int sum = 0;
+        auto s = ex::bulk(ex::just(custom_type_non_default_constructible{2}),
+            indices, [&](int i, auto const& x) { sum += i * x.x; });
+        auto f = [](auto x) { HPX_TEST_EQ(x.x, 2); };
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+        HPX_TEST_EQ(sum, 28);
+    }
+
+    {
+        std::atomic<bool> set_value_called{false};
+        std::atomic<int> calls{0};
+        auto s = ex::bulk(
+            ex::just(custom_type_non_default_constructible_non_copyable{42}),
+            5, [&](int, auto const& x) {
+                HPX_TEST_EQ(x.x, 42);
+                ++calls;
+            });
+        auto f = [](auto x) { HPX_TEST_EQ(x.x, 42); };
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+        HPX_TEST_EQ(calls, 5);
+    }
+
+    // Empty shape
+    {
+        std::atomic<bool> set_value_called{false};
+        std::atomic<int> calls{0};
+        auto s = ex::bulk(ex::just(), 0, [&](int) { ++calls; });
+        auto f = [] {};
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+        HPX_TEST_EQ(calls, 0);
+    }
+
+    // operator| overload
+    {
+        std::atomic<bool> set_value_called{false};
+        std::atomic<int> calls{0};
+        auto s = void_sender{} | ex::bulk(7, [&](int) { ++calls; }) |
+            ex::bulk(3, [&](int) { ++calls; });
+        auto f = [] {};
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+        HPX_TEST_EQ(calls, 10);
+    }
+
+    // tag_invoke overload
+    {
+        std::atomic<bool> receiver_set_value_called{false};
+        std::atomic<bool> tag_invoke_overload_called{false};
+        auto s = custom_sender_tag_invoke{tag_invoke_overload_called} |
+            ex::bulk(10, [](int) {});
+        auto f = [] {};
+        auto r = callback_receiver<decltype(f)>{f, receiver_set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(receiver_set_value_called);
+        HPX_TEST(tag_invoke_overload_called);
+    }
+
+    // Failure path
+    {
+        std::atomic<bool> set_error_called{false};
+        auto s = ex::bulk(ex::just(), 10, [](int i) {
+            if (i == 3)
+            {
+                throw std::runtime_error("error");
+            }
+        });
+        auto r = error_callback_receiver<decltype(check_exception_ptr)>{
+            check_exception_ptr, set_error_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_error_called);
+    }
+
+    {
+        std::atomic<bool> set_error_called{false};
+        std::atomic<int> calls{0};
+        auto s = error_sender{} | ex::bulk(10, [&](int) { ++calls; });
+        auto r = error_callback_receiver<decltype(check_exception_ptr)>{
+            check_exception_ptr, set_error_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_error_called);
+        HPX_TEST_EQ(calls, 0);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,205 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include "algorithm_test_utils.hpp"
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace ex = hpx::execution::experimental;
+
+// This overload is only used to check dispatching. It is not a useful
+// implementation.
+template <typename Allocator = hpx::util::internal_allocator<>>
+auto tag_invoke(
+    ex::split_t, custom_sender_tag_invoke s, Allocator const& = Allocator{})
+{
+    s.tag_invoke_overload_called = true;
+    return void_sender{};
+}
+
+int main()
+{
+    // Success path
+    {
+        std::atomic<bool> set_value_called{false};
+        auto s1 = void_sender{};
+        auto s2 = ex::split(std::move(s1));
+        auto f = [] {};
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s2), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+    }
+
+    {
+        std::atomic<bool> set_value_called{false};
+        auto s1 = ex::just(0);
+        auto s2 = ex::split(std::move(s1));
+        auto f = [](int x) { HPX_TEST_EQ(x, 0); };
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s2), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+    }
+
+    {
+        std::atomic<bool> set_value_called{false};
+        auto s1 =
+            ex::just(custom_type_non_default_constructible_non_copyable{42});
+        auto s2 = ex::split(std::move(s1));
+        auto f = [](auto& x) { HPX_TEST_EQ(x.x, 42); };
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s2), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+    }
+
+    // The predecessor is started lazily, and only once for all receivers
+    {
+        std::atomic<bool> start_called{false};
+        std::atomic<bool> connect_called{false};
+        std::atomic<bool> tag_invoke_overload_called{false};
+        std::atomic<bool> set_value_called1{false};
+        std::atomic<bool> set_value_called2{false};
+
+        auto s1 = custom_sender{
+            start_called, connect_called, tag_invoke_overload_called};
+        auto s2 = ex::split(std::move(s1));
+        HPX_TEST(connect_called);
+        HPX_TEST(!start_called);
+
+        auto f = [] {};
+        auto r1 = callback_receiver<decltype(f)>{f, set_value_called1};
+        auto os1 = ex::connect(s2, std::move(r1));
+        auto r2 = callback_receiver<decltype(f)>{f, set_value_called2};
+        auto os2 = ex::connect(std::move(s2), std::move(r2));
+        HPX_TEST(!start_called);
+
+        ex::start(os1);
+        HPX_TEST(start_called);
+        HPX_TEST(set_value_called1);
+        HPX_TEST(!set_value_called2);
+
+        ex::start(os2);
+        HPX_TEST(set_value_called2);
+    }
+
+    // operator| overload
+    {
+        std::atomic<bool> set_value_called{false};
+        auto s = void_sender{} | ex::split();
+        auto f = [] {};
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+    }
+
+    // tag_invoke overload
+    {
+        std::atomic<bool> receiver_set_value_called{false};
+        std::atomic<bool> tag_invoke_overload_called{false};
+        auto s =
+            custom_sender_tag_invoke{tag_invoke_overload_called} | ex::split();
+        auto f = [] {};
+        auto r = callback_receiver<decltype(f)>{f, receiver_set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(receiver_set_value_called);
+        HPX_TEST(tag_invoke_overload_called);
+    }
+
+    // Failure path
+    {
+        std::atomic<bool> set_error_called{false};
+        auto s = error_sender{} | ex::split();
+        auto r = error_callback_receiver<decltype(check_exception_ptr)>{
+            check_exception_ptr, set_error_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_error_called);
+    }
+
+    {
+        std::atomic<bool> set_error_called{false};
+        auto s = error_sender{} | ex::split() | ex::split() | ex::split();
+        auto r = error_callback_receiver<decltype(check_exception_ptr)>{
+            check_exception_ptr, set_error_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_error_called);
+    }
+
+    // Chained split calls do not create new shared states
+    {
+        std::atomic<bool> receiver_set_value_called{false};
+        auto s1 = ex::just(42) | ex::split();
+        auto s2 = ex::split(s1);
+        HPX_TEST_EQ(s1.st, s2.st);
+        auto s3 = ex::split(std::move(s2));
+        HPX_TEST_EQ(s1.st, s3.st);
+        auto f = [](int x) { HPX_TEST_EQ(x, 42); };
+        auto r = callback_receiver<decltype(f)>{f, receiver_set_value_called};
+        auto os = ex::connect(std::move(s3), std::move(r));
+        ex::start(os);
+        HPX_TEST(receiver_set_value_called);
+    }
+
+    // Destroying senders which were never started releases the shared state
+    // and the predecessor
+    {
+        auto p = std::make_shared<int>(42);
+        std::weak_ptr<int> wp = p;
+        {
+            auto s1 = ex::just(std::move(p)) | ex::split();
+            auto s2 = s1;
+        }
+        HPX_TEST(wp.expired());
+    }
+
+    {
+        auto p = std::make_shared<int>(42);
+        std::weak_ptr<int> wp = p;
+        {
+            std::atomic<bool> set_value_called{false};
+            auto s = ex::just(std::move(p)) | ex::split();
+            auto f = [](std::shared_ptr<int> const&) {};
+            auto r = callback_receiver<decltype(f)>{f, set_value_called};
+            auto os = ex::connect(std::move(s), std::move(r));
+            HPX_TEST(!set_value_called);
+        }
+        HPX_TEST(wp.expired());
+    }
+
+    // The shared state is released once the started predecessor completed
+    {
+        auto p = std::make_shared<int>(42);
+        std::weak_ptr<int> wp = p;
+        {
+            std::atomic<bool> set_value_called{false};
+            auto s = ex::just(std::move(p)) | ex::split();
+            auto f = [](std::shared_ptr<int> const& x) {
+                HPX_TEST_EQ(*x, 42);
+            };
+            auto r = callback_receiver<decltype(f)>{f, set_value_called};
+            auto os = ex::connect(std::move(s), std::move(r));
+            ex::start(os);
+            HPX_TEST(set_value_called);
+        }
+        HPX_TEST(wp.expired());
+    }
+
+    return hpx::util::report_errors();
+}
@@ -11,6 +11,8 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -135,6 +137,71 @@ void test_persistent_auto_chunk_size()
     }
 }
 
+void test_adaptive_chunk_size()
+{
+    {
+        hpx::execution::adaptive_chunk_size acs;
+        parameters_test(acs);
+    }
+
+    {
+        hpx::execution::adaptive_chunk_size acs("executor_parameters");
+        parameters_test(acs);
+
+        // the model for the tagged call site was updated
+        auto const* model =
+            hpx::execution::detail::find_adaptive_chunk_size_model(
+                "executor_parameters");
+        HPX_TEST(model != nullptr);
+        HPX_TEST_NEQ(model->get_last_chunk_size(), std::size_t(0));
+        HPX_TEST_NEQ(model->get_cost(), std::uint64_t(0));
+    }
+
+    {
+        hpx::execution::adaptive_chunk_size acs(
+            std::chrono::milliseconds(1), "executor_parameters_1ms");
+        parameters_test(acs);
+    }
+
+    {
+        hpx::execution::detail::adaptive_chunk_size_model model("model");
+
+        // without an estimate the iterations are evenly distributed
+        HPX_TEST_EQ(model.get_chunk_size(4, 1000, 200000), std::size_t(250));
+
+        // 1000ns per iteration results in 200 iterations per 200us
+        model.seed(1000.0);
+        HPX_TEST_EQ(
+            model.get_chunk_size(4, 100000, 200000), std::size_t(200));
+
+        // chunks are never larger than necessary to keep all cores busy
+        HPX_TEST_EQ(model.get_chunk_size(4, 400, 200000), std::size_t(100));
+
+        // a measured cost of 2000ns per iteration moves the estimate to
+        // 1250ns per iteration
+        model.update(50000000, 0, 4, 100000, 200);
+        HPX_TEST_EQ(model.get_cost(), std::uint64_t(1250));
+        HPX_TEST_EQ(
+            model.get_chunk_size(4, 100000, 200000), std::size_t(160));
+        HPX_TEST_EQ(model.get_last_chunk_size(), std::size_t(160));
+    }
+
+    {
+        hpx::execution::detail::adaptive_chunk_size_model model("overheads");
+
+        // 4 chunks of at most 300 iterations run concurrently, the time
+        // spent creating a single chunk (100us) is not attributed to the
+        // iterations, neither is the idle time of the core executing the
+        // last, shorter chunk
+        model.update(400000, 400000, 4, 1000, 300);
+        HPX_TEST_EQ(model.get_cost(), std::uint64_t(1000));
+
+        // measurements dominated by the scheduling overheads are ignored
+        model.update(100000, 400000, 4, 1000, 300);
+        HPX_TEST_EQ(model.get_cost(), std::uint64_t(1000));
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 struct timer_hooks_parameters
 {
@@ -192,6 +259,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_guided_chunk_size();
     test_auto_chunk_size();
     test_persistent_auto_chunk_size();
+    test_adaptive_chunk_size();
 
     test_combined_hooks();
 
@@ -18,13 +18,16 @@
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/fused_bulk_execute.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/futures/futures_factory.hpp>
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/synchronization/latch.hpp>
+#include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 
 #include <algorithm>
@@ -35,6 +38,43 @@
 #include <vector>
 
 namespace hpx { namespace parallel { namespace execution { namespace detail {
+    // launch the tasks for the elements [part_begin, part_end) of the shape,
+    // asynchronous tasks are created with a single call into the scheduler
+    template <typename Result, typename F, typename Iter, typename... Ts>
+    void bulk_async_execute_part(std::vector<hpx::future<Result>>& results,
+        std::size_t part_begin, std::size_t part_end, Iter it,
+        threads::thread_pool_base* pool, launch policy,
+        threads::thread_priority priority, threads::thread_stacksize stacksize,
+        threads::thread_schedule_hint hint, F& f, Ts&... ts)
+    {
+        if (policy != launch::async)
+        {
+            for (std::size_t part_i = part_begin; part_i < part_end; ++part_i)
+            {
+                results[part_i] =
+                    hpx::detail::async_launch_policy_dispatch<decltype(
+                        policy)>::call(policy, pool, priority, stacksize, hint,
+                        f, *it, ts...);
+                ++it;
+            }
+            return;
+        }
+
+        std::vector<threads::thread_init_data> data;
+        data.reserve(part_end - part_begin);
+        for (std::size_t part_i = part_begin; part_i < part_end; ++part_i)
+        {
+            lcos::local::futures_factory<Result()> p(
+                util::deferred_call(f, *it, ts...));
+            data.push_back(p.get_thread_init_data(
+                "bulk_async_execute_part", priority, stacksize, hint));
+            results[part_i] = p.get_future();
+            ++it;
+        }
+
+        threads::register_work_bulk(data.data(), data.size(), pool);
+    }
+
     template <typename F, typename S, typename... Ts>
     std::vector<
         hpx::future<typename detail::bulk_function_result<F, S, Ts...>::type>>
@@ -76,15 +116,9 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
                     hint,
                     [&, hint, part_begin, part_end, part_size, f,
                         it]() mutable {
-                        for (std::size_t part_i = part_begin; part_i < part_end;
-                             ++part_i)
-                        {
-                            results[part_i] =
-                                hpx::detail::async_launch_policy_dispatch<
-                                    decltype(policy)>::call(policy, pool,
-                                    priority, stacksize, hint, f, *it, ts...);
-                            ++it;
-                        }
+                        bulk_async_execute_part(results, part_begin, part_end,
+                            it, pool, policy, priority, stacksize, hint, f,
+                            ts...);
                         l.count_down(part_size);
                     });
 
@@ -92,15 +126,9 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
             }
             else
             {
-                for (std::size_t part_i = part_begin; part_i < part_end;
-                     ++part_i)
-                {
-                    results[part_i] =
-                        hpx::detail::async_launch_policy_dispatch<decltype(
-                            policy)>::call(policy, pool, priority, stacksize,
-                            hint, f, *it, ts...);
-                    ++it;
-                }
+                bulk_async_execute_part(results, part_begin, part_end, it,
+                    pool, policy, priority, stacksize, hint, f, ts...);
+                std::advance(it, part_size);
                 l.count_down(part_size);
             }
 
@@ -20,8 +20,12 @@
 #include <hpx/functional/invoke_fused.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/threading/thread.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/timing/high_resolution_timer.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
@@ -40,7 +44,8 @@ namespace hpx { namespace execution { namespace experimental {
     /// executor has reference semantics, i.e. copies of a fork_join_executor
     /// hold a reference to the worker threads of the original instance.
     /// Scheduling work through the executor concurrently from different
-    /// threads is undefined behaviour.
+    /// threads is undefined behaviour, except for nested parallel regions (see
+    /// below).
     ///
     /// The executor keeps a set of worker threads alive for the lifetime of the
     /// executor, meaning other work will not be executed while the executor is
@@ -49,17 +54,33 @@ namespace hpx { namespace execution { namespace experimental {
     /// worker threads is a slow operation the executor should be reused
     /// whenever possible for multiple adjacent parallel algorithms or
     /// invocations of bulk_(a)sync_execute.
+    ///
+    /// Parallel regions may be nested, i.e. the function invoked for an
+    /// element of a parallel region may itself invoke bulk_(a)sync_execute on
+    /// the same executor. A nested region does not create new threads. It is
+    /// executed by the worker thread invoking it together with the worker
+    /// threads of the executor that have run out of work in the enclosing
+    /// region. Each nested region uses at most its share of the worker
+    /// threads, i.e. the number of worker threads divided by the number of
+    /// worker threads which are busy when the nested region is started.
+    /// Nested regions have to be started from the thread that invokes the
+    /// element function, otherwise they are executed sequentially by the
+    /// calling thread.
     class fork_join_executor
     {
     public:
         /// Type of loop schedule for use with the fork_join_executor.
         /// loop_schedule::static_ implies no work-stealing;
         /// loop_schedule::dynamic allows stealing when a worker has finished
-        /// its local work.
+        /// its local work;
+        /// loop_schedule::guided hands out chunks of decreasing size (a
+        /// fraction of the remaining iterations) to the worker threads,
+        /// which balances loops with highly variable iteration cost.
         enum class loop_schedule
         {
             static_,
             dynamic,
+            guided,
         };
 
         /// \cond nointernal
@@ -76,22 +97,84 @@ namespace hpx { namespace execution { namespace experimental {
             {
                 starting = 0,
                 idle = 1,
-                partitioning_work = 2,
+                work_assigned = 2,
                 active = 3,
                 stopping = 4,
                 stopped = 5,
+                reserved = 6,
             };
 
             using queue_type =
                 hpx::concurrency::detail::contiguous_index_queue<std::uint32_t>;
             using queues_type =
                 std::vector<hpx::util::cache_aligned_data<queue_type>>;
-            using thread_states_type = std::vector<
-                hpx::util::cache_aligned_data<std::atomic<thread_state>>>;
-            using thread_function_helper_type = void(void*, void const*, void*,
-                std::size_t, std::size_t, loop_schedule, queues_type&,
-                thread_states_type&, hpx::lcos::local::spinlock&,
-                std::exception_ptr&);
+
+            struct region_data;
+            using thread_function_helper_type = void(region_data&, std::size_t);
+
+            // The data describing a single parallel region. The region is
+            // executed by a number of members, member 0 being the thread
+            // which started the region.
+            struct region_data
+            {
+                region_data(thread_function_helper_type* helper,
+                    void* element_function, void const* shape,
+                    void* argument_pack, std::size_t size,
+                    loop_schedule schedule)
+                  : thread_function_helper_(helper)
+                  , element_function_(element_function)
+                  , shape_(shape)
+                  , argument_pack_(argument_pack)
+                  , size_(size)
+                  , schedule_(schedule)
+                {
+                }
+
+                // The helper function that does the actual work for this
+                // region and pointers to the inputs to bulk_sync_execute.
+                thread_function_helper_type* const thread_function_helper_;
+                void* const element_function_;
+                void const* const shape_;
+                void* const argument_pack_;
+                std::size_t const size_;
+                loop_schedule const schedule_;
+
+                std::size_t num_members_ = 1;
+
+                // The queues for each member (used for the dynamic schedule)
+                queues_type* queues_ = nullptr;
+
+                // The next index to hand out (used for the guided schedule)
+                hpx::util::cache_aligned_data<std::atomic<std::size_t>>
+                    next_index_;
+
+                // The number of members (not counting the thread which
+                // started the region) still executing the region
+                hpx::util::cache_aligned_data<std::atomic<std::size_t>>
+                    num_active_members_;
+
+                hpx::lcos::local::spinlock exception_mutex_;
+                std::exception_ptr exception_;
+            };
+
+            // The data kept for each worker HPX thread.
+            struct thread_data
+            {
+                std::atomic<thread_state> state_{thread_state::starting};
+
+                // The region the thread has been assigned to and its index
+                // in the region. Written before the state is set to
+                // work_assigned.
+                region_data* region_ = nullptr;
+                std::size_t member_index_ = 0;
+
+                // The id of the HPX thread, used to identify the worker
+                // starting a nested region.
+                threads::thread_id_type id_;
+            };
+
+            using threads_type =
+                std::vector<hpx::util::cache_aligned_data<thread_data>>;
 
             // Members that are used for all parallel regions executed through
             // this executor.
@@ -103,106 +186,92 @@ namespace hpx { namespace execution { namespace experimental {
             loop_schedule schedule_ = loop_schedule::static_;
             std::size_t main_thread_;
             std::size_t num_threads_;
-            thread_states_type thread_states_;
-            hpx::lcos::local::spinlock exception_mutex_;
-            std::exception_ptr exception_;
+            threads_type threads_;
             std::chrono::nanoseconds yield_delay_;
 
-            // Members that change for each parallel region.
-
-            // The helper function that does the actual work for a single
-            // parallel region.
-            std::atomic<thread_function_helper_type*> thread_function_helper_{
-                nullptr};
-
-            // Pointers to inputs to bulk_sync_execute.
-            std::atomic<void*> element_function_{nullptr};
-            std::atomic<void const*> shape_{nullptr};
-            std::atomic<std::size_t> size_{0};
-            std::atomic<void*> argument_pack_{nullptr};
-
-            // The current queues for each worker HPX thread.
+            // The queues for the outermost parallel region
             queues_type queues_;
 
-            // Entry point for each worker HPX thread. Holds references to the
-            // member variables of fork_join_executor.
+            // Whether an outermost parallel region is being executed
+            std::atomic<bool> region_active_{false};
+
+            // Entry point for each worker HPX thread.
             struct thread_function
             {
-                // Fixed data for the duration of the executor.
-                std::size_t const num_threads_;
+                shared_data& data_;
                 std::size_t const thread_index_;
-                loop_schedule const schedule_;
-                std::atomic<thread_state>& thread_state_;
-                hpx::lcos::local::spinlock& exception_mutex_;
-                std::exception_ptr& exception_;
-                std::chrono::nanoseconds& yield_delay_;
-
-                // Changing data for each parallel region.
-                std::atomic<thread_function_helper_type*>&
-                    thread_function_helper_;
-                std::atomic<void*>& element_function_;
-                std::atomic<void const*>& shape_;
-                std::atomic<std::size_t>& size_;
-                std::atomic<void*>& argument_pack_;
-                queues_type& queues_;
-                thread_states_type& thread_states_;
-
-                void wait_not_state_this_thread(thread_state state)
+
+                void operator()()
                 {
-                    hpx::chrono::high_resolution_timer t;
-                    while (
-                        thread_state_.load(std::memory_order_acquire) == state)
+                    thread_data& self = data_.threads_[thread_index_].data_;
+                    HPX_ASSERT(self.state_ == thread_state::starting);
+
+                    self.id_ = threads::get_self_id();
+                    self.state_.store(
+                        thread_state::idle, std::memory_order_release);
+
+                    while (data_.wait_for_work(self) !=
+                        thread_state::stopping)
                     {
-                        if (t.elapsed_nanoseconds() > yield_delay_.count())
-                        {
-                            hpx::this_thread::yield();
-                        }
+                        data_.run_assigned_work(self);
                     }
+
+                    HPX_ASSERT(self.state_ == thread_state::stopping);
+                    self.state_.store(
+                        thread_state::stopped, std::memory_order_release);
                 }
+            };
 
-                void set_state_this_thread(thread_state state)
+            // Wait until work was assigned to the given thread, or the
+            // executor is being destroyed.
+            thread_state wait_for_work(thread_data& t)
+            {
+                hpx::chrono::high_resolution_timer timer;
+                thread_state state = t.state_.load(std::memory_order_acquire);
+                while (
+                    state == thread_state::idle ||
+                    state == thread_state::reserved)
                 {
-                    thread_state_.store(state, std::memory_order_release);
+                    if (timer.elapsed_nanoseconds() > yield_delay_.count())
+                    {
+                        hpx::this_thread::yield();
+                    }
+                    state = t.state_.load(std::memory_order_acquire);
                 }
+                return state;
+            }
 
-                void operator()()
-                {
-                    HPX_ASSERT(thread_state_ == thread_state::starting);
-                    set_state_this_thread(thread_state::idle);
+            // Execute the part of a region assigned to the given thread.
+            static void run_assigned_work(thread_data& t)
+            {
+                HPX_ASSERT(t.state_ == thread_state::work_assigned);
+                t.state_.store(thread_state::active, std::memory_order_relaxed);
 
-                    do
-                    {
-                        wait_not_state_this_thread(thread_state::idle);
-                        if (thread_state_ == thread_state::stopping)
-                        {
-                            break;
-                        }
+                region_data& region = *t.region_;
+                region.thread_function_helper_(region, t.member_index_);
 
-                        (thread_function_helper_.load(
-                            std::memory_order_relaxed))(
-                            element_function_.load(std::memory_order_relaxed),
-                            shape_.load(std::memory_order_relaxed),
-                            argument_pack_.load(std::memory_order_relaxed),
-                            thread_index_, num_threads_, schedule_, queues_,
-                            thread_states_, exception_mutex_, exception_);
-                    } while (true);
-
-                    HPX_ASSERT(thread_state_ == thread_state::stopping);
-                    set_state_this_thread(thread_state::stopped);
-                }
-            };
+                // The region may not be accessed anymore once the thread which
+                // started it has seen all members finish.
+                region.num_active_members_.data_.fetch_sub(
+                    1, std::memory_order_release);
+
+                t.state_.store(thread_state::idle, std::memory_order_release);
+            }
 
-            void set_state_main_thread(thread_state state)
+            void assign_work(thread_data& t, region_data& region,
+                std::size_t member_index)
             {
-                thread_states_[main_thread_].data_.store(
-                    state, std::memory_order_relaxed);
+                t.region_ = &region;
+                t.member_index_ = member_index;
+                t.state_.store(
+                    thread_state::work_assigned, std::memory_order_release);
             }
 
             void set_state_all(thread_state state)
             {
                 for (std::size_t t = 0; t < num_threads_; ++t)
                 {
-                    thread_states_[t].data_.store(
+                    threads_[t].data_.state_.store(
                         state, std::memory_order_release);
                 }
             }
@@ -211,7 +280,7 @@ namespace hpx { namespace execution { namespace experimental {
             {
                 for (std::size_t t = 0; t < num_threads_; ++t)
                 {
-                    while (thread_states_[t].data_.load(
+                    while (threads_[t].data_.state_.load(
                                std::memory_order_acquire) != state)
                     {
                     }
@@ -224,41 +293,217 @@ namespace hpx { namespace execution { namespace experimental {
                 num_threads_ = pool_->get_os_thread_count();
                 queues_.resize(num_threads_);
 
+                // create all worker HPX threads with a single call into the
+                // scheduler
+                std::vector<threads::thread_init_data> data;
+                data.reserve(num_threads_);
+
                 for (std::size_t t = 0; t < num_threads_; ++t)
                 {
                     if (t == main_thread_)
                     {
-                        thread_states_[t].data_ = thread_state::idle;
+                        threads_[t].data_.state_ = thread_state::idle;
                         continue;
                     }
 
-                    thread_states_[t].data_ = thread_state::starting;
+                    threads_[t].data_.state_ = thread_state::starting;
                     threads::thread_schedule_hint hint{
                         static_cast<std::int16_t>(t)};
-                    hpx::detail::async_launch_policy_dispatch<
-                        launch::async_policy>::call(launch::async, pool_,
-                        priority_, stacksize_, hint,
-                        thread_function{num_threads_, t, schedule_,
-                            thread_states_[t].data_, exception_mutex_,
-                            exception_, yield_delay_, thread_function_helper_,
-                            element_function_, shape_, size_, argument_pack_,
-                            queues_, thread_states_});
+                    data.emplace_back(threads::make_thread_function_nullary(
+                                          thread_function{*this, t}),
+                        util::thread_description("fork_join_executor"),
+                        priority_, hint, stacksize_,
+                        threads::thread_schedule_state::pending);
                 }
 
+                threads::register_work_bulk(data.data(), data.size(), pool_);
+
                 wait_state_all(thread_state::idle);
             }
 
             static void init_local_work_queue(queue_type& queue,
-                std::size_t thread_index, std::size_t num_threads,
+                std::size_t member_index, std::size_t num_members,
                 std::size_t size)
             {
                 auto const part_begin = static_cast<std::uint32_t>(
-                    (thread_index * size) / num_threads);
+                    (member_index * size) / num_members);
                 auto const part_end = static_cast<std::uint32_t>(
-                    ((thread_index + 1) * size) / num_threads);
+                    ((member_index + 1) * size) / num_members);
                 queue.reset(part_begin, part_end);
             }
 
+            static void init_work(region_data& region)
+            {
+                if (region.schedule_ == loop_schedule::dynamic)
+                {
+                    // All queues are initialized before the region starts as
+                    // members may steal from any other member.
+                    queues_type& queues = *region.queues_;
+                    for (std::size_t m = 0; m != region.num_members_; ++m)
+                    {
+                        init_local_work_queue(queues[m].data_, m,
+                            region.num_members_, region.size_);
+                    }
+                }
+                else if (region.schedule_ == loop_schedule::guided)
+                {
+                    region.next_index_.data_.store(
+                        0, std::memory_order_relaxed);
+                }
+            }
+
+            // Return the index of the calling thread in the team, or
+            // num_threads_ if the calling thread is not a member of the team.
+            std::size_t get_thread_index() const
+            {
+                threads::thread_id_type const id = threads::get_self_id();
+                for (std::size_t t = 0; t < num_threads_; ++t)
+                {
+                    if (threads_[t].data_.id_ == id)
+                    {
+                        return t;
+                    }
+                }
+                return num_threads_;
+            }
+
+            // Wait for all members of the given region to finish. The thread
+            // which started the outermost region participates in nested
+            // regions while waiting.
+            void wait_region(region_data& region, thread_data* self)
+            {
+                while (region.num_active_members_.data_.load(
+                           std::memory_order_acquire) != 0)
+                {
+                    if (self != nullptr &&
+                        self->state_.load(std::memory_order_acquire) ==
+                            thread_state::work_assigned)
+                    {
+                        run_assigned_work(*self);
+                    }
+                }
+            }
+
+            // Execute the outermost parallel region using all threads.
+            void execute_region(region_data& region)
+            {
+                thread_data& self = threads_[main_thread_].data_;
+                self.id_ = threads::get_self_id();
+                self.state_.store(
+                    thread_state::active, std::memory_order_relaxed);
+
+                region.num_members_ = num_threads_;
+                region.queues_ = &queues_;
+                region.num_active_members_.data_.store(
+                    num_threads_ - 1, std::memory_order_relaxed);
+                init_work(region);
+
+                // Reserve all worker threads first, otherwise a member which
+                // has already started could claim a thread for a nested region
+                // before it was assigned its part of this region.
+                for (std::size_t t = 0; t < num_threads_; ++t)
+                {
+                    if (t != main_thread_)
+                    {
+                        threads_[t].data_.state_.store(
+                            thread_state::reserved, std::memory_order_relaxed);
+                    }
+                }
+
+                region_active_.store(true, std::memory_order_relaxed);
+
+                // Signal all worker threads to start the actual work.
+                for (std::size_t t = 0; t < num_threads_; ++t)
+                {
+                    if (t != main_thread_)
+                    {
+                        assign_work(threads_[t].data_, region, t);
+                    }
+                }
+
+                // Start work on the main thread.
+                region.thread_function_helper_(region, main_thread_);
+                self.state_.store(
+                    thread_state::idle, std::memory_order_release);
+
+                wait_region(region, &self);
+
+                // Members signal completion of the region before becoming
+                // idle.
+                wait_state_all(thread_state::idle);
+
+                region_active_.store(false, std::memory_order_relaxed);
+            }
+
+            // Execute a parallel region started from within another region
+            // using the calling thread and the idle threads of the team.
+            void execute_nested_region(region_data& region)
+            {
+                std::size_t const thread_index = get_thread_index();
+                if (thread_index == num_threads_)
+                {
+                    // not called from a worker thread, execute sequentially
+                    region.thread_function_helper_(region, 0);
+                    return;
+                }
+
+                // Use at most an equal share of the team for each of the
+                // currently active threads.
+                std::size_t num_active = 0;
+                for (std::size_t t = 0; t < num_threads_; ++t)
+                {
+                    if (threads_[t].data_.state_.load(
+                            std::memory_order_relaxed) == thread_state::active)
+                    {
+                        ++num_active;
+                    }
+                }
+
+                std::size_t const max_members = (std::min)(region.size_,
+                    num_threads_ / (std::max)(num_active, std::size_t(1)));
+
+                // Reserve idle threads, starting with the closest neighbors.
+                std::vector<std::size_t> members;
+                members.reserve(max_members);
+                members.push_back(thread_index);
+
+                for (std::size_t offset = 1;
+                     offset < num_threads_ && members.size() < max_members;
+                     ++offset)
+                {
+                    std::size_t const t =
+                        (thread_index + offset) % num_threads_;
+                    thread_state expected = thread_state::idle;
+                    if (threads_[t].data_.state_.compare_exchange_strong(
+                            expected, thread_state::reserved,
+                            std::memory_order_acquire))
+                    {
+                        members.push_back(t);
+                    }
+                }
+
+                queues_type queues;
+                if (region.schedule_ == loop_schedule::dynamic)
+                {
+                    queues.resize(members.size());
+                }
+
+                region.num_members_ = members.size();
+                region.queues_ = &queues;
+                region.num_active_members_.data_.store(
+                    members.size() - 1, std::memory_order_relaxed);
+                init_work(region);
+
+                for (std::size_t m = 1; m < members.size(); ++m)
+                {
+                    assign_work(threads_[members[m]].data_, region, m);
+                }
+
+                region.thread_function_helper_(region, 0);
+
+                wait_region(region, nullptr);
+            }
+
         public:
             explicit shared_data(threads::thread_priority priority,
                 threads::thread_stacksize stacksize, loop_schedule schedule,
@@ -268,9 +513,7 @@ namespace hpx { namespace execution { namespace experimental {
               , stacksize_(stacksize)
               , schedule_(schedule)
               , num_threads_(pool_->get_os_thread_count())
-              , thread_states_(num_threads_)
-              , exception_mutex_()
-              , exception_()
+              , threads_(num_threads_)
               , yield_delay_(yield_delay)
             {
                 HPX_ASSERT(pool_);
@@ -280,7 +523,8 @@ namespace hpx { namespace execution { namespace experimental {
             ~shared_data()
             {
                 set_state_all(thread_state::stopping);
-                set_state_main_thread(thread_state::stopped);
+                threads_[main_thread_].data_.state_.store(
+                    thread_state::stopped, std::memory_order_relaxed);
                 wait_state_all(thread_state::stopped);
             }
 
@@ -323,95 +567,133 @@ namespace hpx { namespace execution { namespace experimental {
                         f, a, hpx::get<Is_>(std::forward<Tuple_>(t))...);
                 }
 
-                static void set_state(thread_states_type& thread_states,
-                    std::size_t thread_index, thread_state state)
+                static void invoke_range(F& element_function, S const& shape,
+                    Tuple& argument_pack, std::size_t begin, std::size_t end)
                 {
-                    thread_states[thread_index].data_ = state;
+                    auto it = hpx::util::begin(shape);
+                    std::advance(it, begin);
+                    for (std::size_t i = begin; i != end; ++i, ++it)
+                    {
+                        invoke_helper(index_pack_type{}, element_function, *it,
+                            argument_pack);
+                    }
                 }
 
-                /// Main entry point for a single parallel region.
-                static void call(void* element_function_void,
-                    void const* shape_void, void* argument_pack_void,
-                    std::size_t thread_index, std::size_t num_threads,
-                    loop_schedule schedule, queues_type& queues,
-                    thread_states_type& thread_states,
-                    hpx::lcos::local::spinlock& exception_mutex,
-                    std::exception_ptr& exception)
+                static void call_static(region_data& region,
+                    std::size_t member_index, F& element_function,
+                    S const& shape, Tuple& argument_pack)
                 {
-                    try
+                    std::size_t const begin =
+                        (member_index * region.size_) / region.num_members_;
+                    std::size_t const end =
+                        ((member_index + 1) * region.size_) /
+                        region.num_members_;
+
+                    invoke_range(
+                        element_function, shape, argument_pack, begin, end);
+                }
+
+                static void call_dynamic(region_data& region,
+                    std::size_t member_index, F& element_function,
+                    S const& shape, Tuple& argument_pack)
+                {
+                    queues_type& queues = *region.queues_;
+                    std::size_t const num_members = region.num_members_;
+
+                    // Process local items first.
+                    queue_type& local_queue = queues[member_index].data_;
+                    hpx::util::optional<std::uint32_t> index;
+                    while ((index = local_queue.pop_left()))
                     {
-                        // Cast void pointers back to the actual types given to
-                        // bulk_sync_execute.
-                        F& element_function =
-                            *static_cast<F*>(element_function_void);
-                        S const& shape = *static_cast<S const*>(shape_void);
-                        Tuple argument_pack =
-                            *static_cast<Tuple*>(argument_pack_void);
+                        auto it = hpx::util::begin(shape);
+                        std::advance(it, index.value());
+                        invoke_helper(index_pack_type{}, element_function, *it,
+                            argument_pack);
+                    }
 
-                        // Set up the local queues and state.
-                        queue_type& local_queue = queues[thread_index].data_;
-                        std::size_t size = hpx::util::size(shape);
-                        init_local_work_queue(
-                            local_queue, thread_index, num_threads, size);
+                    // Then steal from neighboring members.
+                    for (std::size_t offset = 1; offset < num_members; ++offset)
+                    {
+                        std::size_t neighbor_index =
+                            (member_index + offset) % num_members;
 
-                        set_state(
-                            thread_states, thread_index, thread_state::active);
+                        queue_type& neighbor_queue =
+                            queues[neighbor_index].data_;
 
-                        // Process local items first.
-                        hpx::util::optional<std::uint32_t> index;
-                        while ((index = local_queue.pop_left()))
+                        while ((index = neighbor_queue.pop_right()))
                         {
                             auto it = hpx::util::begin(shape);
                             std::advance(it, index.value());
                             invoke_helper(index_pack_type{}, element_function,
                                 *it, argument_pack);
                         }
+                    }
+                }
 
-                        if (schedule == loop_schedule::static_ ||
-                            num_threads == 1)
+                static void call_guided(region_data& region,
+                    F& element_function, S const& shape, Tuple& argument_pack)
+                {
+                    std::atomic<std::size_t>& next_index =
+                        region.next_index_.data_;
+                    std::size_t const size = region.size_;
+                    std::size_t const divisor = 2 * region.num_members_;
+
+                    std::size_t begin =
+                        next_index.load(std::memory_order_relaxed);
+                    while (begin < size)
+                    {
+                        // Hand out a fraction of the remaining iterations.
+                        std::size_t const chunk_size = (std::max)(
+                            (size - begin) / divisor, std::size_t(1));
+                        std::size_t const end = begin + chunk_size;
+                        if (next_index.compare_exchange_weak(
+                                begin, end, std::memory_order_relaxed))
                         {
-                            set_state(thread_states, thread_index,
-                                thread_state::idle);
-                            return;
+                            invoke_range(element_function, shape,
+                                argument_pack, begin, end);
+                            begin = next_index.load(std::memory_order_relaxed);
                         }
+                    }
+                }
 
-                        // If loop schedule is dynamic, steal from neighboring threads.
-                        for (std::size_t offset = 1; offset < num_threads;
-                             ++offset)
+                /// Main entry point for a single parallel region.
+                static void call(region_data& region, std::size_t member_index)
+                {
+                    try
+                    {
+                        // Cast void pointers back to the actual types given to
+                        // bulk_sync_execute.
+                        F& element_function =
+                            *static_cast<F*>(region.element_function_);
+                        S const& shape = *static_cast<S const*>(region.shape_);
+                        Tuple argument_pack =
+                            *static_cast<Tuple*>(region.argument_pack_);
+
+                        if (region.schedule_ == loop_schedule::static_ ||
+                            region.num_members_ == 1)
+                        {
+                            call_static(region, member_index, element_function,
+                                shape, argument_pack);
+                        }
+                        else if (region.schedule_ == loop_schedule::dynamic)
+                        {
+                            call_dynamic(region, member_index,
+                                element_function, shape, argument_pack);
+                        }
+                        else
                         {
-                            std::size_t neighbor_index =
-                                (thread_index + offset) % num_threads;
-
-                            if (thread_states[neighbor_index].data_.load() !=
-                                thread_state::active)
-                            {
-                                continue;
-                            }
-
-                            queue_type& neighbor_queue =
-                                queues[neighbor_index].data_;
-
-                            while ((index = neighbor_queue.pop_right()))
-                            {
-                                auto it = hpx::util::begin(shape);
-                                std::advance(it, index.value());
-                                invoke_helper(index_pack_type{},
-                                    element_function, *it, argument_pack);
-                            }
-                            set_state(thread_states, thread_index,
-                                thread_state::idle);
+                            call_guided(region, element_function, shape,
+                                argument_pack);
                         }
                     }
                     catch (...)
                     {
                         std::lock_guard<hpx::lcos::local::spinlock> l(
-                            exception_mutex);
-                        if (!exception)
+                            region.exception_mutex_);
+                        if (!region.exception_)
                         {
-                            exception = std::current_exception();
+                            region.exception_ = std::current_exception();
                         }
-                        set_state(
-                            thread_states, thread_index, thread_state::idle);
                     }
                 };
             };
@@ -421,33 +703,28 @@ namespace hpx { namespace execution { namespace experimental {
             void bulk_sync_execute(F&& f, S const& shape, Ts&&... ts)
             {
                 // Set the data for this parallel region
-                element_function_ = static_cast<void*>(&f);
-                shape_ = static_cast<void const*>(&shape);
-                size_ = hpx::util::size(shape);
                 auto argument_pack = hpx::make_tuple<>(std::forward<Ts>(ts)...);
-                argument_pack_ = static_cast<void*>(&argument_pack);
-                thread_function_helper_ =
-                    static_cast<thread_function_helper_type*>(
-                        &thread_function_helper<typename std::decay<F>::type,
-                            typename std::decay<S>::type,
-                            decltype(argument_pack)>::call);
+                using helper_type =
+                    thread_function_helper<typename std::decay<F>::type,
+                        typename std::decay<S>::type, decltype(argument_pack)>;
 
-                // Signal all worker threads to start partitioning work for
-                // themselves, and then starting the actual work.
-                set_state_all(thread_state::partitioning_work);
-
-                // Start work on the main thread.
-                thread_function_helper<typename std::decay<F>::type,
-                    typename std::decay<S>::type,
-                    decltype(argument_pack)>::call(element_function_, shape_,
-                    argument_pack_, main_thread_, num_threads_, schedule_,
-                    queues_, thread_states_, exception_mutex_, exception_);
+                region_data region(&helper_type::call, static_cast<void*>(&f),
+                    static_cast<void const*>(&shape),
+                    static_cast<void*>(&argument_pack), hpx::util::size(shape),
+                    schedule_);
 
-                wait_state_all(thread_state::idle);
+                if (region_active_.load(std::memory_order_relaxed))
+                {
+                    execute_nested_region(region);
+                }
+                else
+                {
+                    execute_region(region);
+                }
 
-                if (exception_)
+                if (region.exception_)
                 {
-                    std::rethrow_exception(std::move(exception_));
+                    std::rethrow_exception(std::move(region.exception_));
                 }
             }
 
@@ -8,15 +8,34 @@
 
 #include <hpx/config.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/execution/algorithms/bulk.hpp>
 #include <hpx/execution/detail/post_policy_dispatch.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
 #include <hpx/execution_base/receiver.hpp>
 #include <hpx/execution_base/sender.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 
+#if defined(HPX_HAVE_CXX17_STD_VARIANT)
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/algorithms/on.hpp>
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_fused.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/type_support/pack.hpp>
+#endif
+
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <iterator>
 #include <type_traits>
 #include <utility>
+#if defined(HPX_HAVE_CXX17_STD_VARIANT)
+#include <variant>
+#endif
 
 namespace hpx { namespace execution { namespace experimental {
     struct executor
@@ -152,6 +171,313 @@ namespace hpx { namespace execution { namespace experimental {
             }
         };
 
+#if defined(HPX_HAVE_CXX17_STD_VARIANT)
+        // The iterations of bulk are split into one contiguous chunk per
+        // worker thread of the pool. Each chunk is executed by a single HPX
+        // thread, the first chunk directly on the thread which completed the
+        // predecessor sender. The chunk finishing last completes the
+        // receiver. No allocations are made per iteration.
+        template <typename Executor, typename Sender, typename Shape,
+            typename F>
+        struct bulk_sender
+        {
+            std::decay_t<Executor> exec;
+            std::decay_t<Sender> s;
+            std::decay_t<Shape> shape;
+            std::decay_t<F> f;
+
+            template <template <typename...> class Tuple,
+                template <typename...> class Variant>
+            using value_types =
+                typename hpx::execution::experimental::sender_traits<
+                    Sender>::template value_types<Tuple, Variant>;
+
+            template <template <typename...> class Variant>
+            using error_types =
+                hpx::util::detail::unique_t<hpx::util::detail::prepend_t<
+                    typename hpx::execution::experimental::sender_traits<
+                        Sender>::template error_types<Variant>,
+                    std::exception_ptr>>;
+
+            static constexpr bool sends_done = false;
+
+            template <typename Receiver>
+            struct operation_state
+            {
+                struct bulk_receiver
+                {
+                    operation_state& os;
+
+                    template <typename E>
+                        void set_error(E&& e) && noexcept
+                    {
+                        hpx::execution::experimental::set_error(
+                            std::move(os.receiver), std::forward<E>(e));
+                    }
+
+                    void set_done() && noexcept
+                    {
+                        hpx::execution::experimental::set_done(
+                            std::move(os.receiver));
+                    };
+
+                    template <typename... Ts>
+                        void set_value(Ts&&... ts) && noexcept
+                    {
+                        os.set_value_predecessor_sender(
+                            std::forward<Ts>(ts)...);
+                    }
+                };
+
+                std::decay_t<Executor> exec;
+                std::decay_t<Shape> shape;
+                std::decay_t<F> f;
+                std::decay_t<Receiver> receiver;
+
+                // The values are stored until the last chunk has finished.
+                template <typename Tuple>
+                struct decay_values
+                {
+                    using type =
+                        hpx::util::detail::transform_t<Tuple, std::decay>;
+                };
+
+                using value_type = hpx::util::detail::prepend_t<
+                    hpx::util::detail::unique_t<hpx::util::detail::transform_t<
+                        typename hpx::execution::experimental::sender_traits<
+                            Sender>::template value_types<hpx::tuple,
+                            std::variant>,
+                        decay_values>>,
+                    std::monostate>;
+                value_type ts;
+
+                std::size_t num_chunks = 0;
+                std::atomic<std::size_t> chunks_remaining{0};
+                std::atomic<bool> exception_thrown{false};
+                std::exception_ptr exception;
+
+                using sender_operation_state_type =
+                    connect_result_t<Sender, bulk_receiver>;
+                sender_operation_state_type sender_os;
+
+                template <typename Sender_, typename Shape_, typename F_,
+                    typename Receiver_>
+                operation_state(Executor const& exec, Sender_&& s,
+                    Shape_&& shape, F_&& f, Receiver_&& receiver)
+                  : exec(exec)
+                  , shape(std::forward<Shape_>(shape))
+                  , f(std::forward<F_>(f))
+                  , receiver(std::forward<Receiver_>(receiver))
+                  , sender_os(hpx::execution::experimental::connect(
+                        std::forward<Sender_>(s), bulk_receiver{*this}))
+                {
+                }
+
+                operation_state(operation_state&&) = delete;
+                operation_state(operation_state const&) = delete;
+                operation_state& operator=(operation_state&&) = delete;
+                operation_state& operator=(operation_state const&) = delete;
+
+                struct set_value_visitor
+                {
+                    std::decay_t<Receiver> receiver;
+
+                    HPX_NORETURN void operator()(std::monostate) const
+                    {
+                        HPX_UNREACHABLE;
+                    }
+
+                    template <typename Ts,
+                        typename = std::enable_if_t<
+                            !std::is_same_v<std::decay_t<Ts>, std::monostate>>>
+                    void operator()(Ts&& ts)
+                    {
+                        hpx::util::invoke_fused(
+                            hpx::util::bind_front(
+                                hpx::execution::experimental::set_value,
+                                std::move(receiver)),
+                            std::forward<Ts>(ts));
+                    }
+                };
+
+                void finish_chunk() noexcept
+                {
+                    if (chunks_remaining.fetch_sub(
+                            1, std::memory_order_acq_rel) != 1)
+                    {
+                        return;
+                    }
+
+                    if (exception_thrown.load(std::memory_order_relaxed))
+                    {
+                        hpx::execution::experimental::set_error(
+                            std::move(receiver), std::move(exception));
+                    }
+                    else
+                    {
+                        std::visit(set_value_visitor{std::move(receiver)},
+                            std::move(ts));
+                    }
+                }
+
+                void store_exception(std::exception_ptr ep) noexcept
+                {
+                    // Only the first exception is reported.
+                    if (!exception_thrown.exchange(true))
+                    {
+                        exception = std::move(ep);
+                    }
+                }
+
+                void execute_chunk(std::size_t chunk) noexcept
+                {
+                    auto&& range =
+                        hpx::execution::experimental::detail::make_bulk_shape(
+                            shape);
+                    auto const size = static_cast<std::size_t>(std::distance(
+                        hpx::util::begin(range), hpx::util::end(range)));
+
+                    auto it = hpx::util::begin(range);
+                    std::advance(it, (chunk * size) / num_chunks);
+                    std::size_t const count =
+                        ((chunk + 1) * size) / num_chunks -
+                        (chunk * size) / num_chunks;
+
+                    try
+                    {
+                        auto invoke_chunk = [&](auto&... vs) {
+                            for (std::size_t i = 0; i != count; ++i, ++it)
+                            {
+                                HPX_INVOKE(f, *it, vs...);
+                            }
+                        };
+
+                        std::visit(
+                            [&](auto& values) {
+                                using values_type =
+                                    std::decay_t<decltype(values)>;
+                                if constexpr (!std::is_same_v<values_type,
+                                                  std::monostate>)
+                                {
+                                    hpx::util::invoke_fused(
+                                        invoke_chunk, values);
+                                }
+                            },
+                            ts);
+                    }
+                    catch (...)
+                    {
+                        store_exception(std::current_exception());
+                    }
+
+                    // The operation state may not be accessed anymore once
+                    // the last chunk has finished.
+                    finish_chunk();
+                }
+
+                template <typename... Ts>
+                void set_value_predecessor_sender(Ts&&... vs) noexcept
+                {
+                    ts.template emplace<hpx::tuple<std::decay_t<Ts>...>>(
+                        std::forward<Ts>(vs)...);
+
+                    auto&& range =
+                        hpx::execution::experimental::detail::make_bulk_shape(
+                            shape);
+                    auto const size = static_cast<std::size_t>(std::distance(
+                        hpx::util::begin(range), hpx::util::end(range)));
+
+                    std::size_t const num_threads =
+                        exec.pool_->get_os_thread_count();
+                    num_chunks = (std::max)(
+                        (std::min)(size, num_threads), std::size_t(1));
+                    chunks_remaining.store(
+                        num_chunks, std::memory_order_relaxed);
+
+                    // Place the chunks on the workers following the one
+                    // executing the first chunk.
+                    std::size_t base_thread =
+                        hpx::get_local_worker_thread_num();
+                    if (base_thread == std::size_t(-1))
+                    {
+                        base_thread = 0;
+                    }
+
+                    hpx::util::thread_description desc(f);
+                    for (std::size_t chunk = 1; chunk != num_chunks; ++chunk)
+                    {
+                        try
+                        {
+                            hpx::threads::thread_schedule_hint hint{
+                                static_cast<std::int16_t>(
+                                    (base_thread + chunk) % num_threads)};
+
+                            using post_dispatch_type = hpx::parallel::
+                                execution::detail::post_policy_dispatch<
+                                    hpx::launch::async_policy>;
+                            post_dispatch_type::call(hpx::launch::async, desc,
+                                exec.pool_, exec.priority_, exec.stacksize_,
+                                hint,
+                                [this, chunk]() { execute_chunk(chunk); });
+                        }
+                        catch (...)
+                        {
+                            store_exception(std::current_exception());
+                            finish_chunk();
+                        }
+                    }
+
+                    execute_chunk(0);
+                }
+
+                void start() & noexcept
+                {
+                    hpx::execution::experimental::start(sender_os);
+                }
+            };
+
+            template <typename Receiver>
+            operation_state<Receiver> connect(Receiver&& receiver) &&
+            {
+                return {exec, std::move(s), std::move(shape), std::move(f),
+                    std::forward<Receiver>(receiver)};
+            }
+
+            template <typename Receiver>
+            operation_state<Receiver> connect(Receiver&& receiver) &
+            {
+                return {exec, s, shape, f, std::forward<Receiver>(receiver)};
+            }
+        };
+
+        template <typename Shape, typename F>
+        friend bulk_sender<executor, sender<executor>, Shape, F> tag_invoke(
+            hpx::execution::experimental::bulk_t, sender<executor> s,
+            Shape&& shape, F&& f)
+        {
+            executor exec = s.exec;
+            return {std::move(exec), std::move(s), std::forward<Shape>(shape),
+                std::forward<F>(f)};
+        }
+
+        template <typename Sender, typename Scheduler, typename Shape,
+            typename F,
+            typename = std::enable_if_t<
+                std::is_same<std::decay_t<Scheduler>, executor>::value>>
+        friend bulk_sender<executor,
+            hpx::execution::experimental::detail::on_sender<Sender, Scheduler>,
+            Shape, F>
+        tag_invoke(hpx::execution::experimental::bulk_t,
+            hpx::execution::experimental::detail::on_sender<Sender, Scheduler>
+                s,
+            Shape&& shape, F&& f)
+        {
+            executor exec = s.scheduler;
+            return {std::move(exec), std::move(s), std::forward<Shape>(shape),
+                std::forward<F>(f)};
+        }
+#endif
+
         template <template <class...> class Tuple,
             template <class...> class Variant>
         using value_types = Variant<Tuple<>>;
@@ -144,6 +144,117 @@ void test_bulk_async_exception()
     HPX_TEST(caught_exception);
 }
 
+void test_bulk_sync_schedule(
+    hpx::execution::experimental::fork_join_executor::loop_schedule schedule)
+{
+    using executor = hpx::execution::experimental::fork_join_executor;
+
+    std::size_t const n = 1007;
+    std::vector<std::atomic<std::size_t>> counts(n);
+    for (auto& c : counts)
+    {
+        c = 0;
+    }
+
+    executor exec(hpx::threads::thread_priority::high,
+        hpx::threads::thread_stacksize::small_, schedule);
+
+    // iterations of highly variable cost
+    hpx::parallel::execution::bulk_sync_execute(
+        exec,
+        [&](std::size_t i) {
+            if (i % 64 == 0)
+            {
+                hpx::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+            ++counts[i];
+        },
+        n);
+
+    for (auto& c : counts)
+    {
+        HPX_TEST_EQ(c.load(), std::size_t(1));
+    }
+}
+
+void test_bulk_sync_nested(
+    hpx::execution::experimental::fork_join_executor::loop_schedule schedule)
+{
+    using executor = hpx::execution::experimental::fork_join_executor;
+
+    std::size_t const outer = 3;
+    std::size_t const inner = 1007;
+    std::vector<std::atomic<std::size_t>> counts(outer * inner);
+    for (auto& c : counts)
+    {
+        c = 0;
+    }
+
+    executor exec(hpx::threads::thread_priority::high,
+        hpx::threads::thread_stacksize::small_, schedule);
+
+    for (int repeat = 0; repeat != 10; ++repeat)
+    {
+        hpx::parallel::execution::bulk_sync_execute(
+            exec,
+            [&](std::size_t i) {
+                hpx::parallel::execution::bulk_sync_execute(
+                    exec,
+                    [&](std::size_t j, std::size_t i) {
+                        ++counts[i * inner + j];
+                    },
+                    inner, i);
+            },
+            outer);
+    }
+
+    for (auto& c : counts)
+    {
+        HPX_TEST_EQ(c.load(), std::size_t(10));
+    }
+
+    // exceptions thrown in nested regions are propagated to the outer region
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::execution::bulk_sync_execute(
+            exec,
+            [&](std::size_t) {
+                hpx::parallel::execution::bulk_sync_execute(
+                    exec, &bulk_test_exception, inner, 42);
+            },
+            outer);
+
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const& /*e*/)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+
+    // the executor is still usable after an exception was thrown
+    hpx::parallel::execution::bulk_sync_execute(
+        exec,
+        [&](std::size_t i) {
+            hpx::parallel::execution::bulk_sync_execute(
+                exec,
+                [&](std::size_t j, std::size_t i) { ++counts[i * inner + j]; },
+                inner, i);
+        },
+        outer);
+
+    for (auto& c : counts)
+    {
+        HPX_TEST_EQ(c.load(), std::size_t(11));
+    }
+}
+
 void static_check_executor()
 {
     using namespace hpx::traits;
@@ -175,6 +286,15 @@ int hpx_main()
     test_bulk_sync_exception();
     test_bulk_async_exception();
 
+    using loop_schedule =
+        hpx::execution::experimental::fork_join_executor::loop_schedule;
+    for (auto schedule : {loop_schedule::static_, loop_schedule::dynamic,
+             loop_schedule::guided})
+    {
+        test_bulk_sync_schedule(schedule);
+        test_bulk_sync_nested(schedule);
+    }
+
     return hpx::local::finalize();
 }
 
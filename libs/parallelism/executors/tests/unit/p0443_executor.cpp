@@ -17,11 +17,14 @@
 #include <chrono>
 #include <cstddef>
 #include <exception>
+#include <mutex>
+#include <set>
 #include <stdexcept>
 #include <string>
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 struct custom_type_non_default_constructible_non_copyable
 {
@@ -1422,6 +1425,145 @@ void test_keep_future_sender()
     }
 }
 
+void test_split()
+{
+    ex::executor exec{};
+
+    {
+        ex::schedule(exec) | ex::split() | ex::sync_wait();
+    }
+
+    {
+        auto s = ex::just_on(exec, 42) | ex::split();
+        HPX_TEST_EQ(ex::sync_wait(std::move(s)), 42);
+    }
+
+    {
+        std::atomic<int> calls{0};
+        auto s = ex::just_on(exec, 42) | ex::transform([&](int x) {
+            ++calls;
+            return x;
+        }) | ex::split();
+        HPX_TEST_EQ(calls, 0);
+        HPX_TEST_EQ(ex::sync_wait(s), 42);
+        HPX_TEST_EQ(ex::sync_wait(s), 42);
+        HPX_TEST_EQ(ex::sync_wait(std::move(s)), 42);
+        HPX_TEST_EQ(calls, 1);
+    }
+
+    {
+        auto s = ex::just_on(exec, 42) | ex::split();
+        auto result = ex::when_all(s | ex::transform([](int x) {
+            return x + 1;
+        }),
+                          s | ex::transform([](int x) { return x + 2; })) |
+            ex::transform([](int x, int y) { return x + y; }) | ex::sync_wait();
+        HPX_TEST_EQ(result, 87);
+    }
+}
+
+void test_schedule_from()
+{
+    ex::executor exec{};
+
+    {
+        auto s = ex::schedule_from(exec, ex::just(42));
+        HPX_TEST_EQ(ex::sync_wait(std::move(s)), 42);
+    }
+
+    {
+        hpx::thread::id parent_id = hpx::this_thread::get_id();
+        auto s = ex::schedule_from(exec, ex::just()) | ex::transform([=]() {
+            HPX_TEST_NEQ(parent_id, hpx::this_thread::get_id());
+        });
+        ex::sync_wait(std::move(s));
+    }
+}
+
+void test_bulk()
+{
+    ex::executor exec{};
+
+    for (std::size_t n : {0, 1, 3, 10, 1007})
+    {
+        std::vector<std::atomic<int>> v(n);
+        for (auto& x : v)
+        {
+            x = 0;
+        }
+
+        ex::schedule(exec) | ex::bulk(n, [&](std::size_t i) { ++v[i]; }) |
+            ex::sync_wait();
+
+        for (auto const& x : v)
+        {
+            HPX_TEST_EQ(x, 1);
+        }
+    }
+
+    // values sent by the predecessor are passed to the function and sent on
+    {
+        std::vector<std::atomic<int>> v(1007);
+        for (auto& x : v)
+        {
+            x = 0;
+        }
+
+        auto s = ex::just(42) | ex::on(exec) |
+            ex::bulk(1007, [&](int i, int x) { v[i] += x; }) |
+            ex::transform([](int x) { return x + 1; });
+        HPX_TEST_EQ(ex::sync_wait(std::move(s)), 43);
+
+        for (auto const& x : v)
+        {
+            HPX_TEST_EQ(x, 42);
+        }
+    }
+
+    // ranges of indices
+    {
+        std::vector<int> indices = {3, 1, 4, 1, 5, 9, 2, 6};
+        std::atomic<int> sum{0};
+        ex::schedule(exec) | ex::bulk(indices, [&](int i) { sum += i; }) |
+            ex::sync_wait();
+        HPX_TEST_EQ(sum, 31);
+    }
+
+    // iterations are executed on more than one thread
+    if (hpx::get_os_thread_count() > 1)
+    {
+        hpx::lcos::local::mutex mtx;
+        std::set<hpx::thread::id> ids;
+        ex::schedule(exec) | ex::bulk(1000, [&](int) {
+            hpx::this_thread::sleep_for(std::chrono::microseconds(10));
+            std::lock_guard<hpx::lcos::local::mutex> l(mtx);
+            ids.insert(hpx::this_thread::get_id());
+        }) | ex::sync_wait();
+        HPX_TEST_LT(std::size_t(1), ids.size());
+    }
+
+    // exceptions thrown by the function are propagated
+    {
+        bool exception_thrown = false;
+        try
+        {
+            ex::schedule(exec) | ex::bulk(1007, [](int i) {
+                if (i == 42)
+                {
+                    throw std::runtime_error("error");
+                }
+            }) | ex::sync_wait();
+            HPX_TEST(false);
+        }
+        catch (std::runtime_error const& e)
+        {
+            HPX_TEST_EQ(std::string(e.what()), std::string("error"));
+            exception_thrown = true;
+        }
+        HPX_TEST(exception_thrown);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main()
 {
@@ -1446,6 +1588,9 @@ int hpx_main()
     test_keep_future_sender();
     test_ensure_started();
     test_ensure_started_when_all();
+    test_split();
+    test_schedule_from();
+    test_bulk();
     test_let_value();
     test_let_error();
     test_detach();
@@ -23,6 +23,7 @@
 #include <hpx/thread_support/atomic_count.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <boost/container/small_vector.hpp>
@@ -30,6 +31,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <mutex>
@@ -199,12 +201,16 @@ namespace hpx { namespace lcos { namespace detail {
     {
         future_data_base()
           : state_(empty)
+          , first_continuation_used_(false)
+          , waiters_(nullptr)
         {
         }
 
         future_data_base(init_no_addref no_addref)
           : future_data_refcnt_base(no_addref)
           , state_(empty)
+          , first_continuation_used_(false)
+          , waiters_(nullptr)
         {
         }
 
@@ -216,6 +222,11 @@ namespace hpx { namespace lcos { namespace detail {
 
         virtual ~future_data_base();
 
+        // The shared state is kept in a single atomic word. Once the future
+        // is ready the word holds exactly one of 'value' or 'exception'. As
+        // long as it is not ready the word holds the head of the list of
+        // registered continuations (the upper bits) and the 'has_waiters'
+        // flag which is set as soon as a thread has blocked on the future.
         enum state
         {
             empty = 0,
@@ -302,10 +313,54 @@ namespace hpx { namespace lcos { namespace detail {
         }
 
     protected:
-        mutable mutex_type mtx_;
-        std::atomic<state> state_;    // current state
-        completed_callback_vector_type on_completed_;
-        local::detail::condition_variable cond_;    // threads waiting in read
+        // flag stored in the state word if at least one thread is blocked
+        // on this future (only valid while the future is not ready)
+        static constexpr std::uintptr_t has_waiters = 2;
+        static constexpr std::uintptr_t flags_mask = 3;
+
+        // node of the intrusive list of registered continuations
+        struct continuation_node
+        {
+            completed_callback_type func_;
+            continuation_node* next_ = nullptr;
+        };
+
+        // synchronization primitives needed only if a thread blocks
+        struct waiters_data
+        {
+            mutex_type mtx_;
+            local::detail::condition_variable cond_;
+        };
+
+        // Atomically make the future ready, wake up all waiting threads, and
+        // invoke all registered continuations. Returns false if the future
+        // was ready already.
+        bool set_ready(state new_state);
+
+        // Release all continuations still referenced from the given state
+        // word without invoking them.
+        void discard_continuations(std::uintptr_t s) noexcept;
+
+        static state get_state(std::uintptr_t s) noexcept
+        {
+            return (s & ready) ? static_cast<state>(s) : empty;
+        }
+
+    private:
+        continuation_node* allocate_continuation(completed_callback_type&& f);
+        void deallocate_continuation(continuation_node* node) noexcept;
+        waiters_data* get_waiters();
+        bool register_waiter(std::uintptr_t& s) noexcept;
+
+    protected:
+        mutable mutex_type mtx_;    // protects state of derived types
+        std::atomic<std::uintptr_t> state_;    // current state
+
+        // the first continuation is stored in place
+        std::atomic<bool> first_continuation_used_;
+        continuation_node first_continuation_;
+
+        std::atomic<waiters_data*> waiters_;    // threads waiting in read
     };
 
     struct in_place
@@ -421,48 +476,16 @@ namespace hpx { namespace lcos { namespace detail {
             result_type* value_ptr = reinterpret_cast<result_type*>(&storage_);
             construct(value_ptr, std::forward<Ts>(ts)...);
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = std::move(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'value' at this
             // point signals to all other threads that this future is ready.
-            state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, value, std::memory_order_release))
+            if (!this->set_ready(value))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_value",
                     "data has already been set for this future");
-                return;
-            }
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(std::move(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
             }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-                handle_on_completed(std::move(on_completed));
         }
 
         void set_exception(std::exception_ptr data) override
@@ -478,48 +501,16 @@ namespace hpx { namespace lcos { namespace detail {
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*) exception_ptr) std::exception_ptr(std::move(data));
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = std::move(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'exception' at this
             // point signals to all other threads that this future is ready.
-            state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, exception, std::memory_order_release))
+            if (!this->set_ready(exception))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_exception",
                     "data has already been set for this future");
-                return;
-            }
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(std::move(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
             }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-                handle_on_completed(std::move(on_completed));
         }
 
         // helper functions for setting data (if successful) or the error (if
@@ -567,7 +558,8 @@ namespace hpx { namespace lcos { namespace detail {
             // and no reader
 
             // release any stored data and callback functions
-            switch (state_.exchange(empty))
+            std::uintptr_t const s = state_.exchange(empty);
+            switch (s)
             {
             case value:
             {
@@ -584,10 +576,11 @@ namespace hpx { namespace lcos { namespace detail {
                 break;
             }
             default:
+                this->discard_continuations(s);
                 break;
             }
 
-            on_completed_.clear();
+            first_continuation_used_.store(false, std::memory_order_relaxed);
         }
 
         std::exception_ptr get_exception_ptr() const override
@@ -597,12 +590,11 @@ namespace hpx { namespace lcos { namespace detail {
         }
 
     protected:
+        using base_type::first_continuation_used_;
         using base_type::mtx_;
-        using base_type::on_completed_;
         using base_type::state_;
 
     private:
-        using base_type::cond_;
         typename future_data_storage<Result>::type storage_;
     };
 
@@ -723,37 +715,40 @@ namespace hpx { namespace lcos { namespace detail {
         {
             hpx::intrusive_ptr<timed_future_data> this_(this);
 
+            // the new thread suspends itself until the given point in time,
+            // it is woken up directly by the timer armed on the worker thread
+            // it runs on
             error_code ec;
             threads::thread_init_data data(
                 threads::make_thread_function_nullary(
-                    [this_ = std::move(this_),
+                    [this_ = std::move(this_), abs_time,
                         init = std::forward<Result_>(init)]() {
+                        error_code ec;
+                        hpx::this_thread::suspend(
+                            hpx::chrono::steady_time_point(abs_time),
+                            "timed_future_data<Result>::timed_future_data", ec);
+                        if (ec)
+                        {
+                            // the thread was aborted, report error to the
+                            // new future
+                            this_->set_exception(
+                                hpx::detail::access_exception(ec));
+                            return;
+                        }
                         this_->set_value(init);
                     }),
                 "timed_future_data<Result>::timed_future_data",
                 threads::thread_priority::boost,
                 threads::thread_schedule_hint(),
                 threads::thread_stacksize::current,
-                threads::thread_schedule_state::suspended, true);
-            threads::thread_id_type id = threads::register_thread(data, ec);
+                threads::thread_schedule_state::pending, true);
+            threads::register_thread(data, ec);
             if (ec)
             {
                 // thread creation failed, report error to the new future
                 this->base_type::set_exception(
                     hpx::detail::access_exception(ec));
             }
-
-            // start new thread at given point in time
-            threads::set_thread_state(id, abs_time,
-                threads::thread_schedule_state::pending,
-                threads::thread_restart_state::timeout,
-                threads::thread_priority::boost, true, ec);
-            if (ec)
-            {
-                // thread scheduling failed, report error to the new future
-                this->base_type::set_exception(
-                    hpx::detail::access_exception(ec));
-            }
         }
     };
 
@@ -869,6 +864,17 @@ namespace hpx { namespace lcos { namespace detail {
             return threads::invalid_thread_id;
         }
 
+        // create the data needed to run this task in a separate thread, the
+        // thread has to be scheduled by the caller
+        virtual threads::thread_init_data get_thread_init_data(
+            const char* /*annotation*/, threads::thread_priority /*priority*/,
+            threads::thread_stacksize /*stacksize*/,
+            threads::thread_schedule_hint /*schedulehint*/)
+        {
+            HPX_ASSERT(false);    // shouldn't ever be called
+            return threads::thread_init_data();
+        }
+
     protected:
         static void run_impl(future_base_type this_)
         {
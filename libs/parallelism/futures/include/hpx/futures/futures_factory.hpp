@@ -21,6 +21,7 @@
 #include <hpx/modules/memory.hpp>
 #include <hpx/threading_base/thread_description.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
 
 #include <cstddef>
@@ -136,6 +137,24 @@ namespace hpx { namespace lcos { namespace local {
                 threads::register_work(data, pool, ec);
                 return threads::invalid_thread_id;
             }
+
+            threads::thread_init_data get_thread_init_data(
+                const char* annotation, threads::thread_priority priority,
+                threads::thread_stacksize stacksize,
+                threads::thread_schedule_hint schedulehint) override
+            {
+                this->check_started();
+
+                typedef typename Base::future_base_type future_base_type;
+                future_base_type this_(this);
+
+                return threads::thread_init_data(
+                    threads::make_thread_function_nullary(util::deferred_call(
+                        &base_type::run_impl, std::move(this_))),
+                    util::thread_description(f_, annotation), priority,
+                    schedulehint, stacksize,
+                    threads::thread_schedule_state::pending);
+            }
         };
 
         template <typename Allocator, typename Result, typename F,
@@ -795,6 +814,29 @@ namespace hpx { namespace lcos { namespace local {
                 schedulehint, ec);
         }
 
+        // Create the data needed to run the task in a separate thread without
+        // scheduling it. This allows to create many tasks with a single call
+        // into the scheduler (see threads::register_work_bulk).
+        threads::thread_init_data get_thread_init_data(
+            const char* annotation = "futures_factory::get_thread_init_data",
+            threads::thread_priority priority =
+                threads::thread_priority::default_,
+            threads::thread_stacksize stacksize =
+                threads::thread_stacksize::default_,
+            threads::thread_schedule_hint schedulehint =
+                threads::thread_schedule_hint()) const
+        {
+            if (!task_)
+            {
+                HPX_THROW_EXCEPTION(task_moved,
+                    "futures_factory<Result()>::get_thread_init_data()",
+                    "futures_factory invalid (has it been moved?)");
+                return threads::thread_init_data();
+            }
+            return task_->get_thread_init_data(
+                annotation, priority, stacksize, schedulehint);
+        }
+
         // This is the same as get_future, except that it moves the
         // shared state into the returned future.
         lcos::future<Result> get_future(error_code& ec = throws)
@@ -18,9 +18,12 @@
 #include <hpx/modules/memory.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <utility>
 
@@ -81,7 +84,11 @@ namespace hpx { namespace lcos { namespace detail {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    future_data_base<traits::detail::future_data_void>::~future_data_base() {}
+    future_data_base<traits::detail::future_data_void>::~future_data_base()
+    {
+        discard_continuations(state_.load(std::memory_order_relaxed));
+        delete waiters_.load(std::memory_order_relaxed);
+    }
 
     static util::unused_type unused_;
 
@@ -105,7 +112,7 @@ namespace hpx { namespace lcos { namespace detail {
         // thread was suspended, in this case we need to load it again.
         if (s == empty)
         {
-            s = state_.load(std::memory_order_relaxed);
+            s = get_state(state_.load(std::memory_order_relaxed));
         }
 
         if (s == value)
@@ -236,6 +243,152 @@ namespace hpx { namespace lcos { namespace detail {
     future_data_base<traits::detail::future_data_void>::handle_on_completed<
         completed_callback_vector_type>(completed_callback_vector_type&&);
 
+    ///////////////////////////////////////////////////////////////////////////
+    future_data_base<traits::detail::future_data_void>::continuation_node*
+    future_data_base<traits::detail::future_data_void>::allocate_continuation(
+        completed_callback_type&& f)
+    {
+        // most futures have at most one continuation attached, use the node
+        // embedded into the shared state if it is still available
+        continuation_node* node = nullptr;
+        if (!first_continuation_used_.load(std::memory_order_relaxed) &&
+            !first_continuation_used_.exchange(true, std::memory_order_acquire))
+        {
+            node = &first_continuation_;
+        }
+        else
+        {
+            node = new continuation_node;
+        }
+
+        node->func_ = std::move(f);
+        return node;
+    }
+
+    void future_data_base<traits::detail::future_data_void>::
+        deallocate_continuation(continuation_node* node) noexcept
+    {
+        if (node == &first_continuation_)
+        {
+            node->func_.reset();
+            node->next_ = nullptr;
+        }
+        else
+        {
+            delete node;
+        }
+    }
+
+    void future_data_base<traits::detail::future_data_void>::
+        discard_continuations(std::uintptr_t s) noexcept
+    {
+        if (s & ready)
+            return;
+
+        continuation_node* node =
+            reinterpret_cast<continuation_node*>(s & ~flags_mask);
+        while (node != nullptr)
+        {
+            continuation_node* next = node->next_;
+            deallocate_continuation(node);
+            node = next;
+        }
+    }
+
+    future_data_base<traits::detail::future_data_void>::waiters_data*
+    future_data_base<traits::detail::future_data_void>::get_waiters()
+    {
+        waiters_data* waiters = waiters_.load(std::memory_order_acquire);
+        if (waiters == nullptr)
+        {
+            std::unique_ptr<waiters_data> new_waiters(new waiters_data);
+            if (waiters_.compare_exchange_strong(waiters, new_waiters.get(),
+                    std::memory_order_acq_rel))
+            {
+                waiters = new_waiters.release();
+            }
+        }
+        return waiters;
+    }
+
+    // Announce that a thread is about to block on this future. Returns false
+    // if the future became ready in the meantime.
+    bool future_data_base<traits::detail::future_data_void>::register_waiter(
+        std::uintptr_t& s) noexcept
+    {
+        while ((s & ready) == 0)
+        {
+            if ((s & has_waiters) != 0 ||
+                state_.compare_exchange_weak(s, s | has_waiters,
+                    std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool future_data_base<traits::detail::future_data_void>::set_ready(
+        state new_state)
+    {
+        // Publish the new state and detach the registered continuations in
+        // one step. Waiting threads and new continuations synchronize with
+        // this exchange only, no lock is involved.
+        std::uintptr_t s = state_.load(std::memory_order_relaxed);
+        do
+        {
+            if (s & ready)
+                return false;
+
+        } while (!state_.compare_exchange_weak(s,
+            static_cast<std::uintptr_t>(new_state), std::memory_order_acq_rel,
+            std::memory_order_relaxed));
+
+        // handle all threads waiting for the future to become ready
+        if (s & has_waiters)
+        {
+            waiters_data* waiters = waiters_.load(std::memory_order_acquire);
+            HPX_ASSERT(waiters != nullptr);
+
+            // Note: we use notify_one repeatedly instead of notify_all as we
+            //       know: a) that most of the time we have at most one thread
+            //       waiting on the future (most futures are not shared), and
+            //       b) our implementation of condition_variable::notify_one
+            //       relinquishes the lock before resuming the waiting thread
+            //       which avoids suspension of this thread when it tries to
+            //       re-lock the mutex while exiting from condition_variable::wait
+            std::unique_lock<mutex_type> l(waiters->mtx_);
+            while (waiters->cond_.notify_one(
+                std::move(l), threads::thread_priority::boost))
+            {
+                l = std::unique_lock<mutex_type>(waiters->mtx_);
+            }
+
+            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
+            //       it unlocked when returning.
+        }
+
+        // invoke the callback (continuation) functions in the order they
+        // were registered
+        continuation_node* node =
+            reinterpret_cast<continuation_node*>(s & ~flags_mask);
+        if (node != nullptr)
+        {
+            completed_callback_vector_type on_completed;
+            while (node != nullptr)
+            {
+                continuation_node* next = node->next_;
+                on_completed.push_back(std::move(node->func_));
+                deallocate_continuation(node);
+                node = next;
+            }
+            std::reverse(on_completed.begin(), on_completed.end());
+
+            handle_on_completed(std::move(on_completed));
+        }
+        return true;
+    }
+
     /// Set the callback which needs to be invoked when the future becomes
     /// ready. If the future is ready the function will be invoked
     /// immediately.
@@ -245,48 +398,61 @@ namespace hpx { namespace lcos { namespace detail {
         if (!data_sink)
             return;
 
-        if (is_ready())
+        std::uintptr_t s = state_.load(std::memory_order_acquire);
+        if (s & ready)
         {
             // invoke the callback (continuation) function right away
             handle_on_completed(std::move(data_sink));
+            return;
         }
-        else
+
+        // push the new continuation onto the list of registered ones
+        continuation_node* node = allocate_continuation(std::move(data_sink));
+        do
         {
-            std::unique_lock<mutex_type> l(mtx_);
-            if (is_ready())
+            if (s & ready)
             {
-                l.unlock();
+                data_sink = std::move(node->func_);
+                deallocate_continuation(node);
 
                 // invoke the callback (continuation) function
                 handle_on_completed(std::move(data_sink));
+                return;
             }
-            else
-            {
-                on_completed_.push_back(std::move(data_sink));
-            }
-        }
+
+            node->next_ = reinterpret_cast<continuation_node*>(s & ~flags_mask);
+
+        } while (!state_.compare_exchange_weak(s,
+            reinterpret_cast<std::uintptr_t>(node) | (s & has_waiters),
+            std::memory_order_acq_rel, std::memory_order_acquire));
     }
 
     future_data_base<traits::detail::future_data_void>::state
     future_data_base<traits::detail::future_data_void>::wait(error_code& ec)
     {
         // block if this entry is empty
-        state s = state_.load(std::memory_order_acquire);
-        if (s == empty)
+        std::uintptr_t s = state_.load(std::memory_order_acquire);
+        if ((s & ready) == 0)
         {
-            std::unique_lock<mutex_type> l(mtx_);
-            s = state_.load(std::memory_order_relaxed);
-            if (s == empty)
+            waiters_data* waiters = get_waiters();
+            if (register_waiter(s))
             {
-                cond_.wait(l, "future_data_base::wait", ec);
-                if (ec)
-                    return s;
+                std::unique_lock<mutex_type> l(waiters->mtx_);
+                s = state_.load(std::memory_order_acquire);
+                if ((s & ready) == 0)
+                {
+                    waiters->cond_.wait(l, "future_data_base::wait", ec);
+                    if (ec)
+                        return empty;
+
+                    s = state_.load(std::memory_order_acquire);
+                }
             }
         }
 
         if (&ec != &throws)
             ec = make_success_code();
-        return s;
+        return get_state(s);
     }
 
     future_status
@@ -294,18 +460,24 @@ namespace hpx { namespace lcos { namespace detail {
         std::chrono::steady_clock::time_point const& abs_time, error_code& ec)
     {
         // block if this entry is empty
-        if (state_.load(std::memory_order_acquire) == empty)
+        std::uintptr_t s = state_.load(std::memory_order_acquire);
+        if ((s & ready) == 0)
         {
-            std::unique_lock<mutex_type> l(mtx_);
-            if (state_.load(std::memory_order_relaxed) == empty)
+            waiters_data* waiters = get_waiters();
+            if (register_waiter(s))
             {
-                threads::thread_restart_state const reason = cond_.wait_until(
-                    l, abs_time, "future_data_base::wait_until", ec);
-                if (ec)
-                    return future_status::uninitialized;
-
-                if (reason == threads::thread_restart_state::timeout)
-                    return future_status::timeout;
+                std::unique_lock<mutex_type> l(waiters->mtx_);
+                if (!is_ready())
+                {
+                    threads::thread_restart_state const reason =
+                        waiters->cond_.wait_until(
+                            l, abs_time, "future_data_base::wait_until", ec);
+                    if (ec)
+                        return future_status::uninitialized;
+
+                    if (reason == threads::thread_restart_state::timeout)
+                        return future_status::timeout;
+                }
             }
         }
 
@@ -11,6 +11,7 @@
 #include <hpx/local/thread.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <memory>
@@ -1505,6 +1506,40 @@ void test_wait_for_three_out_of_five_futures()
     HPX_TEST(hpx::get<4>(result.futures).is_ready());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// continuations and waiters attached concurrently with the future becoming
+// ready must all be handled exactly once
+void test_concurrent_continuations_and_waiters()
+{
+    for (int i = 0; i != 100; ++i)
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::shared_future<int> f = p.get_future();
+
+        std::atomic<int> continuations(0);
+        std::vector<hpx::future<void>> attachers;
+        for (int j = 0; j != 4; ++j)
+        {
+            attachers.push_back(hpx::async([f, &continuations]() {
+                for (int k = 0; k != 10; ++k)
+                {
+                    f.then([&continuations](hpx::shared_future<int>&& f) {
+                         HPX_TEST_EQ(f.get(), 42);
+                         ++continuations;
+                     }).get();
+                }
+            }));
+            attachers.push_back(
+                hpx::async([f]() { HPX_TEST_EQ(f.get(), 42); }));
+        }
+
+        p.set_value(42);
+
+        hpx::wait_all(attachers);
+        HPX_TEST_EQ(continuations.load(), 40);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 using hpx::program_options::options_description;
 using hpx::program_options::variables_map;
@@ -1568,6 +1603,7 @@ int hpx_main(variables_map&)
         test_wait_for_all_five_futures();
         test_wait_for_two_out_of_five_futures();
         test_wait_for_three_out_of_five_futures();
+        test_concurrent_continuations_and_waiters();
     }
 
     hpx::local::finalize();
@@ -0,0 +1,108 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression { namespace detail
+{
+    // the codec used for a message, stored as the first byte of its data
+    enum adaptive_codec : std::uint8_t
+    {
+        codec_none = 0,
+        codec_snappy = 1,
+        codec_zlib = 2,
+        codec_bzip2 = 3,
+        num_codecs = 4
+    };
+
+    // the name of the binary filter plugin implementing the codec
+    char const* get_codec_filter_name(adaptive_codec codec);
+
+    // Estimate of the compressed size of the given data relative to its
+    // size, based on the entropy of the distribution of the byte values.
+    double estimate_entropy_ratio(char const* data, std::size_t size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The cost model used to select the codec for a message. It keeps track
+    // of the throughput and of the compression ratio each codec achieved and
+    // of the bandwidth the bootstrap parcelport achieved, it is shared by all
+    // instances of the adaptive filter.
+    class adaptive_compression_model
+    {
+        using mutex_type = hpx::lcos::local::spinlock;
+
+    public:
+        struct decision
+        {
+            adaptive_codec codec_;
+            double entropy_ratio_;
+        };
+
+        static adaptive_compression_model& instance();
+
+        decision select(char const* data, std::size_t size);
+
+        // the plugin implementing the codec could not be loaded
+        void unavailable(adaptive_codec codec);
+
+        void compressed(decision const& d, std::size_t raw_size,
+            std::size_t compressed_size, std::int64_t time);
+        void uncompressed();
+        void decompressed(std::int64_t time);
+
+        // performance counter data
+        std::int64_t get_compressed_count(bool reset);
+        std::int64_t get_uncompressed_count(bool reset);
+        std::int64_t get_compression_ratio(bool reset);
+        std::int64_t get_compression_time(bool reset);
+        std::int64_t get_decompression_time(bool reset);
+
+    private:
+        adaptive_compression_model();
+
+        // bytes per nanosecond
+        double get_bandwidth();
+
+        struct codec_data
+        {
+            bool available_;
+            double throughput_;    // bytes per nanosecond
+            double efficiency_;    // achieved ratio relative to the estimate
+        };
+
+        std::size_t const min_size_;
+        std::size_t const sample_size_;
+        double const max_ratio_;
+        bool const measure_bandwidth_;
+
+        mutable mutex_type mtx_;
+        codec_data codecs_[num_codecs];
+        double bandwidth_;
+        std::int64_t bytes_sent_;
+        std::int64_t sending_time_;
+        std::atomic<std::int64_t> next_bandwidth_update_;
+
+        std::atomic<std::int64_t> compressed_count_;
+        std::atomic<std::int64_t> uncompressed_count_;
+        std::atomic<std::int64_t> raw_bytes_;
+        std::atomic<std::int64_t> compressed_bytes_;
+        std::atomic<std::int64_t> compression_time_;
+        std::atomic<std::int64_t> decompression_time_;
+    };
+}}}}
+
+#endif
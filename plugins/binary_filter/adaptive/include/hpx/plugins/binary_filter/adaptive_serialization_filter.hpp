@@ -0,0 +1,71 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <hpx/plugins/binary_filter/adaptive_serialization_filter_registration.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+
+#include <hpx/serialization/binary_filter.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    // The adaptive filter decides for every message separately whether and
+    // how it is compressed. Small messages and messages which are unlikely
+    // to compress well are sent as they are, all others are compressed by
+    // the codec which is expected to minimize the time needed to compress
+    // and to transfer the data. The codecs are provided by the other binary
+    // filter plugins (snappy, zlib, bzip2), the first byte of the filtered
+    // data identifies the codec used.
+    struct HPX_LIBRARY_EXPORT adaptive_serialization_filter
+      : public serialization::binary_filter
+    {
+        adaptive_serialization_filter(bool compress = false,
+                serialization::binary_filter* /* next_filter */ = nullptr)
+          : current_(0), flushed_(0), compress_(compress)
+        {}
+
+        void load(void* dst, std::size_t dst_count);
+        void save(void const* src, std::size_t src_count);
+        bool flush(void* dst, std::size_t dst_count, std::size_t& written);
+
+        void set_max_length(std::size_t size);
+        std::size_t init_data(char const* buffer,
+            std::size_t size, std::size_t buffer_size);
+
+    private:
+        void compress();
+
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        HPX_FORCEINLINE void serialize(Archive&, const unsigned int) {}
+
+        HPX_SERIALIZATION_POLYMORPHIC(adaptive_serialization_filter);
+
+        std::vector<char> buffer_;
+        std::vector<char> compressed_;
+        std::unique_ptr<serialization::binary_filter> codec_;
+        std::size_t current_;
+        std::size_t flushed_;
+        bool compress_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
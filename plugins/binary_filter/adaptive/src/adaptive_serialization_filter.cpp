@@ -0,0 +1,477 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/modules/actions.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/runtime/parcelset/parcelhandler.hpp>
+#include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/runtime_distributed.hpp>
+#include <hpx/runtime_distributed/runtime_fwd.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/util/from_string.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <hpx/plugins/plugin_registry.hpp>
+#include <hpx/plugins/binary_filter_factory.hpp>
+#include <hpx/plugins/binary_filter/adaptive_compression_model.hpp>
+#include <hpx/plugins/binary_filter/adaptive_serialization_filter.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::adaptive_serialization_filter,
+    adaptive_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    namespace detail
+    {
+        char const* get_codec_filter_name(adaptive_codec codec)
+        {
+            switch (codec)
+            {
+            case codec_snappy:
+                return "snappy_serialization_filter";
+            case codec_zlib:
+                return "zlib_serialization_filter";
+            case codec_bzip2:
+                return "bzip2_serialization_filter";
+            default:
+                break;
+            }
+            return nullptr;
+        }
+
+        // The order-0 entropy of the byte values bounds the ratio achieved
+        // by entropy coders. Codecs exploiting repetitions do better on
+        // structured data, the model learns this from the achieved ratios.
+        double estimate_entropy_ratio(char const* data, std::size_t size)
+        {
+            if (size == 0)
+                return 1.0;
+
+            std::size_t histogram[256] = {0};
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                ++histogram[static_cast<unsigned char>(data[i])];
+            }
+
+            double entropy = 0.0;
+            for (std::size_t count : histogram)
+            {
+                if (count != 0)
+                {
+                    double const p = double(count) / double(size);
+                    entropy -= p * std::log2(p);
+                }
+            }
+            return entropy / 8.0;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // weight of a new measurement in the running averages of the model
+        constexpr double update_weight = 0.125;
+
+        // the minimal amount of data and the minimal interval between two
+        // measurements of the bandwidth of the bootstrap parcelport
+        constexpr std::int64_t bandwidth_min_bytes = 1048576;
+        constexpr std::int64_t bandwidth_update_interval = 100000000;    // ns
+
+        adaptive_compression_model& adaptive_compression_model::instance()
+        {
+            static adaptive_compression_model model;
+            return model;
+        }
+
+        adaptive_compression_model::adaptive_compression_model()
+          : min_size_(hpx::util::from_string<std::size_t>(
+                get_config_entry(
+                    "hpx.parcel.compression.adaptive.min_size", "4096"),
+                std::size_t(4096)))
+          , sample_size_(4096)
+          , max_ratio_(hpx::util::from_string<double>(
+                get_config_entry(
+                    "hpx.parcel.compression.adaptive.max_ratio", "90"),
+                90.0) / 100.0)
+          , measure_bandwidth_(hpx::util::from_string<int>(
+                get_config_entry(
+                    "hpx.parcel.compression.adaptive.measure_bandwidth", "1"),
+                1) != 0)
+          // MB/s, one MB/s corresponds to 0.001 bytes per nanosecond
+          , bandwidth_(hpx::util::from_string<double>(
+                get_config_entry(
+                    "hpx.parcel.compression.adaptive.bandwidth", "1000"),
+                1000.0) / 1000.0)
+          , bytes_sent_(0)
+          , sending_time_(0)
+          , next_bandwidth_update_(0)
+          , compressed_count_(0)
+          , uncompressed_count_(0)
+          , raw_bytes_(0)
+          , compressed_bytes_(0)
+          , compression_time_(0)
+          , decompression_time_(0)
+        {
+            // initial estimates for the throughput of the codecs and for the
+            // ratio they achieve relative to the entropy estimate, the model
+            // replaces those by the measured values over time
+            codecs_[codec_none] = codec_data{true, 0.0, 1.0};
+            codecs_[codec_snappy] = codec_data{true, 0.25, 1.1};
+            codecs_[codec_zlib] = codec_data{true, 0.03, 0.9};
+            codecs_[codec_bzip2] = codec_data{true, 0.01, 0.8};
+
+            if (bandwidth_ <= 0.0)
+                bandwidth_ = 1.0;
+        }
+
+        adaptive_compression_model::decision adaptive_compression_model::select(
+            char const* data, std::size_t size)
+        {
+            decision d{codec_none, 1.0};
+            if (size < min_size_)
+                return d;
+
+            d.entropy_ratio_ =
+                estimate_entropy_ratio(data, (std::min)(size, sample_size_));
+            if (d.entropy_ratio_ > max_ratio_)
+                return d;
+
+            double const bandwidth = get_bandwidth();
+
+            // pick the codec minimizing the time needed for compressing the
+            // data and for sending the compressed data
+            std::lock_guard<mutex_type> l(mtx_);
+
+            double best = double(size) / bandwidth;
+            for (int c = codec_snappy; c != num_codecs; ++c)
+            {
+                codec_data const& cd = codecs_[c];
+                if (!cd.available_)
+                    continue;
+
+                double const ratio =
+                    (std::min)(1.0, cd.efficiency_ * d.entropy_ratio_);
+                double const cost = double(size) / cd.throughput_ +
+                    double(size) * ratio / bandwidth;
+                if (cost < best)
+                {
+                    best = cost;
+                    d.codec_ = static_cast<adaptive_codec>(c);
+                }
+            }
+            return d;
+        }
+
+        void adaptive_compression_model::unavailable(adaptive_codec codec)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            codecs_[codec].available_ = false;
+        }
+
+        void adaptive_compression_model::compressed(decision const& d,
+            std::size_t raw_size, std::size_t compressed_size,
+            std::int64_t time)
+        {
+            compression_time_ += time;
+            if (compressed_size < raw_size)
+            {
+                ++compressed_count_;
+                raw_bytes_ += static_cast<std::int64_t>(raw_size);
+                compressed_bytes_ += static_cast<std::int64_t>(compressed_size);
+            }
+            else
+            {
+                // the data was sent uncompressed after all
+                ++uncompressed_count_;
+            }
+
+            std::lock_guard<mutex_type> l(mtx_);
+
+            codec_data& cd = codecs_[d.codec_];
+            if (time > 0)
+            {
+                cd.throughput_ += update_weight *
+                    (double(raw_size) / double(time) - cd.throughput_);
+            }
+            if (raw_size != 0 && d.entropy_ratio_ > 0.01)
+            {
+                double const efficiency =
+                    double(compressed_size) / double(raw_size) /
+                    d.entropy_ratio_;
+                cd.efficiency_ += update_weight * (efficiency - cd.efficiency_);
+            }
+        }
+
+        void adaptive_compression_model::uncompressed()
+        {
+            ++uncompressed_count_;
+        }
+
+        void adaptive_compression_model::decompressed(std::int64_t time)
+        {
+            decompression_time_ += time;
+        }
+
+        // The bandwidth is derived from the amount of data sent by the
+        // bootstrap parcelport and from the time it needed for this, the
+        // configured bandwidth is used until enough data was sent.
+        double adaptive_compression_model::get_bandwidth()
+        {
+            std::int64_t const now = static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now());
+            std::int64_t next = next_bandwidth_update_.load();
+            if (measure_bandwidth_ && now >= next &&
+                next_bandwidth_update_.compare_exchange_strong(
+                    next, now + bandwidth_update_interval))
+            {
+                runtime_distributed* rt = get_runtime_distributed_ptr();
+                std::shared_ptr<parcelset::parcelport> pp;
+                if (rt != nullptr)
+                    pp = rt->get_parcel_handler().get_bootstrap_parcelport();
+
+                if (pp)
+                {
+                    std::int64_t const bytes_sent = pp->get_data_sent(false);
+                    std::int64_t const sending_time =
+                        pp->get_sending_time(false);
+
+                    std::lock_guard<mutex_type> l(mtx_);
+                    if (bytes_sent - bytes_sent_ >= bandwidth_min_bytes &&
+                        sending_time > sending_time_)
+                    {
+                        bandwidth_ = double(bytes_sent - bytes_sent_) /
+                            double(sending_time - sending_time_);
+                        bytes_sent_ = bytes_sent;
+                        sending_time_ = sending_time;
+                    }
+                }
+            }
+
+            std::lock_guard<mutex_type> l(mtx_);
+            return bandwidth_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::int64_t adaptive_compression_model::get_compressed_count(
+            bool reset)
+        {
+            return util::get_and_reset_value(compressed_count_, reset);
+        }
+
+        std::int64_t adaptive_compression_model::get_uncompressed_count(
+            bool reset)
+        {
+            return util::get_and_reset_value(uncompressed_count_, reset);
+        }
+
+        // the size of the compressed data relative to the size of the
+        // original data of all compressed messages in 0.1%
+        std::int64_t adaptive_compression_model::get_compression_ratio(
+            bool reset)
+        {
+            std::int64_t const raw =
+                util::get_and_reset_value(raw_bytes_, reset);
+            std::int64_t const compressed =
+                util::get_and_reset_value(compressed_bytes_, reset);
+            return raw == 0 ? 0 : (compressed * 1000) / raw;
+        }
+
+        std::int64_t adaptive_compression_model::get_compression_time(
+            bool reset)
+        {
+            return util::get_and_reset_value(compression_time_, reset);
+        }
+
+        std::int64_t adaptive_compression_model::get_decompression_time(
+            bool reset)
+        {
+            return util::get_and_reset_value(decompression_time_, reset);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    std::size_t adaptive_serialization_filter::init_data(
+        char const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        using namespace detail;
+
+        if (size == 0)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "adaptive_serialization_filter::init_data",
+                "archive data bstream is too short");
+            return 0;
+        }
+
+        current_ = 0;
+
+        adaptive_codec const codec =
+            static_cast<adaptive_codec>(static_cast<unsigned char>(buffer[0]));
+        if (codec == codec_none)
+        {
+            buffer_.assign(buffer + 1, buffer + size);
+            return buffer_.size();
+        }
+
+        char const* name = get_codec_filter_name(codec);
+        if (name == nullptr)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "adaptive_serialization_filter::init_data",
+                hpx::util::format("unknown codec: {}", int(codec)));
+            return 0;
+        }
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+        codec_.reset(hpx::create_binary_filter(name, false));
+        std::size_t const s =
+            codec_->init_data(buffer + 1, size - 1, buffer_size);
+
+        adaptive_compression_model::instance().decompressed(
+            static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now() - start));
+        return s;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (codec_)
+        {
+            codec_->load(dst, dst_count);
+            return;
+        }
+
+        if (current_+dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                    "adaptive_serialization_filter::load",
+                    "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_serialization_filter::save(void const* src,
+        std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(src_begin, src_begin+src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool adaptive_serialization_filter::flush(void* dst,
+        std::size_t dst_count, std::size_t& written)
+    {
+        // the data is compressed at once, flushing may take more than one
+        // call if the destination is too small
+        if (compressed_.empty())
+            compress();
+
+        written = (std::min)(dst_count, compressed_.size() - flushed_);
+        std::memcpy(dst, compressed_.data() + flushed_, written);
+        flushed_ += written;
+
+        return flushed_ == compressed_.size();
+    }
+
+    void adaptive_serialization_filter::compress()
+    {
+        using namespace detail;
+
+        adaptive_compression_model& model =
+            adaptive_compression_model::instance();
+        adaptive_compression_model::decision const d =
+            model.select(buffer_.data(), buffer_.size());
+
+        if (d.codec_ != codec_none)
+        {
+            error_code ec(lightweight);
+            std::unique_ptr<serialization::binary_filter> codec(
+                hpx::create_binary_filter(
+                    get_codec_filter_name(d.codec_), true, nullptr, ec));
+
+            if (ec || !codec)
+            {
+                // the plugin is not available, don't try again
+                model.unavailable(d.codec_);
+                model.uncompressed();
+            }
+            else
+            {
+                std::uint64_t const start =
+                    hpx::chrono::high_resolution_clock::now();
+
+                codec->set_max_length(buffer_.size());
+                codec->save(buffer_.data(), buffer_.size());
+
+                // the same protocol as used by filtered_output_container
+                compressed_.resize(buffer_.size() / 2 + 64);
+                std::size_t current = 1;
+                while (true)
+                {
+                    std::size_t written = 0;
+                    bool const flushed = codec->flush(&compressed_[current],
+                        compressed_.size() - current, written);
+
+                    current += written;
+                    if (flushed)
+                        break;
+
+                    compressed_.resize(2 * compressed_.size());
+                }
+                compressed_.resize(current);
+
+                std::size_t const compressed_size = current - 1;
+                model.compressed(d, buffer_.size(), compressed_size,
+                    static_cast<std::int64_t>(
+                        hpx::chrono::high_resolution_clock::now() - start));
+
+                if (compressed_size < buffer_.size())
+                {
+                    compressed_[0] = static_cast<char>(d.codec_);
+                    return;
+                }
+            }
+        }
+        else
+        {
+            model.uncompressed();
+        }
+
+        // send the data as it is
+        compressed_.resize(buffer_.size() + 1);
+        compressed_[0] = static_cast<char>(codec_none);
+        if (!buffer_.empty())
+            std::memcpy(&compressed_[1], buffer_.data(), buffer_.size());
+    }
+}}}
+
+#endif
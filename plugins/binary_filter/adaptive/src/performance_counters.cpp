@@ -0,0 +1,103 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/components_base/component_startup_shutdown.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/runtime_local/startup_function.hpp>
+
+#include <hpx/plugins/binary_filter/adaptive_compression_model.hpp>
+
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    namespace detail
+    {
+        std::int64_t get_compressed_count(bool reset)
+        {
+            return adaptive_compression_model::instance().get_compressed_count(
+                reset);
+        }
+
+        std::int64_t get_uncompressed_count(bool reset)
+        {
+            return adaptive_compression_model::instance()
+                .get_uncompressed_count(reset);
+        }
+
+        std::int64_t get_compression_ratio(bool reset)
+        {
+            return adaptive_compression_model::instance()
+                .get_compression_ratio(reset);
+        }
+
+        std::int64_t get_compression_time(bool reset)
+        {
+            return adaptive_compression_model::instance().get_compression_time(
+                reset);
+        }
+
+        std::int64_t get_decompression_time(bool reset)
+        {
+            return adaptive_compression_model::instance()
+                .get_decompression_time(reset);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Install the counter types, un-installation of the types is handled
+    // automatically.
+    void startup()
+    {
+        using hpx::performance_counters::install_counter_type;
+
+        install_counter_type("/compression/adaptive/count/compressed",
+            &detail::get_compressed_count,
+            "returns the number of messages compressed by the adaptive "
+            "binary filter");
+        install_counter_type("/compression/adaptive/count/uncompressed",
+            &detail::get_uncompressed_count,
+            "returns the number of messages the adaptive binary filter "
+            "sent without compressing them");
+        install_counter_type("/compression/adaptive/ratio",
+            &detail::get_compression_ratio,
+            "returns the size of the compressed messages relative to their "
+            "original size",
+            "0.1%");
+        install_counter_type("/compression/adaptive/time/compression",
+            &detail::get_compression_time,
+            "returns the overall time spent compressing messages",
+            "ns");
+        install_counter_type("/compression/adaptive/time/decompression",
+            &detail::get_decompression_time,
+            "returns the overall time spent decompressing messages",
+            "ns");
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool get_startup(hpx::startup_function_type& startup_func,
+        bool& pre_startup)
+    {
+        startup_func = startup;   // function to run during startup
+        pre_startup = true;       // run 'startup' as pre-startup function
+        return true;
+    }
+}}}
+
+///////////////////////////////////////////////////////////////////////////////
+// Register a startup function which will be called as a HPX-thread during
+// runtime startup. We use this function to register our performance counter
+// types.
+//
+// Note that this macro can be used not more than once in one module.
+HPX_REGISTER_STARTUP_MODULE_DYNAMIC(hpx::plugins::compression::get_startup);
+
+#endif
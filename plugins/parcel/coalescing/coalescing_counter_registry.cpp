@@ -35,7 +35,8 @@ namespace hpx { namespace plugins { namespace parcel
         get_counter_type num_parcels, get_counter_type num_messages,
         get_counter_type num_parcels_per_message,
         get_counter_type average_time_between_parcels,
-        get_counter_values_creator_type time_between_parcels_histogram_creator)
+        get_counter_values_creator_type time_between_parcels_histogram_creator,
+        get_counter_values_creator_type parcels_per_message_histogram_creator)
     {
         if (name.empty())
         {
@@ -54,6 +55,8 @@ namespace hpx { namespace plugins { namespace parcel
                 num_parcels, num_messages,
                 num_parcels_per_message, average_time_between_parcels,
                 time_between_parcels_histogram_creator,
+                0, 0, 1,
+                parcels_per_message_histogram_creator,
                 0, 0, 1
             };
 
@@ -79,12 +82,27 @@ namespace hpx { namespace plugins { namespace parcel
                     (*it).second.num_buckets, result);
             }
 
+            (*it).second.parcels_per_message_histogram_creator =
+                parcels_per_message_histogram_creator;
+
+            if ((*it).second.parcels_per_message_min_boundary !=
+                (*it).second.parcels_per_message_max_boundary)
+            {
+                // instantiate actual histogram collection
+                coalescing_counter_registry::get_counter_values_type result;
+                parcels_per_message_histogram_creator(
+                    (*it).second.parcels_per_message_min_boundary,
+                    (*it).second.parcels_per_message_max_boundary,
+                    (*it).second.parcels_per_message_num_buckets, result);
+            }
+
             // silence warnings
             (void) (*it).second.num_parcels;
             (void) (*it).second.num_messages;
             (void) (*it).second.num_parcels_per_message;
             (void) (*it).second.average_time_between_parcels;
             (void) (*it).second.time_between_parcels_histogram_creator;
+            (void) (*it).second.parcels_per_message_histogram_creator;
         }
     }
 
@@ -213,6 +231,39 @@ namespace hpx { namespace plugins { namespace parcel
         return result;
     }
 
+    coalescing_counter_registry::get_counter_values_type
+        coalescing_counter_registry::get_parcels_per_message_histogram_counter(
+            std::string const& name, std::int64_t min_boundary,
+            std::int64_t max_boundary, std::int64_t num_buckets)
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "coalescing_counter_registry::"
+                    "get_parcels_per_message_histogram_counter",
+                "unknown action type");
+            return &coalescing_counter_registry::empty_histogram;
+        }
+
+        if ((*it).second.parcels_per_message_histogram_creator.empty())
+        {
+            // no parcel of this type has been sent yet
+            (*it).second.parcels_per_message_min_boundary = min_boundary;
+            (*it).second.parcels_per_message_max_boundary = max_boundary;
+            (*it).second.parcels_per_message_num_buckets = num_buckets;
+            return coalescing_counter_registry::get_counter_values_type();
+        }
+
+        coalescing_counter_registry::get_counter_values_type result;
+        (*it).second.parcels_per_message_histogram_creator(
+            min_boundary, max_boundary, num_buckets, result);
+        return result;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool coalescing_counter_registry::counter_discoverer(
         performance_counters::counter_info const& info,
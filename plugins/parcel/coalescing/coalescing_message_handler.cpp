@@ -8,6 +8,7 @@
 
 #if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_COALESCING)
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
@@ -30,6 +31,7 @@
 #include <cstdint>
 #include <mutex>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -42,6 +44,8 @@ namespace hpx { namespace traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      allow_background_flush = 1
+    //      adaptive = 0
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -50,7 +54,8 @@ namespace hpx { namespace traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0";
         }
     };
 }}    // namespace hpx::traits
@@ -84,6 +89,21 @@ namespace hpx { namespace plugins { namespace parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive(bool adaptive)
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive",
+                adaptive ? "1" : "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        bool is_high_priority(threads::thread_priority priority)
+        {
+            return priority == threads::thread_priority::high ||
+                priority == threads::thread_priority::high_recursive ||
+                priority == threads::thread_priority::boost;
+        }
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
@@ -99,6 +119,12 @@ namespace hpx { namespace plugins { namespace parcel {
         interval_ = detail::get_interval(interval_);
     }
 
+    void coalescing_message_handler::update_adaptive()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        adaptive_ = detail::get_adaptive(adaptive_);
+    }
+
     coalescing_message_handler::coalescing_message_handler(
         char const* action_name, parcelset::parcelport* pp, std::size_t num,
         std::size_t interval)
@@ -113,6 +139,7 @@ namespace hpx { namespace plugins { namespace parcel {
             std::string(action_name) + "_timer")
       , stopped_(false)
       , allow_background_flush_(detail::get_background_flush())
+      , adaptive_(detail::get_adaptive(false))
       , action_name_(action_name)
       , num_parcels_(0)
       , reset_num_parcels_(0)
@@ -126,6 +153,9 @@ namespace hpx { namespace plugins { namespace parcel {
       , histogram_min_boundary_(-1)
       , histogram_max_boundary_(-1)
       , histogram_num_buckets_(-1)
+      , parcels_per_message_min_boundary_(-1)
+      , parcels_per_message_max_boundary_(-1)
+      , parcels_per_message_num_buckets_(-1)
     {
         // register performance counter functions
         coalescing_counter_registry::instance().register_action(action_name,
@@ -141,6 +171,9 @@ namespace hpx { namespace plugins { namespace parcel {
                 this),
             util::bind_front(&coalescing_message_handler::
                                  get_time_between_parcels_histogram_creator,
+                this),
+            util::bind_front(&coalescing_message_handler::
+                                 get_parcels_per_message_histogram_creator,
                 this));
 
         // register parameter update callbacks
@@ -150,6 +183,9 @@ namespace hpx { namespace plugins { namespace parcel {
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             util::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.adaptive",
+            util::bind(&coalescing_message_handler::update_adaptive, this));
     }
 
     void coalescing_message_handler::put_parcel(parcelset::locality const& dest,
@@ -167,15 +203,47 @@ namespace hpx { namespace plugins { namespace parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
-        std::chrono::microseconds interval(interval_);
+        std::size_t num_coalesced_parcels = num_coalesced_parcels_;
+        std::chrono::nanoseconds interval =
+            std::chrono::microseconds(interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
         // empty and time since last parcel is larger than coalescing interval.
-        if (stopped_ ||
+        bool send_now = stopped_ ||
             (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval))
+                std::chrono::nanoseconds(time_since_last_parcel) > interval);
+
+        if (adaptive_)
+        {
+            // derive the number of parcels to coalesce and the flush deadline
+            // from the measured parcel arrival rate and message send times,
+            // the configured values serve as upper bounds
+            cost_model_.parcel_arrived(
+                time_since_last_parcel, interval.count());
+            if (cost_model_.has_estimate())
+            {
+                num_coalesced_parcels =
+                    cost_model_.batch_size(num_coalesced_parcels_);
+                interval = std::chrono::nanoseconds(cost_model_.flush_interval(
+                    num_coalesced_parcels, interval.count()));
+            }
+
+            // high priority parcels are never delayed, neither are parcels
+            // for which coalescing would not reduce the overall send time
+            send_now = send_now ||
+                (buffer_.empty() && num_coalesced_parcels <= 1) ||
+                detail::is_high_priority(p.get_thread_priority());
+        }
+
+        if (send_now)
         {
             ++num_messages_;
+            record_parcels_per_message(1);
+
+            if (adaptive_)
+            {
+                f = measure_message(std::move(f), 1);
+            }
             l.unlock();
 
             // this instance should not buffer parcels anymore
@@ -191,6 +259,15 @@ namespace hpx { namespace plugins { namespace parcel {
         case detail::message_buffer::first_message:
             HPX_FALLTHROUGH;
         case detail::message_buffer::normal:
+            if (adaptive_ && buffer_.size() >= num_coalesced_parcels)
+            {
+                flush_locked(l,
+                    parcelset::policies::message_handler::
+                        flush_mode_buffer_full,
+                    false, true);
+                break;
+            }
+
             // start deadline timer to flush buffer
             l.unlock();
             timer_.start(interval);
@@ -278,6 +355,13 @@ namespace hpx { namespace plugins { namespace parcel {
         std::swap(buff, buffer_);
 
         ++num_messages_;
+        record_parcels_per_message(buff.size());
+
+        if (adaptive_)
+        {
+            buff.front_handler() =
+                measure_message(std::move(buff.front_handler()), buff.size());
+        }
         l.unlock();
 
         HPX_ASSERT(nullptr != pp_);
@@ -286,6 +370,45 @@ namespace hpx { namespace plugins { namespace parcel {
         return true;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // adaptive coalescing
+    coalescing_message_handler::write_handler_type
+    coalescing_message_handler::measure_message(
+        write_handler_type&& f, std::size_t num_parcels)
+    {
+        return util::bind_front(&coalescing_message_handler::message_sent,
+            this, std::move(f), hpx::chrono::high_resolution_clock::now(),
+            num_parcels);
+    }
+
+    void coalescing_message_handler::message_sent(write_handler_type const& f,
+        std::int64_t started, std::size_t num_parcels,
+        std::error_code const& ec, parcelset::parcel const& p)
+    {
+        if (!ec)
+        {
+            std::int64_t elapsed =
+                hpx::chrono::high_resolution_clock::now() - started;
+
+            // the size of the first parcel is representative for all parcels
+            // in the message
+            std::lock_guard<mutex_type> l(mtx_);
+            cost_model_.message_sent(
+                num_parcels, num_parcels * p.size(), elapsed);
+        }
+
+        if (f)
+            f(ec, p);
+    }
+
+    void coalescing_message_handler::record_parcels_per_message(
+        std::size_t num_parcels)
+    {
+        if (parcels_per_message_)
+            (*parcels_per_message_)(double(num_parcels));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
     // performance counter values
     std::int64_t coalescing_message_handler::get_average_time_between_parcels(
         bool reset)
@@ -431,6 +554,62 @@ namespace hpx { namespace plugins { namespace parcel {
             this);
     }
 
+    std::vector<std::int64_t>
+    coalescing_message_handler::get_parcels_per_message_histogram(
+        bool /* reset */)
+    {
+        std::vector<std::int64_t> result;
+
+        std::unique_lock<mutex_type> l(mtx_);
+        if (!parcels_per_message_)
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "coalescing_message_handler::"
+                "get_parcels_per_message_histogram",
+                "parcels-per-message-histogram counter was not initialized "
+                "for action type: {}",
+                action_name_);
+            return result;
+        }
+
+        // first add histogram parameters
+        result.push_back(parcels_per_message_min_boundary_);
+        result.push_back(parcels_per_message_max_boundary_);
+        result.push_back(parcels_per_message_num_buckets_);
+
+        auto data = hpx::util::histogram(*parcels_per_message_);
+        for (auto const& item : data)
+        {
+            result.push_back(std::int64_t(item.second * 1000));
+        }
+
+        return result;
+    }
+
+    void coalescing_message_handler::get_parcels_per_message_histogram_creator(
+        std::int64_t min_boundary, std::int64_t max_boundary,
+        std::int64_t num_buckets,
+        util::function_nonser<std::vector<std::int64_t>(bool)>& result)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        if (!parcels_per_message_)
+        {
+            parcels_per_message_min_boundary_ = min_boundary;
+            parcels_per_message_max_boundary_ = max_boundary;
+            parcels_per_message_num_buckets_ = num_buckets;
+
+            parcels_per_message_.reset(new histogram_collector_type(
+                hpx::util::tag::histogram::num_bins = double(num_buckets),
+                hpx::util::tag::histogram::min_range = double(min_boundary),
+                hpx::util::tag::histogram::max_range = double(max_boundary)));
+        }
+
+        result = util::bind_front(
+            &coalescing_message_handler::get_parcels_per_message_histogram,
+            this);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // register the given action (called during startup)
     void coalescing_message_handler::register_action(
@@ -502,6 +502,134 @@ namespace hpx { namespace plugins { namespace parcel
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    struct parcels_per_message_histogram_counter_surrogate
+    {
+        parcels_per_message_histogram_counter_surrogate(
+                std::string const& action_name, std::int64_t min_boundary,
+            std::int64_t max_boundary, std::int64_t num_buckets)
+          : action_name_(action_name), min_boundary_(min_boundary),
+            max_boundary_(max_boundary), num_buckets_(num_buckets)
+        {}
+
+        parcels_per_message_histogram_counter_surrogate(
+                parcels_per_message_histogram_counter_surrogate const& rhs)
+          : action_name_(rhs.action_name_), min_boundary_(rhs.min_boundary_),
+            max_boundary_(rhs.max_boundary_), num_buckets_(rhs.num_buckets_)
+        {}
+
+        std::vector<std::int64_t> operator()(bool reset)
+        {
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+                if (counter_.empty())
+                {
+                    counter_ = coalescing_counter_registry::instance().
+                        get_parcels_per_message_histogram_counter(action_name_,
+                            min_boundary_, max_boundary_, num_buckets_);
+
+                    // no counter available yet
+                    if (counter_.empty())
+                        return coalescing_counter_registry::empty_histogram(reset);
+                }
+            }
+
+            // dispatch to actual counter
+            return counter_(reset);
+        }
+
+        hpx::lcos::local::spinlock mtx_;
+        hpx::util::function_nonser<std::vector<std::int64_t>(bool)> counter_;
+        std::string action_name_;
+        std::int64_t min_boundary_;
+        std::int64_t max_boundary_;
+        std::int64_t num_buckets_;
+    };
+
+    hpx::naming::gid_type parcels_per_message_histogram_counter_creator(
+        hpx::performance_counters::counter_info const& info, hpx::error_code& ec)
+    {
+        switch (info.type_) {
+        case performance_counters::counter_histogram:
+            {
+                performance_counters::counter_path_elements paths;
+                performance_counters::get_counter_path_elements(
+                    info.fullname_, paths, ec);
+                if (ec) return naming::invalid_gid;
+
+                if (paths.parentinstance_is_basename_) {
+                    HPX_THROWS_IF(ec, bad_parameter,
+                        "parcels_per_message_histogram_counter_creator",
+                        "invalid counter name for "
+                        "parcels-per-message histogram (instance "
+                        "name must not be a valid base counter name)");
+                    return naming::invalid_gid;
+                }
+
+                if (paths.parameters_.empty())
+                {
+                    HPX_THROWS_IF(ec, bad_parameter,
+                        "parcels_per_message_histogram_counter_creator",
+                        "invalid counter parameter for "
+                        "parcels-per-message histogram: must "
+                        "specify an action type");
+                    return naming::invalid_gid;
+                }
+
+                // split parameters, extract separate values
+                std::vector<std::string> params;
+                hpx::string_util::split(params, paths.parameters_,
+                    hpx::string_util::is_any_of(","),
+                    hpx::string_util::token_compress_mode::off);
+
+                std::int64_t min_boundary = 0;
+                std::int64_t max_boundary = 100;
+                std::int64_t num_buckets = 20;
+
+                if (params.empty() || params[0].empty())
+                {
+                    HPX_THROWS_IF(ec, bad_parameter,
+                        "parcels_per_message_histogram_counter_creator",
+                        "invalid counter parameter for "
+                        "parcels-per-message histogram: "
+                        "must specify an action type");
+                    return naming::invalid_gid;
+                }
+
+                if (params.size() > 1 && !params[1].empty())
+                    min_boundary = util::from_string<std::int64_t>(params[1]);
+                if (params.size() > 2 && !params[2].empty())
+                    max_boundary = util::from_string<std::int64_t>(params[2]);
+                if (params.size() > 3 && !params[3].empty())
+                    num_buckets = util::from_string<std::int64_t>(params[3]);
+
+                // ask registry
+                hpx::util::function_nonser<std::vector<std::int64_t>(bool)> f =
+                    coalescing_counter_registry::instance().
+                        get_parcels_per_message_histogram_counter(params[0],
+                            min_boundary, max_boundary, num_buckets);
+
+                if (!f.empty())
+                {
+                    return performance_counters::detail::create_raw_counter(
+                        info, std::move(f), ec);
+                }
+
+                // the counter is not available yet, create surrogate function
+                return performance_counters::detail::create_raw_counter(info,
+                    parcels_per_message_histogram_counter_surrogate(
+                        params[0], min_boundary, max_boundary, num_buckets), ec);
+            }
+            break;
+
+        default:
+            HPX_THROWS_IF(ec, bad_parameter,
+                "parcels_per_message_histogram_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // This function will be registered as a startup function for HPX below.
     //
@@ -562,6 +690,17 @@ namespace hpx { namespace plugins { namespace parcel
               &time_between_parcels_histogram_counter_creator,
               &counter_discoverer,
               "ns/0.1%"
+            },
+            // /coalescing(...)/count/parcels-per-message-histogram@action-name,min,max,buckets
+            { "/coalescing/count/parcels-per-message-histogram",
+              counter_histogram,
+              "returns the histogram for the number of parcels sent in a "
+              "message generated by the message handler associated with "
+              "the action which is given by the counter parameter",
+              HPX_PERFORMANCE_COUNTER_V1,
+              &parcels_per_message_histogram_counter_creator,
+              &counter_discoverer,
+              "0.1%"
             }
         };
 
@@ -0,0 +1,316 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/plugins/parcelport_factory.hpp>
+
+// parcelport
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcelport_impl.hpp>
+
+#include <hpx/plugins/parcelport/shmem/header.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/plugins/parcelport/shmem/sender.hpp>
+
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/functional/bind.hpp>
+#include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/util/get_entry_as.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset
+{
+    namespace policies { namespace shmem
+    {
+        class HPX_EXPORT parcelport;
+    }}
+
+    template <>
+    struct connection_handler_traits<policies::shmem::parcelport>
+    {
+        typedef policies::shmem::sender_connection connection_type;
+        typedef std::false_type send_early_parcel;
+        typedef std::true_type  do_background_work;
+        typedef std::false_type send_immediate_parcels;
+
+        static const char * type()
+        {
+            return "shmem";
+        }
+
+        static const char * pool_name()
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static const char * pool_name_postfix()
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies { namespace shmem
+    {
+        std::uint64_t next_chunk_seq(sender * s)
+        {
+            return s->next_chunk_seq();
+        }
+
+        void add_connection(
+            sender* s, std::shared_ptr<sender_connection> const& ptr)
+        {
+            s->add(ptr);
+        }
+
+        // The shared memory parcelport connects localities running on the
+        // same host. It cannot bootstrap the runtime, the localities learn
+        // about each other through the bootstrap parcelport (usually tcp).
+        class HPX_EXPORT parcelport
+          : public parcelport_impl<parcelport>
+        {
+            typedef parcelport_impl<parcelport> base_type;
+
+            static parcelset::locality here()
+            {
+                return parcelset::locality(locality(host_id(), process_id()));
+            }
+
+            static bool enabled(util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<int>(
+                    ini, "hpx.parcel.shmem.enable", 0) != 0;
+            }
+
+            static std::size_t segment_threshold(
+                util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.segment_threshold", 262144);
+            }
+
+            // the number of times the receive loop polls before blocking
+            static constexpr std::size_t spin_count = 32;
+
+        public:
+            parcelport(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier)
+              : base_type(ini, here(), notifier)
+              , stopped_(false)
+              , host_id_(host_id())
+              , sender_(segment_threshold(ini))
+              , receiver_(*this, segment_)
+            {
+                // The segment has to exist before the endpoints of this
+                // locality are published.
+                if (enabled(ini))
+                {
+                    std::size_t num_rings =
+                        hpx::util::get_entry_as<std::size_t>(ini,
+                            "hpx.parcel.shmem.max_peers", segment::max_rings);
+                    num_rings = (std::min)(
+                        (std::max)(num_rings, std::size_t(1)),
+                        segment::max_rings);
+
+                    segment_.create(segment_name(process_id()), num_rings,
+                        hpx::util::get_entry_as<std::size_t>(
+                            ini, "hpx.parcel.shmem.ring_size", 1048576));
+                    receiver_.run();
+                }
+            }
+
+            ~parcelport()
+            {
+                segment_.unlink();
+            }
+
+            /// Start the handling of connections.
+            bool do_run()
+            {
+                if (segment_)
+                {
+                    io_service_pool_.get_io_service(0).post(
+                        hpx::util::bind(&parcelport::receive_loop, this));
+                }
+                return true;
+            }
+
+            /// Stop the handling of connections.
+            void do_stop()
+            {
+                while(do_background_work(0, parcelport_background_mode_all))
+                {
+                    if(threads::get_self_ptr())
+                        hpx::this_thread::suspend(
+                            hpx::threads::thread_schedule_state::pending,
+                            "shmem::parcelport::do_stop");
+                }
+                stopped_ = true;
+
+                // wake up the receive loop
+                if (segment_)
+                {
+                    segment_.notify();
+                    segment_.unlink();
+                }
+            }
+
+            /// Return the name of this locality
+            std::string get_locality_name() const override
+            {
+                return host_name();
+            }
+
+            // Only localities on the same host can be reached, and only
+            // once the bootstrap parcelport has connected the localities.
+            bool can_connect(parcelset::locality const& l,
+                bool use_alternative_parcelport) override
+            {
+                return use_alternative_parcelport && segment_ &&
+                    l.get<locality>().host() == host_id_;
+            }
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec)
+            {
+                return sender_.create_connection(l, this, ec);
+            }
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const&) const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            parcelset::locality create_locality() const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode)
+            {
+                if (stopped_)
+                    return false;
+
+                bool has_work = false;
+                if (mode & parcelport_background_mode_send)
+                {
+                    has_work = sender_.background_work();
+                }
+                if (mode & parcelport_background_mode_receive)
+                {
+                    has_work =
+                        receiver_.background_work(num_thread) || has_work;
+                }
+                return has_work;
+            }
+
+        private:
+            std::atomic<bool> stopped_;
+            std::uint64_t const host_id_;
+
+            segment segment_;
+            sender sender_;
+            receiver<parcelport> receiver_;
+
+            // Runs on the io-service thread of this parcelport and picks up
+            // incoming messages without delay while the worker threads are
+            // busy. It polls for a while after the last message and blocks
+            // on the doorbell of the segment afterwards.
+            void receive_loop()
+            {
+                std::size_t k = 0;
+                while (!stopped_)
+                {
+                    bool has_work = sender_.background_work();
+                    has_work = receiver_.background_work() || has_work;
+                    if (has_work)
+                    {
+                        k = 0;
+                    }
+                    else if (++k < spin_count)
+                    {
+                        util::detail::yield_k(k,
+                            "hpx::parcelset::policies::shmem::parcelport::"
+                                "receive_loop");
+                    }
+                    else
+                    {
+                        // Outgoing messages waiting for space in a full ring
+                        // are not notified about the receiver catching up,
+                        // poll for those regularly.
+                        receiver_.wait(sender_.has_pending() ?
+                                std::chrono::microseconds(100) :
+                                std::chrono::microseconds(10000));
+                        k = 0;
+                    }
+                }
+            }
+        };
+    }}
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+namespace hpx { namespace traits
+{
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.parcel.shmem]
+    //      ...
+    //      priority = 20000
+    //
+    template <>
+    struct plugin_config_data<hpx::parcelset::policies::shmem::parcelport>
+    {
+        static char const* priority()
+        {
+            return "20000";
+        }
+
+        static void init(int* /* argc */, char*** /* argv */,
+            util::command_line_handling& /* cfg */)
+        {
+        }
+
+        static void destroy() {}
+
+        static char const* call()
+        {
+            return
+                "io_pool_size = ${HPX_PARCEL_SHMEM_IO_POOL_SIZE:1}\n"
+                "ring_size = ${HPX_PARCEL_SHMEM_RING_SIZE:1048576}\n"
+                "max_peers = ${HPX_PARCEL_SHMEM_MAX_PEERS:64}\n"
+                "segment_threshold = "
+                    "${HPX_PARCEL_SHMEM_SEGMENT_THRESHOLD:262144}\n"
+                ;
+        }
+    };
+}}
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::shmem::parcelport,
+    shmem);
+
+#endif
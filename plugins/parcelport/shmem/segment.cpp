@@ -0,0 +1,517 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+        "futex words must have the size of an int");
+
+    namespace {
+        // identifies the layout of a segment, has to be changed whenever
+        // the layout changes
+        constexpr std::uint64_t segment_magic = 0x687078736d656d01ull;
+
+        std::string last_error()
+        {
+            return std::error_code(errno, std::system_category()).message();
+        }
+
+        std::size_t round_up_pow2(std::size_t value)
+        {
+            std::size_t result = threads::get_cache_line_size();
+            while (result < value)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        std::size_t header_size()
+        {
+            std::size_t const cache_line = threads::get_cache_line_size();
+            return (sizeof(segment_header) + cache_line - 1) / cache_line *
+                cache_line;
+        }
+
+        std::size_t ring_stride(std::size_t capacity)
+        {
+            return sizeof(ring_buffer) + capacity;
+        }
+
+        // FNV-1a, stable across processes and compilers
+        std::uint64_t hash(std::string const& s)
+        {
+            std::uint64_t h = 14695981039346656037ull;
+            for (char c : s)
+            {
+                h ^= static_cast<std::uint8_t>(c);
+                h *= 1099511628211ull;
+            }
+            return h;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::string host_name()
+    {
+        char name[HOST_NAME_MAX + 1] = {0};
+        if (gethostname(name, sizeof(name) - 1) != 0)
+        {
+            return "localhost";
+        }
+        return name;
+    }
+
+    std::uint64_t host_id()
+    {
+        // include the boot id to tell apart hosts with the same name
+        std::string boot_id;
+        std::ifstream in("/proc/sys/kernel/random/boot_id");
+        if (in)
+        {
+            std::getline(in, boot_id);
+        }
+        return hash(host_name() + "/" + boot_id);
+    }
+
+    std::int32_t process_id()
+    {
+        return static_cast<std::int32_t>(getpid());
+    }
+
+    std::string segment_name(std::int32_t pid)
+    {
+        return hpx::util::format("/hpx.shmem.{}", pid);
+    }
+
+    std::string chunk_name(std::int32_t pid, std::uint64_t seq)
+    {
+        return hpx::util::format("/hpx.shmem.{}.{}", pid, seq);
+    }
+
+    void futex_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected,
+        std::chrono::microseconds timeout)
+    {
+        timespec ts;
+        ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000);
+        ts.tv_nsec = static_cast<long>((timeout.count() % 1000000) * 1000);
+
+        // the word is shared between processes, don't use FUTEX_PRIVATE_FLAG
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT,
+            expected, &ts, nullptr, 0);
+    }
+
+    void futex_wake(std::atomic<std::uint32_t>& word)
+    {
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE,
+            INT_MAX, nullptr, nullptr, 0);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t ring_buffer::write(void const* data, std::size_t size) noexcept
+    {
+        std::uint64_t const tail = tail_.load(std::memory_order_relaxed);
+        if (capacity_ - (tail - head_cache_) < size)
+        {
+            head_cache_ = head_.load(std::memory_order_acquire);
+        }
+
+        std::size_t const n = (std::min)(
+            size, static_cast<std::size_t>(capacity_ - (tail - head_cache_)));
+        if (n == 0)
+        {
+            return 0;
+        }
+
+        std::size_t const pos =
+            static_cast<std::size_t>(tail & (capacity_ - 1));
+        std::size_t const first =
+            (std::min)(n, static_cast<std::size_t>(capacity_ - pos));
+
+        std::memcpy(buffer() + pos, data, first);
+        if (first != n)
+        {
+            std::memcpy(
+                buffer(), static_cast<char const*>(data) + first, n - first);
+        }
+
+        tail_.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    std::size_t ring_buffer::read(void* data, std::size_t size) noexcept
+    {
+        std::uint64_t const head = head_.load(std::memory_order_relaxed);
+        if (tail_cache_ - head < size)
+        {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+        }
+
+        std::size_t const n =
+            (std::min)(size, static_cast<std::size_t>(tail_cache_ - head));
+        if (n == 0)
+        {
+            return 0;
+        }
+
+        std::size_t const pos =
+            static_cast<std::size_t>(head & (capacity_ - 1));
+        std::size_t const first =
+            (std::min)(n, static_cast<std::size_t>(capacity_ - pos));
+
+        std::memcpy(data, buffer() + pos, first);
+        if (first != n)
+        {
+            std::memcpy(static_cast<char*>(data) + first, buffer(), n - first);
+        }
+
+        head_.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    segment::~segment()
+    {
+        unmap();
+    }
+
+    void segment::unmap() noexcept
+    {
+        if (addr_ != nullptr)
+        {
+            munmap(addr_, size_);
+            addr_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    void segment::create(std::string const& name, std::size_t num_rings,
+        std::size_t ring_capacity, error_code& ec)
+    {
+        HPX_ASSERT(addr_ == nullptr);
+        HPX_ASSERT(num_rings != 0 && num_rings <= max_rings);
+
+        ring_capacity = round_up_pow2(ring_capacity);
+        std::size_t const size =
+            header_size() + num_rings * ring_stride(ring_capacity);
+
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd == -1 && errno == EEXIST)
+        {
+            // left behind by a process which had the same id, the names are
+            // unique for all live processes
+            shm_unlink(name.c_str());
+            fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        }
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::create",
+                "could not create shared memory segment {}: {}", name,
+                last_error());
+            return;
+        }
+
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            std::string const error = last_error();
+            close(fd);
+            shm_unlink(name.c_str());
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::create",
+                "could not resize shared memory segment {}: {}", name, error);
+            return;
+        }
+
+        void* addr =
+            mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (addr == MAP_FAILED)
+        {
+            std::string const error = last_error();
+            shm_unlink(name.c_str());
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::create",
+                "could not map shared memory segment {}: {}", name, error);
+            return;
+        }
+
+        name_ = name;
+        addr_ = addr;
+        size_ = size;
+        owner_ = true;
+
+        segment_header* h =
+            new (addr_) segment_header(num_rings, ring_capacity);
+        for (std::size_t i = 0; i != num_rings; ++i)
+        {
+            new (&ring(i)) ring_buffer(ring_capacity);
+        }
+
+        // make the segment usable for other processes
+        h->magic_.store(segment_magic, std::memory_order_release);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    void segment::open(std::string const& name, error_code& ec)
+    {
+        HPX_ASSERT(addr_ == nullptr);
+
+        int fd = shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                "could not open shared memory segment {}: {}", name,
+                last_error());
+            return;
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 ||
+            static_cast<std::size_t>(st.st_size) < header_size())
+        {
+            close(fd);
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                "shared memory segment {} is invalid", name);
+            return;
+        }
+
+        std::size_t const size = static_cast<std::size_t>(st.st_size);
+        void* addr =
+            mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (addr == MAP_FAILED)
+        {
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                "could not map shared memory segment {}: {}", name,
+                last_error());
+            return;
+        }
+
+        name_ = name;
+        addr_ = addr;
+        size_ = size;
+        owner_ = false;
+
+        segment_header& h = header();
+        if (h.magic_.load(std::memory_order_acquire) != segment_magic ||
+            h.num_rings_ == 0 || h.num_rings_ > max_rings ||
+            size_ <
+                header_size() +
+                    h.num_rings_ *
+                        ring_stride(static_cast<std::size_t>(h.ring_capacity_)))
+        {
+            unmap();
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                "shared memory segment {} has an incompatible layout", name);
+            return;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    void segment::unlink()
+    {
+        if (owner_ && !name_.empty())
+        {
+            shm_unlink(name_.c_str());
+            owner_ = false;
+        }
+    }
+
+    ring_buffer& segment::ring(std::size_t i) noexcept
+    {
+        HPX_ASSERT(i < num_rings());
+        char* base = static_cast<char*>(addr_) + header_size();
+        return *reinterpret_cast<ring_buffer*>(base +
+            i * ring_stride(static_cast<std::size_t>(header().ring_capacity_)));
+    }
+
+    std::size_t segment::claim_ring(error_code& ec)
+    {
+        std::int32_t const pid = process_id();
+        for (std::size_t i = 0; i != num_rings(); ++i)
+        {
+            std::int32_t expected = 0;
+            if (ring(i).owner_.compare_exchange_strong(expected, pid))
+            {
+                header().claimed_.fetch_or(std::uint64_t(1) << i);
+
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return i;
+            }
+        }
+
+        HPX_THROWS_IF(ec, network_error, "shmem::segment::claim_ring",
+            "no free ring in shared memory segment {} (increase "
+            "hpx.parcel.shmem.max_peers on the receiving locality)",
+            name_);
+        return std::size_t(-1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void export_chunk(std::string const& name, void const* data,
+        std::size_t size, error_code& ec)
+    {
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd == -1 && errno == EEXIST)
+        {
+            shm_unlink(name.c_str());
+            fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        }
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, network_error, "shmem::export_chunk",
+                "could not create shared memory segment {}: {}", name,
+                last_error());
+            return;
+        }
+
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            std::string const error = last_error();
+            close(fd);
+            shm_unlink(name.c_str());
+            HPX_THROWS_IF(ec, network_error, "shmem::export_chunk",
+                "could not resize shared memory segment {}: {}", name, error);
+            return;
+        }
+
+        void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, fd, 0);
+        close(fd);
+        if (addr == MAP_FAILED)
+        {
+            std::string const error = last_error();
+            shm_unlink(name.c_str());
+            HPX_THROWS_IF(ec, network_error, "shmem::export_chunk",
+                "could not map shared memory segment {}: {}", name, error);
+            return;
+        }
+
+        std::memcpy(addr, data, size);
+        munmap(addr, size);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    void remove_chunk(std::string const& name) noexcept
+    {
+        shm_unlink(name.c_str());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    chunk_buffer::~chunk_buffer()
+    {
+        unmap();
+    }
+
+    chunk_buffer::chunk_buffer(chunk_buffer&& rhs) noexcept
+      : data_(std::move(rhs.data_))
+      , addr_(rhs.addr_)
+      , size_(rhs.size_)
+    {
+        rhs.addr_ = nullptr;
+        rhs.size_ = 0;
+    }
+
+    chunk_buffer& chunk_buffer::operator=(chunk_buffer&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            unmap();
+            data_ = std::move(rhs.data_);
+            addr_ = rhs.addr_;
+            size_ = rhs.size_;
+            rhs.addr_ = nullptr;
+            rhs.size_ = 0;
+        }
+        return *this;
+    }
+
+    void chunk_buffer::unmap() noexcept
+    {
+        if (addr_ != nullptr)
+        {
+            munmap(addr_, size_);
+            addr_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    void chunk_buffer::map(
+        std::string const& name, std::size_t size, error_code& ec)
+    {
+        unmap();
+        data_.clear();
+
+        int fd = shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd == -1)
+        {
+            std::string const error = last_error();
+            shm_unlink(name.c_str());
+            HPX_THROWS_IF(ec, network_error, "shmem::chunk_buffer::map",
+                "could not open shared memory segment {}: {}", name, error);
+            return;
+        }
+
+        void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, fd, 0);
+        std::string const error = addr == MAP_FAILED ? last_error() : "";
+        close(fd);
+
+        // the mapping keeps the memory alive
+        shm_unlink(name.c_str());
+
+        if (addr == MAP_FAILED)
+        {
+            HPX_THROWS_IF(ec, network_error, "shmem::chunk_buffer::map",
+                "could not map shared memory segment {}: {}", name, error);
+            return;
+        }
+
+        addr_ = addr;
+        size_ = size;
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+}}}}
+
+#endif
@@ -39,6 +39,7 @@
 #include <hpx/runtime_distributed/applier.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/state.hpp>
+#include <hpx/serialization/detail/buffer_pool.hpp>
 #include <hpx/synchronization/counting_semaphore.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/external_timer.hpp>
@@ -1144,6 +1145,14 @@ namespace hpx { namespace parcelset
         util::function_nonser<std::int64_t(bool)> outgoing_routed_count(
             util::bind_front(&parcelhandler::get_parcel_routed_count, this));
 
+        using serialization::detail::buffer_pool;
+        util::function_nonser<std::int64_t(bool)> buffer_pool_hits(
+            &buffer_pool::get_hits);
+        util::function_nonser<std::int64_t(bool)> buffer_pool_misses(
+            &buffer_pool::get_misses);
+        util::function_nonser<std::int64_t(bool)> buffer_pool_bytes_recycled(
+            &buffer_pool::get_bytes_recycled);
+
         performance_counters::generic_counter_type_data const counter_types[] =
         {
             { "/parcelqueue/length/receive",
@@ -1175,6 +1184,36 @@ namespace hpx { namespace parcelset
                   _1, outgoing_routed_count, _2),
               &performance_counters::locality_counter_discoverer,
               ""
+            },
+            { "/parcels/buffer_pool/hits",
+              performance_counters::counter_monotonically_increasing,
+              "returns the number of serialization buffers which were reused "
+                  "from the buffer pool",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, buffer_pool_hits, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/parcels/buffer_pool/misses",
+              performance_counters::counter_monotonically_increasing,
+              "returns the number of serialization buffers which had to be "
+                  "newly allocated as the buffer pool had none available",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, buffer_pool_misses, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/parcels/buffer_pool/bytes_recycled",
+              performance_counters::counter_monotonically_increasing,
+              "returns the overall capacity of the serialization buffers "
+                  "which were reused from the buffer pool",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, buffer_pool_bytes_recycled, _2),
+              &performance_counters::locality_counter_discoverer,
+              "bytes"
             }
         };
         performance_counters::install_counter_types(
@@ -1685,6 +1724,10 @@ namespace hpx { namespace parcelset
         ini_defs.emplace_back(
             "zero_copy_optimization = ${HPX_PARCEL_ZERO_COPY_OPTIMIZATION:"
             "$[hpx.parcel.array_optimization]}");
+        ini_defs.emplace_back(
+            "zero_copy_serialization_threshold = "
+            "${HPX_PARCEL_ZERO_COPY_SERIALIZATION_THRESHOLD:" HPX_PP_STRINGIZE(
+                HPX_ZERO_COPY_SERIALIZATION_THRESHOLD) "}");
         ini_defs.emplace_back(
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}");
 #if defined(HPX_HAVE_PARCEL_COALESCING)
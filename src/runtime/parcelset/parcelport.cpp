@@ -42,6 +42,7 @@ namespace hpx { namespace parcelset
         max_outbound_message_size_(ini.get_max_outbound_message_size()),
         allow_array_optimizations_(true),
         allow_zero_copy_optimizations_(true),
+        zero_copy_serialization_threshold_(0),
         async_serialization_(false),
         priority_(hpx::util::get_entry_as<int>(ini,
             "hpx.parcel." + type + ".priority", 0)),
@@ -65,6 +66,16 @@ namespace hpx { namespace parcelset
             }
         }
 
+        zero_copy_serialization_threshold_ =
+            hpx::util::get_entry_as<std::size_t>(ini,
+                key + ".zero_copy_serialization_threshold",
+                HPX_ZERO_COPY_SERIALIZATION_THRESHOLD);
+        if (zero_copy_serialization_threshold_ == 0)
+        {
+            zero_copy_serialization_threshold_ =
+                HPX_ZERO_COPY_SERIALIZATION_THRESHOLD;
+        }
+
         if (hpx::util::get_entry_as<int>(
                 ini, key + ".async_serialization", 0) != 0)
         {
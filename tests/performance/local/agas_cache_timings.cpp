@@ -14,11 +14,13 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 
+#include <hpx/agas/gva_cache.hpp>
 #include <hpx/cache/entries/lfu_entry.hpp>
 #include <hpx/cache/local_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/preprocessor/stringize.hpp>
 #include <hpx/statistics/histogram.hpp>
+#include <hpx/modules/synchronization.hpp>
 #include <hpx/modules/testing.hpp>
 
 #include <hpx/modules/program_options.hpp>
@@ -30,6 +32,8 @@
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -231,6 +235,106 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Concurrent lookups: the original cache guarded by a single spinlock compared
+// to the sharded cache used by AGAS.
+template <typename F>
+double run_concurrent_lookups(std::size_t num_threads, F const& f)
+{
+    std::vector<hpx::future<void>> lookups;
+    lookups.reserve(num_threads);
+
+    hpx::chrono::high_resolution_timer t;
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        lookups.push_back(hpx::async(f, i));
+    }
+    hpx::wait_all(lookups);
+
+    return t.elapsed();
+}
+
+void print_lookup_rate(std::string const& prefix, std::size_t num_lookups,
+    double elapsed)
+{
+    std::cout << prefix << ": " << std::setprecision(3) << std::setw(10)
+              << (num_lookups / elapsed) << " lookups/s" << std::endl;
+}
+
+void test_concurrent_get(std::size_t cache_size, std::size_t num_entries,
+    std::size_t num_threads, std::size_t num_lookups)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::int32_t ct = hpx::components::component_invalid;
+
+    std::vector<hpx::naming::gid_type> keys;
+    keys.reserve(num_entries);
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        keys.push_back(hpx::detail::get_next_id());
+    }
+
+    // original cache, guarded by a single lock
+    {
+        hpx::lcos::local::spinlock mtx;
+        gva_cache_type cache;
+        cache.reserve(cache_size);
+
+        for (auto const& key : keys)
+        {
+            cache.insert(gva_cache_key(key, 1),
+                hpx::agas::gva(locality, ct, 1, std::uint64_t(0), 0));
+        }
+
+        double elapsed = run_concurrent_lookups(
+            num_threads, [&](std::size_t seed) {
+                for (std::size_t i = 0; i != num_lookups; ++i)
+                {
+                    gva_cache_key key(keys[(seed + i * 7) % keys.size()], 1);
+                    gva_cache_key idbase;
+                    gva_cache_type::entry_type e;
+
+                    std::lock_guard<hpx::lcos::local::spinlock> l(mtx);
+                    cache.get_entry(key, idbase, e);
+                }
+            });
+
+        print_lookup_rate(
+            "  locked get", num_threads * num_lookups, elapsed);
+    }
+
+    // sharded cache
+    {
+        hpx::agas::gva_cache cache;
+        cache.reserve(cache_size);
+
+        for (auto const& key : keys)
+        {
+            hpx::naming::gid_type old_gid;
+            std::uint64_t old_count = 0;
+            cache.update(key, 1,
+                hpx::agas::gva(locality, ct, 1, std::uint64_t(0), 0), old_gid,
+                old_count);
+        }
+
+        double elapsed = run_concurrent_lookups(
+            num_threads, [&](std::size_t seed) {
+                for (std::size_t i = 0; i != num_lookups; ++i)
+                {
+                    hpx::naming::gid_type idbase;
+                    hpx::agas::gva g;
+
+                    cache.get_entry(
+                        keys[(seed + i * 7) % keys.size()], idbase, g);
+                }
+            });
+
+        print_lookup_rate(
+            " sharded get", num_threads * num_lookups, elapsed);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -241,6 +345,16 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::size_t num_entries = 1000;
     if (vm.count("num_entries"))
         num_entries = vm["num_entries"].as<std::size_t>();
+    if (num_entries == 0)
+        throw std::invalid_argument("num_entries must be larger than 0");
+
+    std::size_t num_threads = hpx::get_os_thread_count();
+    if (vm.count("num_threads"))
+        num_threads = vm["num_threads"].as<std::size_t>();
+
+    std::size_t num_lookups = 100000;
+    if (vm.count("num_lookups"))
+        num_lookups = vm["num_lookups"].as<std::size_t>();
 
     gva_cache_type cache;
     cache.reserve(cache_size);
@@ -252,6 +366,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_insert(cache, num_entries);
     test_get(cache, first_key);
     test_update(cache, first_key);
+    test_concurrent_get(cache_size, num_entries, num_threads, num_lookups);
 
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
@@ -271,6 +386,10 @@ int main(int argc, char* argv[])
          HPX_PP_STRINGIZE(HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")
         ("num_entries,n", value<std::size_t>(),
          "number of items to insert into cache (default: 1000)")
+        ("num_threads", value<std::size_t>(),
+         "number of concurrent lookup tasks (default: number of cores)")
+        ("num_lookups", value<std::size_t>(),
+         "number of lookups per task (default: 100000)")
         ;
 
     // Initialize and run HPX
@@ -0,0 +1,276 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the vectorized (datapar) implementations of the
+// reduce, transform_reduce, count_if, find_if, minmax_element, equal, and
+// mismatch algorithms against their scalar counterparts.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_count.hpp>
+#include <hpx/include/parallel_equal.hpp>
+#include <hpx/include/parallel_find.hpp>
+#include <hpx/include/parallel_minmax.hpp>
+#include <hpx/include/parallel_mismatch.hpp>
+#include <hpx/include/parallel_reduce.hpp>
+#include <hpx/include/parallel_transform_reduce.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// all operations are generic to be usable with scalars and vector packs
+struct plus
+{
+    template <typename T1, typename T2>
+    auto operator()(T1 const& t1, T2 const& t2) const -> decltype(t1 + t2)
+    {
+        return t1 + t2;
+    }
+};
+
+struct square
+{
+    template <typename T>
+    auto operator()(T const& t) const -> decltype(t * t)
+    {
+        return t * t;
+    }
+};
+
+struct less
+{
+    template <typename T1, typename T2>
+    auto operator()(T1 const& t1, T2 const& t2) const -> decltype(t1 < t2)
+    {
+        return t1 < t2;
+    }
+};
+
+struct equal_to
+{
+    template <typename T1, typename T2>
+    auto operator()(T1 const& t1, T2 const& t2) const -> decltype(t1 == t2)
+    {
+        return t1 == t2;
+    }
+};
+
+template <typename T>
+struct is_negative
+{
+    template <typename U>
+    auto operator()(U const& u) const -> decltype(u < U(T(0)))
+    {
+        return u < U(T(0));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+struct benchmark_data
+{
+    explicit benchmark_data(std::size_t size, std::mt19937& gen)
+      : data1(size)
+      , data2(size)
+    {
+        std::uniform_int_distribution<> dis(0, 1000);
+        for (T& val : data1)
+            val = T(dis(gen));
+
+        // the searched for elements are located at the end of the data
+        data1.back() = T(-1);
+        data2 = data1;
+        data2.back() = T(-2);
+    }
+
+    std::vector<T> data1;
+    std::vector<T> data2;
+};
+
+// the data is passed by non-const reference as the datapar loops may store
+// the vector packs back to the underlying sequence
+template <typename ExPolicy, typename T>
+void run_algorithm(
+    std::string const& name, ExPolicy&& policy, benchmark_data<T>& d)
+{
+    auto first = std::begin(d.data1);
+    auto last = std::end(d.data1);
+
+    if (name == "reduce")
+    {
+        hpx::reduce(policy, first, last, T(0), ::plus());
+    }
+    else if (name == "transform_reduce")
+    {
+        hpx::transform_reduce(policy, first, last, T(0), ::plus(), ::square());
+    }
+    else if (name == "count_if")
+    {
+        hpx::count_if(policy, first, last, is_negative<T>());
+    }
+    else if (name == "find_if")
+    {
+        hpx::find_if(policy, first, last, is_negative<T>());
+    }
+    else if (name == "minmax_element")
+    {
+        hpx::parallel::minmax_element(policy, first, last, ::less());
+    }
+    else if (name == "equal")
+    {
+        hpx::equal(policy, first, last, std::begin(d.data2), ::equal_to());
+    }
+    else if (name == "mismatch")
+    {
+        hpx::mismatch(policy, first, last, std::begin(d.data2), ::equal_to());
+    }
+}
+
+template <typename ExPolicy, typename T>
+double measure_algorithm(std::string const& name, int count,
+    ExPolicy&& policy, benchmark_data<T>& d)
+{
+    std::int64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != count; ++i)
+        run_algorithm(name, policy, d);
+
+    return double(hpx::chrono::high_resolution_clock::now() - start) /
+        (1e9 * count);
+}
+
+template <typename T>
+void measure_algorithms(std::string const& type_name, std::size_t size,
+    int test_count, bool csvoutput, std::mt19937& gen)
+{
+    benchmark_data<T> d(size, gen);
+
+    char const* const algorithms[] = {"reduce", "transform_reduce",
+        "count_if", "find_if", "minmax_element", "equal", "mismatch"};
+
+    for (char const* name : algorithms)
+    {
+        // warm up caches
+        run_algorithm(name, hpx::execution::par, d);
+
+        // do measurements
+        double time_seq =
+            measure_algorithm(name, test_count, hpx::execution::seq, d);
+        double time_dataseq =
+            measure_algorithm(name, test_count, hpx::execution::dataseq, d);
+        double time_par =
+            measure_algorithm(name, test_count, hpx::execution::par, d);
+        double time_datapar =
+            measure_algorithm(name, test_count, hpx::execution::datapar, d);
+
+        if (csvoutput)
+        {
+            hpx::cout << name << "," << type_name << "," << time_seq << ","
+                      << time_dataseq << "," << time_par << ","
+                      << time_datapar << "\n"
+                      << hpx::flush;
+        }
+        else
+        {
+            hpx::cout << std::left << std::setw(17) << name << std::setw(8)
+                      << type_name << std::right << std::setw(13) << time_seq
+                      << std::setw(13) << time_dataseq << std::setw(13)
+                      << time_par << std::setw(13) << time_datapar << "\n"
+                      << hpx::flush;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    hpx::cout << "using seed: " << seed << std::endl;
+    std::mt19937 gen(seed);
+
+    std::size_t size = vm["vector_size"].as<std::size_t>();
+    bool csvoutput = vm["csv_output"].as<int>() ? true : false;
+    int test_count = vm["test_count"].as<int>();
+
+    if (test_count <= 0)
+    {
+        hpx::cout << "test_count cannot be less than zero...\n" << hpx::flush;
+    }
+    else
+    {
+        if (csvoutput)
+        {
+            hpx::cout << "algorithm,type,seq,dataseq,par,datapar\n"
+                      << hpx::flush;
+        }
+        else
+        {
+            hpx::cout << std::left << std::setw(17) << "algorithm"
+                      << std::setw(8) << "type" << std::right << std::setw(13)
+                      << "seq" << std::setw(13) << "dataseq" << std::setw(13)
+                      << "par" << std::setw(13) << "datapar"
+                      << "\n"
+                      << hpx::flush;
+        }
+
+        measure_algorithms<float>("float", size, test_count, csvoutput, gen);
+        measure_algorithms<double>("double", size, test_count, csvoutput, gen);
+        measure_algorithms<std::int32_t>(
+            "int32", size, test_count, csvoutput, gen);
+        measure_algorithms<std::int64_t>(
+            "int64", size, test_count, csvoutput, gen);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(1048576)
+        , "size of vector")
+
+        ("csv_output"
+        , hpx::program_options::value<int>()->default_value(0)
+        , "print results in csv format")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(10)
+        , "number of tests to take average from")
+
+        ("seed,s"
+        , hpx::program_options::value<unsigned int>()
+        , "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
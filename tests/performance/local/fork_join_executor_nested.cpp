@@ -0,0 +1,132 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the time it takes to execute nested parallel loops
+// (an outer loop over blocks and an inner loop over the elements of each
+// block) with iterations of heterogeneous cost using the fork_join_executor.
+// It is meant to be compared to openmp_nested_parallel_region.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "worker_timed.hpp"
+
+using executor_type = hpx::execution::experimental::fork_join_executor;
+
+///////////////////////////////////////////////////////////////////////////////
+// every 16th element is more expensive by the given factor
+std::uint64_t element_delay(
+    std::size_t element, std::uint64_t delay, std::uint64_t imbalance)
+{
+    return element % 16 == 0 ? delay * imbalance : delay;
+}
+
+executor_type::loop_schedule get_schedule(std::string const& schedule)
+{
+    if (schedule == "static")
+        return executor_type::loop_schedule::static_;
+    if (schedule == "dynamic")
+        return executor_type::loop_schedule::dynamic;
+    if (schedule == "guided")
+        return executor_type::loop_schedule::guided;
+
+    throw std::invalid_argument("invalid schedule: " + schedule);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const repetitions = vm["repetitions"].as<std::uint64_t>();
+    std::size_t const outer = vm["outer"].as<std::size_t>();
+    std::size_t const inner = vm["inner"].as<std::size_t>();
+    std::uint64_t const delay = vm["delay"].as<std::uint64_t>();
+    std::uint64_t const imbalance = vm["imbalance"].as<std::uint64_t>();
+    std::string const schedule = vm["schedule"].as<std::string>();
+    bool const nested = vm.count("no-nesting") == 0;
+
+    executor_type exec(hpx::threads::thread_priority::high,
+        hpx::threads::thread_stacksize::small_, get_schedule(schedule));
+
+    auto inner_loop = [&](std::size_t element) {
+        worker_timed(element_delay(element, delay, imbalance));
+    };
+
+    auto outer_loop = [&](std::size_t) {
+        if (nested)
+        {
+            hpx::parallel::execution::bulk_sync_execute(
+                exec, inner_loop, inner);
+        }
+        else
+        {
+            for (std::size_t i = 0; i != inner; ++i)
+                inner_loop(i);
+        }
+    };
+
+    // Do one warmup iteration
+    hpx::parallel::execution::bulk_sync_execute(exec, outer_loop, outer);
+
+    std::cout << "threads, schedule, outer, inner, nested, time [s]"
+              << std::endl;
+
+    hpx::chrono::high_resolution_timer timer;
+    for (std::uint64_t i = 0; i < repetitions; ++i)
+    {
+        timer.restart();
+
+        hpx::parallel::execution::bulk_sync_execute(exec, outer_loop, outer);
+
+        double const t = timer.elapsed();
+
+        std::cout << hpx::get_os_thread_count() << ", " << schedule << ", "
+                  << outer << ", " << inner << ", " << nested << ", " << t
+                  << std::endl;
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("repetitions", value<std::uint64_t>()->default_value(10),
+         "number of repetitions")
+        ("outer", value<std::size_t>()->default_value(4),
+         "number of iterations of the outer loop")
+        ("inner", value<std::size_t>()->default_value(10000),
+         "number of iterations of the inner loop")
+        ("delay", value<std::uint64_t>()->default_value(1000),
+         "time spent in each inner iteration [ns]")
+        ("imbalance", value<std::uint64_t>()->default_value(10),
+         "factor by which every 16th inner iteration is more expensive")
+        ("schedule", value<std::string>()->default_value("static"),
+         "loop schedule (static, dynamic, or guided)")
+        ("no-nesting", "execute the inner loop sequentially");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,122 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the time it takes to execute nested OpenMP parallel
+// loops (an outer loop over blocks and an inner loop over the elements of
+// each block) with iterations of heterogeneous cost. It is meant to be
+// compared to fork_join_executor_nested.
+
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "worker_timed.hpp"
+
+// every 16th element is more expensive by the given factor
+std::uint64_t element_delay(
+    std::size_t element, std::uint64_t delay, std::uint64_t imbalance)
+{
+    return element % 16 == 0 ? delay * imbalance : delay;
+}
+
+omp_sched_t get_schedule(std::string const& schedule)
+{
+    if (schedule == "static")
+        return omp_sched_static;
+    if (schedule == "dynamic")
+        return omp_sched_dynamic;
+    if (schedule == "guided")
+        return omp_sched_guided;
+
+    throw std::invalid_argument("invalid schedule: " + schedule);
+}
+
+int main(int argc, char** argv)
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline;
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("repetitions", value<std::uint64_t>()->default_value(10),
+         "number of repetitions")
+        ("outer", value<std::int64_t>()->default_value(4),
+         "number of iterations of the outer loop")
+        ("inner", value<std::int64_t>()->default_value(10000),
+         "number of iterations of the inner loop")
+        ("delay", value<std::uint64_t>()->default_value(1000),
+         "time spent in each inner iteration [ns]")
+        ("imbalance", value<std::uint64_t>()->default_value(10),
+         "factor by which every 16th inner iteration is more expensive")
+        ("schedule", value<std::string>()->default_value("static"),
+         "loop schedule (static, dynamic, or guided)")
+        ("no-nesting", "execute the inner loop sequentially");
+    // clang-format on
+
+    variables_map vm;
+    store(command_line_parser(argc, argv)
+              .allow_unregistered()
+              .options(desc_commandline)
+              .run(),
+        vm);
+
+    std::uint64_t const repetitions = vm["repetitions"].as<std::uint64_t>();
+    std::int64_t const outer = vm["outer"].as<std::int64_t>();
+    std::int64_t const inner = vm["inner"].as<std::int64_t>();
+    std::uint64_t const delay = vm["delay"].as<std::uint64_t>();
+    std::uint64_t const imbalance = vm["imbalance"].as<std::uint64_t>();
+    std::string const schedule = vm["schedule"].as<std::string>();
+    bool const nested = vm.count("no-nesting") == 0;
+
+    omp_set_schedule(get_schedule(schedule), 0);
+    omp_set_max_active_levels(nested ? 2 : 1);
+
+    std::size_t const threads = omp_get_max_threads();
+
+    auto outer_loop = [&]() {
+#pragma omp parallel for schedule(runtime)
+        for (std::int64_t i = 0; i < outer; ++i)
+        {
+            // the inner region uses the threads left over by the outer loop
+            int const inner_threads = static_cast<int>(
+                (std::max)(std::size_t(1), threads / std::size_t(outer)));
+#pragma omp parallel for schedule(runtime) num_threads(inner_threads)
+            for (std::int64_t j = 0; j < inner; ++j)
+            {
+                worker_timed(element_delay(j, delay, imbalance));
+            }
+        }
+    };
+
+    // Do one warmup iteration
+    outer_loop();
+
+    std::cout << "threads, schedule, outer, inner, nested, time [s]"
+              << std::endl;
+
+    hpx::chrono::high_resolution_timer timer;
+    for (std::uint64_t i = 0; i < repetitions; ++i)
+    {
+        timer.restart();
+
+        outer_loop();
+
+        double const t = timer.elapsed();
+
+        std::cout << threads << ", " << schedule << ", " << outer << ", "
+                  << inner << ", " << nested << ", " << t << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the time it takes to execute a data-parallel loop
+// using the bulk sender algorithm on the thread pool scheduler to the time it
+// takes using parallel_executor::bulk_async_execute and waiting for the
+// returned futures.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include "worker_timed.hpp"
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+double measure(std::uint64_t repetitions, F&& f)
+{
+    // Do one warmup iteration
+    f();
+
+    hpx::chrono::high_resolution_timer timer;
+    for (std::uint64_t i = 0; i < repetitions; ++i)
+    {
+        f();
+    }
+    return timer.elapsed() / repetitions;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const repetitions = vm["repetitions"].as<std::uint64_t>();
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+    std::uint64_t const delay = vm["delay"].as<std::uint64_t>();
+
+    auto f = [delay](std::size_t) { worker_timed(delay); };
+
+    double const t_sender = measure(repetitions, [&]() {
+        ex::schedule(ex::executor{}) | ex::bulk(iterations, f) |
+            ex::sync_wait();
+    });
+
+    double const t_executor = measure(repetitions, [&]() {
+        hpx::execution::parallel_executor exec;
+        hpx::wait_all(hpx::parallel::execution::bulk_async_execute(
+            exec, f, iterations));
+    });
+
+    std::cout << "threads, iterations, delay [ns], sender bulk [s], "
+                 "bulk_async_execute [s]"
+              << std::endl;
+    std::cout << hpx::get_os_thread_count() << ", " << iterations << ", "
+              << delay << ", " << t_sender << ", " << t_executor << std::endl;
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("repetitions", value<std::uint64_t>()->default_value(100),
+         "number of repetitions")
+        ("iterations", value<std::size_t>()->default_value(10000),
+         "number of iterations of the parallel loop")
+        ("delay", value<std::uint64_t>()->default_value(0),
+         "time spent in each iteration [ns]");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -6,17 +6,23 @@
 
 // This example benchmarks the time it takes to start and stop the HPX runtime.
 // This is meant to be compared to resume_suspend and openmp_parallel_region.
+// The time spent in the individual startup phases is reported as well.
 
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_start.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 
 #include <hpx/modules/program_options.hpp>
 
 #include <cstddef>
 #include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
 int hpx_main()
 {
@@ -54,6 +60,7 @@ int main(int argc, char ** argv)
 
     double start_time = 0;
     double stop_time  = 0;
+    std::map<std::string, double> phase_times;
     hpx::chrono::high_resolution_timer timer;
 
     for (std::size_t i = 0; i < repetitions; ++i)
@@ -67,6 +74,9 @@ int main(int argc, char ** argv)
         auto t_start = timer.elapsed();
         start_time += t_start;
 
+        std::vector<std::pair<std::string, double>> phases =
+            hpx::util::get_startup_phase_timings();
+
         for (std::size_t thread = 0; thread < threads; ++thread)
         {
             hpx::apply([](){});
@@ -84,8 +94,28 @@ int main(int argc, char ** argv)
             << t_apply << ", "
             << t_stop
             << std::endl;
+
+        // phases may be nested or run concurrently, they don't add up to
+        // the overall startup time
+        for (auto const& phase : phases)
+        {
+            std::cout << "    " << phase.first << " [s]: " << phase.second
+                      << std::endl;
+            phase_times[phase.first] += phase.second;
+        }
     }
     hpx::util::print_cdash_timing("StartTime", start_time);
     hpx::util::print_cdash_timing("StopTime",  stop_time);
+
+    for (auto const& phase : phase_times)
+    {
+        std::string name = "StartTime_" + phase.first;
+        for (char& c : name)
+        {
+            if (c == ' ')
+                c = '_';
+        }
+        hpx::util::print_cdash_timing(name.c_str(), phase.second);
+    }
 }
 
@@ -0,0 +1,153 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the cost and the accuracy of suspending many HPX
+// threads until a point in time using the per-worker timer wheels (as done by
+// hpx::this_thread::sleep_until) to arming an asio timer on the timer service
+// which resumes the suspended thread from its completion handler.
+
+#include <hpx/config/asio.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <asio/basic_waitable_timer.hpp>
+#include <asio/io_context.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <system_error>
+#include <vector>
+
+using clock_type = std::chrono::steady_clock;
+
+///////////////////////////////////////////////////////////////////////////////
+void sleep_until_wheel(clock_type::time_point abs_time)
+{
+    hpx::this_thread::sleep_until(abs_time);
+}
+
+void sleep_until_asio(clock_type::time_point abs_time)
+{
+    using deadline_timer = asio::basic_waitable_timer<clock_type>;
+
+    deadline_timer t(
+        *hpx::threads::detail::get_default_timer_service(), abs_time);
+
+    hpx::threads::thread_id_type id = hpx::threads::get_self_id();
+    t.async_wait([id](std::error_code const&) {
+        hpx::threads::set_thread_state(id,
+            hpx::threads::thread_schedule_state::pending,
+            hpx::threads::thread_restart_state::timeout,
+            hpx::threads::thread_priority::boost);
+    });
+
+    hpx::this_thread::suspend(
+        hpx::threads::thread_schedule_state::suspended, "sleep_until_asio");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct result
+{
+    double elapsed;     // [s]
+    double lateness;    // average [us]
+};
+
+template <typename F>
+result measure(std::uint64_t tasks, std::uint64_t max_delay, F sleep)
+{
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<std::uint64_t> dist(0, max_delay);
+
+    std::atomic<std::int64_t> lateness(0);
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(tasks);
+
+    hpx::chrono::high_resolution_timer timer;
+    for (std::uint64_t i = 0; i != tasks; ++i)
+    {
+        std::chrono::microseconds const delay(dist(gen));
+        futures.push_back(hpx::async([&lateness, delay, sleep]() {
+            auto const abs_time = clock_type::now() + delay;
+            sleep(abs_time);
+            lateness += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                clock_type::now() - abs_time)
+                            .count();
+        }));
+    }
+    hpx::wait_all(futures);
+
+    return result{timer.elapsed(), lateness.load() / (tasks * 1000.0)};
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const repetitions = vm["repetitions"].as<std::uint64_t>();
+    std::uint64_t const tasks = vm["tasks"].as<std::uint64_t>();
+    std::uint64_t const max_delay = vm["max-delay"].as<std::uint64_t>();
+
+    // Do one warmup iteration
+    measure(tasks, max_delay, &sleep_until_wheel);
+    measure(tasks, max_delay, &sleep_until_asio);
+
+    result wheel{0, 0};
+    result asio{0, 0};
+    for (std::uint64_t i = 0; i < repetitions; ++i)
+    {
+        result r = measure(tasks, max_delay, &sleep_until_wheel);
+        wheel.elapsed += r.elapsed;
+        wheel.lateness += r.lateness;
+
+        r = measure(tasks, max_delay, &sleep_until_asio);
+        asio.elapsed += r.elapsed;
+        asio.lateness += r.lateness;
+    }
+
+    std::cout << "threads, tasks, max delay [us], timer wheel [s], "
+                 "timer wheel lateness [us], asio [s], asio lateness [us]"
+              << std::endl;
+    std::cout << hpx::get_os_thread_count() << ", " << tasks << ", "
+              << max_delay << ", " << wheel.elapsed / repetitions << ", "
+              << wheel.lateness / repetitions << ", "
+              << asio.elapsed / repetitions << ", "
+              << asio.lateness / repetitions << std::endl;
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("repetitions", value<std::uint64_t>()->default_value(10),
+         "number of repetitions")
+        ("tasks", value<std::uint64_t>()->default_value(100000),
+         "number of threads suspended until a point in time")
+        ("max-delay", value<std::uint64_t>()->default_value(1000),
+         "maximal time a thread is suspended for [us]");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
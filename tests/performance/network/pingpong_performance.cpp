@@ -11,9 +11,12 @@
 #include <hpx/iostream.hpp>
 #include <hpx/include/async.hpp>
 #include <hpx/include/serialization.hpp>
+#include <hpx/modules/timing.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <complex>
+#include <iomanip>
 #include <string>
 #include <vector>
 
@@ -25,10 +28,17 @@ namespace pingpong
         {
             return std::complex<double>(13.3,-23.8);
         }
+
+        hpx::serialization::serialize_buffer<char> echo_buffer(
+            hpx::serialization::serialize_buffer<char> const& buffer)
+        {
+            return buffer;
+        }
     }
 }
 
 HPX_PLAIN_ACTION(pingpong::server::get_element, pingpong_get_element_action);
+HPX_PLAIN_ACTION(pingpong::server::echo_buffer, pingpong_echo_buffer_action);
 //HPX_ACTION_USES_MESSAGE_COALESCING(pingpong_get_element_action);
 
 
@@ -71,6 +81,37 @@ int hpx_main(hpx::program_options::variables_map& vm)
                       <<received[n-1]<< "\n" << hpx::flush;
         }
     ).get();
+
+    // measure the bandwidth achieved when bouncing large buffers
+    if (0 == hpx::get_locality_id())
+    {
+        typedef hpx::serialization::serialize_buffer<char> buffer_type;
+
+        std::size_t const min_size =
+            (std::max)(vm["min-size"].as<std::size_t>(), std::size_t(1));
+        std::size_t const max_size = vm["max-size"].as<std::size_t>();
+        std::size_t const nbuffers = vm["nbuffers"].as<std::size_t>();
+
+        std::vector<char> data(max_size, 'a');
+        pingpong_echo_buffer_action echo;
+
+        hpx::cout << "# Size    Bandwidth (MB/s)\n" << hpx::flush;
+        for (std::size_t size = min_size; size <= max_size; size *= 2)
+        {
+            buffer_type buffer(data.data(), size, buffer_type::reference);
+
+            hpx::chrono::high_resolution_timer t;
+            for (std::size_t i = 0; i != nbuffers; ++i)
+            {
+                echo(other_locality, buffer);
+            }
+            double elapsed = t.elapsed();
+
+            hpx::cout << std::left << std::setw(10) << size
+                      << (2 * size / 1e6 * nbuffers) / elapsed << "\n"
+                      << hpx::flush;
+        }
+    }
     return hpx::finalize();
 }
 
@@ -84,6 +125,16 @@ int main(int argc, char* argv[])
         ("nparcels,n",
          hpx::program_options::value<std::size_t>()->default_value(100),
          "the number of parcels to create")
+        ("nbuffers",
+         hpx::program_options::value<std::size_t>()->default_value(10),
+         "the number of round trips per buffer size used for measuring "
+         "the bandwidth")
+        ("min-size",
+         hpx::program_options::value<std::size_t>()->default_value(1 << 16),
+         "the minimal size of the buffers to bounce (default: 64 KiB)")
+        ("max-size",
+         hpx::program_options::value<std::size_t>()->default_value(1 << 26),
+         "the maximal size of the buffers to bounce (default: 64 MiB)")
         ;
     // Initialize and run HPX
     std::vector<std::string> cfg;
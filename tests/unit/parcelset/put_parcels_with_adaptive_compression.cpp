@@ -0,0 +1,177 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/plugins/binary_filter/adaptive_serialization_filter_registration.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const numparcels_default = 10;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t checksum(std::vector<char> const& data)
+{
+    std::uint64_t sum = 0;
+    for (char c : data)
+    {
+        sum = sum * 31 + static_cast<unsigned char>(c);
+    }
+    return sum;
+}
+
+HPX_PLAIN_ACTION(checksum, checksum_action);
+
+HPX_ACTION_USES_ADAPTIVE_COMPRESSION(checksum_action)
+
+///////////////////////////////////////////////////////////////////////////////
+// too small to be worth compressing
+std::vector<char> generate_small()
+{
+    return std::vector<char>(100, 'x');
+}
+
+// not compressible at all
+std::vector<char> generate_random()
+{
+    std::vector<char> data(65536);
+    for (char& c : data)
+    {
+        c = static_cast<char>(std::rand());
+    }
+    return data;
+}
+
+// compressible text
+std::vector<char> generate_text()
+{
+    std::string const words[] = {
+        "parcel ", "action ", "locality ", "future ", "component "};
+
+    std::vector<char> data;
+    data.reserve(65536);
+    while (data.size() < 65536)
+    {
+        std::string const& w = words[std::rand() % 5];
+        data.insert(data.end(), w.begin(), w.end());
+    }
+    return data;
+}
+
+void test_payload(hpx::id_type const& id, std::vector<char> const& data)
+{
+    std::vector<hpx::future<std::uint64_t>> results;
+    results.reserve(numparcels_default);
+
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        results.push_back(hpx::async(checksum_action(), id, data));
+    }
+
+    std::uint64_t const expected = checksum(data);
+    for (hpx::future<std::uint64_t>& f : results)
+    {
+        HPX_TEST_EQ(f.get(), expected);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_counter_value(char const* name)
+{
+    hpx::performance_counters::performance_counter c(name);
+    std::int64_t value = c.get_value<std::int64_t>(hpx::launch::sync);
+
+    hpx::cout << "counter: " << name << ", value: " << value << std::endl;
+    return value;
+}
+
+void verify_counters()
+{
+    std::int64_t const compressed = get_counter_value(
+        "/compression{locality#0/total}/adaptive/count/compressed");
+    std::int64_t const uncompressed = get_counter_value(
+        "/compression{locality#0/total}/adaptive/count/uncompressed");
+    std::int64_t const ratio =
+        get_counter_value("/compression{locality#0/total}/adaptive/ratio");
+
+    // the small and the random payloads are never compressed
+    HPX_TEST_LTE(std::int64_t(2 * numparcels_default), uncompressed);
+
+#if defined(HPX_HAVE_COMPRESSION_SNAPPY) ||                                    \
+    defined(HPX_HAVE_COMPRESSION_ZLIB) || defined(HPX_HAVE_COMPRESSION_BZIP2)
+    // the text was compressed by one of the available codecs
+    HPX_TEST_LT(std::int64_t(0), compressed);
+    HPX_TEST_LT(std::int64_t(0), ratio);
+    HPX_TEST_LT(ratio, std::int64_t(1000));
+#else
+    HPX_TEST_EQ(compressed, std::int64_t(0));
+    HPX_TEST_EQ(ratio, std::int64_t(0));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_payload(id, generate_small());
+        test_payload(id, generate_random());
+        test_payload(id, generate_text());
+    }
+
+    verify_counters();
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // Pretend a slow network to make compressing the text worthwhile
+    // regardless of the actual bandwidth of the parcelport.
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.compression.adaptive.bandwidth=10",
+        "hpx.parcel.compression.adaptive.measure_bandwidth=0"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
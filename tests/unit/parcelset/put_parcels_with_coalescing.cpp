@@ -16,6 +16,7 @@
 #include <hpx/modules/testing.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <utility>
@@ -237,6 +238,27 @@ void print_counters(char const* name)
     }
 }
 
+void print_histogram(hpx::performance_counters::performance_counter& c)
+{
+    using namespace hpx::performance_counters;
+
+    counter_values_array values = c.get_counter_values_array(
+        hpx::launch::sync, false);
+
+    // the first three values represent the histogram parameters
+    HPX_TEST_LT(std::size_t(3), values.values_.size());
+    HPX_TEST_EQ(values.values_[0], 0);
+    HPX_TEST_EQ(values.values_[1], 10);
+    HPX_TEST_EQ(values.values_[2], 10);
+
+    hpx::cout << "counter: " << c.get_name(hpx::launch::sync) << ", values:";
+    for (std::int64_t value : values.values_)
+    {
+        hpx::cout << " " << value;
+    }
+    hpx::cout << std::endl;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -247,6 +269,12 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::cout << "using seed: " << seed << std::endl;
     std::srand(seed);
 
+    // start collecting the number of parcels coalesced into one message
+    hpx::performance_counters::performance_counter parcels_per_message(
+        "/coalescing{locality#0/total}/count/parcels-per-message-histogram@"
+        "test1_action,0,10,10");
+    parcels_per_message.start(hpx::launch::sync);
+
     for (hpx::id_type const& id : hpx::find_remote_localities())
     {
         test_plain_argument(id);
@@ -259,6 +287,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
     print_counters("/coalescing{locality#0/total}/count/parcels@test2_action");
     print_counters("/coalescing{locality#0/total}/count/messages@test1_action");
     print_counters("/coalescing{locality#0/total}/count/messages@test2_action");
+    if (!hpx::find_remote_localities().empty())
+        print_histogram(parcels_per_message);
 
     return hpx::finalize();
 }
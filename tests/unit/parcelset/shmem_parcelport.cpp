@@ -0,0 +1,121 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test is run with rings of 4096 bytes and a segment threshold of 65536
+// bytes (see CMakeLists.txt). Messages larger than a ring are streamed
+// through it in pieces, which makes the senders wait for the receiver to
+// catch up, large zero-copy chunks are handed over through segments of
+// their own.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+double sum(buffer_type const& b)
+{
+    return std::accumulate(b.data(), b.data() + b.size(), 0.0);
+}
+HPX_PLAIN_ACTION(sum, sum_action);
+
+buffer_type echo(buffer_type const& b)
+{
+    return b;
+}
+HPX_PLAIN_ACTION(echo, echo_action);
+
+buffer_type make_buffer(std::size_t size)
+{
+    buffer_type b(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        b[i] = static_cast<double>(i % 1000);
+    }
+    return b;
+}
+
+std::int64_t shmem_parcels_sent()
+{
+    hpx::performance_counters::performance_counter sent("/parcels{locality#" +
+        std::to_string(hpx::get_locality_id()) + "/total}/count/shmem/sent");
+    return sent.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+std::vector<std::size_t> const sizes = {1, 16, 1000, 100000};
+std::size_t const num_messages = 100;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sizes(hpx::id_type const& id)
+{
+    for (std::size_t size : sizes)
+    {
+        buffer_type const b = make_buffer(size);
+        HPX_TEST_EQ(sum_action()(id, b), sum(b));
+
+        buffer_type const r = echo_action()(id, b);
+        HPX_TEST_EQ(r.size(), size);
+        HPX_TEST(std::equal(b.data(), b.data() + size, r.data()));
+    }
+}
+
+void test_concurrent(hpx::id_type const& id)
+{
+    // many messages to the same destination compete for its ring
+    std::vector<hpx::future<double>> results;
+    std::vector<double> expected;
+    results.reserve(num_messages);
+    expected.reserve(num_messages);
+    for (std::size_t i = 0; i != num_messages; ++i)
+    {
+        buffer_type const b = make_buffer(sizes[i % sizes.size()]);
+        results.push_back(hpx::async(sum_action(), id, b));
+        expected.push_back(sum(b));
+    }
+
+    for (std::size_t i = 0; i != num_messages; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    HPX_TEST_EQ(
+        hpx::get_config_entry("hpx.parcel.shmem.enable", "0"), std::string("1"));
+
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    HPX_TEST(!localities.empty());
+
+    std::int64_t const sent = shmem_parcels_sent();
+    for (hpx::id_type const& id : localities)
+    {
+        test_sizes(id);
+        test_concurrent(id);
+    }
+
+    // the localities run on the same host, all parcels went through the
+    // shared memory parcelport
+    std::size_t const num_parcels = 2 * sizes.size() + num_messages;
+    HPX_TEST_LTE(sent + std::int64_t(localities.size() * num_parcels),
+        shmem_parcels_sent());
+
+    return hpx::util::report_errors();
+}
+#endif